@@ -0,0 +1,78 @@
+// Copyright (c) 2024, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+import 'package:benchmark_harness/benchmark_harness.dart';
+
+// Micro-benchmark for throwing and catching exceptions.
+//
+// Measures the latency from a throw to the matching catch at different
+// stack depths, for exceptions that do not carry a stack trace, for Errors
+// (which capture one when thrown) and for handlers that ask for it.
+
+const int N = 1000;
+
+class ParseFailure implements Exception {
+  const ParseFailure();
+}
+
+class ParseError extends Error {}
+
+@pragma('vm:never-inline')
+@pragma('wasm:never-inline')
+@pragma('dart2js:never-inline')
+int recurse(int depth, Object Function() exception) {
+  if (depth == 0) throw exception();
+  return recurse(depth - 1, exception) + 1;
+}
+
+class ThrowCatch extends BenchmarkBase {
+  final int depth;
+  final Object Function() exception;
+  final bool captureStackTrace;
+  StackTrace? lastStackTrace;
+
+  ThrowCatch(String name, this.depth, this.exception,
+      {this.captureStackTrace = false})
+      : super('ExceptionThrowCatch.$name.Depth$depth');
+
+  @override
+  void run() {
+    int caught = 0;
+    for (int i = 0; i < N; ++i) {
+      if (captureStackTrace) {
+        try {
+          recurse(depth, exception);
+        } catch (e, st) {
+          lastStackTrace = st;
+          caught++;
+        }
+      } else {
+        try {
+          recurse(depth, exception);
+        } catch (e) {
+          caught++;
+        }
+      }
+    }
+    if (caught != N) throw 'Bad result: $caught';
+  }
+}
+
+void main() {
+  final benchmarks = [
+    for (final depth in [1, 10, 100]) ...[
+      ThrowCatch('Exception', depth, () => const ParseFailure()),
+      ThrowCatch('Error', depth, () => ParseError()),
+      ThrowCatch('StackTrace', depth, () => const ParseFailure(),
+          captureStackTrace: true),
+    ],
+  ];
+
+  for (final benchmark in benchmarks) {
+    benchmark.warmup();
+  }
+  for (final benchmark in benchmarks) {
+    benchmark.report();
+  }
+}
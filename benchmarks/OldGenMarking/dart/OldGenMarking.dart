@@ -0,0 +1,63 @@
+// Copyright (c) 2024, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+// Measures allocation throughput with a large, pointer-heavy live heap, so
+// that the time is dominated by old generation marking.
+
+import 'package:benchmark_harness/benchmark_harness.dart';
+
+class Node {
+  Node? left;
+  Node? right;
+  final List<Object?> slots;
+  Node(this.left, this.right, this.slots);
+}
+
+Node? buildTree(int depth) {
+  if (depth == 0) return null;
+  return Node(buildTree(depth - 1), buildTree(depth - 1),
+      List<Object?>.filled(4, null));
+}
+
+class OldGenMarking extends BenchmarkBase {
+  OldGenMarking() : super('OldGenMarking');
+
+  // Live data that every major GC has to mark.
+  late Node? tree;
+  late List<Map<int, Object>> maps;
+
+  // Short-lived but promoted objects, which keep the old generation growing
+  // and so trigger major GCs.
+  final List<Object?> window = List<Object?>.filled(1 << 12, null);
+  int cursor = 0;
+
+  @override
+  void setup() {
+    tree = buildTree(18);
+    maps = List<Map<int, Object>>.generate(1 << 10, (int i) {
+      final map = <int, Object>{};
+      for (int j = 0; j < 64; j++) {
+        map[j] = List<int>.filled(2, j);
+      }
+      return map;
+    });
+  }
+
+  @override
+  void run() {
+    for (int i = 0; i < 1 << 14; i++) {
+      window[cursor] = List<Object?>.filled(16, tree);
+      cursor = (cursor + 1) & (window.length - 1);
+    }
+  }
+
+  @override
+  void teardown() {
+    tree = null;
+  }
+}
+
+void main() {
+  OldGenMarking().report();
+}
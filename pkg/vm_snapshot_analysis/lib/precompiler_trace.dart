@@ -85,6 +85,20 @@ class CallGraphNode {
     }
   }
 
+  /// Returns the sum of [sizeOf] over this node and all nodes it dominates,
+  /// i.e. the size which would be removed from the program along with this
+  /// node.
+  ///
+  /// Requires [CallGraph.computeDominators] to be called first.
+  int retainedSize(int Function(CallGraphNode n) sizeOf) {
+    var total = 0;
+    visitDominatorTree((n, depth) {
+      total += sizeOf(n);
+      return true;
+    });
+    return total;
+  }
+
   @override
   String toString() {
     return 'CallGraphNode(${data is ProgramInfoNode ? data.qualifiedName : data})';
@@ -30,6 +30,7 @@ Explain why certain methods were pulled into the binary.
 
   ExplainCommand() {
     addSubcommand(ExplainDynamicCallsCommand());
+    addSubcommand(ExplainRootsCommand());
   }
 }
 
@@ -73,36 +74,11 @@ precompiler trace (an output of --trace-precompiler-to flag).
     final programInfo = loadProgramInfoFromJson(sizesJsonRaw);
 
     final histogram = Histogram.fromIterable<CallGraphNode>(
-        callGraph.dynamicCalls, sizeOf: (dynamicCall) {
-      // Compute approximate retained size by traversing the dominator tree
-      // and consulting snapshot profile.
-      var totalSize = 0;
-      dynamicCall.visitDominatorTree((retained, depth) {
-        if (retained.isFunctionNode) {
-          // Note that call graph keeps private library keys intact in the
-          // names (because we need to distinguish dynamic invocations
-          // through with the same private name in different libraries).
-          // So we need to scrub the path before we lookup information in the
-          // profile.
-          final path = (retained.data as ProgramInfoNode)
-              .path
-              .map((n) => Name(n).scrubbed)
-              .toList();
-          if (path.last.startsWith('[tear-off] ')) {
-            // Tear-off forwarder is placed into the function that is torn so
-            // we need to slightly tweak the path to be able to find it.
-            path.insert(
-                path.length - 1, path.last.replaceAll('[tear-off] ', ''));
-          }
-          final retainedSize = programInfo.lookup(path);
-          totalSize += (retainedSize?.totalSize ?? 0);
-        }
-        return true;
-      });
-      return totalSize;
-    }, bucketFor: (n) {
-      return (n.data as String).replaceAll('dyn:', '');
-    }, bucketInfo: BucketInfo(nameComponents: ['Selector']));
+        callGraph.dynamicCalls,
+        sizeOf: (dynamicCall) => dynamicCall
+            .retainedSize((n) => _sizeInProfile(programInfo, n)),
+        bucketFor: (n) => (n.data as String).replaceAll('dyn:', ''),
+        bucketInfo: BucketInfo(nameComponents: ['Selector']));
 
     printHistogram(programInfo, histogram,
         prefix: histogram.bySize.where((key) => histogram.buckets[key]! > 0));
@@ -129,3 +105,111 @@ precompiler trace (an output of --trace-precompiler-to flag).
   String get invocation =>
       super.invocation.replaceAll('[arguments]', '<sizes.json> <trace.json>');
 }
+
+/// Generates a report about the nodes which are immediately dominated by the
+/// root of the call graph (entry points, `vm:entry-point` annotated members
+/// and the calls which are only reachable from them) sorted by approximation
+/// of their retained size.
+class ExplainRootsCommand extends Command<void> {
+  @override
+  final name = 'roots';
+
+  @override
+  final description = '''
+This command explains which roots of the program keep the most code alive.
+
+Every node of the call graph which is reachable from more than one root is
+attributed to the program root itself, so the report lists only the code
+which would be removed from the binary along with the given root.
+
+It needs AOT snapshot size profile (an output of either
+--write-v8-snapshot-profile-to or --print-instructions-sizes-to flags) and
+precompiler trace (an output of --trace-precompiler-to flag).
+''';
+
+  ExplainRootsCommand() {
+    argParser.addOption('max',
+        abbr: 'n',
+        help: 'Only print the given number of the largest roots.',
+        defaultsTo: '30');
+  }
+
+  @override
+  Future<void> run() async {
+    final args = argResults!;
+    if (args.rest.length != 2) {
+      usageException('Need to provide a size profile and a trace.');
+    }
+    final maxRoots = int.tryParse(args['max']);
+    if (maxRoots == null) {
+      usageException('Expected integer value for --max');
+    }
+
+    final sizesJson = File(args.rest[0]);
+    if (!sizesJson.existsSync()) {
+      usageException('Size profile ${sizesJson.path} does not exist!');
+    }
+    final sizesJsonRaw = await loadJsonFromFile(sizesJson);
+
+    final traceJson = File(args.rest[1]);
+    if (!traceJson.existsSync()) {
+      usageException('Precompiler trace ${traceJson.path} does not exist!');
+    }
+    final traceJsonRaw = await loadJsonFromFile(traceJson);
+
+    final callGraph = loadTrace(traceJsonRaw);
+    callGraph.computeDominators();
+
+    final programInfo = loadProgramInfoFromJson(sizesJsonRaw);
+
+    final histogram = Histogram.fromIterable<CallGraphNode>(
+        callGraph.root.dominated,
+        sizeOf: (root) =>
+            root.retainedSize((n) => _sizeInProfile(programInfo, n)),
+        bucketFor: _describeNode,
+        bucketInfo: BucketInfo(nameComponents: ['Root']));
+
+    printHistogram(programInfo, histogram,
+        prefix: histogram.bySize
+            .where((key) => histogram.buckets[key]! > 0)
+            .take(maxRoots));
+  }
+
+  @override
+  String get invocation =>
+      super.invocation.replaceAll('[arguments]', '<sizes.json> <trace.json>');
+}
+
+/// Returns a human readable description of the given call graph node.
+String _describeNode(CallGraphNode n) {
+  final data = n.data;
+  if (data is ProgramInfoNode) {
+    return data.qualifiedName;
+  } else if (data is String) {
+    return 'dynamic call ${data.replaceAll('dyn:', '')}';
+  } else {
+    return 'dispatch table call #$data';
+  }
+}
+
+/// Returns the size attributed to the given call graph node in the snapshot
+/// profile [programInfo]. Only function nodes have a size.
+int _sizeInProfile(ProgramInfo programInfo, CallGraphNode node) {
+  if (!node.isFunctionNode) {
+    return 0;
+  }
+
+  // Note that call graph keeps private library keys intact in the
+  // names (because we need to distinguish dynamic invocations
+  // through with the same private name in different libraries).
+  // So we need to scrub the path before we lookup information in the
+  // profile.
+  final path =
+      (node.data as ProgramInfoNode).path.map((n) => Name(n).scrubbed).toList();
+  if (path.last.startsWith('[tear-off] ')) {
+    // Tear-off forwarder is placed into the function that is torn so
+    // we need to slightly tweak the path to be able to find it.
+    path.insert(path.length - 1, path.last.replaceAll('[tear-off] ', ''));
+  }
+  return programInfo.lookup(path)?.totalSize ?? 0;
+}
@@ -100,6 +100,31 @@ void main() async {
       });
     });
 
+    test('retained-size', () async {
+      await withFlag(testSource, '--trace_precompiler_to', (json) async {
+        final jsonRaw = await loadJson(File(json));
+        final callGraph = loadTrace(jsonRaw);
+        callGraph.computeDominators();
+
+        int countFunctions(CallGraphNode n) => n.isFunctionNode ? 1 : 0;
+
+        final main = callGraph.program
+            .lookup(['package:input', 'package:input/input.dart', '', 'main'])!;
+        final mainNode = callGraph.lookup(main);
+        expect(callGraph.root.retainedSize(countFunctions),
+            greaterThan(mainNode.retainedSize(countFunctions)));
+        final mainDominatedFunctions =
+            mainNode.dominated.where((n) => n.isFunctionNode).length;
+        expect(mainNode.retainedSize(countFunctions),
+            greaterThan(mainDominatedFunctions));
+
+        final getTearOffCall = callGraph.dynamicCalls
+            .firstWhere((n) => n.data == 'dyn:get:tornOff');
+        expect(getTearOffCall.retainedSize(countFunctions),
+            greaterThanOrEqualTo(2));
+      });
+    });
+
     test('collapse-by-package', () async {
       await withFlag(testSource, '--trace_precompiler_to', (json) async {
         final jsonRaw = await loadJson(File(json));
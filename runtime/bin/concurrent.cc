@@ -28,28 +28,37 @@ void FUNCTION_NAME(Mutex_Initialize)(Dart_NativeArguments args) {
   Dart_NewFinalizableHandle(mutex_obj, mutex, sizeof(Mutex), DeleteMutex);
 }
 
-void FUNCTION_NAME(Mutex_Lock)(Dart_NativeArguments args) {
-  Dart_Handle mutex_obj = Dart_GetNativeArgument(args, 0);
-  Mutex* mutex;
-  Dart_Handle result = Dart_GetNativeInstanceField(
-      mutex_obj, kMutexNativeField, reinterpret_cast<intptr_t*>(&mutex));
+// Number of times Mutex_Lock retries an uncontended acquire before it blocks
+// in the kernel. Critical sections guarded by Dart mutexes tend to be short,
+// so spinning briefly avoids the futex wait and wake-up on most contention.
+static constexpr intptr_t kMutexLockSpinCount = 100;
+
+// Reads the single native field of the argument at [index]. Unlike
+// Dart_GetNativeArgument followed by Dart_GetNativeInstanceField, this does
+// not allocate a handle or transition into the VM on the fast path.
+template <typename T>
+static T* GetNativeFieldOfArgument(Dart_NativeArguments args, int index) {
+  intptr_t field = 0;
+  Dart_Handle result = Dart_GetNativeFieldsOfArgument(args, index, 1, &field);
   if (Dart_IsError(result)) {
     Dart_PropagateError(result);
   }
+  return reinterpret_cast<T*>(field);
+}
+
+void FUNCTION_NAME(Mutex_Lock)(Dart_NativeArguments args) {
+  Mutex* mutex = GetNativeFieldOfArgument<Mutex>(args, 0);
+  for (intptr_t i = 0; i < kMutexLockSpinCount; i++) {
+    if (mutex->TryLock()) {
+      return;
+    }
+  }
   mutex->Lock();
-  Dart_SetReturnValue(args, Dart_Null());
 }
 
 void FUNCTION_NAME(Mutex_Unlock)(Dart_NativeArguments args) {
-  Dart_Handle mutex_obj = Dart_GetNativeArgument(args, 0);
-  Mutex* mutex;
-  Dart_Handle result = Dart_GetNativeInstanceField(
-      mutex_obj, kMutexNativeField, reinterpret_cast<intptr_t*>(&mutex));
-  if (Dart_IsError(result)) {
-    Dart_PropagateError(result);
-  }
+  Mutex* mutex = GetNativeFieldOfArgument<Mutex>(args, 0);
   mutex->Unlock();
-  Dart_SetReturnValue(args, Dart_Null());
 }
 
 static void DeleteConditionVariable(void* isolate_data, void* condvar_pointer) {
@@ -70,34 +79,16 @@ void FUNCTION_NAME(ConditionVariable_Initialize)(Dart_NativeArguments args) {
 }
 
 void FUNCTION_NAME(ConditionVariable_Wait)(Dart_NativeArguments args) {
-  Dart_Handle condvar_obj = Dart_GetNativeArgument(args, 0);
-  Dart_Handle mutex_obj = Dart_GetNativeArgument(args, 1);
-  Mutex* mutex;
-  Dart_Handle result_mutex = Dart_GetNativeInstanceField(
-      mutex_obj, kCondVarNativeField, reinterpret_cast<intptr_t*>(&mutex));
-  if (Dart_IsError(result_mutex)) {
-    Dart_PropagateError(result_mutex);
-  }
-  ConditionVariable* condvar;
-  Dart_Handle result_condvar = Dart_GetNativeInstanceField(
-      condvar_obj, kCondVarNativeField, reinterpret_cast<intptr_t*>(&condvar));
-  if (Dart_IsError(result_condvar)) {
-    Dart_PropagateError(result_condvar);
-  }
+  ConditionVariable* condvar =
+      GetNativeFieldOfArgument<ConditionVariable>(args, 0);
+  Mutex* mutex = GetNativeFieldOfArgument<Mutex>(args, 1);
   condvar->Wait(mutex);
-  Dart_SetReturnValue(args, Dart_Null());
 }
 
 void FUNCTION_NAME(ConditionVariable_Notify)(Dart_NativeArguments args) {
-  Dart_Handle condvar_obj = Dart_GetNativeArgument(args, 0);
-  ConditionVariable* condvar;
-  Dart_Handle result_condvar = Dart_GetNativeInstanceField(
-      condvar_obj, kCondVarNativeField, reinterpret_cast<intptr_t*>(&condvar));
-  if (Dart_IsError(result_condvar)) {
-    Dart_PropagateError(result_condvar);
-  }
+  ConditionVariable* condvar =
+      GetNativeFieldOfArgument<ConditionVariable>(args, 0);
   condvar->Notify();
-  Dart_SetReturnValue(args, Dart_Null());
 }
 
 }  // namespace bin
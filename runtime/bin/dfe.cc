@@ -66,7 +66,7 @@ DFE::DFE()
     : use_dfe_(false),
       use_incremental_compiler_(false),
       frontend_filename_(nullptr),
-      application_kernel_buffer_(nullptr),
+      application_kernel_buffer_(),
       application_kernel_buffer_size_(0),
       kernel_blobs_(&SimpleHashMap::SameStringValue, 4),
       kernel_blobs_lock_() {}
@@ -77,7 +77,6 @@ DFE::~DFE() {
   }
   frontend_filename_ = nullptr;
 
-  free(application_kernel_buffer_);
   application_kernel_buffer_ = nullptr;
   application_kernel_buffer_size_ = 0;
 
@@ -306,6 +305,38 @@ static bool TryReadFile(const char* script_uri,
   return *buffer != nullptr;
 }
 
+// Maps [script_uri] into memory if it is a kernel file. Returns a shared
+// pointer which removes the mapping when the last reference to the kernel is
+// dropped, or an empty pointer if the file is not a kernel file or could not
+// be mapped.
+static std::shared_ptr<uint8_t> TryMapKernelFile(const char* script_uri,
+                                                 intptr_t* size,
+                                                 bool decode_uri) {
+  File* file = decode_uri ? File::OpenUri(nullptr, script_uri, File::kRead)
+                          : File::Open(nullptr, script_uri, File::kRead);
+  if (file == nullptr) {
+    return nullptr;
+  }
+  RefCntReleaseScope<File> rs(file);
+  const int64_t length = file->Length();
+  if ((length <= 0) || (length > kIntptrMax)) {
+    return nullptr;
+  }
+  MappedMemory* mapping = file->Map(File::kReadOnly, 0, length);
+  if (mapping == nullptr) {
+    return nullptr;
+  }
+  uint8_t* buffer = reinterpret_cast<uint8_t*>(mapping->address());
+  if (DartUtils::SniffForMagicNumber(buffer, length) !=
+      DartUtils::kKernelMagicNumber) {
+    delete mapping;
+    return nullptr;
+  }
+  *size = static_cast<intptr_t>(length);
+  return std::shared_ptr<uint8_t>(buffer,
+                                  [mapping](uint8_t*) { delete mapping; });
+}
+
 class KernelIRNode {
  public:
   KernelIRNode(uint8_t* kernel_ir, intptr_t kernel_size)
@@ -452,6 +483,18 @@ bool DFE::TryReadKernelFile(const char* script_uri,
       return true;
     }
   }
+  if (kernel_blob_ptr != nullptr &&
+      (app_snapshot == nullptr || app_snapshot->IsKernel())) {
+    // Kernel files are mapped rather than read when the caller can take
+    // shared ownership of the buffer.
+    *kernel_blob_ptr =
+        TryMapKernelFile(script_uri, kernel_ir_size, decode_uri);
+    if (*kernel_blob_ptr) {
+      *kernel_ir = kernel_blob_ptr->get();
+      return true;
+    }
+    *kernel_ir_size = -1;
+  }
   if (app_snapshot == nullptr || app_snapshot->IsKernel() ||
       app_snapshot->IsKernelList()) {
     uint8_t* buffer;
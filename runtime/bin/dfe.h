@@ -57,12 +57,13 @@ class DFE {
 
   // Set the kernel program for the main application if it was specified
   // as a dill file.
-  void set_application_kernel_buffer(uint8_t* buffer, intptr_t size) {
-    application_kernel_buffer_ = buffer;
+  void set_application_kernel_buffer(std::shared_ptr<uint8_t> buffer,
+                                     intptr_t size) {
+    application_kernel_buffer_ = std::move(buffer);
     application_kernel_buffer_size_ = size;
   }
   void application_kernel_buffer(const uint8_t** buffer, intptr_t* size) const {
-    *buffer = application_kernel_buffer_;
+    *buffer = application_kernel_buffer_.get();
     *size = application_kernel_buffer_size_;
   }
 
@@ -98,8 +99,9 @@ class DFE {
   // valid kernel file, sets 'kernel_buffer' to nullptr otherwise.
   //
   // If 'kernel_blob_ptr' is not nullptr, then this function can also
-  // read kernel blobs. In such case it sets 'kernel_blob_ptr'
-  // to a shared pointer which owns the kernel buffer.
+  // read kernel blobs and maps kernel files into memory instead of reading
+  // them. In such case it sets 'kernel_blob_ptr' to a shared pointer which
+  // owns the kernel buffer.
   // Otherwise, the caller is responsible for free()ing 'kernel_buffer'.
   void ReadScript(const char* script_uri,
                   const AppSnapshot* app_snapshot,
@@ -115,8 +117,9 @@ class DFE {
   // to be the kernel IR contents.
   //
   // If 'kernel_blob_ptr' is not nullptr, then this function can also
-  // read kernel blobs. In such case it sets 'kernel_blob_ptr'
-  // to a shared pointer which owns the kernel buffer.
+  // read kernel blobs and maps kernel files into memory instead of reading
+  // them. In such case it sets 'kernel_blob_ptr' to a shared pointer which
+  // owns the kernel buffer.
   // Otherwise, the caller is responsible for free()ing 'kernel_buffer'
   // if `true` was returned.
   bool TryReadKernelFile(const char* script_uri,
@@ -161,7 +164,7 @@ class DFE {
       Dart_KernelCompilationVerbosityLevel_All;
 
   // Kernel binary specified on the cmd line.
-  uint8_t* application_kernel_buffer_;
+  std::shared_ptr<uint8_t> application_kernel_buffer_;
   intptr_t application_kernel_buffer_size_;
 
   // Registry of kernel blobs. Maps URI (char *) to KernelBlob.
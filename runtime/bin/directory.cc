@@ -328,7 +328,9 @@ CObject* Directory::ListNextRequest(const CObjectArray& request) {
   if (dir_listing->IsEmpty()) {
     return new CObjectArray(CObject::NewArray(0));
   }
-  const int kArraySize = 128;
+  // Each reply carries up to kArraySize / 2 entries (a type and a path per
+  // entry); larger chunks mean fewer round trips for big trees.
+  const int kArraySize = 1024;
   CObjectArray* response = new CObjectArray(CObject::NewArray(kArraySize));
   dir_listing->SetArray(response, kArraySize);
   Directory::List(dir_listing);
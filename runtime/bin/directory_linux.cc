@@ -148,13 +148,12 @@ ListType DirectoryListingEntry::Next(DirectoryListing* listing) {
         // On some file systems the entry type is not determined by
         // readdir. For those and for links we use stat to determine
         // the actual entry type. Notice that stat returns the type of
-        // the file pointed to.
-        NamespaceScope ns(listing->namespc(),
-                          listing->path_buffer().AsString());
+        // the file pointed to. The entry is looked up relative to the open
+        // directory so the kernel does not walk the full path again.
         struct stat64 entry_info;
         int stat_success;
-        stat_success = TEMP_FAILURE_RETRY(
-            fstatat64(ns.fd(), ns.path(), &entry_info, AT_SYMLINK_NOFOLLOW));
+        stat_success = TEMP_FAILURE_RETRY(fstatat64(
+            fd_, entry->d_name, &entry_info, AT_SYMLINK_NOFOLLOW));
         if (stat_success == -1) {
           return kListError;
         }
@@ -170,8 +169,8 @@ ListType DirectoryListingEntry::Next(DirectoryListing* listing) {
             }
             previous = previous->next;
           }
-          stat_success =
-              TEMP_FAILURE_RETRY(fstatat64(ns.fd(), ns.path(), &entry_info, 0));
+          stat_success = TEMP_FAILURE_RETRY(
+              fstatat64(fd_, entry->d_name, &entry_info, 0));
           if (stat_success == -1 || (S_IFMT & entry_info.st_mode) == 0) {
             // Report a broken link as a link, even if follow_links is true.
             // A symbolic link can potentially point to an anon_inode. For
@@ -15,6 +15,7 @@
 #include "bin/file.h"
 #include "bin/virtual_memory.h"
 #include "platform/elf.h"
+#include "platform/lz4.h"
 
 #include "platform/unwinding_records.h"
 
@@ -196,6 +197,10 @@ class LoadedElf {
 
   const char* error() { return error_; }
 
+  /// Whether some of the contents of the loaded ELF are not backed by the
+  /// file, like decompressed sections.
+  bool has_anonymous_data() const { return has_anonymous_data_; }
+
  private:
   bool ReadHeader();
   bool ReadProgramTable();
@@ -203,6 +208,7 @@ class LoadedElf {
   bool ReadSectionTable();
   bool ReadSectionStringTable();
   bool ReadSections();
+  bool DecompressSection(const dart::elf::SectionHeader& header);
 
   static uword PageSize() { return VirtualMemory::PageSize(); }
 
@@ -240,6 +246,7 @@ class LoadedElf {
   const char* dynamic_string_table_ = nullptr;
   const dart::elf::Symbol* dynamic_symbol_table_ = nullptr;
   uword dynamic_symbol_count_ = 0;
+  bool has_anonymous_data_ = false;
 
 #if defined(DART_HOST_OS_WINDOWS) &&                                           \
     (defined(HOST_ARCH_X64) || defined(HOST_ARCH_ARM64))
@@ -426,7 +433,10 @@ bool LoadedElf::LoadSegments() {
     void* const memory_start =
         static_cast<char*>(base_->address()) + memory_offset - adjustment;
     const uword file_start = elf_data_offset_ + file_offset - adjustment;
-    const uword length = header.memory_size + adjustment;
+    // Memory past the file contents of the segment (e.g., compressed sections)
+    // is left in the anonymous reservation.
+    const uword length = header.file_size + adjustment;
+    if (header.file_size == 0) continue;
 
     File::MapType map_type = File::kReadOnly;
     if (header.flags == (dart::elf::PF_R | dart::elf::PF_W)) {
@@ -494,6 +504,9 @@ bool LoadedElf::ReadSections() {
       dynamic_symbol_table_ = reinterpret_cast<const dart::elf::Symbol*>(
           base_->start() + header.memory_offset);
       dynamic_symbol_count_ = header.file_size / sizeof(dart::elf::Symbol);
+    } else if (strncmp(name, dart::elf::kCompressedSectionPrefix,
+                       strlen(dart::elf::kCompressedSectionPrefix)) == 0) {
+      CHECK(DecompressSection(header));
     }
   }
 
@@ -502,6 +515,65 @@ bool LoadedElf::ReadSections() {
   return true;
 }
 
+bool LoadedElf::DecompressSection(const dart::elf::SectionHeader& header) {
+  CHECK_ERROR(header.link < header_.num_section_headers,
+              "Invalid compressed section.");
+  const dart::elf::SectionHeader target = section_table_[header.link];
+  CHECK_ERROR(target.type == dart::elf::SectionHeaderType::SHT_NOBITS &&
+                  target.memory_offset != 0 &&
+                  Utils::IsAligned(target.memory_offset, PageSize()),
+              "Invalid target of compressed section.");
+  CHECK_ERROR(header.file_size >= sizeof(dart::elf::CompressedSectionHeader),
+              "Invalid compressed section.");
+
+  const void* contents = nullptr;
+  std::unique_ptr<MappedMemory> mapping(
+      MapFilePiece(header.file_offset, header.file_size, &contents));
+  CHECK_ERROR(mapping != nullptr, "Could not mmap compressed section.");
+  const auto* const compressed =
+      reinterpret_cast<const dart::elf::CompressedSectionHeader*>(contents);
+  const uint64_t size = compressed->size;
+  const uint64_t frame_size = compressed->frame_size;
+  const uint64_t num_frames = compressed->num_frames;
+  CHECK_ERROR(frame_size != 0 &&
+                  num_frames == Utils::RoundUp(size, frame_size) / frame_size,
+              "Invalid compressed section.");
+  const uint64_t offsets_size = (num_frames + 1) * sizeof(uint32_t);
+  CHECK_ERROR(offsets_size <= header.file_size -
+                                  sizeof(dart::elf::CompressedSectionHeader),
+              "Invalid compressed section.");
+  const uint8_t* const offsets_start =
+      reinterpret_cast<const uint8_t*>(compressed + 1);
+  const uint8_t* const frames = offsets_start + offsets_size;
+  const uint64_t frames_size = header.file_size -
+                               sizeof(dart::elf::CompressedSectionHeader) -
+                               offsets_size;
+
+  // The target section is at the end of a segment and is not mapped from the
+  // file, so it resides in the anonymous reservation.
+  CHECK_ERROR(
+      target.memory_offset + size <= static_cast<uword>(base_->size()),
+      "Invalid target of compressed section.");
+  uint8_t* const target_start =
+      reinterpret_cast<uint8_t*>(base_->start() + target.memory_offset);
+  for (uint64_t i = 0; i < num_frames; i++) {
+    uint32_t start, end;
+    memcpy(&start, offsets_start + i * sizeof(uint32_t), sizeof(start));
+    memcpy(&end, offsets_start + (i + 1) * sizeof(uint32_t), sizeof(end));
+    CHECK_ERROR(start <= end && end <= frames_size,
+                "Invalid compressed section.");
+    const uint64_t frame_start = i * frame_size;
+    const uint64_t length = Utils::Minimum(frame_size, size - frame_start);
+    CHECK_ERROR(dart::Lz4::Decompress(frames + start, end - start,
+                                      target_start + frame_start, length),
+                "Could not decompress section.");
+  }
+  VirtualMemory::Protect(target_start, Utils::RoundUp(size, PageSize()),
+                         VirtualMemory::kReadOnly);
+  has_anonymous_data_ = true;
+  return true;
+}
+
 bool LoadedElf::ResolveSymbols(const uint8_t** vm_data,
                                const uint8_t** vm_instrs,
                                const uint8_t** isolate_data,
@@ -510,8 +582,18 @@ bool LoadedElf::ResolveSymbols(const uint8_t** vm_data,
     return false;
   }
 
+  // Stop scanning once all the requested symbols have been found.
+  intptr_t remaining = 0;
+  for (const uint8_t** output : {vm_data, vm_instrs, isolate_data,
+                                 isolate_instrs}) {
+    if (output != nullptr) {
+      *output = nullptr;
+      remaining++;
+    }
+  }
+
   // The first entry of the symbol table is reserved.
-  for (uword i = 1; i < dynamic_symbol_count_; ++i) {
+  for (uword i = 1; i < dynamic_symbol_count_ && remaining > 0; ++i) {
     const dart::elf::Symbol sym = dynamic_symbol_table_[i];
     const char* name = dynamic_string_table_ + sym.name;
     const uint8_t** output = nullptr;
@@ -527,6 +609,7 @@ bool LoadedElf::ResolveSymbols(const uint8_t** vm_data,
     }
 
     if (output != nullptr) {
+      if (*output == nullptr) remaining--;
       *output = reinterpret_cast<const uint8_t*>(base_->start() + sym.value);
     }
   }
@@ -640,6 +723,10 @@ DART_EXPORT Dart_LoadedElf* Dart_LoadELF_Memory(
   return reinterpret_cast<Dart_LoadedElf*>(elf.release());
 }
 
+DART_EXPORT bool Dart_LoadedElfHasAnonymousData(Dart_LoadedElf* loaded) {
+  return reinterpret_cast<LoadedElf*>(loaded)->has_anonymous_data();
+}
+
 DART_EXPORT void Dart_UnloadELF(Dart_LoadedElf* loaded) {
   delete reinterpret_cast<LoadedElf*>(loaded);
 }
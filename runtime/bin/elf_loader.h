@@ -57,6 +57,12 @@ DART_EXPORT Dart_LoadedElf* Dart_LoadELF_Memory(
     const uint8_t** vm_isolate_data,
     const uint8_t** vm_isolate_instrs);
 
+/// Returns whether some of the contents of an ELF object loaded through
+/// Dart_LoadELF{_Fd, _Memory} are not backed by the file, e.g., because they
+/// were stored compressed. madvise(DONT_NEED) is destructive for such
+/// contents.
+DART_EXPORT bool Dart_LoadedElfHasAnonymousData(Dart_LoadedElf* loaded);
+
 /// Unloads an ELF object loaded through Dart_LoadELF{_Fd, _Memory}.
 ///
 /// Unlike dlclose(), this does not use reference counting.
@@ -15,17 +15,37 @@
 namespace dart {
 namespace bin {
 
-static EventHandler* event_handler = nullptr;
+int64_t TimeoutQueue::slack_millis_ = 0;
+
+intptr_t EventHandler::thread_count_ = 1;
+
+static EventHandler** event_handlers = nullptr;
+static intptr_t event_handler_count = 0;
 static Monitor* shutdown_monitor = nullptr;
 
+void EventHandler::set_thread_count(intptr_t count) {
+  ASSERT(event_handlers == nullptr);
+  ASSERT(count > 0);
+#if defined(DART_HOST_OS_WINDOWS) || defined(DART_HOST_OS_FUCHSIA)
+  // Handles are bound to a single delegate when they are created, so these
+  // platforms cannot shard them across event handler threads.
+  count = 1;
+#endif
+  thread_count_ = count;
+}
+
 void EventHandler::Start() {
   // Initialize global socket registry.
   ListeningSocketRegistry::Initialize();
 
-  ASSERT(event_handler == nullptr);
+  ASSERT(event_handlers == nullptr);
   shutdown_monitor = new Monitor();
-  event_handler = new EventHandler();
-  event_handler->delegate_.Start(event_handler);
+  event_handler_count = thread_count_;
+  event_handlers = new EventHandler*[event_handler_count];
+  for (intptr_t i = 0; i < event_handler_count; i++) {
+    event_handlers[i] = new EventHandler();
+    event_handlers[i]->delegate_.Start(event_handlers[i]);
+  }
 
   if (!SocketBase::Initialize()) {
     FATAL("Failed to initialize sockets");
@@ -38,22 +58,26 @@ void EventHandler::NotifyShutdownDone() {
 }
 
 void EventHandler::Stop() {
-  if (event_handler == nullptr) {
+  if (event_handlers == nullptr) {
     return;
   }
 
-  // Wait until it has stopped.
-  {
-    MonitorLocker ml(shutdown_monitor);
+  for (intptr_t i = 0; i < event_handler_count; i++) {
+    // Wait until it has stopped.
+    {
+      MonitorLocker ml(shutdown_monitor);
 
-    // Signal to event handler that we want it to stop.
-    event_handler->delegate_.Shutdown();
-    ml.Wait(Monitor::kNoTimeout);
+      // Signal to event handler that we want it to stop.
+      event_handlers[i]->delegate_.Shutdown();
+      ml.Wait(Monitor::kNoTimeout);
+    }
+    delete event_handlers[i];
   }
 
   // Cleanup
-  delete event_handler;
-  event_handler = nullptr;
+  delete[] event_handlers;
+  event_handlers = nullptr;
+  event_handler_count = 0;
   delete shutdown_monitor;
   shutdown_monitor = nullptr;
 
@@ -62,14 +86,30 @@ void EventHandler::Stop() {
 }
 
 EventHandlerImplementation* EventHandler::delegate() {
-  if (event_handler == nullptr) {
+  if (event_handlers == nullptr) {
     return nullptr;
   }
-  return &event_handler->delegate_;
+  return &event_handlers[0]->delegate_;
+}
+
+EventHandler* EventHandler::HandlerFor(intptr_t id, Dart_Port port) {
+  if (event_handler_count == 1) {
+    return event_handlers[0];
+  }
+  // Shard by file descriptor rather than by Socket, as shared listening
+  // sockets use several Socket objects for the same descriptor. Messages for
+  // an already closed socket are ignored by whichever thread receives them.
+  uword key;
+  if (id == kTimerId) {
+    key = static_cast<uword>(port);
+  } else {
+    key = static_cast<uword>(reinterpret_cast<Socket*>(id)->fd());
+  }
+  return event_handlers[key % event_handler_count];
 }
 
 void EventHandler::SendFromNative(intptr_t id, Dart_Port port, int64_t data) {
-  event_handler->SendData(id, port, data);
+  HandlerFor(id, port)->SendData(id, port, data);
 }
 
 /*
@@ -98,7 +138,7 @@ void FUNCTION_NAME(EventHandler_SendData)(Dart_NativeArguments args) {
     id = reinterpret_cast<intptr_t>(socket);
   }
   int64_t data = DartUtils::GetIntegerValue(Dart_GetNativeArgument(args, 2));
-  event_handler->SendData(id, dart_port, data);
+  EventHandler::SendFromNative(id, dart_port, data);
 }
 
 void FUNCTION_NAME(EventHandler_TimerMillisecondClock)(
@@ -91,9 +91,27 @@ class TimeoutQueue {
     }
   }
 
+  // Notifies and removes every timeout which expires no later than the timer
+  // slack after [now]. Firing timeouts which are close together at once saves
+  // event handler wake-ups when many isolates have pending timers.
+  void PostExpiredTimeouts(int64_t now) {
+    const int64_t deadline = now + slack_millis_;
+    while (HasTimeout() && (CurrentTimeout() <= deadline)) {
+      DartUtils::PostNull(CurrentPort());
+      RemoveCurrent();
+    }
+  }
+
+  static int64_t slack_millis() { return slack_millis_; }
+  static void set_slack_millis(int64_t slack_millis) {
+    slack_millis_ = slack_millis;
+  }
+
  private:
   PriorityQueue<int64_t, Dart_Port> timeouts_;
 
+  static int64_t slack_millis_;
+
   DISALLOW_COPY_AND_ASSIGN(TimeoutQueue);
 };
 
@@ -623,12 +641,24 @@ class EventHandler {
    */
   static void Stop();
 
+  // Returns the delegate of the first event handler thread. Platforms which
+  // attach handles to a delegate run a single event handler thread.
   static EventHandlerImplementation* delegate();
 
   static void SendFromNative(intptr_t id, Dart_Port port, int64_t data);
 
+  // The number of event handler threads to start. Descriptors are sharded
+  // across the threads by file descriptor and timers by port. Must be set
+  // before Start().
+  static intptr_t thread_count() { return thread_count_; }
+  static void set_thread_count(intptr_t count);
+
  private:
   friend class EventHandlerImplementation;
+
+  static EventHandler* HandlerFor(intptr_t id, Dart_Port port);
+
+  static intptr_t thread_count_;
   EventHandlerImplementation delegate_;
 
   DISALLOW_COPY_AND_ASSIGN(EventHandler);
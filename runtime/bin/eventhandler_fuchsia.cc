@@ -624,14 +624,7 @@ int64_t EventHandlerImplementation::GetTimeout() const {
 }
 
 void EventHandlerImplementation::HandleTimeout() {
-  if (timeout_queue_.HasTimeout()) {
-    int64_t millis = timeout_queue_.CurrentTimeout() -
-                     TimerUtils::GetCurrentMonotonicMillis();
-    if (millis <= 0) {
-      DartUtils::PostNull(timeout_queue_.CurrentPort());
-      timeout_queue_.RemoveCurrent();
-    }
-  }
+  timeout_queue_.PostExpiredTimeouts(TimerUtils::GetCurrentMonotonicMillis());
 }
 
 void EventHandlerImplementation::Poll(uword args) {
@@ -24,6 +24,7 @@
 #include "bin/process.h"
 #include "bin/socket.h"
 #include "bin/thread.h"
+#include "bin/utils.h"
 #include "platform/syslog.h"
 #include "platform/utils.h"
 
@@ -50,15 +51,18 @@ static void RemoveFromEpollInstance(intptr_t epoll_fd_, DescriptorInfo* di) {
       epoll_ctl(epoll_fd_, EPOLL_CTL_DEL, di->fd(), nullptr));
 }
 
-static void AddToEpollInstance(intptr_t epoll_fd_, DescriptorInfo* di) {
+// Registers the file descriptor for a DescriptorInfo structure with epoll, or
+// updates the events of an already registered one if [op] is EPOLL_CTL_MOD.
+static void AddToEpollInstance(intptr_t epoll_fd_,
+                               DescriptorInfo* di,
+                               int op = EPOLL_CTL_ADD) {
   struct epoll_event event;
   event.events = EPOLLRDHUP | di->GetPollEvents();
   if (!di->IsListeningSocket()) {
     event.events |= EPOLLET;
   }
   event.data.ptr = di;
-  int status =
-      NO_RETRY_EXPECTED(epoll_ctl(epoll_fd_, EPOLL_CTL_ADD, di->fd(), &event));
+  int status = NO_RETRY_EXPECTED(epoll_ctl(epoll_fd_, op, di->fd(), &event));
   if (status == -1) {
     // TODO(dart:io): Verify that the dart end is handling this correctly.
 
@@ -144,8 +148,9 @@ void EventHandlerImplementation::UpdateEpollInstance(intptr_t old_mask,
     AddToEpollInstance(epoll_fd_, di);
   } else if ((old_mask != 0) && (new_mask != 0) && (old_mask != new_mask)) {
     ASSERT(!di->IsListeningSocket());
-    RemoveFromEpollInstance(epoll_fd_, di);
-    AddToEpollInstance(epoll_fd_, di);
+    // A single EPOLL_CTL_MOD both replaces the events and, like adding the
+    // descriptor anew, reports readiness which is already pending.
+    AddToEpollInstance(epoll_fd_, di, EPOLL_CTL_MOD);
   }
 }
 
@@ -195,9 +200,60 @@ void EventHandlerImplementation::WakeupHandler(intptr_t id,
   }
 }
 
+// Remembers the mask each descriptor had before the first message of a batch
+// of interrupt messages changed it. This lets the epoll instance be updated
+// once per descriptor after the batch, instead of once per message, when e.g.
+// tokens are returned and the event mask is set for the same socket.
+class EpollUpdateBatch {
+ public:
+  EpollUpdateBatch() : length_(0) {}
+
+  // Must be called before the mask of [di] is changed.
+  void Record(DescriptorInfo* di) {
+    for (intptr_t i = 0; i < length_; i++) {
+      if (infos_[i] == di) {
+        return;
+      }
+    }
+    ASSERT(length_ < kCapacity);
+    infos_[length_] = di;
+    old_masks_[length_] = di->Mask();
+    length_++;
+  }
+
+  // Returns the mask [di] had before the batch and stops tracking it. Used
+  // when [di] is updated right away, e.g. because it is about to be closed.
+  intptr_t Take(DescriptorInfo* di) {
+    for (intptr_t i = 0; i < length_; i++) {
+      if (infos_[i] == di) {
+        intptr_t old_mask = old_masks_[i];
+        length_--;
+        infos_[i] = infos_[length_];
+        old_masks_[i] = old_masks_[length_];
+        return old_mask;
+      }
+    }
+    return di->Mask();
+  }
+
+  intptr_t length() const { return length_; }
+  DescriptorInfo* InfoAt(intptr_t i) const { return infos_[i]; }
+  intptr_t OldMaskAt(intptr_t i) const { return old_masks_[i]; }
+
+  static constexpr intptr_t kCapacity = kInterruptMessageSize;
+
+ private:
+  DescriptorInfo* infos_[kCapacity];
+  intptr_t old_masks_[kCapacity];
+  intptr_t length_;
+
+  DISALLOW_COPY_AND_ASSIGN(EpollUpdateBatch);
+};
+
 void EventHandlerImplementation::HandleInterruptFd() {
-  const intptr_t MAX_MESSAGES = kInterruptMessageSize;
+  const intptr_t MAX_MESSAGES = EpollUpdateBatch::kCapacity;
   InterruptMessage msg[MAX_MESSAGES];
+  EpollUpdateBatch batch;
   ssize_t bytes = TEMP_FAILURE_RETRY_NO_SIGNAL_BLOCKER(
       read(interrupt_fds_[0], msg, MAX_MESSAGES * kInterruptMessageSize));
   for (ssize_t i = 0; i < bytes / kInterruptMessageSize; i++) {
@@ -229,7 +285,7 @@ void EventHandlerImplementation::HandleInterruptFd() {
         if (IS_SIGNAL_SOCKET(msg[i].data)) {
           Process::ClearSignalHandlerByFd(di->fd(), socket->isolate_port());
         }
-        intptr_t old_mask = di->Mask();
+        intptr_t old_mask = batch.Take(di);
         Dart_Port port = msg[i].dart_port;
         if (port != ILLEGAL_PORT) {
           di->RemovePort(port);
@@ -266,22 +322,23 @@ void EventHandlerImplementation::HandleInterruptFd() {
         DartUtils::PostInt32(port, 1 << kDestroyedEvent);
       } else if (IS_COMMAND(msg[i].data, kReturnTokenCommand)) {
         int count = TOKEN_COUNT(msg[i].data);
-        intptr_t old_mask = di->Mask();
+        batch.Record(di);
         di->ReturnTokens(msg[i].dart_port, count);
-        UpdateEpollInstance(old_mask, di);
       } else if (IS_COMMAND(msg[i].data, kSetEventMaskCommand)) {
         // `events` can only have kInEvent/kOutEvent flags set.
         intptr_t events = msg[i].data & EVENT_MASK;
         ASSERT(0 == (events & ~(1 << kInEvent | 1 << kOutEvent)));
 
-        intptr_t old_mask = di->Mask();
+        batch.Record(di);
         di->SetPortAndMask(msg[i].dart_port, msg[i].data & EVENT_MASK);
-        UpdateEpollInstance(old_mask, di);
       } else {
         UNREACHABLE();
       }
     }
   }
+  for (intptr_t i = 0; i < batch.length(); i++) {
+    UpdateEpollInstance(batch.OldMaskAt(i), batch.InfoAt(i));
+  }
 }
 
 void EventHandlerImplementation::UpdateTimerFd() {
@@ -360,10 +417,8 @@ void EventHandlerImplementation::HandleEvents(struct epoll_event* events,
       int64_t val;
       VOID_TEMP_FAILURE_RETRY_NO_SIGNAL_BLOCKER(
           read(timer_fd_, &val, sizeof(val)));
-      if (timeout_queue_.HasTimeout()) {
-        DartUtils::PostNull(timeout_queue_.CurrentPort());
-        timeout_queue_.RemoveCurrent();
-      }
+      timeout_queue_.PostExpiredTimeouts(
+          TimerUtils::GetCurrentMonotonicMillis());
       UpdateTimerFd();
     } else {
       DescriptorInfo* di =
@@ -390,7 +445,9 @@ void EventHandlerImplementation::HandleEvents(struct epoll_event* events,
 
 void EventHandlerImplementation::Poll(uword args) {
   ThreadSignalBlocker signal_blocker(SIGPROF);
-  const intptr_t kMaxEvents = 16;
+  // Take many events per epoll_wait, so that busy servers with lots of
+  // connections need fewer system calls to drain the ready list.
+  const intptr_t kMaxEvents = 256;
   struct epoll_event events[kMaxEvents];
   EventHandler* handler = reinterpret_cast<EventHandler*>(args);
   EventHandlerImplementation* handler_impl = &handler->delegate_;
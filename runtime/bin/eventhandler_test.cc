@@ -79,5 +79,33 @@ VM_UNIT_TEST_CASE(CircularLinkedList) {
   list.Remove(4242);
 }
 
+VM_UNIT_TEST_CASE(TimeoutQueue_PostExpiredTimeouts) {
+  const int64_t saved_slack_millis = TimeoutQueue::slack_millis();
+  TimeoutQueue queue;
+  // The ports don't exist, so posting to them is a no-op.
+  queue.UpdateTimeout(1, 100);
+  queue.UpdateTimeout(2, 105);
+  queue.UpdateTimeout(3, 120);
+
+  // Without slack only the expired timeouts are removed.
+  TimeoutQueue::set_slack_millis(0);
+  queue.PostExpiredTimeouts(99);
+  EXPECT_EQ(1, queue.CurrentPort());
+  queue.PostExpiredTimeouts(100);
+  EXPECT_EQ(2, queue.CurrentPort());
+
+  // Timeouts within the slack fire together.
+  queue.UpdateTimeout(1, 110);
+  TimeoutQueue::set_slack_millis(10);
+  queue.PostExpiredTimeouts(100);
+  EXPECT(queue.HasTimeout());
+  EXPECT_EQ(3, queue.CurrentPort());
+  EXPECT_EQ(120, queue.CurrentTimeout());
+  queue.PostExpiredTimeouts(110);
+  EXPECT(!queue.HasTimeout());
+
+  TimeoutQueue::set_slack_millis(saved_slack_millis);
+}
+
 }  // namespace bin
 }  // namespace dart
@@ -1322,8 +1322,10 @@ void EventHandlerImplementation::HandleTimeout() {
   if (!timeout_queue_.HasTimeout()) {
     return;
   }
+  // The wait timed out, so the first timeout has expired.
   DartUtils::PostNull(timeout_queue_.CurrentPort());
   timeout_queue_.RemoveCurrent();
+  timeout_queue_.PostExpiredTimeouts(TimerUtils::GetCurrentMonotonicMillis());
 }
 
 void EventHandlerImplementation::HandleIOCompletion(DWORD bytes,
@@ -361,6 +361,58 @@ void FUNCTION_NAME(File_Length)(Dart_NativeArguments args) {
   }
 }
 
+static void UnmapFileFinalizer(void* isolate_callback_data, void* peer) {
+  delete reinterpret_cast<MappedMemory*>(peer);
+}
+
+void FUNCTION_NAME(File_Map)(Dart_NativeArguments args) {
+  // Mappings must start at an offset aligned to the page size (or, on
+  // Windows, the allocation granularity). 64KB is a multiple of both on all
+  // supported platforms, so map from the enclosing 64KB boundary and return
+  // a view that starts at the requested offset.
+  const int64_t kMapAlignment = 64 * KB;
+  File* file = GetFile(args);
+  ASSERT(file != nullptr);
+  // start and end are checked in Dart code to lie within the file.
+  int64_t start = DartUtils::GetNativeIntegerArgument(args, 1);
+  int64_t end = DartUtils::GetNativeIntegerArgument(args, 2);
+  bool copy_on_write = DartUtils::GetNativeBooleanArgument(args, 3);
+  ASSERT((start >= 0) && (start < end));
+  const int64_t aligned_start = start & ~(kMapAlignment - 1);
+  const int64_t delta = start - aligned_start;
+  const int64_t length = end - start;
+
+  // File::Map may move the file position, so restore it afterwards.
+  const int64_t position = file->Position();
+  MappedMemory* mapping =
+      file->Map(copy_on_write ? File::kReadWrite : File::kReadOnly,
+                aligned_start, length + delta);
+  if (mapping == nullptr) {
+    Dart_SetReturnValue(args, DartUtils::NewDartOSError());
+    return;
+  }
+  if ((position >= 0) && !file->SetPosition(position)) {
+    delete mapping;
+    Dart_SetReturnValue(args, DartUtils::NewDartOSError());
+    return;
+  }
+
+  uint8_t* data = reinterpret_cast<uint8_t*>(mapping->address()) + delta;
+  Dart_Handle result =
+      copy_on_write
+          ? Dart_NewExternalTypedDataWithFinalizer(
+                Dart_TypedData_kUint8, data, length, mapping, length,
+                UnmapFileFinalizer)
+          : Dart_NewUnmodifiableExternalTypedDataWithFinalizer(
+                Dart_TypedData_kUint8, data, length, mapping, length,
+                UnmapFileFinalizer);
+  if (Dart_IsError(result)) {
+    delete mapping;
+    Dart_PropagateError(result);
+  }
+  Dart_SetReturnValue(args, result);
+}
+
 void FUNCTION_NAME(File_LengthFromPath)(Dart_NativeArguments args) {
   Namespace* namespc = Namespace::GetNamespace(args, 0);
   const char* path = DartUtils::GetNativeTypedDataArgument(args, 1);
@@ -103,7 +103,10 @@ static int InotifyEventToMask(struct inotify_event* e) {
 Dart_Handle FileSystemWatcher::ReadEvents(intptr_t id, intptr_t path_id) {
   USE(path_id);
   const intptr_t kEventSize = sizeof(struct inotify_event);
-  const intptr_t kBufferSize = kEventSize + NAME_MAX + 1;
+  // Drain up to kMaxEventsPerRead maximally sized events per wakeup, rather
+  // than a single one, so bursts of changes need fewer round trips.
+  const intptr_t kMaxEventsPerRead = 32;
+  const intptr_t kBufferSize = kMaxEventsPerRead * (kEventSize + NAME_MAX + 1);
   uint8_t buffer[kBufferSize];
   intptr_t bytes =
       SocketBase::Read(id, buffer, kBufferSize, SocketBase::kAsync);
@@ -114,12 +117,29 @@ Dart_Handle FileSystemWatcher::ReadEvents(intptr_t id, intptr_t path_id) {
   Dart_Handle events = Dart_NewList(kMaxCount);
   intptr_t offset = 0;
   intptr_t i = 0;
+  struct inotify_event* last_modify = nullptr;
   while (offset < bytes) {
     struct inotify_event* e =
         reinterpret_cast<struct inotify_event*>(buffer + offset);
+    int mask = InotifyEventToMask(e);
+    // A write to a file typically produces a run of IN_MODIFY events
+    // followed by IN_CLOSE_WRITE, which all map to the same content
+    // modification. Only report the first of such a run.
+    const int kModifyMask =
+        FileSystemWatcher::kModifyContent | FileSystemWatcher::kIsDir;
+    bool is_modify = ((e->mask & IN_IGNORED) == 0) &&
+                     ((mask & ~kModifyMask) == 0) &&
+                     ((mask & FileSystemWatcher::kModifyContent) != 0);
+    if (is_modify && (last_modify != nullptr) &&
+        (last_modify->wd == e->wd) && (last_modify->len == e->len) &&
+        (InotifyEventToMask(last_modify) == mask) &&
+        (strncmp(last_modify->name, e->name, e->len) == 0)) {
+      offset += kEventSize + e->len;
+      continue;
+    }
+    last_modify = is_modify ? e : nullptr;
     if ((e->mask & IN_IGNORED) == 0) {
       Dart_Handle event = Dart_NewList(5);
-      int mask = InotifyEventToMask(e);
       Dart_ListSetAt(event, 0, Dart_NewInteger(mask));
       Dart_ListSetAt(event, 1, Dart_NewInteger(e->cookie));
       if (e->len > 0) {
@@ -256,6 +256,63 @@ void FUNCTION_NAME(Filter_Processed)(Dart_NativeArguments args) {
   }
 }
 
+// Like Filter_Processed, but writes the output directly into the Uint8List
+// passed in [buffer] between [start] and [end] rather than copying it out of
+// the filter's internal buffer into a freshly allocated list. Returns the
+// number of bytes written, which is 0 once there is no more output.
+void FUNCTION_NAME(Filter_ProcessedInto)(Dart_NativeArguments args) {
+  Dart_Handle filter_obj = Dart_GetNativeArgument(args, 0);
+  Dart_Handle buffer_obj = Dart_GetNativeArgument(args, 1);
+  intptr_t start = DartUtils::GetIntptrValue(Dart_GetNativeArgument(args, 2));
+  intptr_t end = DartUtils::GetIntptrValue(Dart_GetNativeArgument(args, 3));
+  bool flush = DartUtils::GetBooleanValue(Dart_GetNativeArgument(args, 4));
+  bool finish = DartUtils::GetBooleanValue(Dart_GetNativeArgument(args, 5));
+
+  Filter* filter = nullptr;
+  Dart_Handle err = GetFilter(filter_obj, &filter);
+  if (Dart_IsError(err)) {
+    Dart_PropagateError(err);
+  }
+
+  Dart_TypedData_Type type;
+  uint8_t* buffer = nullptr;
+  intptr_t length = 0;
+  err = Dart_TypedDataAcquireData(buffer_obj, &type,
+                                  reinterpret_cast<void**>(&buffer), &length);
+  if (Dart_IsError(err)) {
+    Dart_PropagateError(err);
+  }
+  if ((type != Dart_TypedData_kUint8) || (start < 0) || (end < start) ||
+      (end > length)) {
+    Dart_TypedDataReleaseData(buffer_obj);
+    Dart_ThrowException(DartUtils::NewInternalError(
+        "Invalid argument passed to Filter_ProcessedInto"));
+  }
+  intptr_t read = (start == end)
+                      ? 0
+                      : filter->Processed(buffer + start, end - start, flush,
+                                          finish);
+  Dart_TypedDataReleaseData(buffer_obj);
+  if (read < 0) {
+    Dart_ThrowException(
+        DartUtils::NewDartFormatException("Filter error, bad data"));
+  }
+  Dart_SetIntegerReturnValue(args, read);
+}
+
+void FUNCTION_NAME(Filter_Reset)(Dart_NativeArguments args) {
+  Dart_Handle filter_obj = Dart_GetNativeArgument(args, 0);
+  Filter* filter = nullptr;
+  Dart_Handle err = GetFilter(filter_obj, &filter);
+  if (Dart_IsError(err)) {
+    Dart_PropagateError(err);
+  }
+  if (!filter->Reset()) {
+    Dart_ThrowException(
+        DartUtils::NewInternalError("Failed to reset filter"));
+  }
+}
+
 static void DeleteFilter(void* isolate_data, void* filter_pointer) {
   Filter* filter = reinterpret_cast<Filter*>(filter_pointer);
   delete filter;
@@ -316,10 +373,10 @@ bool ZLibDeflateFilter::Init() {
   if (result != Z_OK) {
     return false;
   }
+  // The dictionary is kept until the filter is destroyed so that Reset can
+  // apply it again.
   if ((dictionary_ != nullptr) && !gzip_ && !raw_) {
     result = deflateSetDictionary(&stream_, dictionary_, dictionary_length_);
-    delete[] dictionary_;
-    dictionary_ = nullptr;
     if (result != Z_OK) {
       return false;
     }
@@ -328,6 +385,21 @@ bool ZLibDeflateFilter::Init() {
   return true;
 }
 
+bool ZLibDeflateFilter::Reset() {
+  delete[] current_buffer_;
+  current_buffer_ = nullptr;
+  stream_.next_in = Z_NULL;
+  stream_.avail_in = 0;
+  if (deflateReset(&stream_) != Z_OK) {
+    return false;
+  }
+  if ((dictionary_ != nullptr) && !gzip_ && !raw_) {
+    return deflateSetDictionary(&stream_, dictionary_, dictionary_length_) ==
+           Z_OK;
+  }
+  return true;
+}
+
 bool ZLibDeflateFilter::Process(uint8_t* data, intptr_t length) {
   if (current_buffer_ != nullptr) {
     return false;
@@ -393,6 +465,14 @@ bool ZLibInflateFilter::Init() {
   return true;
 }
 
+bool ZLibInflateFilter::Reset() {
+  delete[] current_buffer_;
+  current_buffer_ = nullptr;
+  stream_.next_in = Z_NULL;
+  stream_.avail_in = 0;
+  return inflateReset(&stream_) == Z_OK;
+}
+
 bool ZLibInflateFilter::Process(uint8_t* data, intptr_t length) {
   if (current_buffer_ != nullptr) {
     return false;
@@ -441,10 +521,10 @@ intptr_t ZLibInflateFilter::Processed(uint8_t* buffer,
       if (dictionary_ == nullptr) {
         error = true;
       } else {
+        // The dictionary is kept for any later stream that needs it, either
+        // after a Reset or in concatenated input.
         int result =
             inflateSetDictionary(&stream_, dictionary_, dictionary_length_);
-        delete[] dictionary_;
-        dictionary_ = nullptr;
         error = result != Z_OK;
       }
       if (error) {
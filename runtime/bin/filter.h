@@ -30,6 +30,11 @@ class Filter {
                              bool finish,
                              bool end) = 0;
 
+  // Returns the filter to the state it was in right after Init, discarding
+  // any pending input, so the same native state can be reused for another
+  // stream.
+  virtual bool Reset() = 0;
+
   static Dart_Handle SetFilterAndCreateFinalizer(Dart_Handle filter,
                                                  Filter* filter_pointer,
                                                  intptr_t filter_size);
@@ -79,6 +84,7 @@ class ZLibDeflateFilter : public Filter {
                              intptr_t length,
                              bool finish,
                              bool end);
+  virtual bool Reset();
 
  private:
   const bool gzip_;
@@ -114,6 +120,7 @@ class ZLibInflateFilter : public Filter {
                              intptr_t length,
                              bool finish,
                              bool end);
+  virtual bool Reset();
 
  private:
   const int32_t window_bits_;
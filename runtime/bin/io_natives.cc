@@ -54,6 +54,7 @@ namespace bin {
   V(File_LengthFromPath, 2)                                                    \
   V(File_LinkTarget, 2)                                                        \
   V(File_Lock, 4)                                                              \
+  V(File_Map, 4)                                                               \
   V(File_Open, 3)                                                              \
   V(File_OpenStdio, 1)                                                         \
   V(File_Position, 1)                                                          \
@@ -82,6 +83,8 @@ namespace bin {
   V(Filter_CreateZLibInflate, 4)                                               \
   V(Filter_Process, 4)                                                         \
   V(Filter_Processed, 3)                                                       \
+  V(Filter_ProcessedInto, 6)                                                   \
+  V(Filter_Reset, 1)                                                           \
   V(ResourceHandleImpl_toFile, 1)                                              \
   V(ResourceHandleImpl_toSocket, 1)                                            \
   V(ResourceHandleImpl_toRawSocket, 1)                                         \
@@ -164,13 +167,17 @@ namespace bin {
   V(Socket_JoinMulticast, 4)                                                   \
   V(Socket_LeaveMulticast, 4)                                                  \
   V(Socket_Read, 2)                                                            \
+  V(Socket_ReadInto, 4)                                                        \
   V(Socket_RecvFrom, 1)                                                        \
+  V(Socket_RecvFromMultiple, 2)                                                \
   V(Socket_ReceiveMessage, 2)                                                  \
+  V(Socket_SendFile, 4)                                                        \
   V(Socket_SendMessage, 5)                                                     \
   V(Socket_SendTo, 6)                                                          \
   V(Socket_SetOption, 4)                                                       \
   V(Socket_SetRawOption, 4)                                                    \
   V(Socket_SetSocketId, 3)                                                     \
+  V(Socket_WriteBuffers, 2)                                                    \
   V(Socket_WriteList, 4)                                                       \
   V(Socket_HasPendingWrite, 1)                                                 \
   V(SocketControlMessage_fromHandles, 2)                                       \
@@ -25,8 +25,40 @@ namespace bin {
 
 #define CASE_REQUEST(type, method, id)                                         \
   case IOService::k##type##method##Request:                                    \
-    response = type::method##Request(data);                                    \
-    break;
+    return type::method##Request(data);
+
+static CObject* DispatchRequest(intptr_t request_id, const CObjectArray& data) {
+  switch (request_id) {
+    IO_SERVICE_REQUEST_LIST(CASE_REQUEST);
+    default:
+      UNREACHABLE();
+  }
+  return CObject::IllegalArgumentError();
+}
+
+CObject* IOService::BatchRequest(const CObjectArray& request) {
+  if ((request.Length() % 2) != 0) {
+    return CObject::IllegalArgumentError();
+  }
+  const intptr_t count = request.Length() / 2;
+  for (intptr_t i = 0; i < count; i++) {
+    if (!request[2 * i]->IsInt32() || !request[2 * i + 1]->IsArray()) {
+      return CObject::IllegalArgumentError();
+    }
+    CObjectInt32 request_id(request[2 * i]);
+    if ((request_id.Value() < 0) ||
+        (request_id.Value() >= kIOServiceBatchRequest)) {
+      return CObject::IllegalArgumentError();
+    }
+  }
+  CObjectArray* responses = new CObjectArray(CObject::NewArray(count));
+  for (intptr_t i = 0; i < count; i++) {
+    CObjectInt32 request_id(request[2 * i]);
+    CObjectArray data(request[2 * i + 1]);
+    responses->SetAt(i, DispatchRequest(request_id.Value(), data));
+  }
+  return responses;
+}
 
 void IOServiceCallback(Dart_Port dest_port_id, Dart_CObject* message) {
   Dart_Port reply_port_id = ILLEGAL_PORT;
@@ -40,11 +72,7 @@ void IOServiceCallback(Dart_Port dest_port_id, Dart_CObject* message) {
     CObjectInt32 request_id(request[2]);
     CObjectArray data(request[3]);
     reply_port_id = reply_port.Value();
-    switch (request_id.Value()) {
-      IO_SERVICE_REQUEST_LIST(CASE_REQUEST);
-      default:
-        UNREACHABLE();
-    }
+    response = DispatchRequest(request_id.Value(), data);
   }
 
   CObjectArray result(CObject::NewArray(2));
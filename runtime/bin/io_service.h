@@ -10,6 +10,7 @@
 #endif
 
 #include "bin/builtin.h"
+#include "bin/dartutils.h"
 #include "bin/utils.h"
 
 namespace dart {
@@ -60,7 +61,8 @@ namespace bin {
   V(Directory, ListNext, 40)                                                   \
   V(Directory, ListStop, 41)                                                   \
   V(Directory, Rename, 42)                                                     \
-  V(SSLFilter, ProcessFilter, 43)
+  V(SSLFilter, ProcessFilter, 43)                                              \
+  V(IOService, Batch, 44)
 
 #define DECLARE_REQUEST(type, method, id) k##type##method##Request = id,
 
@@ -70,6 +72,13 @@ class IOService {
 
   static Dart_Port GetServicePort();
 
+  // Runs several requests in one message to the IO service. The data is a
+  // flat array of (request id, request data) pairs and the response is an
+  // array with the response of each request, in order. This saves a round
+  // trip between the isolate and the IO service per request when many small
+  // requests, such as stats, are issued together. Batches cannot be nested.
+  static CObject* BatchRequest(const CObjectArray& request);
+
  private:
   DISALLOW_ALLOCATION();
   DISALLOW_IMPLICIT_CONSTRUCTORS(IOService);
@@ -68,6 +68,9 @@ static bool vm_run_app_snapshot = false;
 static char* app_script_uri = nullptr;
 static const uint8_t* app_isolate_snapshot_data = nullptr;
 static const uint8_t* app_isolate_snapshot_instructions = nullptr;
+static bool app_snapshot_is_dontneed_safe = true;
+// The file the app snapshot was loaded from, if any.
+static const char* app_snapshot_filename = nullptr;
 static bool kernel_isolate_is_running = false;
 
 static Dart_Isolate main_isolate = nullptr;
@@ -130,7 +133,23 @@ static void WriteDepsFile() {
   file->Release();
 }
 
+static void WriteSnapshotPageTrace() {
+  const char* trace_filename = Options::snapshot_page_trace_filename();
+  if ((trace_filename == nullptr) || (app_snapshot_filename == nullptr)) {
+    return;
+  }
+  if (!Snapshot::WritePageTrace(app_snapshot_filename, trace_filename)) {
+    Syslog::PrintErr("Failed to write snapshot page trace to %s\n",
+                     trace_filename);
+  }
+}
+
 static void OnExitHook(int64_t exit_code) {
+  WriteSnapshotPageTrace();
+  if ((Options::gen_snapshot_kind() != kAppJIT) &&
+      (Options::depfile() == nullptr)) {
+    return;
+  }
   if (Dart_CurrentIsolate() != main_isolate) {
     Syslog::PrintErr(
         "A snapshot was requested, but a secondary isolate "
@@ -654,11 +673,19 @@ static Dart_Isolate CreateAndSetupDartDevIsolate(const char* script_uri,
         new IsolateGroupData(DART_DEV_ISOLATE_NAME, packages_config, nullptr,
                              isolate_run_app_snapshot);
     uint8_t* application_kernel_buffer = nullptr;
+    std::shared_ptr<uint8_t> application_kernel_buffer_ptr;
     intptr_t application_kernel_buffer_size = 0;
     dfe.ReadScript(dartdev_path.get(), nullptr, &application_kernel_buffer,
-                   &application_kernel_buffer_size, /*decode_uri=*/false);
-    isolate_group_data->SetKernelBufferNewlyOwned(
-        application_kernel_buffer, application_kernel_buffer_size);
+                   &application_kernel_buffer_size, /*decode_uri=*/false,
+                   &application_kernel_buffer_ptr);
+    if (application_kernel_buffer_ptr) {
+      isolate_group_data->SetKernelBufferAlreadyOwned(
+          std::move(application_kernel_buffer_ptr),
+          application_kernel_buffer_size);
+    } else {
+      isolate_group_data->SetKernelBufferNewlyOwned(
+          application_kernel_buffer, application_kernel_buffer_size);
+    }
 
     isolate_data = new IsolateData(isolate_group_data);
     isolate = Dart_CreateIsolateGroup(
@@ -722,6 +749,9 @@ static Dart_Isolate CreateIsolateGroupAndSetupHelper(
     app_snapshot->SetBuffers(
         &ignore_vm_snapshot_data, &ignore_vm_snapshot_instructions,
         &isolate_snapshot_data, &isolate_snapshot_instructions);
+    if (!app_snapshot->IsDontNeedSafe()) {
+      flags->snapshot_is_dontneed_safe = false;
+    }
   }
 
   bool isolate_run_app_snapshot = true;
@@ -866,6 +896,9 @@ static Dart_Isolate CreateIsolateGroupAndSetup(const char* script_uri,
     dontneed_safe = false;
   }
 #endif
+  if (!app_snapshot_is_dontneed_safe) {
+    dontneed_safe = false;
+  }
   flags->snapshot_is_dontneed_safe = dontneed_safe;
 
   int exit_code = 0;
@@ -1022,6 +1055,9 @@ void RunMainIsolate(const char* script_name,
     dontneed_safe = false;
   }
 #endif
+  if (!app_snapshot_is_dontneed_safe) {
+    dontneed_safe = false;
+  }
   flags.snapshot_is_dontneed_safe = dontneed_safe;
 
   Dart_Isolate isolate = CreateIsolateGroupAndSetupHelper(
@@ -1282,8 +1318,15 @@ void main(int argc, char** argv) {
       // in-memory ELF loader.
       const bool force_load_elf_from_memory =
           false DEBUG_ONLY(|| Options::force_load_elf_from_memory());
+      if (Options::snapshot_prefetch_filename() != nullptr) {
+        Snapshot::PrefetchPages(script_name,
+                                Options::snapshot_prefetch_filename());
+      }
       app_snapshot =
           Snapshot::TryReadAppSnapshot(script_name, force_load_elf_from_memory);
+      if (app_snapshot != nullptr && app_snapshot->IsJITorAOT()) {
+        app_snapshot_filename = script_name;
+      }
     }
     if (app_snapshot != nullptr && app_snapshot->IsJITorAOT()) {
       if (app_snapshot->IsAOT() && !Dart_IsPrecompiledRuntime()) {
@@ -1296,6 +1339,7 @@ void main(int argc, char** argv) {
       app_snapshot->SetBuffers(&vm_snapshot_data, &vm_snapshot_instructions,
                                &app_isolate_snapshot_data,
                                &app_isolate_snapshot_instructions);
+      app_snapshot_is_dontneed_safe = app_snapshot->IsDontNeedSafe();
     }
   };
 
@@ -1325,7 +1369,8 @@ void main(int argc, char** argv) {
   // If we need to write an app-jit snapshot or a depfile, then add an exit
   // hook that writes the snapshot and/or depfile as appropriate.
   if ((Options::gen_snapshot_kind() == kAppJIT) ||
-      (Options::depfile() != nullptr)) {
+      (Options::depfile() != nullptr) ||
+      (Options::snapshot_page_trace_filename() != nullptr)) {
     Process::SetExitHook(OnExitHook);
   }
 
@@ -1351,13 +1396,20 @@ void main(int argc, char** argv) {
   dfe.set_verbosity(Options::verbosity_level());
   if (script_name != nullptr) {
     uint8_t* application_kernel_buffer = nullptr;
+    std::shared_ptr<uint8_t> application_kernel_buffer_ptr;
     intptr_t application_kernel_buffer_size = 0;
     dfe.ReadScript(script_name, app_snapshot, &application_kernel_buffer,
-                   &application_kernel_buffer_size);
+                   &application_kernel_buffer_size, /*decode_uri=*/true,
+                   &application_kernel_buffer_ptr);
     if (application_kernel_buffer != nullptr) {
+      if (!application_kernel_buffer_ptr) {
+        application_kernel_buffer_ptr = std::shared_ptr<uint8_t>(
+            application_kernel_buffer, std::free);
+      }
       // Since we loaded the script anyway, save it.
-      dfe.set_application_kernel_buffer(application_kernel_buffer,
-                                        application_kernel_buffer_size);
+      dfe.set_application_kernel_buffer(
+          std::move(application_kernel_buffer_ptr),
+          application_kernel_buffer_size);
       Options::dfe()->set_use_dfe();
     }
   }
@@ -1443,6 +1495,8 @@ void main(int argc, char** argv) {
     }
   }
 
+  WriteSnapshotPageTrace();
+
   // Terminate process exit-code handler.
   Process::TerminateExitCodeHandler();
 
@@ -10,6 +10,8 @@
 
 #include "bin/dartdev_isolate.h"
 #include "bin/error_exit.h"
+#include "bin/eventhandler.h"
+#include "bin/file.h"
 #include "bin/file_system_watcher.h"
 #include "bin/options.h"
 #include "bin/platform.h"
@@ -126,6 +128,52 @@ static void hot_reload_rollback_test_mode_callback(
 DEFINE_BOOL_OPTION_CB(hot_reload_rollback_test_mode,
                       hot_reload_rollback_test_mode_callback);
 
+#if defined(DART_HOST_OS_LINUX)
+// Returns the memory limit of the process' cgroup in MB, or 0 if there is no
+// limit or it cannot be determined.
+static intptr_t CgroupMemoryLimitInMB() {
+  // cgroup v2, then v1.
+  const char* const kLimitFiles[] = {
+      "/sys/fs/cgroup/memory.max",
+      "/sys/fs/cgroup/memory/memory.limit_in_bytes",
+  };
+  for (const char* path : kLimitFiles) {
+    File* file = File::Open(/*namespc=*/nullptr, path, File::kRead);
+    if (file == nullptr) continue;
+    char buffer[32];
+    const int64_t length = file->Read(buffer, sizeof(buffer) - 1);
+    file->Release();
+    if (length <= 0) continue;
+    buffer[length] = '\0';
+    // Unlimited is "max" in v2 and a value close to 2^63 in v1.
+    char* end = nullptr;
+    const int64_t limit = strtoll(buffer, &end, 10);
+    if ((end == buffer) || (limit <= 0) || (limit / MB > kMaxInt32)) {
+      return 0;
+    }
+    return static_cast<intptr_t>(limit / MB);
+  }
+  return 0;
+}
+#endif  // defined(DART_HOST_OS_LINUX)
+
+static void old_gen_heap_size_from_cgroup_callback(
+    CommandLineOptions* vm_options) {
+#if defined(DART_HOST_OS_LINUX)
+  // The old generation grows more cautiously as its usage, which includes
+  // external allocations, approaches the limit, so garbage holding on to
+  // native memory is collected before the container runs out of memory.
+  const intptr_t limit_in_mb = CgroupMemoryLimitInMB();
+  if (limit_in_mb > 0) {
+    vm_options->AddArgument(
+        Utils::SCreate("--old_gen_heap_size=%" Pd, limit_in_mb));
+  }
+#endif  // defined(DART_HOST_OS_LINUX)
+}
+
+DEFINE_BOOL_OPTION_CB(old_gen_heap_size_from_cgroup,
+                      old_gen_heap_size_from_cgroup_callback);
+
 void Options::PrintVersion() {
   Syslog::Print("Dart SDK version: %s\n", Dart_VersionString());
 }
@@ -231,12 +279,33 @@ void Options::PrintUsage() {
 "  it fails to bind instead of failing to start.\n"
 "\n"
 #endif  // !defined(PRODUCT)
+"--timer-slack=<milliseconds>\n"
+"  Allows timers to fire up to this many milliseconds early so that timers\n"
+"  of different isolates which expire close together fire at once\n"
+"  (default 0).\n"
+"--event-handler-threads=<count>\n"
+"  The number of threads which wait for socket IO and timers. Sockets are\n"
+"  spread across the threads by file descriptor (default 1).\n"
 "--root-certs-file=<path>\n"
 "  The path to a file containing the trusted root certificates to use for\n"
 "  secure socket connections.\n"
 "--root-certs-cache=<path>\n"
 "  The path to a cache directory containing the trusted root certificates to\n"
 "  use for secure socket connections.\n"
+#if defined(DART_HOST_OS_LINUX) || defined(DART_HOST_OS_ANDROID)
+"--write-snapshot-page-trace=<path>\n"
+"  When the program exits, write the ranges of the app snapshot which it\n"
+"  touched to the given file.\n"
+"--prefetch-snapshot-pages=<path>\n"
+"  Start reading the ranges of the app snapshot listed in the given file\n"
+"  (see --write-snapshot-page-trace) into memory before loading it.\n"
+#endif  // defined(DART_HOST_OS_LINUX) || defined(DART_HOST_OS_ANDROID)
+#if defined(DART_HOST_OS_LINUX)
+"--old-gen-heap-size-from-cgroup\n"
+"  Limit the old generation heap to the memory limit of the process'\n"
+"  cgroup, so that garbage collections become more frequent as the heap and\n"
+"  external allocations get close to it.\n"
+#endif  // defined(DART_HOST_OS_LINUX)
 #if defined(DART_HOST_OS_LINUX) || \
     defined(DART_HOST_OS_ANDROID) || \
     defined(DART_HOST_OS_FUCHSIA)
@@ -430,6 +499,44 @@ bool Options::ProcessEnableVmServiceOption(const char* arg,
 #endif  // !defined(PRODUCT)
 }
 
+bool Options::ProcessTimerSlackOption(const char* arg,
+                                      CommandLineOptions* vm_options) {
+  const char* value = OptionProcessor::ProcessOption(arg, "--timer-slack=");
+  if (value == nullptr) {
+    return false;
+  }
+  char* end = nullptr;
+  int64_t slack_millis = strtoll(value, &end, 10);
+  if ((end == value) || (*end != '\0') || (slack_millis < 0)) {
+    Syslog::PrintErr(
+        "unrecognized --timer-slack option syntax. "
+        "Use --timer-slack=<milliseconds>\n");
+    return false;
+  }
+  TimeoutQueue::set_slack_millis(slack_millis);
+  return true;
+}
+
+bool Options::ProcessEventHandlerThreadsOption(
+    const char* arg,
+    CommandLineOptions* vm_options) {
+  const char* value =
+      OptionProcessor::ProcessOption(arg, "--event-handler-threads=");
+  if (value == nullptr) {
+    return false;
+  }
+  char* end = nullptr;
+  int64_t count = strtoll(value, &end, 10);
+  if ((end == value) || (*end != '\0') || (count < 1)) {
+    Syslog::PrintErr(
+        "unrecognized --event-handler-threads option syntax. "
+        "Use --event-handler-threads=<count>\n");
+    return false;
+  }
+  EventHandler::set_thread_count(count);
+  return true;
+}
+
 bool Options::ProcessObserveOption(const char* arg,
                                    CommandLineOptions* vm_options) {
 #if !defined(PRODUCT)
@@ -26,7 +26,9 @@ namespace bin {
   V(root_certs_file, root_certs_file)                                          \
   V(root_certs_cache, root_certs_cache)                                        \
   V(namespace, namespc)                                                        \
-  V(write_service_info, vm_write_service_info_filename)
+  V(write_service_info, vm_write_service_info_filename)                        \
+  V(write_snapshot_page_trace, snapshot_page_trace_filename)                   \
+  V(prefetch_snapshot_pages, snapshot_prefetch_filename)
 
 // As STRING_OPTIONS_LIST but for boolean valued options. The default value is
 // always false, and the presence of the flag switches the value to true.
@@ -77,6 +79,8 @@ namespace bin {
   V(ProcessEnvironmentOption)                                                  \
   V(ProcessEnableVmServiceOption)                                              \
   V(ProcessObserveOption)                                                      \
+  V(ProcessEventHandlerThreadsOption)                                          \
+  V(ProcessTimerSlackOption)                                                   \
   V(ProcessVMDebuggingOptions)
 
 // This enum must match the strings in kSnapshotKindNames in main_options.cc.
@@ -10,6 +10,7 @@
 #include <errno.h>         // NOLINT
 #include <fcntl.h>         // NOLINT
 #include <poll.h>          // NOLINT
+#include <spawn.h>         // NOLINT
 #include <stdio.h>         // NOLINT
 #include <stdlib.h>        // NOLINT
 #include <string.h>        // NOLINT
@@ -31,6 +32,15 @@
 
 extern char** environ;
 
+// glibc's posix_spawn uses CLONE_VFORK, so it does not copy the parent's page
+// tables, and it reports exec failures through its return value. 2.29 added
+// posix_spawn_file_actions_addchdir_np, which working directories need.
+// Other C libraries may fork and report exec failures as exit code 127, so
+// they keep using the fork path.
+#if defined(__GLIBC__) && __GLIBC_PREREQ(2, 29)
+#define DART_USE_POSIX_SPAWN 1
+#endif
+
 namespace dart {
 namespace bin {
 
@@ -73,11 +83,20 @@ class ProcessInfoList {
 
   static void AddProcess(pid_t pid, intptr_t fd) {
     MutexLocker locker(mutex_);
+    AddProcessLocked(pid, fd);
+  }
+
+  // Like AddProcess, but the caller must hold mutex(). This lets a process
+  // be registered in the same critical section that created it, so the exit
+  // code handler cannot reap it before its exit fd is known.
+  static void AddProcessLocked(pid_t pid, intptr_t fd) {
     ProcessInfo* info = new ProcessInfo(pid, fd);
     info->set_next(active_processes_);
     active_processes_ = info;
   }
 
+  static Mutex* mutex() { return mutex_; }
+
   static intptr_t LookupProcessExitFd(pid_t pid) {
     MutexLocker locker(mutex_);
     ProcessInfo* current = active_processes_;
@@ -305,6 +324,12 @@ class ProcessStarter {
   }
 
   int Start() {
+#if defined(DART_USE_POSIX_SPAWN)
+    if (CanSpawn()) {
+      return Spawn();
+    }
+#endif
+
     // Create pipes required.
     int err = CreatePipes();
     if (err != 0) {
@@ -400,6 +425,18 @@ class ProcessStarter {
  private:
   static constexpr int kErrorBufferSize = 1024;
 
+  // Output from children is read in chunks of at most the pipe's capacity,
+  // each of which becomes a separate read event and Dart list. The default
+  // capacity is 64KB; ask for more so processes with large outputs need fewer
+  // round trips. This is best effort: the kernel caps the size for
+  // unprivileged processes (see /proc/sys/fs/pipe-max-size).
+  static void EnlargeOutputPipe(int fd) {
+#if defined(F_SETPIPE_SZ)
+    const int kOutputPipeSize = 1 * MB;
+    VOID_NO_RETRY_EXPECTED(fcntl(fd, F_SETPIPE_SZ, kOutputPipeSize));
+#endif
+  }
+
   int CreatePipes() {
     int result;
     result = TEMP_FAILURE_RETRY(pipe2(exec_control_, O_CLOEXEC));
@@ -416,10 +453,12 @@ class ProcessStarter {
 
     // For detached processes the pipe to connect stderr and stdin are not used.
     if (Process::ModeHasStdio(mode_)) {
+      EnlargeOutputPipe(read_in_[0]);
       result = TEMP_FAILURE_RETRY(pipe2(read_err_, O_CLOEXEC));
       if (result < 0) {
         return CleanupAndReturnError();
       }
+      EnlargeOutputPipe(read_err_[0]);
 
       result = TEMP_FAILURE_RETRY(pipe2(write_out_, O_CLOEXEC));
       if (result < 0) {
@@ -430,6 +469,97 @@ class ProcessStarter {
     return 0;
   }
 
+#if defined(DART_USE_POSIX_SPAWN)
+  // Attached processes in the default namespace can be started with
+  // posix_spawn instead of fork. Forking a process with a large heap copies
+  // its page tables, which is slow. Detached processes still need the double
+  // fork to start a new session.
+  bool CanSpawn() {
+    return Process::ModeIsAttached(mode_) && Namespace::IsDefault(namespc_);
+  }
+
+  int Spawn() {
+    int result;
+    if (Process::ModeHasStdio(mode_)) {
+      result = TEMP_FAILURE_RETRY(pipe2(read_in_, O_CLOEXEC));
+      if (result < 0) {
+        return CleanupAndReturnError();
+      }
+      EnlargeOutputPipe(read_in_[0]);
+      result = TEMP_FAILURE_RETRY(pipe2(read_err_, O_CLOEXEC));
+      if (result < 0) {
+        return CleanupAndReturnError();
+      }
+      EnlargeOutputPipe(read_err_[0]);
+      result = TEMP_FAILURE_RETRY(pipe2(write_out_, O_CLOEXEC));
+      if (result < 0) {
+        return CleanupAndReturnError();
+      }
+    }
+    int event_fds[2];
+    result = TEMP_FAILURE_RETRY(pipe2(event_fds, O_CLOEXEC));
+    if (result < 0) {
+      return CleanupAndReturnError();
+    }
+
+    posix_spawn_file_actions_t actions;
+    posix_spawn_file_actions_init(&actions);
+    if (mode_ == kNormal) {
+      posix_spawn_file_actions_adddup2(&actions, write_out_[0], STDIN_FILENO);
+      posix_spawn_file_actions_adddup2(&actions, read_in_[1], STDOUT_FILENO);
+      posix_spawn_file_actions_adddup2(&actions, read_err_[1], STDERR_FILENO);
+    } else {
+      ASSERT(mode_ == kInheritStdio);
+    }
+    if (working_directory_ != nullptr) {
+      posix_spawn_file_actions_addchdir_np(&actions, working_directory_);
+    }
+    char** environment =
+        program_environment_ != nullptr ? program_environment_ : environ;
+
+    // Register the process while still holding the process list lock, so
+    // that the exit code handler blocks in its lookup until the exit fd is
+    // known, even if the child exits right away. Unlike the fork path there
+    // is no need to hold the child back before exec.
+    pid_t pid = -1;
+    {
+      MutexLocker locker(ProcessInfoList::mutex());
+      result = posix_spawnp(&pid, path_, &actions, nullptr,
+                            const_cast<char* const*>(program_arguments_),
+                            environment);
+      if (result == 0) {
+        ProcessInfoList::AddProcessLocked(pid, event_fds[1]);
+      }
+    }
+    posix_spawn_file_actions_destroy(&actions);
+    if (result != 0) {
+      // This also covers exec failures, which glibc reports here.
+      close(event_fds[0]);
+      close(event_fds[1]);
+      errno = result;
+      return CleanupAndReturnError();
+    }
+    ExitCodeHandler::ProcessStarted();
+    *exit_event_ = event_fds[0];
+    FDUtils::SetNonBlocking(event_fds[0]);
+
+    if (Process::ModeHasStdio(mode_)) {
+      // Connect stdio, stdout and stderr.
+      FDUtils::SetNonBlocking(read_in_[0]);
+      *in_ = read_in_[0];
+      close(read_in_[1]);
+      FDUtils::SetNonBlocking(write_out_[1]);
+      *out_ = write_out_[1];
+      close(write_out_[0]);
+      FDUtils::SetNonBlocking(read_err_[0]);
+      *err_ = read_err_[0];
+      close(read_err_[1]);
+    }
+    *id_ = pid;
+    return 0;
+  }
+#endif  // defined(DART_USE_POSIX_SPAWN)
+
   void NewProcess() {
     // Wait for parent process before setting up the child process.
     char msg;
@@ -38,15 +38,19 @@ int SSLFilter::ssl_cert_context_index;
 void SSLFilter::Init() {
   ASSERT(SSLFilter::mutex_ == nullptr);
   SSLFilter::mutex_ = new Mutex();
+  SSLClientSessionCache::Init();
 }
 
 void SSLFilter::Cleanup() {
   ASSERT(SSLFilter::mutex_ != nullptr);
+  SSLClientSessionCache::Cleanup();
   delete SSLFilter::mutex_;
   SSLFilter::mutex_ = nullptr;
 }
 
-const intptr_t SSLFilter::kInternalBIOSize = 10 * KB;
+// Large enough to hold a full TLS record, so that a record never needs more
+// than one request to pass through the BIO pair.
+const intptr_t SSLFilter::kInternalBIOSize = 20 * KB;
 const intptr_t SSLFilter::kApproximateSize =
     sizeof(SSLFilter) + (2 * SSLFilter::kInternalBIOSize);
 
@@ -276,6 +280,29 @@ CObject* SSLFilter::ProcessFilterRequest(const CObjectArray& request) {
 bool SSLFilter::ProcessAllBuffers(int starts[kNumBuffers],
                                   int ends[kNumBuffers],
                                   bool in_handshake) {
+  // A single pass decrypts only what was fed to BoringSSL by the previous
+  // request, and encrypts only what fits before the encrypted output is
+  // drained. Repeat the passes while data moves, so that several TLS records
+  // are processed per round trip from the Dart thread.
+  for (intptr_t pass = 0; pass < kMaxProcessPasses; pass++) {
+    int old_starts[kNumBuffers];
+    int old_ends[kNumBuffers];
+    memmove(old_starts, starts, sizeof(old_starts));
+    memmove(old_ends, ends, sizeof(old_ends));
+    if (!ProcessAllBuffersOnce(starts, ends, in_handshake)) {
+      return false;
+    }
+    if ((memcmp(old_starts, starts, sizeof(old_starts)) == 0) &&
+        (memcmp(old_ends, ends, sizeof(old_ends)) == 0)) {
+      break;
+    }
+  }
+  return true;
+}
+
+bool SSLFilter::ProcessAllBuffersOnce(int starts[kNumBuffers],
+                                      int ends[kNumBuffers],
+                                      bool in_handshake) {
   for (int i = 0; i < kNumBuffers; ++i) {
     if (in_handshake && (i == kReadPlaintext || i == kWritePlaintext)) continue;
     int start = starts[i];
@@ -532,6 +559,12 @@ void SSLFilter::Connect(const char* hostname,
     status = SSL_set_tlsext_host_name(ssl_, hostname);
     SecureSocketUtils::CheckStatusSSL(status, "TlsException",
                                       "Set SNI host name", ssl_);
+    SSL_SESSION* session = SSLClientSessionCache::Lookup(
+        context->session_cache_id(), hostname);
+    if (session != nullptr) {
+      SSL_set_session(ssl_, session);
+      SSL_SESSION_free(session);
+    }
     // Sets the hostname in the certificate-checking object, so it is checked
     // against the certificate presented by the server.
     X509_VERIFY_PARAM* certificate_checking_parameters = SSL_get0_param(ssl_);
@@ -99,6 +99,9 @@ class SSLFilter : public ReferenceCounted<SSLFilter> {
   bool ProcessAllBuffers(int starts[kNumBuffers],
                          int ends[kNumBuffers],
                          bool in_handshake);
+  bool ProcessAllBuffersOnce(int starts[kNumBuffers],
+                             int ends[kNumBuffers],
+                             bool in_handshake);
   Dart_Handle PeerCertificate();
   static void InitializeLibrary();
   Dart_Handle callback_error;
@@ -121,6 +124,7 @@ class SSLFilter : public ReferenceCounted<SSLFilter> {
 
  private:
   static const intptr_t kInternalBIOSize;
+  static constexpr intptr_t kMaxProcessPasses = 4;
   static bool library_initialized_;
   static Mutex* mutex_;  // To protect library initialization.
 
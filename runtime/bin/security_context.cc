@@ -12,6 +12,7 @@
 #include <openssl/ssl.h>
 #include <openssl/x509.h>
 
+#include "platform/atomic.h"
 #include "platform/globals.h"
 
 #include "bin/directory.h"
@@ -37,6 +38,97 @@ const char* SSLCertContext::root_certs_cache_ = nullptr;
 bool SSLCertContext::long_ssl_cert_evaluation_ = false;
 bool SSLCertContext::bypass_trusting_system_roots_ = false;
 
+Mutex* SSLClientSessionCache::mutex_ = nullptr;
+SSLClientSessionCache::Entry
+    SSLClientSessionCache::entries_[SSLClientSessionCache::kCapacity];
+intptr_t SSLClientSessionCache::next_victim_ = 0;
+
+intptr_t SSLCertContext::NextSessionCacheId() {
+  static RelaxedAtomic<intptr_t> next_id = kSharedSessionCacheId + 1;
+  return next_id.fetch_add(1);
+}
+
+void SSLClientSessionCache::Init() {
+  ASSERT(mutex_ == nullptr);
+  mutex_ = new Mutex();
+}
+
+void SSLClientSessionCache::Cleanup() {
+  ASSERT(mutex_ != nullptr);
+  for (intptr_t i = 0; i < kCapacity; i++) {
+    if (entries_[i].session != nullptr) {
+      SSL_SESSION_free(entries_[i].session);
+      free(entries_[i].hostname);
+      entries_[i] = {};
+    }
+  }
+  next_victim_ = 0;
+  delete mutex_;
+  mutex_ = nullptr;
+}
+
+SSL_SESSION* SSLClientSessionCache::Lookup(intptr_t cache_id,
+                                           const char* hostname) {
+  MutexLocker ml(mutex_);
+  for (intptr_t i = 0; i < kCapacity; i++) {
+    Entry* entry = &entries_[i];
+    if ((entry->session != nullptr) && (entry->cache_id == cache_id) &&
+        (strcmp(entry->hostname, hostname) == 0)) {
+      if (SSL_SESSION_is_resumable(entry->session) == 0) {
+        return nullptr;
+      }
+      SSL_SESSION_up_ref(entry->session);
+      return entry->session;
+    }
+  }
+  return nullptr;
+}
+
+void SSLClientSessionCache::Insert(intptr_t cache_id,
+                                   const char* hostname,
+                                   SSL_SESSION* session) {
+  MutexLocker ml(mutex_);
+  Entry* target = nullptr;
+  for (intptr_t i = 0; i < kCapacity; i++) {
+    Entry* entry = &entries_[i];
+    if ((entry->session != nullptr) && (entry->cache_id == cache_id) &&
+        (strcmp(entry->hostname, hostname) == 0)) {
+      target = entry;
+      break;
+    }
+  }
+  if (target == nullptr) {
+    // Replace entries round-robin once the cache is full.
+    target = &entries_[next_victim_];
+    next_victim_ = (next_victim_ + 1) % kCapacity;
+  }
+  if (target->session != nullptr) {
+    SSL_SESSION_free(target->session);
+    free(target->hostname);
+  }
+  target->cache_id = cache_id;
+  target->hostname = Utils::StrDup(hostname);
+  target->session = session;
+}
+
+int SSLClientSessionCache::NewSessionCallback(SSL* ssl, SSL_SESSION* session) {
+  SSLFilter* filter = static_cast<SSLFilter*>(
+      SSL_get_ex_data(ssl, SSLFilter::filter_ssl_index));
+  SSLCertContext* context = static_cast<SSLCertContext*>(
+      SSL_get_ex_data(ssl, SSLFilter::ssl_cert_context_index));
+  if ((filter == nullptr) || (context == nullptr) || filter->is_server() ||
+      (filter->hostname() == nullptr)) {
+    return 0;
+  }
+  // A certificate which was only accepted by an onBadCertificate callback
+  // must not be trusted again without asking that callback.
+  if (SSL_get_verify_result(ssl) != X509_V_OK) {
+    return 0;
+  }
+  Insert(context->session_cache_id(), filter->hostname(), session);
+  return 1;
+}
+
 int SSLCertContext::CertificateCallback(int preverify_ok,
                                         X509_STORE_CTX* store_ctx) {
   if (preverify_ok == 1) {
@@ -798,6 +890,7 @@ void FUNCTION_NAME(SecurityContext_UsePrivateKeyBytes)(
     Dart_NativeArguments args) {
   SSLCertContext* context = SSLCertContext::GetSecurityContext(args);
   const char* password = SSLCertContext::GetPasswordArgument(args, 2);
+  context->MarkCustomized();
 
   int status;
   EVP_PKEY* key;
@@ -831,6 +924,8 @@ void FUNCTION_NAME(SecurityContext_Allocate)(Dart_NativeArguments args) {
   // for `SecurityContext.minimumTlsProtocolVersion` must also be changed.
   SSL_CTX_set_min_proto_version(ctx, TLS1_2_VERSION);
   SSL_CTX_set_cipher_list(ctx, "HIGH:MEDIUM");
+  SSL_CTX_set_session_cache_mode(ctx, SSL_SESS_CACHE_BOTH);
+  SSL_CTX_sess_set_new_cb(ctx, SSLClientSessionCache::NewSessionCallback);
   SSLCertContext* context = new SSLCertContext(ctx);
   Dart_Handle err = SetSecurityContext(args, context);
   if (Dart_IsError(err)) {
@@ -847,6 +942,7 @@ void FUNCTION_NAME(SecurityContext_SetTrustedCertificatesBytes)(
 
   ASSERT(context != nullptr);
   ASSERT(password != nullptr);
+  context->MarkCustomized();
   context->SetTrustedCertificatesBytes(cert_bytes, password);
 }
 
@@ -860,6 +956,7 @@ void FUNCTION_NAME(SecurityContext_SetClientAuthoritiesBytes)(
   ASSERT(context != nullptr);
   ASSERT(password != nullptr);
 
+  context->MarkCustomized();
   context->SetClientAuthoritiesBytes(client_authorities_bytes, password);
 }
 
@@ -872,6 +969,7 @@ void FUNCTION_NAME(SecurityContext_UseCertificateChainBytes)(
   ASSERT(context != nullptr);
   ASSERT(password != nullptr);
 
+  context->MarkCustomized();
   int status = context->UseCertificateChainBytes(cert_chain_bytes, password);
 
   SecureSocketUtils::CheckStatus(status, "TlsException",
@@ -885,6 +983,7 @@ void FUNCTION_NAME(SecurityContext_TrustBuiltinRoots)(
   ASSERT(context != nullptr);
 
   context->TrustBuiltinRoots();
+  context->MarkTrustsBuiltinRoots();
 }
 
 void FUNCTION_NAME(SecurityContext_SetAllowTlsRenegotiation)(
@@ -914,6 +1013,7 @@ void FUNCTION_NAME(SecurityContext_SetMinimumProtocolVersion)(
   }
 
   int protocol_version = DartUtils::GetIntegerValue(protocol_version_handle);
+  context->MarkCustomized();
   if (SSL_CTX_set_min_proto_version(context->context(), protocol_version) ==
       0) {
     Dart_ThrowException(DartUtils::NewDartArgumentError(
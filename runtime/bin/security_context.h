@@ -32,7 +32,9 @@ class SSLCertContext : public ReferenceCounted<SSLCertContext> {
         context_(context),
         alpn_protocol_string_(nullptr),
         trust_builtin_(false),
-        allow_tls_renegotiation_(false) {}
+        allow_tls_renegotiation_(false),
+        customized_(false),
+        session_cache_id_(NextSessionCacheId()) {}
 
   ~SSLCertContext() {
     SSL_CTX_free(context_);
@@ -90,6 +92,23 @@ class SSLCertContext : public ReferenceCounted<SSLCertContext> {
 
   void set_trust_builtin(bool trust_builtin) { trust_builtin_ = trust_builtin; }
 
+  // Client sessions are only resumed by contexts with the same session cache
+  // id. Contexts which only trust the built-in roots share one id, so that
+  // e.g. the default contexts of different isolates share sessions. Any other
+  // configuration gives the context an id of its own, so that a session is
+  // never resumed under different trust settings or client certificates.
+  static constexpr intptr_t kSharedSessionCacheId = 0;
+  intptr_t session_cache_id() const { return session_cache_id_; }
+  void MarkCustomized() {
+    customized_ = true;
+    session_cache_id_ = NextSessionCacheId();
+  }
+  void MarkTrustsBuiltinRoots() {
+    if (!customized_) {
+      session_cache_id_ = kSharedSessionCacheId;
+    }
+  }
+
   void RegisterCallbacks(SSL* ssl);
   TrustEvaluateHandlerFunc GetTrustEvaluateHandler() const;
 
@@ -111,6 +130,8 @@ class SSLCertContext : public ReferenceCounted<SSLCertContext> {
   void LoadRootCertFile(const char* file);
   void LoadRootCertCache(const char* cache);
 
+  static intptr_t NextSessionCacheId();
+
   static const char* root_certs_file_;
   static const char* root_certs_cache_;
 
@@ -119,12 +140,48 @@ class SSLCertContext : public ReferenceCounted<SSLCertContext> {
 
   bool trust_builtin_;
   bool allow_tls_renegotiation_;
+  bool customized_;
+  intptr_t session_cache_id_;
   static bool long_ssl_cert_evaluation_;
   static bool bypass_trusting_system_roots_;
 
   DISALLOW_COPY_AND_ASSIGN(SSLCertContext);
 };
 
+// A process-wide cache of TLS client sessions, keyed by the session cache id
+// of the SSLCertContext and the server host name, so that connections made
+// from different isolates to the same server can resume a session instead of
+// doing a full handshake.
+class SSLClientSessionCache : public AllStatic {
+ public:
+  static void Init();
+  static void Cleanup();
+
+  // Returns a new reference to a resumable session, or nullptr.
+  static SSL_SESSION* Lookup(intptr_t cache_id, const char* hostname);
+
+  // Installed with SSL_CTX_sess_set_new_cb. Takes ownership of [session] if
+  // it stores it.
+  static int NewSessionCallback(SSL* ssl, SSL_SESSION* session);
+
+ private:
+  static constexpr intptr_t kCapacity = 64;
+
+  struct Entry {
+    intptr_t cache_id;
+    char* hostname;
+    SSL_SESSION* session;
+  };
+
+  static void Insert(intptr_t cache_id,
+                     const char* hostname,
+                     SSL_SESSION* session);
+
+  static Mutex* mutex_;
+  static Entry entries_[kCapacity];
+  static intptr_t next_victim_;
+};
+
 class X509Helper : public AllStatic {
  public:
   static Dart_Handle GetDer(Dart_NativeArguments args);
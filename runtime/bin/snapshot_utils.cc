@@ -19,8 +19,17 @@
 #if defined(DART_TARGET_OS_WINDOWS)
 #include <platform/pe.h>
 #endif
+#include "platform/growable_array.h"
 #include "platform/utils.h"
 
+#if defined(DART_HOST_OS_LINUX) || defined(DART_HOST_OS_ANDROID)
+#include <fcntl.h>
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#endif
+
 #define LOG_SECTION_BOUNDARIES false
 
 namespace dart {
@@ -171,6 +180,10 @@ class ElfAppSnapshot : public AppSnapshot {
     *isolate_instructions_buffer = isolate_snapshot_instructions_;
   }
 
+  bool IsDontNeedSafe() const {
+    return !Dart_LoadedElfHasAnonymousData(elf_);
+  }
+
  private:
   Dart_LoadedElf* elf_;
   const uint8_t* vm_snapshot_data_;
@@ -199,10 +212,10 @@ static AppSnapshot* TryReadAppSnapshotElf(
     if (memory == nullptr) return nullptr;
     const uint8_t* address =
         reinterpret_cast<const uint8_t*>(memory->address());
-    handle =
-        Dart_LoadELF_Memory(address + file_offset, file->Length(), &error,
-                            &vm_data_buffer, &vm_instructions_buffer,
-                            &isolate_data_buffer, &isolate_instructions_buffer);
+    handle = Dart_LoadELF_Memory(
+        address + file_offset, file->Length() - file_offset, &error,
+        &vm_data_buffer, &vm_instructions_buffer, &isolate_data_buffer,
+        &isolate_instructions_buffer);
     delete memory;
     file->Release();
 #if !defined(DART_HOST_OS_FUCHSIA)
@@ -332,7 +345,8 @@ AppSnapshot* Snapshot::TryReadAppendedAppSnapshotElfFromPE(
       // We have to do the loading manually even though currently the snapshot
       // data is at the end of the file because the file alignment for
       // PE sections can be less than the page size, and TryReadAppSnapshotElf
-      // won't work if the file offset isn't page-aligned.
+      // won't work if the file offset isn't page-aligned. The whole file is
+      // mapped instead so that the section does not have to be copied.
       const char* error = nullptr;
       const uint8_t* vm_data_buffer = nullptr;
       const uint8_t* vm_instructions_buffer = nullptr;
@@ -341,13 +355,21 @@ AppSnapshot* Snapshot::TryReadAppendedAppSnapshotElfFromPE(
 
       const intptr_t offset = section_header.file_offset;
       const intptr_t size = section_header.file_size;
+      if (offset + size > file->Length()) {
+        return nullptr;
+      }
 
-      std::unique_ptr<uint8_t[]> snapshot(new uint8_t[size]);
-      file->SetPosition(offset);
-      file->ReadFully(snapshot.get(), sizeof(uint8_t) * size);
+      std::unique_ptr<MappedMemory> mapping(
+          file->Map(File::kReadOnly, /*position=*/0,
+                    /*length=*/offset + size));
+      if (mapping == nullptr) {
+        return nullptr;
+      }
+      const uint8_t* snapshot =
+          reinterpret_cast<const uint8_t*>(mapping->address()) + offset;
 
       Dart_LoadedElf* const handle =
-          Dart_LoadELF_Memory(snapshot.get(), size, &error, &vm_data_buffer,
+          Dart_LoadELF_Memory(snapshot, size, &error, &vm_data_buffer,
                               &vm_instructions_buffer, &isolate_data_buffer,
                               &isolate_instructions_buffer);
 
@@ -774,5 +796,107 @@ void Snapshot::GenerateAppAOTAsAssembly(const char* snapshot_filename) {
   }
 }
 
+#if defined(DART_HOST_OS_LINUX) || defined(DART_HOST_OS_ANDROID)
+bool Snapshot::WritePageTrace(const char* snapshot_filename,
+                              const char* trace_filename) {
+  char snapshot_path[PATH_MAX];
+  if (realpath(snapshot_filename, snapshot_path) == nullptr) {
+    return false;
+  }
+  FILE* maps = fopen("/proc/self/maps", "r");
+  if (maps == nullptr) {
+    return false;
+  }
+  const int pagemap = open("/proc/self/pagemap", O_RDONLY | O_CLOEXEC);
+  if (pagemap < 0) {
+    fclose(maps);
+    return false;
+  }
+
+  // Pages of the snapshot file which are mapped into this process, i.e. were
+  // touched since the snapshot was loaded (or are next to a touched page,
+  // as the kernel maps pages around a faulting one).
+  const uint64_t page_size = sysconf(_SC_PAGESIZE);
+  MallocGrowableArray<uint64_t> touched_offsets;
+  char line[PATH_MAX + 128];
+  char path[sizeof(line)];
+  while (fgets(line, sizeof(line), maps) != nullptr) {
+    uint64_t start, end, offset;
+    path[0] = '\0';
+    if (sscanf(line, "%" SCNx64 "-%" SCNx64 " %*s %" SCNx64 " %*s %*s %s",
+               &start, &end, &offset, path) != 4 ||
+        strcmp(path, snapshot_path) != 0) {
+      continue;
+    }
+    for (uint64_t page = start; page < end; page += page_size) {
+      uint64_t entry = 0;
+      const off_t entry_offset = (page / page_size) * sizeof(entry);
+      if (pread(pagemap, &entry, sizeof(entry), entry_offset) !=
+          sizeof(entry)) {
+        break;
+      }
+      // Bit 63 is set if the page is present.
+      if ((entry >> 63) != 0) {
+        touched_offsets.Add(offset + (page - start));
+      }
+    }
+  }
+  close(pagemap);
+  fclose(maps);
+
+  touched_offsets.Sort([](const uint64_t* a, const uint64_t* b) {
+    return (*a < *b) ? -1 : ((*a > *b) ? 1 : 0);
+  });
+  File* file = File::Open(nullptr, trace_filename, File::kWriteTruncate);
+  if (file == nullptr) {
+    return false;
+  }
+  RefCntReleaseScope<File> rs(file);
+  bool success = true;
+  intptr_t i = 0;
+  while (i < touched_offsets.length()) {
+    // Coalesce runs of consecutive pages into one range.
+    const uint64_t range_start = touched_offsets[i++];
+    uint64_t range_end = range_start + page_size;
+    while (i < touched_offsets.length() && touched_offsets[i] <= range_end) {
+      range_end = touched_offsets[i++] + page_size;
+    }
+    success = success && file->Print("%" Pu64 " %" Pu64 "\n", range_start,
+                                     range_end - range_start);
+  }
+  return success;
+}
+
+void Snapshot::PrefetchPages(const char* snapshot_filename,
+                             const char* trace_filename) {
+  FILE* trace = fopen(trace_filename, "r");
+  if (trace == nullptr) {
+    Syslog::PrintErr("Failed to open page trace %s\n", trace_filename);
+    return;
+  }
+  const int fd = open(snapshot_filename, O_RDONLY | O_CLOEXEC);
+  if (fd < 0) {
+    fclose(trace);
+    return;
+  }
+  // POSIX_FADV_WILLNEED only initiates the reads, so this does not wait for
+  // the I/O to complete.
+  uint64_t offset, length;
+  while (fscanf(trace, "%" SCNu64 " %" SCNu64, &offset, &length) == 2) {
+    posix_fadvise(fd, offset, length, POSIX_FADV_WILLNEED);
+  }
+  close(fd);
+  fclose(trace);
+}
+#else
+bool Snapshot::WritePageTrace(const char* snapshot_filename,
+                              const char* trace_filename) {
+  return false;
+}
+
+void Snapshot::PrefetchPages(const char* snapshot_filename,
+                             const char* trace_filename) {}
+#endif  // defined(DART_HOST_OS_LINUX) || defined(DART_HOST_OS_ANDROID)
+
 }  // namespace bin
 }  // namespace dart
@@ -23,6 +23,10 @@ class AppSnapshot {
   bool IsJIT() const { return magic_number_ == DartUtils::kAppJITMagicNumber; }
   bool IsAOT() const { return DartUtils::IsAotMagicNumber(magic_number_); }
   bool IsJITorAOT() const { return IsJIT() || IsAOT(); }
+
+  // Whether madvise(DONT_NEED) on the snapshot data is harmless, i.e., whether
+  // the data can be paged back in from a file.
+  virtual bool IsDontNeedSafe() const { return true; }
   bool IsKernel() const {
     return magic_number_ == DartUtils::kKernelMagicNumber;
   }
@@ -64,6 +68,17 @@ class Snapshot {
                                uint8_t* isolate_instructions_buffer,
                                intptr_t isolate_instructions_size);
 
+  // Writes the ranges of the snapshot file |snapshot_filename| whose pages
+  // the current process touched into |trace_filename|, one
+  // "<offset> <length>" pair per line. Only supported on Linux and Android.
+  static bool WritePageTrace(const char* snapshot_filename,
+                             const char* trace_filename);
+
+  // Asks the OS to read the ranges of |snapshot_filename| listed in
+  // |trace_filename| (see WritePageTrace) into the page cache ahead of use.
+  static void PrefetchPages(const char* snapshot_filename,
+                            const char* trace_filename);
+
  private:
 #if defined(DART_TARGET_OS_MACOS)
   static AppSnapshot* TryReadAppendedAppSnapshotElfFromMachO(
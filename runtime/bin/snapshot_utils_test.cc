@@ -72,4 +72,44 @@ TEST_CASE(CanDetectMachOFiles) {
 }
 #endif
 
+#if defined(DART_HOST_OS_LINUX) || defined(DART_HOST_OS_ANDROID)
+TEST_CASE(SnapshotPageTrace) {
+  const char* kSnapshotFilename = "snapshot_page_trace_test.bin";
+  const char* kTraceFilename = "snapshot_page_trace_test.txt";
+  const intptr_t kSize = 16 * KB;
+  uint8_t* contents = reinterpret_cast<uint8_t*>(calloc(kSize, 1));
+  auto* file = bin::DartUtils::OpenFile(kSnapshotFilename, /*write=*/true);
+  bin::DartUtils::WriteFile(contents, kSize, file);
+  bin::DartUtils::CloseFile(file);
+  free(contents);
+
+  bin::File* snapshot =
+      bin::File::Open(nullptr, kSnapshotFilename, bin::File::kRead);
+  ASSERT(snapshot != nullptr);
+  bin::MappedMemory* mapping = snapshot->Map(bin::File::kReadOnly, 0, kSize);
+  snapshot->Release();
+  ASSERT(mapping != nullptr);
+  // Touch the start of the mapping.
+  EXPECT_EQ(0, *reinterpret_cast<volatile uint8_t*>(mapping->address()));
+
+  EXPECT(bin::Snapshot::WritePageTrace(kSnapshotFilename, kTraceFilename));
+  delete mapping;
+
+  uint8_t* trace = nullptr;
+  intptr_t trace_length = 0;
+  file = bin::DartUtils::OpenFile(kTraceFilename, /*write=*/false);
+  bin::DartUtils::ReadFile(&trace, &trace_length, file);
+  bin::DartUtils::CloseFile(file);
+  EXPECT(trace_length > 2);
+  EXPECT(strncmp(reinterpret_cast<char*>(trace), "0 ", 2) == 0);
+  free(trace);
+
+  // Prefetching only gives hints, but should accept its own trace.
+  bin::Snapshot::PrefetchPages(kSnapshotFilename, kTraceFilename);
+
+  EXPECT(bin::File::Delete(nullptr, kTraceFilename));
+  EXPECT(bin::File::Delete(nullptr, kSnapshotFilename));
+}
+#endif  // defined(DART_HOST_OS_LINUX) || defined(DART_HOST_OS_ANDROID)
+
 }  // namespace dart
@@ -4,6 +4,8 @@
 
 #include "bin/socket.h"
 
+#include <errno.h>  // NOLINT
+
 #include "bin/dartutils.h"
 #include "bin/eventhandler.h"
 #include "bin/file.h"
@@ -582,34 +584,47 @@ void FUNCTION_NAME(Socket_Read)(Dart_NativeArguments args) {
   }
 }
 
-void FUNCTION_NAME(Socket_RecvFrom)(Dart_NativeArguments args) {
-  // TODO(sgjesse): Use a MTU value here. Only the loopback adapter can
-  // handle 64k datagrams.
-  const int kReceiveBufferLen = 65536;
+void FUNCTION_NAME(Socket_ReadInto)(Dart_NativeArguments args) {
   Socket* socket =
       Socket::GetSocketIdNativeField(Dart_GetNativeArgument(args, 0));
-
-  // Ensure that a receive buffer for the UDP socket exists.
-  ASSERT(socket != nullptr);
-  uint8_t* recv_buffer = socket->udp_receive_buffer();
-  if (recv_buffer == nullptr) {
-    recv_buffer = reinterpret_cast<uint8_t*>(malloc(kReceiveBufferLen));
-    socket->set_udp_receive_buffer(recv_buffer);
+  Dart_Handle buffer_obj = Dart_GetNativeArgument(args, 1);
+  intptr_t offset = DartUtils::GetIntptrValue(Dart_GetNativeArgument(args, 2));
+  intptr_t length = DartUtils::GetIntptrValue(Dart_GetNativeArgument(args, 3));
+  if (Socket::short_socket_read()) {
+    length = (length + 1) / 2;
   }
-
-  // Read data into the buffer.
-  RawAddr addr;
-  const intptr_t bytes_read = SocketBase::RecvFrom(
-      socket->fd(), recv_buffer, kReceiveBufferLen, &addr, SocketBase::kAsync);
-  if (bytes_read == 0) {
-    Dart_SetReturnValue(args, Dart_Null());
-    return;
+  Dart_TypedData_Type type;
+  uint8_t* buffer = nullptr;
+  intptr_t len;
+  Dart_Handle result = Dart_TypedDataAcquireData(
+      buffer_obj, &type, reinterpret_cast<void**>(&buffer), &len);
+  if (Dart_IsError(result)) {
+    Dart_PropagateError(result);
   }
-  if (bytes_read < 0) {
-    ASSERT(bytes_read == -1);
-    Dart_ThrowException(DartUtils::NewDartOSError());
+  ASSERT(type == Dart_TypedData_kUint8);
+  ASSERT((offset >= 0) && (length >= 0) && ((offset + length) <= len));
+  intptr_t bytes_read = SocketBase::Read(socket->fd(), buffer + offset, length,
+                                         SocketBase::kAsync);
+  if (bytes_read >= 0) {
+    Dart_TypedDataReleaseData(buffer_obj);
+    Dart_SetIntegerReturnValue(args, bytes_read);
+  } else {
+    // Extract OSError before we release data, as it may override the error.
+    Dart_Handle error;
+    {
+      OSError os_error;
+      Dart_TypedDataReleaseData(buffer_obj);
+      error = DartUtils::NewDartOSError(&os_error);
+    }
+    Dart_ThrowException(error);
   }
+}
 
+// Creates a Datagram object with a copy of the [bytes_read] bytes received in
+// [recv_buffer] from [addr].
+static Dart_Handle NewDatagram(const uint8_t* recv_buffer,
+                               intptr_t bytes_read,
+                               RawAddr addr) {
   // Datagram data read. Copy into buffer of the exact size,
   ASSERT(bytes_read >= 0);
   uint8_t* data_buffer = nullptr;
@@ -660,9 +675,81 @@ void FUNCTION_NAME(Socket_RecvFrom)(Dart_NativeArguments args) {
   if (Dart_IsError(io_lib)) {
     Dart_PropagateError(io_lib);
   }
-  Dart_Handle result = Dart_Invoke(
-      io_lib, DartUtils::NewString("_makeDatagram"), kNumArgs, dart_args);
-  Dart_SetReturnValue(args, result);
+  return Dart_Invoke(io_lib, DartUtils::NewString("_makeDatagram"), kNumArgs,
+                     dart_args);
+}
+
+void FUNCTION_NAME(Socket_RecvFrom)(Dart_NativeArguments args) {
+  // TODO(sgjesse): Use a MTU value here. Only the loopback adapter can
+  // handle 64k datagrams.
+  const int kReceiveBufferLen = 65536;
+  Socket* socket =
+      Socket::GetSocketIdNativeField(Dart_GetNativeArgument(args, 0));
+
+  // Ensure that a receive buffer for the UDP socket exists.
+  ASSERT(socket != nullptr);
+  uint8_t* recv_buffer = socket->udp_receive_buffer();
+  if (recv_buffer == nullptr) {
+    recv_buffer = reinterpret_cast<uint8_t*>(malloc(kReceiveBufferLen));
+    socket->set_udp_receive_buffer(recv_buffer);
+  }
+
+  // Read data into the buffer.
+  RawAddr addr;
+  const intptr_t bytes_read = SocketBase::RecvFrom(
+      socket->fd(), recv_buffer, kReceiveBufferLen, &addr, SocketBase::kAsync);
+  if (bytes_read == 0) {
+    Dart_SetReturnValue(args, Dart_Null());
+    return;
+  }
+  if (bytes_read < 0) {
+    ASSERT(bytes_read == -1);
+    Dart_ThrowException(DartUtils::NewDartOSError());
+  }
+
+  Dart_SetReturnValue(args, NewDatagram(recv_buffer, bytes_read, addr));
+}
+
+void FUNCTION_NAME(Socket_RecvFromMultiple)(Dart_NativeArguments args) {
+  // Each datagram gets a slot as large as the buffer of Socket_RecvFrom.
+  const int kReceiveBufferLen = 65536;
+  Socket* socket =
+      Socket::GetSocketIdNativeField(Dart_GetNativeArgument(args, 0));
+  intptr_t max_datagrams =
+      DartUtils::GetIntptrValue(Dart_GetNativeArgument(args, 1));
+  max_datagrams =
+      Utils::Minimum(max_datagrams, SocketBase::kMaxReceiveDatagrams);
+  ASSERT(max_datagrams > 0);
+
+  // Ensure that a batch receive buffer for the UDP socket exists.
+  ASSERT(socket != nullptr);
+  uint8_t* recv_buffer = socket->udp_batch_receive_buffer();
+  if (recv_buffer == nullptr) {
+    recv_buffer = reinterpret_cast<uint8_t*>(
+        malloc(SocketBase::kMaxReceiveDatagrams * kReceiveBufferLen));
+    socket->set_udp_batch_receive_buffer(recv_buffer);
+  }
+
+  intptr_t lengths[SocketBase::kMaxReceiveDatagrams];
+  RawAddr addrs[SocketBase::kMaxReceiveDatagrams];
+  const intptr_t received = SocketBase::RecvFromMultiple(
+      socket->fd(), recv_buffer, kReceiveBufferLen, max_datagrams, lengths,
+      addrs, SocketBase::kAsync);
+  if (received == 0) {
+    Dart_SetReturnValue(args, Dart_Null());
+    return;
+  }
+  if (received < 0) {
+    ASSERT(received == -1);
+    Dart_ThrowException(DartUtils::NewDartOSError());
+  }
+  Dart_Handle list = ThrowIfError(Dart_NewList(received));
+  for (intptr_t i = 0; i < received; i++) {
+    Dart_Handle datagram = ThrowIfError(
+        NewDatagram(recv_buffer + i * kReceiveBufferLen, lengths[i], addrs[i]));
+    ThrowIfError(Dart_ListSetAt(list, i, datagram));
+  }
+  Dart_SetReturnValue(args, list);
 }
 
 void FUNCTION_NAME(Socket_ReceiveMessage)(Dart_NativeArguments args) {
@@ -846,6 +933,102 @@ void FUNCTION_NAME(Socket_SendMessage)(Dart_NativeArguments args) {
   Dart_SetIntegerReturnValue(args, bytes_written);
 }
 
+void FUNCTION_NAME(Socket_WriteBuffers)(Dart_NativeArguments args) {
+  Socket* socket =
+      Socket::GetSocketIdNativeField(Dart_GetNativeArgument(args, 0));
+  Dart_Handle buffers_obj = Dart_GetNativeArgument(args, 1);
+  intptr_t num_buffers = 0;
+  Dart_Handle result = Dart_ListLength(buffers_obj, &num_buffers);
+  if (Dart_IsError(result)) {
+    Dart_PropagateError(result);
+  }
+  ASSERT(num_buffers <= SocketBase::kMaxWriteBuffers);
+  Dart_Handle handles[SocketBase::kMaxWriteBuffers];
+  result = Dart_ListGetRange(buffers_obj, 0, num_buffers, handles);
+  if (Dart_IsError(result)) {
+    Dart_PropagateError(result);
+  }
+  // Acquire the data of all buffers before writing. No other API calls are
+  // made until they are released.
+  uint8_t* buffers[SocketBase::kMaxWriteBuffers];
+  intptr_t lengths[SocketBase::kMaxWriteBuffers];
+  for (intptr_t i = 0; i < num_buffers; i++) {
+    Dart_TypedData_Type type;
+    result = Dart_TypedDataAcquireData(
+        handles[i], &type, reinterpret_cast<void**>(&buffers[i]), &lengths[i]);
+    if (Dart_IsError(result)) {
+      for (intptr_t j = 0; j < i; j++) {
+        Dart_TypedDataReleaseData(handles[j]);
+      }
+      Dart_PropagateError(result);
+    }
+    ASSERT(type == Dart_TypedData_kUint8);
+  }
+  bool short_write = false;
+  intptr_t num_buffers_to_write = num_buffers;
+  if (Socket::short_socket_write() && (num_buffers > 0)) {
+    // Only write half of the first buffer, as Socket_WriteList does.
+    short_write = true;
+    num_buffers_to_write = 1;
+    lengths[0] = (lengths[0] + 1) / 2;
+  }
+  intptr_t bytes_written =
+      SocketBase::WriteBuffers(socket->fd(), buffers, lengths,
+                               num_buffers_to_write, SocketBase::kAsync);
+  if (bytes_written >= 0) {
+    for (intptr_t i = 0; i < num_buffers; i++) {
+      Dart_TypedDataReleaseData(handles[i]);
+    }
+    Dart_SetIntegerReturnValue(args, short_write ? -bytes_written
+                                                 : bytes_written);
+  } else {
+    // Extract OSError before we release data, as it may override the error.
+    Dart_Handle error;
+    {
+      OSError os_error;
+      for (intptr_t i = 0; i < num_buffers; i++) {
+        Dart_TypedDataReleaseData(handles[i]);
+      }
+      error = DartUtils::NewDartOSError(&os_error);
+    }
+    Dart_ThrowException(error);
+  }
+}
+
+void FUNCTION_NAME(Socket_SendFile)(Dart_NativeArguments args) {
+#if defined(DART_HOST_OS_LINUX) || defined(DART_HOST_OS_ANDROID)
+  Socket* socket =
+      Socket::GetSocketIdNativeField(Dart_GetNativeArgument(args, 0));
+  intptr_t file_fd = DartUtils::GetIntptrValue(Dart_GetNativeArgument(args, 1));
+  int64_t offset = DartUtils::GetInt64ValueCheckRange(
+      Dart_GetNativeArgument(args, 2), 0, kMaxInt64);
+  int64_t count = DartUtils::GetInt64ValueCheckRange(
+      Dart_GetNativeArgument(args, 3), 0, kMaxInt64);
+  if (Socket::short_socket_write()) {
+    count = (count + 1) / 2;
+  }
+  intptr_t bytes_sent =
+      SocketBase::SendFile(socket->fd(), file_fd, offset, count);
+  if (bytes_sent >= 0) {
+    Dart_SetIntegerReturnValue(args, bytes_sent);
+  } else if (errno == EWOULDBLOCK) {
+    // Return null rather than 0, which signals the end of the file.
+    Dart_SetReturnValue(args, Dart_Null());
+  } else {
+    Dart_ThrowException(DartUtils::NewDartOSError());
+  }
+#else
+  Dart_Handle exception;
+  {
+    // Make sure OSError destructor is called.
+    OSError os_error(-1, "sendfile is not supported on this platform",
+                     OSError::kUnknown);
+    exception = DartUtils::NewDartOSError(&os_error);
+  }
+  Dart_ThrowException(exception);
+#endif
+}
+
 void FUNCTION_NAME(Socket_SendTo)(Dart_NativeArguments args) {
   Socket* socket =
       Socket::GetSocketIdNativeField(Dart_GetNativeArgument(args, 0));
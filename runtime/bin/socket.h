@@ -66,6 +66,13 @@ class Socket : public ReferenceCounted<Socket> {
   uint8_t* udp_receive_buffer() const { return udp_receive_buffer_; }
   void set_udp_receive_buffer(uint8_t* buffer) { udp_receive_buffer_ = buffer; }
 
+  uint8_t* udp_batch_receive_buffer() const {
+    return udp_batch_receive_buffer_;
+  }
+  void set_udp_batch_receive_buffer(uint8_t* buffer) {
+    udp_batch_receive_buffer_ = buffer;
+  }
+
   static bool Initialize();
 
   // Creates a socket which is bound and connected. The port to connect to is
@@ -117,6 +124,8 @@ class Socket : public ReferenceCounted<Socket> {
     ASSERT(fd_ == kClosedFd);
     free(udp_receive_buffer_);
     udp_receive_buffer_ = nullptr;
+    free(udp_batch_receive_buffer_);
+    udp_batch_receive_buffer_ = nullptr;
   }
 
   static constexpr int kClosedFd = -1;
@@ -128,6 +137,8 @@ class Socket : public ReferenceCounted<Socket> {
   Dart_Port isolate_port_;
   Dart_Port port_;
   uint8_t* udp_receive_buffer_;
+  // Holds SocketBase::kMaxReceiveDatagrams datagrams for batched receives.
+  uint8_t* udp_batch_receive_buffer_;
 
   friend class ReferenceCounted<Socket>;
   DISALLOW_COPY_AND_ASSIGN(Socket);
@@ -5,6 +5,9 @@
 #include "bin/socket_base.h"
 
 #include <errno.h>  // NOLINT
+#if !defined(DART_HOST_OS_WINDOWS)
+#include <sys/uio.h>  // NOLINT
+#endif
 
 #include "bin/dartutils.h"
 #include "bin/io_buffer.h"
@@ -346,5 +349,85 @@ intptr_t SocketBase::Write(intptr_t fd,
 }
 #endif
 
+#if !defined(DART_HOST_OS_LINUX) && !defined(DART_HOST_OS_ANDROID)
+intptr_t SocketBase::RecvFromMultiple(intptr_t fd,
+                                      uint8_t* buffer,
+                                      intptr_t datagram_size,
+                                      intptr_t max_datagrams,
+                                      intptr_t* lengths,
+                                      RawAddr* addrs,
+                                      SocketOpKind sync) {
+  ASSERT(max_datagrams <= kMaxReceiveDatagrams);
+  intptr_t received = 0;
+  while (received < max_datagrams) {
+    intptr_t bytes_read = RecvFrom(fd, buffer + received * datagram_size,
+                                   datagram_size, &addrs[received], sync);
+    if (bytes_read <= 0) {
+      // Report an error only if nothing was received. Otherwise it surfaces
+      // again on the next call.
+      if ((bytes_read < 0) && (received == 0)) {
+        return -1;
+      }
+      break;
+    }
+    lengths[received++] = bytes_read;
+  }
+  return received;
+}
+#endif
+
+intptr_t SocketBase::WriteBuffers(intptr_t fd,
+                                  uint8_t* const* buffers,
+                                  const intptr_t* lengths,
+                                  intptr_t num_buffers,
+                                  SocketOpKind sync) {
+  ASSERT(num_buffers <= kMaxWriteBuffers);
+#if defined(DART_HOST_OS_WINDOWS)
+  // Writes complete asynchronously on Windows and only one can be pending,
+  // so write the first buffer and let the caller retry the rest.
+  if (num_buffers == 0) {
+    return 0;
+  }
+  return Write(fd, buffers[0], lengths[0], sync);
+#else
+  struct iovec iov[kMaxWriteBuffers];
+  for (intptr_t i = 0; i < num_buffers; i++) {
+    iov[i].iov_base = buffers[i];
+    iov[i].iov_len = lengths[i];
+  }
+  // As in Write, keep writing until EAGAIN so that edge-triggered polling
+  // reports the socket as writable again.
+  struct iovec* current = iov;
+  intptr_t remaining = num_buffers;
+  intptr_t total_written = 0;
+  while (remaining > 0) {
+    ssize_t written_bytes = writev(fd, current, remaining);
+    if (written_bytes == -1) {
+      if (errno == EINTR) {
+        continue;
+      }
+      if ((sync == kAsync) && (errno == EWOULDBLOCK)) {
+        break;
+      }
+      return -1;  // Error occurred.
+    }
+    total_written += written_bytes;
+    // Skip the buffers written completely and advance into the first buffer
+    // which was written partially, if any.
+    size_t written = written_bytes;
+    while ((remaining > 0) && (written >= current->iov_len)) {
+      written -= current->iov_len;
+      current++;
+      remaining--;
+    }
+    if (remaining > 0) {
+      current->iov_base = static_cast<uint8_t*>(current->iov_base) + written;
+      current->iov_len -= written;
+    }
+  }
+  return total_written;
+#endif
+}
+
 }  // namespace bin
 }  // namespace dart
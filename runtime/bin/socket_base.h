@@ -197,6 +197,28 @@ class SocketBase : public AllStatic {
                         intptr_t num_bytes,
                         SocketOpKind sync);
 
+  // Writes the [num_buffers] buffers in order, as Write would write their
+  // concatenation, using a single writev call per attempt where available.
+  // Returns the total number of bytes written, or -1 on error.
+  static constexpr intptr_t kMaxWriteBuffers = 16;
+  static intptr_t WriteBuffers(intptr_t fd,
+                               uint8_t* const* buffers,
+                               const intptr_t* lengths,
+                               intptr_t num_buffers,
+                               SocketOpKind sync);
+
+#if defined(DART_HOST_OS_LINUX) || defined(DART_HOST_OS_ANDROID)
+  // Sends up to [count] bytes of the file [file_fd], starting at [offset],
+  // without copying them through user space. Returns the number of bytes
+  // sent, which is 0 at the end of the file, or -1 on error. If the socket
+  // cannot take more data right now, -1 is returned with errno set to
+  // EWOULDBLOCK.
+  static intptr_t SendFile(intptr_t fd,
+                           intptr_t file_fd,
+                           int64_t offset,
+                           int64_t count);
+#endif
+
   // Send data on a socket. The port to send to is specified in the port
   // component of the passed RawAddr structure. The RawAddr structure is only
   // used for datagram sockets.
@@ -217,6 +239,19 @@ class SocketBase : public AllStatic {
                            intptr_t num_bytes,
                            RawAddr* addr,
                            SocketOpKind sync);
+  // Receives up to [max_datagrams] datagrams into consecutive slots of
+  // [datagram_size] bytes in [buffer], using a single recvmmsg call where
+  // available. The length and sender of each datagram are stored in
+  // [lengths] and [addrs]. Returns the number of datagrams received, which is
+  // 0 if none are available, or -1 on error.
+  static constexpr intptr_t kMaxReceiveDatagrams = 16;
+  static intptr_t RecvFromMultiple(intptr_t fd,
+                                   uint8_t* buffer,
+                                   intptr_t datagram_size,
+                                   intptr_t max_datagrams,
+                                   intptr_t* lengths,
+                                   RawAddr* addrs,
+                                   SocketOpKind sync);
   static intptr_t ReceiveMessage(intptr_t fd,
                                  void* buffer,
                                  int64_t* p_buffer_num_bytes,
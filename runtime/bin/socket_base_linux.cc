@@ -7,15 +7,16 @@
 
 #include "bin/socket_base.h"
 
-#include <errno.h>        // NOLINT
-#include <ifaddrs.h>      // NOLINT
-#include <net/if.h>       // NOLINT
-#include <netinet/tcp.h>  // NOLINT
-#include <stdio.h>        // NOLINT
-#include <stdlib.h>       // NOLINT
-#include <string.h>       // NOLINT
-#include <sys/stat.h>     // NOLINT
-#include <unistd.h>       // NOLINT
+#include <errno.h>         // NOLINT
+#include <ifaddrs.h>       // NOLINT
+#include <net/if.h>        // NOLINT
+#include <netinet/tcp.h>   // NOLINT
+#include <stdio.h>         // NOLINT
+#include <stdlib.h>        // NOLINT
+#include <string.h>        // NOLINT
+#include <sys/sendfile.h>  // NOLINT
+#include <sys/stat.h>      // NOLINT
+#include <unistd.h>        // NOLINT
 
 #include "bin/fdutils.h"
 #include "bin/file.h"
@@ -118,6 +119,54 @@ bool SocketBase::GetOption(intptr_t fd,
   return result == 0;
 }
 
+intptr_t SocketBase::SendFile(intptr_t fd,
+                              intptr_t file_fd,
+                              int64_t offset,
+                              int64_t count) {
+  ASSERT(fd >= 0);
+  off64_t file_offset = offset;
+  // Like File::Copy, never ask for more than sendfile transfers at once.
+  const int64_t kMaxSendFileCount = 0x7ffff000;
+  return TEMP_FAILURE_RETRY(sendfile64(
+      fd, file_fd, &file_offset, Utils::Minimum(count, kMaxSendFileCount)));
+}
+
+intptr_t SocketBase::RecvFromMultiple(intptr_t fd,
+                                      uint8_t* buffer,
+                                      intptr_t datagram_size,
+                                      intptr_t max_datagrams,
+                                      intptr_t* lengths,
+                                      RawAddr* addrs,
+                                      SocketOpKind sync) {
+  ASSERT(fd >= 0);
+  ASSERT(max_datagrams <= kMaxReceiveDatagrams);
+  struct mmsghdr msgs[kMaxReceiveDatagrams];
+  struct iovec iovs[kMaxReceiveDatagrams];
+  memset(msgs, 0, sizeof(msgs));
+  for (intptr_t i = 0; i < max_datagrams; i++) {
+    iovs[i].iov_base = buffer + i * datagram_size;
+    iovs[i].iov_len = datagram_size;
+    msgs[i].msg_hdr.msg_iov = &iovs[i];
+    msgs[i].msg_hdr.msg_iovlen = 1;
+    msgs[i].msg_hdr.msg_name = &addrs[i].addr;
+    msgs[i].msg_hdr.msg_namelen = sizeof(addrs[i].ss);
+  }
+  int received =
+      TEMP_FAILURE_RETRY(recvmmsg(fd, msgs, max_datagrams, 0, nullptr));
+  if (received == -1) {
+    if ((sync == kAsync) && (errno == EWOULDBLOCK)) {
+      // If the read would block we need to retry and therefore return 0
+      // as the number of datagrams read.
+      return 0;
+    }
+    return -1;
+  }
+  for (int i = 0; i < received; i++) {
+    lengths[i] = msgs[i].msg_len;
+  }
+  return received;
+}
+
 bool SocketBase::JoinMulticast(intptr_t fd,
                                const RawAddr& addr,
                                const RawAddr&,
@@ -1570,6 +1570,34 @@ DART_EXPORT void Dart_SetMessageNotifyCallback(
  */
 DART_EXPORT Dart_MessageNotifyCallback Dart_GetMessageNotifyCallback(void);
 
+typedef enum {
+  /**
+   * The isolate's message handling runs before that of other isolates and is
+   * never asked to yield to them. Use this for isolates serving requests.
+   */
+  Dart_IsolateSchedulingClass_LatencySensitive,
+  /**
+   * The isolate yields to other isolates after handling messages for a time
+   * slice (`--isolate-time-slice-micros`).
+   */
+  Dart_IsolateSchedulingClass_Default,
+  /**
+   * As Dart_IsolateSchedulingClass_Default, but the isolate also waits for
+   * all isolates which became ready before it. Use this for background work.
+   */
+  Dart_IsolateSchedulingClass_Batch,
+} Dart_IsolateSchedulingClass;
+
+/**
+ * Sets how the current isolate is scheduled on the VM-managed thread pool
+ * relative to the other isolates. Has no effect on isolates which are run by
+ * the embedder (see Dart_SetMessageNotifyCallback).
+ *
+ * \param scheduling_class The scheduling class of the current isolate.
+ */
+DART_EXPORT void Dart_SetIsolateSchedulingClass(
+    Dart_IsolateSchedulingClass scheduling_class);
+
 /**
  * The VM's default message handler supports pausing an isolate before it
  * processes the first message and right after the it processes the isolate's
@@ -3008,6 +3036,24 @@ DART_EXPORT Dart_Handle Dart_SetNativeInstanceField(Dart_Handle obj,
                                                     int index,
                                                     intptr_t value);
 
+/**
+ * Gets the values of all the native fields of an object.
+ *
+ * This is equivalent to calling Dart_GetNativeInstanceField for each index,
+ * but checks and unwraps the object only once.
+ *
+ * \param obj An object with native fields.
+ * \param num_fields The number of native fields of 'obj', which is also the
+ *   size of the 'field_values' array.
+ * \param field_values Array in which the native field values are returned.
+ *
+ * \return Success if the native field values were copied into
+ *   'field_values'. Otherwise returns an error handle.
+ */
+DART_EXPORT Dart_Handle Dart_GetNativeInstanceFields(Dart_Handle obj,
+                                                     int num_fields,
+                                                     intptr_t* field_values);
+
 /**
  * The arguments to a native function.
  *
@@ -3527,6 +3573,24 @@ Dart_DeferredLoadCompleteError(intptr_t loading_unit_id,
                                const char* error_message,
                                bool transient);
 
+/**
+ * Asks the VM to invoke the Dart_DeferredLoadHandler for the given loading
+ * unit ahead of the first `prefix.loadLibrary()` which needs it, e.g. in order
+ * to start loading the units an application is known to need during startup.
+ *
+ * An asynchronous handler allows the embedder to fetch several units in
+ * parallel. The load completes through Dart_DeferredLoadComplete or
+ * Dart_DeferredLoadCompleteError as usual, and later invocations of
+ * `prefix.loadLibrary()` do not issue another request for the unit.
+ *
+ * Does nothing if the unit is already loaded or a load is outstanding.
+ *
+ * \return A valid handle if no error occurs, otherwise an error handle. In
+ *   particular an error is returned if there is no unit with the given id.
+ */
+DART_EXPORT DART_WARN_UNUSED_RESULT Dart_Handle
+Dart_DeferredLoadPrefetch(intptr_t loading_unit_id);
+
 /**
  * Loads the root library for the current isolate.
  *
@@ -526,6 +526,69 @@ DART_EXPORT int64_t
 Dart_IsolateGroupHeapNewCapacityMetric(Dart_IsolateGroup group);  // Byte
 DART_EXPORT int64_t
 Dart_IsolateGroupHeapNewExternalMetric(Dart_IsolateGroup group);  // Byte
+DART_EXPORT int64_t
+Dart_IsolateGroupHeapOldLiveMetric(Dart_IsolateGroup group);  // Byte
+
+/**
+ * A summary of a distribution recorded by the VM.
+ *
+ * Percentiles are upper bounds accurate to within 1/16 of the true value.
+ */
+typedef struct {
+  int64_t count;
+  int64_t sum;
+  int64_t p50;
+  int64_t p90;
+  int64_t p99;
+  int64_t max;
+} Dart_HistogramMetric;
+
+/**
+ * Reads the distribution of an isolate group's histogram metric.
+ *
+ * The available metrics are:
+ *
+ *   gc.scavenge.pause     Scavenge pause times (microseconds).
+ *   gc.mark.pause         Final marking pause times (microseconds).
+ *   gc.sweep.time         Old-space sweeping times (microseconds).
+ *   safepoint.time        Times to bring other threads to a safepoint
+ *                         (microseconds).
+ *   heap.allocation.rate  New-space allocation rate between scavenges
+ *                         (bytes per second).
+ *
+ * Unlike the vm-service, this is also available in product mode. It may be
+ * called from any thread while the isolate group is alive.
+ *
+ * \return false if |name| is not a histogram metric.
+ */
+DART_EXPORT bool Dart_IsolateGroupHistogramMetric(
+    Dart_IsolateGroup group,
+    const char* name,
+    Dart_HistogramMetric* histogram);
+
+/**
+ * Resources attributed to a single isolate.
+ *
+ * cpu_time_micros is the thread CPU time spent while the isolate was entered,
+ * up to the last time it was exited. allocated_bytes counts new-space
+ * allocation. gc_time_micros is the wall time of garbage collections
+ * triggered by the isolate.
+ */
+typedef struct {
+  int64_t cpu_time_micros;
+  int64_t allocated_bytes;
+  int64_t gc_time_micros;
+} Dart_IsolateResourceUsage;
+
+/**
+ * Reads the resources used so far by an isolate.
+ *
+ * Unlike the metrics above, this is also available in product mode. It may be
+ * called from any thread while the isolate is alive.
+ */
+DART_EXPORT void Dart_GetIsolateResourceUsage(
+    Dart_Isolate isolate,
+    Dart_IsolateResourceUsage* usage);
 
 /*
  * ========
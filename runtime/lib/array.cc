@@ -54,6 +54,26 @@ DEFINE_NATIVE_ENTRY(List_slice, 0, 4) {
   return src.Slice(istart, icount, needs_type_arg.value());
 }
 
+// ObjectArray dst, int start, ObjectArray src, int srcStart, int count.
+DEFINE_NATIVE_ENTRY(List_copyRange, 0, 5) {
+  const Array& dst = Array::CheckedHandle(zone, arguments->NativeArgAt(0));
+  GET_NON_NULL_NATIVE_ARGUMENT(Smi, start, arguments->NativeArgAt(1));
+  const Array& src = Array::CheckedHandle(zone, arguments->NativeArgAt(2));
+  GET_NON_NULL_NATIVE_ARGUMENT(Smi, src_start, arguments->NativeArgAt(3));
+  GET_NON_NULL_NATIVE_ARGUMENT(Smi, count, arguments->NativeArgAt(4));
+  const intptr_t icount = count.Value();
+  if ((icount < 0) || (start.Value() < 0) ||
+      (start.Value() > dst.Length() - icount)) {
+    Exceptions::ThrowRangeError("start", start, 0, dst.Length() - icount);
+  }
+  if ((src_start.Value() < 0) || (src_start.Value() > src.Length() - icount)) {
+    Exceptions::ThrowRangeError("srcStart", src_start, 0,
+                                src.Length() - icount);
+  }
+  dst.CopyRange(start.Value(), src, src_start.Value(), icount);
+  return Object::null();
+}
+
 // Private factory, expects correct arguments.
 DEFINE_NATIVE_ENTRY(ImmutableList_from, 0, 4) {
   // Ignore first argument of this factory (type argument).
@@ -8,8 +8,11 @@
 #include "include/internal/dart_api_dl_impl.h"
 #include "platform/globals.h"
 #include "vm/bootstrap_natives.h"
+#include "vm/dart_api_state.h"
 #include "vm/exceptions.h"
+#include "vm/ffi_callback_metadata.h"
 #include "vm/flags.h"
+#include "vm/heap/bulk_memory_arena.h"
 #include "vm/heap/gc_shared.h"
 #include "vm/log.h"
 #include "vm/native_arguments.h"
@@ -36,6 +39,22 @@ DEFINE_NATIVE_ENTRY(Ffi_createNativeCallableListener, 1, 2) {
       isolate->CreateAsyncFfiCallback(zone, send_function, port.Id()));
 }
 
+DEFINE_NATIVE_ENTRY(Ffi_takeCoalescedNativeCallableListenerCalls, 0, 1) {
+  const auto& port = ReceivePort::CheckedHandle(zone, arguments->NativeArg0());
+  MallocGrowableArray<PersistentHandle*> pending;
+  FfiCallbackMetadata::Instance()->TakePendingAsyncCallbacks(port.Id(),
+                                                             &pending);
+  auto* api_state = isolate->group()->api_state();
+  const auto& calls = Array::Handle(zone, Array::New(pending.length()));
+  auto& args = Object::Handle(zone);
+  for (intptr_t i = 0; i < pending.length(); i++) {
+    args = pending[i]->ptr();
+    calls.SetAt(i, args);
+    api_state->FreePersistentHandle(pending[i]);
+  }
+  return calls.ptr();
+}
+
 DEFINE_NATIVE_ENTRY(Ffi_createNativeCallableIsolateLocal, 1, 3) {
   const auto& trampoline =
       Function::CheckedHandle(zone, arguments->NativeArg0());
@@ -97,6 +116,38 @@ DEFINE_NATIVE_ENTRY(DartApiDLInitializeData, 0, 0) {
   return Integer::New(reinterpret_cast<intptr_t>(&dart_api_data));
 }
 
+DEFINE_NATIVE_ENTRY(TypedDataArena_new, 0, 0) {
+  return Integer::New(reinterpret_cast<intptr_t>(new BulkMemoryArena()));
+}
+
+DEFINE_NATIVE_ENTRY(TypedDataArena_allocateUint8List, 0, 2) {
+  const int64_t address =
+      Integer::CheckedHandle(zone, arguments->NativeArg0()).AsInt64Value();
+  GET_NON_NULL_NATIVE_ARGUMENT(Integer, length, arguments->NativeArgAt(1));
+  const int64_t len = length.AsInt64Value();
+  if (len < 0 ||
+      len > ExternalTypedData::MaxElements(kExternalTypedDataUint8ArrayCid)) {
+    Exceptions::ThrowRangeError(
+        "length", length, 0,
+        ExternalTypedData::MaxElements(kExternalTypedDataUint8ArrayCid));
+  }
+  auto* const arena = reinterpret_cast<BulkMemoryArena*>(address);
+  uint8_t* data = arena->Allocate(len);
+  if (data == nullptr) {
+    Exceptions::ThrowOOM();
+  }
+  // No finalizer and no external size: the arena owns the memory, so the GC
+  // neither accounts for it nor frees it.
+  return ExternalTypedData::New(kExternalTypedDataUint8ArrayCid, data, len);
+}
+
+DEFINE_NATIVE_ENTRY(TypedDataArena_delete, 0, 1) {
+  const int64_t address =
+      Integer::CheckedHandle(zone, arguments->NativeArg0()).AsInt64Value();
+  delete reinterpret_cast<BulkMemoryArena*>(address);
+  return Object::null();
+}
+
 DEFINE_FFI_NATIVE_ENTRY(FinalizerEntry_SetExternalSize,
                         void,
                         (Dart_Handle entry_handle, intptr_t external_size)) {
@@ -70,6 +70,19 @@ DEFINE_NATIVE_ENTRY(GrowableList_setData, 0, 2) {
   return Object::null();
 }
 
+DEFINE_NATIVE_ENTRY(GrowableList_grow, 0, 2) {
+  const GrowableObjectArray& array =
+      GrowableObjectArray::CheckedHandle(zone, arguments->NativeArgAt(0));
+  GET_NON_NULL_NATIVE_ARGUMENT(Smi, capacity, arguments->NativeArgAt(1));
+  if (capacity.Value() > Array::kMaxElements) {
+    Exceptions::ThrowRangeError("length", capacity, 0, Array::kMaxElements);
+  }
+  ASSERT(capacity.Value() > array.Capacity());
+  const Array& data = Array::Handle(zone, array.data());
+  array.SetData(Array::Handle(zone, Array::Grow(data, capacity.Value())));
+  return Object::null();
+}
+
 DEFINE_NATIVE_ENTRY(Internal_makeListFixedLength, 0, 1) {
   GET_NON_NULL_NATIVE_ARGUMENT(GrowableObjectArray, array,
                                arguments->NativeArgAt(0));
@@ -764,6 +764,55 @@ static void ThrowIsolateSpawnException(const String& message) {
   Exceptions::ThrowByType(Exceptions::kIsolateSpawn, args);
 }
 
+// Creates isolates for later lightweight spawns until the group's pool is
+// full (see --isolate-pool-size).
+class RefillIsolatePoolTask : public ThreadPool::Task {
+ public:
+  RefillIsolatePoolTask(Isolate* parent_isolate, IsolateGroup* group)
+      : ThreadPool::Task(kLowPriority),
+        parent_isolate_(parent_isolate),
+        group_(group) {
+    // Pooled isolates are only added while another isolate of the group is
+    // alive.
+    parent_isolate->IncrementSpawnCount();
+  }
+
+  ~RefillIsolatePoolTask() override { parent_isolate_->DecrementSpawnCount(); }
+
+  void Run() override {
+    auto initialize_callback = Isolate::InitializeCallback();
+    ASSERT(initialize_callback != nullptr);
+    while (group_->IsolatePoolNeedsRefill()) {
+      char* error = nullptr;
+      Isolate* isolate =
+          CreateWithinExistingIsolateGroup(group_, "pooled-isolate", &error);
+      if (isolate == nullptr) {
+        free(error);
+        return;
+      }
+      void* isolate_data = nullptr;
+      if (!initialize_callback(&isolate_data, &error)) {
+        Dart_ShutdownIsolate();
+        free(error);
+        return;
+      }
+      isolate->set_init_callback_data(isolate_data);
+      Dart_ExitIsolate();
+      if (!group_->AddPooledIsolate(isolate)) {
+        Dart_EnterIsolate(Api::CastIsolate(isolate));
+        Dart_ShutdownIsolate();
+        return;
+      }
+    }
+  }
+
+ private:
+  Isolate* parent_isolate_;
+  IsolateGroup* group_;
+
+  DISALLOW_COPY_AND_ASSIGN(RefillIsolatePoolTask);
+};
+
 class SpawnIsolateTask : public ThreadPool::Task {
  public:
   SpawnIsolateTask(Isolate* parent_isolate,
@@ -850,11 +899,19 @@ class SpawnIsolateTask : public ThreadPool::Task {
     char* error = nullptr;
 
     auto group = state_->isolate_group();
-    Isolate* isolate = CreateWithinExistingIsolateGroup(group, name, &error);
-    parent_isolate_->DecrementSpawnCount();
-    parent_isolate_ = nullptr;
+    Isolate* isolate = group->TakePooledIsolate();
+    if (isolate != nullptr) {
+      Dart_EnterIsolate(Api::CastIsolate(isolate));
+      isolate->set_name(name);
+      Run(isolate);
+      ScheduleRefillIsolatePool(group);
+      return;
+    }
 
+    isolate = CreateWithinExistingIsolateGroup(group, name, &error);
     if (isolate == nullptr) {
+      parent_isolate_->DecrementSpawnCount();
+      parent_isolate_ = nullptr;
       FailedSpawn(error, /*has_current_isolate=*/false);
       free(error);
       return;
@@ -863,6 +920,8 @@ class SpawnIsolateTask : public ThreadPool::Task {
     void* child_isolate_data = nullptr;
     const bool success = initialize_callback(&child_isolate_data, &error);
     if (!success) {
+      parent_isolate_->DecrementSpawnCount();
+      parent_isolate_ = nullptr;
       FailedSpawn(error);
       Dart_ShutdownIsolate();
       free(error);
@@ -871,9 +930,19 @@ class SpawnIsolateTask : public ThreadPool::Task {
 
     isolate->set_init_callback_data(child_isolate_data);
     Run(isolate);
+    ScheduleRefillIsolatePool(group);
   }
 
  private:
+  // Refills the pool on another worker, so the child can start on this one.
+  // The parent isolate keeps the group alive until the refill is done.
+  void ScheduleRefillIsolatePool(IsolateGroup* group) {
+    ASSERT(parent_isolate_ != nullptr);
+    if (group->IsolatePoolNeedsRefill()) {
+      group->thread_pool()->Run<RefillIsolatePoolTask>(parent_isolate_, group);
+    }
+  }
+
   void Run(Isolate* child) {
     if (!EnsureIsRunnable(child)) {
       Dart_ShutdownIsolate();
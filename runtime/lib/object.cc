@@ -306,6 +306,10 @@ DEFINE_NATIVE_ENTRY(LibraryPrefix_issueLoad, 0, 1) {
   ASSERT(id.Value() != LoadingUnit::kIllegalId);
   LoadingUnit& unit = LoadingUnit::Handle(zone);
   unit ^= units.At(id.Value());
+  if (unit.load_outstanding()) {
+    // Already requested through Dart_DeferredLoadPrefetch.
+    return Object::null();
+  }
   return unit.IssueLoad();
 }
 
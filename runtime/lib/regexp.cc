@@ -139,14 +139,8 @@ DEFINE_NATIVE_ENTRY(RegExp_getGroupNameMap, 0, 1) {
   return Object::null();
 }
 
-static ObjectPtr ExecuteMatch(Zone* zone,
-                              NativeArguments* arguments,
-                              bool sticky) {
-  const RegExp& regexp = RegExp::CheckedHandle(zone, arguments->NativeArgAt(0));
-  ASSERT(!regexp.IsNull());
-  GET_NON_NULL_NATIVE_ARGUMENT(String, subject, arguments->NativeArgAt(1));
-  GET_NON_NULL_NATIVE_ARGUMENT(Smi, start_index, arguments->NativeArgAt(2));
-
+static void ValidateMatchArguments(const String& subject,
+                                   const Smi& start_index) {
   // Both generated code and the interpreter are using 32-bit registers and
   // 32-bit backtracking stack so they can't work with strings which are
   // larger than that. Validate these assumptions before running the regexp.
@@ -159,6 +153,16 @@ static ObjectPtr ExecuteMatch(Zone* zone,
     Exceptions::ThrowRangeError("start_index", Integer::Cast(start_index),
                                 kMinInt32, kMaxInt32);
   }
+}
+
+static ObjectPtr ExecuteMatch(Zone* zone,
+                              NativeArguments* arguments,
+                              bool sticky) {
+  const RegExp& regexp = RegExp::CheckedHandle(zone, arguments->NativeArgAt(0));
+  ASSERT(!regexp.IsNull());
+  GET_NON_NULL_NATIVE_ARGUMENT(String, subject, arguments->NativeArgAt(1));
+  GET_NON_NULL_NATIVE_ARGUMENT(Smi, start_index, arguments->NativeArgAt(2));
+  ValidateMatchArguments(subject, start_index);
 
 #if !defined(DART_PRECOMPILED_RUNTIME)
   if (!FLAG_interpret_irregexp) {
@@ -180,4 +184,29 @@ DEFINE_NATIVE_ENTRY(RegExp_ExecuteMatchSticky, 0, 3) {
   return ExecuteMatch(zone, arguments, /*sticky=*/true);
 }
 
+DEFINE_NATIVE_ENTRY(RegExp_ExecuteHasMatch, 0, 4) {
+  const RegExp& regexp = RegExp::CheckedHandle(zone, arguments->NativeArgAt(0));
+  ASSERT(!regexp.IsNull());
+  GET_NON_NULL_NATIVE_ARGUMENT(String, subject, arguments->NativeArgAt(1));
+  GET_NON_NULL_NATIVE_ARGUMENT(Smi, start_index, arguments->NativeArgAt(2));
+  GET_NON_NULL_NATIVE_ARGUMENT(Bool, sticky, arguments->NativeArgAt(3));
+  ValidateMatchArguments(subject, start_index);
+
+#if !defined(DART_PRECOMPILED_RUNTIME)
+  if (!FLAG_interpret_irregexp) {
+    return Bool::Get(IRRegExpMacroAssembler::Execute(regexp, subject,
+                                                     start_index, sticky.value(),
+                                                     zone) != Object::null())
+        .ptr();
+  }
+#endif
+  return Bool::Get(BytecodeRegExpMacroAssembler::HasMatch(
+                       regexp, subject, start_index, sticky.value(), zone))
+      .ptr();
+}
+
+DEFINE_NATIVE_ENTRY(RegExp_interpretsBytecode, 0, 0) {
+  return Bool::Get(FLAG_interpret_irregexp).ptr();
+}
+
 }  // namespace dart
@@ -9,8 +9,10 @@
 
 namespace dart {
 
-DEFINE_NATIVE_ENTRY(Stopwatch_now, 0, 0) {
-  return Integer::New(OS::GetCurrentMonotonicTicks());
+// Called as an FFI leaf call, so reading the clock needs neither a transition
+// out of generated code nor a boxed result.
+DEFINE_FFI_NATIVE_ENTRY(Stopwatch_now, int64_t, ()) {
+  return OS::GetCurrentMonotonicTicks();
 }
 
 DEFINE_NATIVE_ENTRY(Stopwatch_frequency, 0, 0) {
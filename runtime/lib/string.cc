@@ -257,6 +257,36 @@ DEFINE_NATIVE_ENTRY(OneByteString_substringUnchecked, 0, 3) {
   return OneByteString::New(receiver, start, end - start, Heap::kNew);
 }
 
+DEFINE_NATIVE_ENTRY(OneByteString_indexOfCodeUnit, 0, 3) {
+  const String& receiver =
+      String::CheckedHandle(zone, arguments->NativeArgAt(0));
+  ASSERT(receiver.IsOneByteString());
+  GET_NON_NULL_NATIVE_ARGUMENT(Smi, code_unit_obj, arguments->NativeArgAt(1));
+  GET_NON_NULL_NATIVE_ARGUMENT(Smi, start_obj, arguments->NativeArgAt(2));
+
+  const intptr_t code_unit = code_unit_obj.Value();
+  const intptr_t start = start_obj.Value();
+  ASSERT((0 <= code_unit) && (code_unit <= 0xFF));
+  return Smi::New(OneByteString::IndexOf(receiver, code_unit, start));
+}
+
+DEFINE_NATIVE_ENTRY(Utf8Decoder_decodeWellFormed, 0, 5) {
+  const TypedDataBase& bytes =
+      TypedDataBase::CheckedHandle(zone, arguments->NativeArgAt(0));
+  GET_NON_NULL_NATIVE_ARGUMENT(Smi, start_obj, arguments->NativeArgAt(1));
+  GET_NON_NULL_NATIVE_ARGUMENT(Smi, end_obj, arguments->NativeArgAt(2));
+  GET_NON_NULL_NATIVE_ARGUMENT(Smi, size_obj, arguments->NativeArgAt(3));
+  GET_NON_NULL_NATIVE_ARGUMENT(Bool, one_byte_obj, arguments->NativeArgAt(4));
+
+  const intptr_t start = start_obj.Value();
+  const intptr_t end = end_obj.Value();
+  const intptr_t size = size_obj.Value();
+  ASSERT((0 <= start) && (start <= end) && (end <= bytes.LengthInBytes()));
+  ASSERT((0 < size) && (size <= (end - start)));
+  return String::FromWellFormedUTF8(bytes, start, end, size,
+                                    one_byte_obj.value());
+}
+
 DEFINE_NATIVE_ENTRY(Internal_allocateOneByteString, 0, 1) {
   GET_NON_NULL_NATIVE_ARGUMENT(Integer, length_obj, arguments->NativeArgAt(0));
   const int64_t length = length_obj.AsInt64Value();
@@ -452,6 +482,14 @@ DEFINE_NATIVE_ENTRY(String_concat, 0, 2) {
   const String& receiver =
       String::CheckedHandle(zone, arguments->NativeArgAt(0));
   GET_NON_NULL_NATIVE_ARGUMENT(String, b, arguments->NativeArgAt(1));
+  // Strings are immutable, so appending to or prepending an empty string can
+  // return the other operand instead of copying it.
+  if (b.Length() == 0) {
+    return receiver.ptr();
+  }
+  if (receiver.Length() == 0) {
+    return b.ptr();
+  }
   return String::Concat(receiver, b);
 }
 
@@ -501,7 +539,20 @@ DEFINE_NATIVE_ENTRY(String_concatRange, 0, 3) {
     ASSERT(elem.IsString());
   }
 #endif
-  return String::ConcatAllRange(strings, start_ix, end_ix, Heap::kNew);
+  // If at most one of the strings is non-empty the result is that string, e.g.
+  // when interpolating a large value into an otherwise empty template.
+  String& single = String::Handle(Symbols::Empty().ptr());
+  String& str = String::Handle();
+  for (intptr_t i = start_ix; i < end_ix; i++) {
+    str ^= strings.At(i);
+    if (str.Length() != 0) {
+      if (single.Length() != 0) {
+        return String::ConcatAllRange(strings, start_ix, end_ix, Heap::kNew);
+      }
+      single = str.ptr();
+    }
+  }
+  return single.ptr();
 }
 
 DEFINE_NATIVE_ENTRY(StringBuffer_createStringFromUint16Array, 0, 3) {
@@ -4,8 +4,14 @@
 
 #include "vm/bootstrap_natives.h"
 
+#if defined(HOST_ARCH_X64)
+#include <nmmintrin.h>
+#endif
+
 #include "include/dart_api.h"
 
+#include "platform/unaligned.h"
+#include "vm/cpu.h"
 #include "vm/exceptions.h"
 #include "vm/native_entry.h"
 #include "vm/object.h"
@@ -107,6 +113,163 @@ DEFINE_NATIVE_ENTRY(TypedDataBase_setClampedRange, 0, 5) {
   return Object::null();
 }
 
+// Fills [count] bytes starting at byte [start] with the low eight bits of
+// [value]. Called by fillRange on lists with one byte elements after the
+// range has been checked and the value truncated or clamped by storing it
+// into the first element.
+DEFINE_NATIVE_ENTRY(TypedDataBase_fillBytes, 0, 4) {
+  const TypedDataBase& array =
+      TypedDataBase::CheckedHandle(zone, arguments->NativeArgAt(0));
+  const Smi& start = Smi::CheckedHandle(zone, arguments->NativeArgAt(1));
+  const Smi& count = Smi::CheckedHandle(zone, arguments->NativeArgAt(2));
+  const Smi& value = Smi::CheckedHandle(zone, arguments->NativeArgAt(3));
+  ASSERT_EQUAL(array.ElementSizeInBytes(), 1);
+  ASSERT(start.Value() >= 0 && count.Value() >= 0);
+  ASSERT(count.Value() <= array.LengthInBytes() - start.Value());
+
+  NoSafepointScope no_safepoint;
+  memset(array.DataAddr(start.Value()), static_cast<uint8_t>(value.Value()),
+         count.Value());
+  return Object::null();
+}
+
+// Returns the index of the first byte in [start, end) equal to the low eight
+// bits of [value], or -1. Callers must check that the element at the returned
+// index actually equals the searched value, which is not the case when the
+// value is out of the element range.
+DEFINE_NATIVE_ENTRY(TypedDataBase_indexOfByte, 0, 4) {
+  const TypedDataBase& array =
+      TypedDataBase::CheckedHandle(zone, arguments->NativeArgAt(0));
+  const Smi& value = Smi::CheckedHandle(zone, arguments->NativeArgAt(1));
+  const Smi& start = Smi::CheckedHandle(zone, arguments->NativeArgAt(2));
+  const Smi& end = Smi::CheckedHandle(zone, arguments->NativeArgAt(3));
+  ASSERT_EQUAL(array.ElementSizeInBytes(), 1);
+  ASSERT(0 <= start.Value() && start.Value() <= end.Value());
+  ASSERT(end.Value() <= array.LengthInBytes());
+
+  NoSafepointScope no_safepoint;
+  const uint8_t* data =
+      reinterpret_cast<const uint8_t*>(array.DataAddr(start.Value()));
+  const void* found = memchr(data, static_cast<uint8_t>(value.Value()),
+                             end.Value() - start.Value());
+  if (found == nullptr) {
+    return Smi::New(-1);
+  }
+  return Smi::New(start.Value() +
+                  (reinterpret_cast<const uint8_t*>(found) - data));
+}
+
+// CRC-32C (Castagnoli), as used by iSCSI, ext4 and many storage formats.
+static constexpr uint32_t kCrc32cPolynomial = 0x82f63b78;  // Reversed.
+
+// Tables for computing the checksum eight bytes at a time ("slicing-by-8")
+// on CPUs without a CRC32 instruction.
+struct Crc32cTables {
+  constexpr Crc32cTables() : entries() {
+    for (uint32_t i = 0; i < 256; i++) {
+      uint32_t crc = i;
+      for (intptr_t j = 0; j < 8; j++) {
+        crc = (crc >> 1) ^ ((crc & 1) != 0 ? kCrc32cPolynomial : 0);
+      }
+      entries[0][i] = crc;
+    }
+    for (intptr_t k = 1; k < 8; k++) {
+      for (intptr_t i = 0; i < 256; i++) {
+        const uint32_t crc = entries[k - 1][i];
+        entries[k][i] = (crc >> 8) ^ entries[0][crc & 0xff];
+      }
+    }
+  }
+
+  uint32_t entries[8][256];
+};
+
+static constexpr Crc32cTables kCrc32cTables;
+
+static uint32_t Crc32cSoftware(uint32_t crc,
+                               const uint8_t* data,
+                               intptr_t length) {
+  const auto& t = kCrc32cTables.entries;
+  for (; length >= 8; data += 8, length -= 8) {
+    uint64_t v = LoadUnaligned(reinterpret_cast<const uint64_t*>(data)) ^ crc;
+    crc = t[7][v & 0xff] ^ t[6][(v >> 8) & 0xff] ^ t[5][(v >> 16) & 0xff] ^
+          t[4][(v >> 24) & 0xff] ^ t[3][(v >> 32) & 0xff] ^
+          t[2][(v >> 40) & 0xff] ^ t[1][(v >> 48) & 0xff] ^ t[0][v >> 56];
+  }
+  for (; length > 0; data++, length--) {
+    crc = (crc >> 8) ^ t[0][(crc ^ *data) & 0xff];
+  }
+  return crc;
+}
+
+#if defined(HOST_ARCH_X64) && defined(TARGET_ARCH_X64) && defined(__GNUC__)
+#define CRC32C_HARDWARE_SUPPORTED
+__attribute__((target("sse4.2"))) static uint32_t Crc32cHardware(
+    uint32_t crc,
+    const uint8_t* data,
+    intptr_t length) {
+  uint64_t crc64 = crc;
+  for (; length >= 8; data += 8, length -= 8) {
+    const uint64_t v = LoadUnaligned(reinterpret_cast<const uint64_t*>(data));
+    crc64 = _mm_crc32_u64(crc64, v);
+  }
+  crc = static_cast<uint32_t>(crc64);
+  for (; length > 0; data++, length--) {
+    crc = _mm_crc32_u8(crc, *data);
+  }
+  return crc;
+}
+#endif
+
+// Number of bytes checksummed between safepoint checks.
+static constexpr intptr_t kCrc32cChunkSize = 64 * KB;
+
+// int crc, TypedDataBase data, int start, int end.
+DEFINE_NATIVE_ENTRY(Internal_crc32c, 0, 4) {
+  GET_NON_NULL_NATIVE_ARGUMENT(Integer, crc_value, arguments->NativeArgAt(0));
+  GET_NON_NULL_NATIVE_ARGUMENT(TypedDataBase, data, arguments->NativeArgAt(1));
+  GET_NON_NULL_NATIVE_ARGUMENT(Smi, start, arguments->NativeArgAt(2));
+  GET_NON_NULL_NATIVE_ARGUMENT(Smi, end, arguments->NativeArgAt(3));
+  if (data.ElementSizeInBytes() != 1) {
+    Exceptions::ThrowArgumentError(data);
+  }
+  const intptr_t length = data.LengthInBytes();
+  if ((start.Value() < 0) || (start.Value() > length)) {
+    Exceptions::ThrowRangeError("start", start, 0, length);
+  }
+  if ((end.Value() < start.Value()) || (end.Value() > length)) {
+    Exceptions::ThrowRangeError("end", end, start.Value(), length);
+  }
+
+#if defined(CRC32C_HARDWARE_SUPPORTED)
+  const bool use_hardware = HostCPUFeatures::sse4_2_supported();
+#endif
+  uint32_t crc = ~static_cast<uint32_t>(crc_value.AsInt64Value());
+  for (intptr_t i = start.Value(); i < end.Value();) {
+    const intptr_t chunk = Utils::Minimum(end.Value() - i, kCrc32cChunkSize);
+    {
+      NoSafepointScope no_safepoint(thread);
+      const uint8_t* bytes = reinterpret_cast<uint8_t*>(data.DataAddr(i));
+#if defined(CRC32C_HARDWARE_SUPPORTED)
+      if (use_hardware) {
+        crc = Crc32cHardware(crc, bytes, chunk);
+      } else {
+        crc = Crc32cSoftware(crc, bytes, chunk);
+      }
+#else
+      crc = Crc32cSoftware(crc, bytes, chunk);
+#endif
+    }
+    i += chunk;
+    if (i < end.Value()) {
+      thread->CheckForSafepoint();
+    }
+  }
+  return Integer::New(~crc);
+}
+
+#undef CRC32C_HARDWARE_SUPPORTED
+
 // The native getter and setter functions defined here are only called if
 // unboxing doubles or SIMD values is not supported by the flow graph compiler,
 // and the provided offsets have already been range checked by the calling code.
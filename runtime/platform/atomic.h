@@ -105,6 +105,10 @@ class AcqRelAtomic {
     value_.store(arg, order);
   }
 
+  T exchange(T arg, std::memory_order order = std::memory_order_acq_rel) {
+    return value_.exchange(arg, order);
+  }
+
   T fetch_add(T arg, std::memory_order order = std::memory_order_acq_rel) {
     return value_.fetch_add(arg, order);
   }
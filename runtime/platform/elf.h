@@ -152,6 +152,17 @@ struct Note {
   uint8_t data[];
 };
 
+// The header of a section holding the compressed contents of another,
+// SHT_NOBITS section (see kCompressedSectionPrefix). The header is followed by
+// num_frames + 1 offsets of the frames, relative to the end of the offsets,
+// and then by the frames. Each frame holds frame_size bytes of the original
+// contents (except the last, which may hold fewer) compressed with LZ4.
+struct CompressedSectionHeader {
+  uint64_t size;
+  uint32_t frame_size;
+  uint32_t num_frames;
+};
+
 #pragma pack(pop)
 
 static constexpr intptr_t ELFCLASS32 = 1;
@@ -198,6 +209,11 @@ static constexpr intptr_t STT_SECTION = 3;
 
 static constexpr const char ELF_NOTE_GNU[] = "GNU";
 
+// Unallocated sections whose names start with this prefix hold the contents
+// of the allocated section given by their link field, which has no contents in
+// the file. The Dart ELF loader decompresses them when loading the snapshot.
+static constexpr const char kCompressedSectionPrefix[] = ".lz4";
+
 // Creates symbol info from the given STB and STT values.
 constexpr decltype(Symbol::info) SymbolInfo(intptr_t binding, intptr_t type) {
   // Take the low nibble of each value in case, though the upper bits should
@@ -0,0 +1,162 @@
+// Copyright (c) 2024, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+#include "platform/lz4.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "platform/assert.h"
+#include "platform/unaligned.h"
+#include "platform/utils.h"
+
+namespace dart {
+
+// The shortest match which is encoded.
+static constexpr intptr_t kMinMatch = 4;
+// The last match must start at least this many bytes before the end of the
+// input and the last five bytes are always literals, which allows decoders to
+// copy in larger steps.
+static constexpr intptr_t kMatchStartLimit = 12;
+static constexpr intptr_t kLastLiterals = 5;
+static constexpr intptr_t kHashBits = 12;
+
+static inline uint32_t HashOf(uint32_t value) {
+  return (value * 2654435761U) >> (32 - kHashBits);
+}
+
+// Writes a length which did not fit into the 4 bits of the token.
+static uint8_t* WriteLength(uint8_t* dst, intptr_t length) {
+  for (; length >= 255; length -= 255) {
+    *dst++ = 255;
+  }
+  *dst++ = static_cast<uint8_t>(length);
+  return dst;
+}
+
+// Writes a sequence of literals, optionally followed by a match.
+static uint8_t* WriteSequence(uint8_t* dst,
+                              const uint8_t* literals,
+                              intptr_t literal_length,
+                              intptr_t offset,
+                              intptr_t match_length) {
+  uint8_t* token = dst++;
+  *token = static_cast<uint8_t>(Utils::Minimum<intptr_t>(literal_length, 15)
+                                << 4);
+  if (literal_length >= 15) {
+    dst = WriteLength(dst, literal_length - 15);
+  }
+  memcpy(dst, literals, literal_length);  // NOLINT
+  dst += literal_length;
+  if (match_length == 0) return dst;
+  ASSERT(offset > 0 && offset <= Lz4::kMaxDistance);
+  *dst++ = static_cast<uint8_t>(offset);
+  *dst++ = static_cast<uint8_t>(offset >> 8);
+  const intptr_t length = match_length - kMinMatch;
+  *token |= static_cast<uint8_t>(Utils::Minimum<intptr_t>(length, 15));
+  if (length >= 15) {
+    dst = WriteLength(dst, length - 15);
+  }
+  return dst;
+}
+
+intptr_t Lz4::Compress(const uint8_t* src, intptr_t size, uint8_t* dst) {
+  ASSERT(size >= 0);
+  uint8_t* const dst_start = dst;
+  // Positions of the last occurrence of each hashed 4 byte sequence, plus one
+  // so that 0 means none.
+  intptr_t* table = reinterpret_cast<intptr_t*>(
+      calloc(intptr_t{1} << kHashBits, sizeof(intptr_t)));
+  intptr_t anchor = 0;
+  intptr_t i = 0;
+  const intptr_t limit = size - kMatchStartLimit;
+  while (i < limit) {
+    const uint32_t value = LoadUnaligned(reinterpret_cast<const uint32_t*>(
+        src + i));
+    const uint32_t hash = HashOf(value);
+    const intptr_t candidate = table[hash] - 1;
+    table[hash] = i + 1;
+    if (candidate < 0 || i - candidate > kMaxDistance ||
+        LoadUnaligned(reinterpret_cast<const uint32_t*>(src + candidate)) !=
+            value) {
+      i++;
+      continue;
+    }
+    intptr_t length = kMinMatch;
+    const intptr_t max_length = size - kLastLiterals - i;
+    while (length < max_length && src[candidate + length] == src[i + length]) {
+      length++;
+    }
+    dst = WriteSequence(dst, src + anchor, i - anchor, i - candidate, length);
+    i += length;
+    anchor = i;
+  }
+  dst = WriteSequence(dst, src + anchor, size - anchor, 0, 0);
+  free(table);
+  ASSERT(dst - dst_start <= MaxCompressedSize(size));
+  return dst - dst_start;
+}
+
+// Reads the continuation of a length which did not fit into the 4 bits of the
+// token. Returns false if the input ends early.
+static bool ReadLength(const uint8_t* src,
+                       intptr_t src_size,
+                       intptr_t* position,
+                       intptr_t* length) {
+  uint8_t byte;
+  do {
+    if (*position >= src_size) return false;
+    byte = src[(*position)++];
+    *length += byte;
+  } while (byte == 255);
+  return true;
+}
+
+bool Lz4::Decompress(const uint8_t* src,
+                     intptr_t src_size,
+                     uint8_t* dst,
+                     intptr_t dst_size) {
+  intptr_t i = 0;
+  intptr_t o = 0;
+  while (i < src_size) {
+    const uint8_t token = src[i++];
+    intptr_t literal_length = token >> 4;
+    if (literal_length == 15 &&
+        !ReadLength(src, src_size, &i, &literal_length)) {
+      return false;
+    }
+    if (literal_length > src_size - i || literal_length > dst_size - o) {
+      return false;
+    }
+    memcpy(dst + o, src + i, literal_length);  // NOLINT
+    i += literal_length;
+    o += literal_length;
+    // The last sequence has no match.
+    if (i == src_size) break;
+
+    if (src_size - i < 2) return false;
+    const intptr_t offset = src[i] | (src[i + 1] << 8);
+    i += 2;
+    if (offset == 0 || offset > o) return false;
+    intptr_t match_length = token & 0xf;
+    if (match_length == 15 && !ReadLength(src, src_size, &i, &match_length)) {
+      return false;
+    }
+    match_length += kMinMatch;
+    if (match_length > dst_size - o) return false;
+    const uint8_t* match = dst + o - offset;
+    if (offset >= match_length) {
+      memcpy(dst + o, match, match_length);  // NOLINT
+    } else {
+      // Overlapping matches repeat the last |offset| bytes.
+      for (intptr_t j = 0; j < match_length; j++) {
+        dst[o + j] = match[j];
+      }
+    }
+    o += match_length;
+  }
+  return o == dst_size;
+}
+
+}  // namespace dart
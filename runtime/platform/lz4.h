@@ -0,0 +1,44 @@
+// Copyright (c) 2024, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+#ifndef RUNTIME_PLATFORM_LZ4_H_
+#define RUNTIME_PLATFORM_LZ4_H_
+
+#include "platform/allocation.h"
+#include "platform/globals.h"
+
+namespace dart {
+
+// Compression and decompression of data in the LZ4 block format.
+//
+// The compressor is a simple greedy one which favors speed of decompression
+// over compression ratio. It is used for data which is compressed once when
+// building a snapshot and decompressed whenever the snapshot is loaded.
+class Lz4 : public AllStatic {
+ public:
+  // Offsets of matches are stored in 16 bits, so compressing inputs in
+  // frames of at most this size loses little.
+  static constexpr intptr_t kMaxDistance = 0xffff;
+
+  // The maximum size of the compressed form of |size| bytes.
+  static intptr_t MaxCompressedSize(intptr_t size) {
+    return size + size / 255 + 16;
+  }
+
+  // Compresses |size| bytes at |src| into |dst|, which must have room for
+  // MaxCompressedSize(size) bytes. Returns the size of the compressed data.
+  static intptr_t Compress(const uint8_t* src, intptr_t size, uint8_t* dst);
+
+  // Decompresses |src_size| bytes at |src| into the |dst_size| bytes at
+  // |dst|. Returns false if the input is malformed or does not decompress to
+  // exactly |dst_size| bytes.
+  static bool Decompress(const uint8_t* src,
+                         intptr_t src_size,
+                         uint8_t* dst,
+                         intptr_t dst_size);
+};
+
+}  // namespace dart
+
+#endif  // RUNTIME_PLATFORM_LZ4_H_
@@ -76,6 +76,12 @@ class TextBuffer : public BaseTextBuffer {
   // NOTE: TextBuffer is empty afterwards.
   char* Steal();
 
+  // Grows the buffer so that at least |len| more characters fit.
+  void Reserve(intptr_t len) {
+    EnsureCapacity(len);
+    buffer_[length_] = '\0';
+  }
+
  private:
   bool EnsureCapacity(intptr_t len);
 
@@ -263,6 +263,97 @@ bool Utf8::DecodeToUTF32(const uint8_t* utf8_array,
   return true;  // Success.
 }
 
+template <typename CodeUnit>
+static bool DecodeWellFormed(const uint8_t* utf8_array,
+                             intptr_t array_len,
+                             CodeUnit* dst,
+                             intptr_t len) {
+  const uint8_t* src = utf8_array;
+  const uint8_t* const src_end = utf8_array + array_len;
+  CodeUnit* const dst_end = dst + len;
+  while (src < src_end) {
+    // Copy ASCII a word at a time.
+    while ((src_end - src) >= 8 && (dst_end - dst) >= 8) {
+      uint64_t word;
+      memcpy(&word, src, sizeof(word));
+      if ((word & 0x8080808080808080ULL) != 0) break;
+      for (intptr_t i = 0; i < 8; i++) {
+        dst[i] = src[i];
+      }
+      src += 8;
+      dst += 8;
+    }
+    if (dst == dst_end) {
+      return false;  // Output overflow.
+    }
+    uint32_t ch = *src++;
+    if (ch <= Utf8::kMaxOneByteChar) {
+      *dst++ = ch;
+      continue;
+    }
+    intptr_t num_trail_bytes;
+    uint32_t min;
+    if ((ch & 0xE0) == 0xC0) {
+      num_trail_bytes = 1;
+      ch &= 0x1F;
+      min = Utf8::kMaxOneByteChar + 1;
+    } else if ((ch & 0xF0) == 0xE0) {
+      num_trail_bytes = 2;
+      ch &= 0x0F;
+      min = Utf8::kMaxTwoByteChar + 1;
+    } else if ((ch & 0xF8) == 0xF0) {
+      num_trail_bytes = 3;
+      ch &= 0x07;
+      min = Utf8::kMaxThreeByteChar + 1;
+    } else {
+      return false;  // Invalid lead byte.
+    }
+    if ((src_end - src) < num_trail_bytes) {
+      return false;  // Unfinished sequence.
+    }
+    for (intptr_t i = 0; i < num_trail_bytes; i++) {
+      const uint8_t code_unit = *src++;
+      if ((code_unit & 0xC0) != 0x80) {
+        return false;  // Invalid trail byte.
+      }
+      ch = (ch << 6) | (code_unit & 0x3F);
+    }
+    if ((ch < min) || (ch > static_cast<uint32_t>(Utf::kMaxCodePoint)) ||
+        Utf16::IsSurrogate(ch)) {
+      return false;  // Overlong, out of range or surrogate.
+    }
+    if (ch <= Utf16::kMaxCodeUnit) {
+      if ((sizeof(CodeUnit) == 1) && !Utf::IsLatin1(ch)) {
+        return false;  // Not representable.
+      }
+      *dst++ = ch;
+    } else {
+      if ((sizeof(CodeUnit) == 1) || ((dst_end - dst) < 2)) {
+        return false;  // Not representable or output overflow.
+      }
+      uint16_t pair[2];
+      Utf16::Encode(ch, pair);
+      *dst++ = pair[0];
+      *dst++ = pair[1];
+    }
+  }
+  return dst == dst_end;
+}
+
+bool Utf8::DecodeWellFormedToLatin1(const uint8_t* utf8_array,
+                                    intptr_t array_len,
+                                    uint8_t* dst,
+                                    intptr_t len) {
+  return DecodeWellFormed(utf8_array, array_len, dst, len);
+}
+
+bool Utf8::DecodeWellFormedToUTF16(const uint8_t* utf8_array,
+                                   intptr_t array_len,
+                                   uint16_t* dst,
+                                   intptr_t len) {
+  return DecodeWellFormed(utf8_array, array_len, dst, len);
+}
+
 bool Utf8::DecodeCStringToUTF32(const char* str, int32_t* dst, intptr_t len) {
   ASSERT(str != nullptr);
   intptr_t array_len = strlen(str);
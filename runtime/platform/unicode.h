@@ -78,6 +78,19 @@ class Utf8 : AllStatic {
                             intptr_t array_len,
                             int32_t* dst,
                             intptr_t len);
+
+  // Strict variants of DecodeToLatin1 and DecodeToUTF16 which decode
+  // exactly |len| code units. Unlike Decode they also reject encoded
+  // surrogates, so that they accept exactly the input accepted by the
+  // dart:convert UTF-8 decoder. Runs of ASCII are copied a word at a time.
+  static bool DecodeWellFormedToLatin1(const uint8_t* utf8_array,
+                                       intptr_t array_len,
+                                       uint8_t* dst,
+                                       intptr_t len);
+  static bool DecodeWellFormedToUTF16(const uint8_t* utf8_array,
+                                      intptr_t array_len,
+                                      uint16_t* dst,
+                                      intptr_t len);
   static intptr_t ReportInvalidByte(const uint8_t* utf8_array,
                                     intptr_t array_len,
                                     intptr_t len);
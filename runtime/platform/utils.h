@@ -216,6 +216,13 @@ class Utils {
     return (value == 0) ? 0 : (Utils::HighestBit(value) + 1);
   }
 
+  // Hints that the cache line containing 'address' will soon be read.
+  static inline void PrefetchForRead(const void* address) {
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(address, /*rw=*/0, /*locality=*/3);
+#endif
+  }
+
   static int CountLeadingZeros32(uint32_t x) {
 #if defined(DART_HOST_OS_WINDOWS)
     unsigned long position;  // NOLINT
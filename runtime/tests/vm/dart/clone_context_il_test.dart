@@ -0,0 +1,39 @@
+// Copyright (c) 2024, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+// Verifies that in AOT mode contexts holding captured loop variables are
+// copied with explicit loads and stores instead of CloneContext, so that
+// the copies are visible to load forwarding and allocation sinking.
+
+import 'package:expect/expect.dart';
+import 'package:vm/testing/il_matchers.dart';
+
+@pragma('vm:never-inline')
+int run(int Function() fn) => fn();
+
+@pragma('vm:never-inline')
+@pragma('vm:testing:print-flow-graph')
+int sumCaptured(int n) {
+  int total = 0;
+  for (int i = 0; i < n; i++) {
+    total += run(() => i * 2);
+  }
+  return total;
+}
+
+void matchIL$sumCaptured(FlowGraph graph) {
+  graph.dump();
+  for (var block in graph.blocks()) {
+    for (var instr in [...?block['is']]) {
+      if (instr['o'] == 'CloneContext') {
+        throw 'Unexpected CloneContext in block '
+            '${PrettyPrinter.blockName(block)}';
+      }
+    }
+  }
+}
+
+void main() {
+  Expect.equals(90, sumCaptured(10));
+}
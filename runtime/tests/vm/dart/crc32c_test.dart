@@ -0,0 +1,53 @@
+// Copyright (c) 2024, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+// Tests the CRC-32C checksum helper in dart:_internal.
+
+import 'dart:_internal' show crc32c;
+import 'dart:typed_data';
+
+import 'package:expect/expect.dart';
+
+// Bitwise reference implementation.
+int referenceCrc32c(int crc, List<int> data, int start, int end) {
+  crc = ~crc & 0xffffffff;
+  for (int i = start; i < end; i++) {
+    crc ^= data[i];
+    for (int j = 0; j < 8; j++) {
+      crc = (crc >> 1) ^ ((crc & 1) != 0 ? 0x82f63b78 : 0);
+    }
+  }
+  return ~crc & 0xffffffff;
+}
+
+main() {
+  final check = Uint8List.fromList('123456789'.codeUnits);
+  Expect.equals(0xe3069283, crc32c(0, check, 0, check.length));
+  Expect.equals(0, crc32c(0, check, 3, 3));
+
+  // Checksums can be computed incrementally.
+  Expect.equals(0xe3069283, crc32c(crc32c(0, check, 0, 5), check, 5, 9));
+
+  final data = Uint8List(300000);
+  for (int i = 0; i < data.length; i++) {
+    data[i] = (i * 7 + (i >> 8)) & 0xff;
+  }
+  for (int start = 0; start < 16; start++) {
+    for (int end = start; end < start + 40; end += 3) {
+      Expect.equals(referenceCrc32c(0, data, start, end),
+          crc32c(0, data, start, end));
+    }
+  }
+  // Spans several chunks between safepoint checks.
+  Expect.equals(referenceCrc32c(0, data, 1, data.length),
+      crc32c(0, data, 1, data.length));
+
+  // Views.
+  final view = Uint8List.sublistView(data, 10, 100);
+  Expect.equals(
+      referenceCrc32c(0, data, 10, 100), crc32c(0, view, 0, view.length));
+
+  Expect.throwsRangeError(() => crc32c(0, check, 0, check.length + 1));
+  Expect.throwsRangeError(() => crc32c(0, check, 5, 4));
+}
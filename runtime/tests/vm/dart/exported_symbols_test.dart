@@ -86,6 +86,7 @@ main() {
     "Dart_DebugNameToCString",
     "Dart_DeferredLoadComplete",
     "Dart_DeferredLoadCompleteError",
+    "Dart_DeferredLoadPrefetch",
     "Dart_DeleteFinalizableHandle",
     "Dart_DeletePersistentHandle",
     "Dart_DeleteWeakPersistentHandle",
@@ -126,6 +127,7 @@ main() {
     "Dart_GetNativeFieldsOfArgument",
     "Dart_GetNativeInstanceField",
     "Dart_GetNativeInstanceFieldCount",
+    "Dart_GetNativeInstanceFields",
     "Dart_GetNativeIntegerArgument",
     "Dart_GetNativeIsolateGroupData",
     "Dart_GetNativeReceiver",
@@ -125,6 +125,19 @@ final sharableObjects = [
     ),
     somePointer: Pointer.fromAddress(0xdeadbeef),
   ),
+
+  // Records and unmodifiable lists which only refer to sharable objects.
+  (int.parse('1'), 'foo', 1.5),
+  (a: 1, b: ('bar', (2, const [1]))),
+  List<Object>.unmodifiable([1, 'baz', (3, 4)]),
+];
+
+// Records and unmodifiable lists referring to mutable objects have to be
+// copied.
+final copyableImmutableContainers = <dynamic>[
+  (1, <int>[2]),
+  (1, ('foo', Object())),
+  List<Object>.unmodifiable([1, <int>[2]]),
 ];
 
 final copyableClosures = <dynamic>[
@@ -157,6 +170,7 @@ class SendReceiveTest extends SendReceiveTestBase {
     await testSharable();
     await testSharable2();
     await testCopyableClosures();
+    await testCopyableImmutableContainers();
     await testSharableTypedData();
   }
 
@@ -206,6 +220,18 @@ class SendReceiveTest extends SendReceiveTestBase {
     }
   }
 
+  Future testCopyableImmutableContainers() async {
+    print('testCopyableImmutableContainers');
+    final copy = await sendReceive([
+      ...copyableImmutableContainers,
+    ]);
+    for (int i = 0; i < copyableImmutableContainers.length; ++i) {
+      Expect.notIdentical(copyableImmutableContainers[i], copy[i]);
+      Expect.equals(
+          copyableImmutableContainers[i].runtimeType, copy[i].runtimeType);
+    }
+  }
+
   Future testSharableTypedData() async {
     print('testSharableTypedData');
     const int Dart_TypedData_kUint8 = 2;
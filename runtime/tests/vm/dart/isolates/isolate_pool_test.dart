@@ -0,0 +1,36 @@
+// Copyright (c) 2024, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+// VMOptions=--isolate-pool-size=0
+// VMOptions=--isolate-pool-size=2
+
+import 'dart:isolate';
+
+import 'package:expect/expect.dart';
+
+int counter = 0;
+
+// Each spawned isolate has to start with fresh static state, whether it was
+// created on demand or taken from the pool.
+int incrementCounter(String name) {
+  counter++;
+  Expect.equals(name, Isolate.current.debugName);
+  return counter;
+}
+
+main() async {
+  for (int i = 0; i < 20; i++) {
+    final name = 'run-$i';
+    final result =
+        await Isolate.run(() => incrementCounter(name), debugName: name);
+    Expect.equals(1, result);
+  }
+
+  final results = await Future.wait([
+    for (int i = 0; i < 10; i++)
+      Isolate.run(() => incrementCounter('parallel'), debugName: 'parallel'),
+  ]);
+  Expect.listEquals(List.filled(10, 1), results);
+  Expect.equals(0, counter);
+}
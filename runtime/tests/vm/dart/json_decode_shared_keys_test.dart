@@ -0,0 +1,34 @@
+// Copyright (c) 2024, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+//
+// Verifies that the VM's JSON decoder shares the key strings of objects with
+// the same property names, both for string and UTF-8 input.
+
+import 'dart:convert';
+
+import 'package:expect/expect.dart';
+
+void checkSharedKeys(List<Object?> decoded) {
+  final first = decoded[0] as Map<String, dynamic>;
+  final second = decoded[1] as Map<String, dynamic>;
+  Expect.mapEquals({'id': 1, 'näme': 'a'}, first);
+  Expect.mapEquals({'id': 2, 'näme': 'b'}, second);
+  final firstKeys = first.keys.toList();
+  final secondKeys = second.keys.toList();
+  for (int i = 0; i < firstKeys.length; i++) {
+    Expect.isTrue(identical(firstKeys[i], secondKeys[i]));
+  }
+}
+
+void main() {
+  const input = '[{"id": 1, "näme": "a"}, {"id": 2, "näme": "b"}]';
+  checkSharedKeys(jsonDecode(input) as List<Object?>);
+  checkSharedKeys(
+      json.fuse(utf8).decode(utf8.encode(input)) as List<Object?>);
+
+  // Inputs with many distinct keys still decode correctly once the key cache
+  // is full.
+  final many = {for (int i = 0; i < 1000; i++) 'key$i': i};
+  Expect.mapEquals(many, jsonDecode(jsonEncode(many)));
+}
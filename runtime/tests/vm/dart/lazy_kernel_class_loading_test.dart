@@ -0,0 +1,53 @@
+// Copyright (c) 2024, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+// VMOptions=--lazy-kernel-class-loading
+// Tests that classes whose declarations are loaded on first use behave like
+// classes which are loaded eagerly.
+
+import "package:expect/expect.dart";
+
+abstract interface class Shape {
+  double get area;
+}
+
+class Rectangle implements Shape {
+  final double width;
+  final double height;
+  const Rectangle(this.width, this.height);
+  double get area => width * height;
+}
+
+class Square extends Rectangle {
+  const Square(double side) : super(side, side);
+}
+
+class Box<T> {
+  final T value;
+  Box(this.value);
+}
+
+enum Color { red, green }
+
+class Unused {
+  static int counter = 0;
+}
+
+const Shape kUnit = Square(1.0);
+
+main() {
+  Expect.equals(1.0, kUnit.area);
+  Expect.isTrue(kUnit is Rectangle);
+  Expect.equals(6.0, Rectangle(2.0, 3.0).area);
+
+  final Object box = Box<Shape>(Square(2.0));
+  Expect.isTrue(box is Box<Object>);
+  Expect.isFalse(box is Box<Rectangle>);
+  Expect.equals(4.0, (box as Box<Shape>).value.area);
+
+  Expect.equals(2, Color.values.length);
+  Expect.equals("green", Color.green.name);
+
+  Expect.equals(0, Unused.counter++);
+  Expect.equals(1, Unused.counter);
+}
@@ -0,0 +1,34 @@
+// Copyright (c) 2024, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+// Verifies that pow with a constant exponent of 2.0 is replaced with a
+// multiplication instead of calling into the C library.
+
+import 'dart:math' as math;
+
+import 'package:expect/expect.dart';
+import 'package:vm/testing/il_matchers.dart';
+
+@pragma('vm:never-inline')
+@pragma('vm:testing:print-flow-graph')
+double square(double x) => math.pow(x, 2.0) as double;
+
+void matchIL$square(FlowGraph graph) {
+  for (var block in graph.blocks()) {
+    for (var instr in [...?block['is']]) {
+      if (instr['o'] == 'InvokeMathCFunction') {
+        throw 'Unexpected InvokeMathCFunction in block '
+            '${PrettyPrinter.blockName(block)}';
+      }
+    }
+  }
+}
+
+void main(List<String> args) {
+  final x = args.isEmpty ? 1.5 : double.parse(args.first);
+  Expect.equals(2.25, square(x));
+  Expect.equals(double.infinity, square(-double.infinity));
+  Expect.isTrue(square(double.nan).isNaN);
+  Expect.identical(0.0, square(-0.0));
+}
@@ -0,0 +1,57 @@
+// Copyright (c) 2024, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+// Tests that printing stack traces which share frames, which AOT serves from
+// a cache of symbolized frames, keeps the frame indices and positions right.
+
+import "package:expect/expect.dart";
+
+@pragma('vm:never-inline')
+void thrower(int depth) {
+  if (depth > 0) return thrower(depth - 1);
+  throw 'thrown'; // Line 12.
+}
+
+@pragma('vm:prefer-inline')
+void inlinedCaller(int depth) => thrower(depth);
+
+StackTrace traceAt(int depth) {
+  try {
+    inlinedCaller(depth);
+  } catch (e, st) {
+    return st;
+  }
+  throw 'unreachable';
+}
+
+// Returns the frames of |trace| without their indices.
+List<String> framesOf(StackTrace trace) => trace
+    .toString()
+    .split('\n')
+    .where((line) => line.startsWith('#'))
+    .map((line) => line.substring(line.indexOf(' ')).trim())
+    .toList();
+
+main() {
+  for (var i = 0; i < 3; i++) {
+    final shallow = traceAt(0).toString();
+    Expect.equals(shallow, traceAt(0).toString());
+    Expect.isTrue(shallow.startsWith('#0'), shallow);
+    Expect.isTrue(
+        shallow.contains('repeated_stacktrace_to_string_test.dart:12'),
+        shallow);
+  }
+
+  final shallow = framesOf(traceAt(0));
+  final deep = framesOf(traceAt(3));
+  Expect.equals(shallow.length + 3, deep.length);
+  Expect.equals(shallow.first, deep.first);
+  // Callers of thrower up to the different call sites in main.
+  Expect.equals(shallow[1], deep[4]);
+  Expect.equals(shallow[2], deep[5]);
+
+  final lines = traceAt(3).toString().split('\n');
+  for (var i = 0; i < deep.length; i++) {
+    Expect.isTrue(lines[i].startsWith('#$i '), lines[i]);
+  }
+}
@@ -22,6 +22,7 @@
 #include "vm/growable_array.h"
 #include "vm/heap/heap.h"
 #include "vm/image_snapshot.h"
+#include "vm/json_writer.h"
 #include "vm/native_entry.h"
 #include "vm/object.h"
 #include "vm/object_store.h"
@@ -29,6 +30,7 @@
 #include "vm/raw_object_fields.h"
 #include "vm/stub_code.h"
 #include "vm/symbols.h"
+#include "vm/thread_pool.h"
 #include "vm/timeline.h"
 #include "vm/v8_snapshot_writer.h"
 #include "vm/version.h"
@@ -49,11 +51,27 @@ DEFINE_FLAG(bool,
             "Print information about clusters written to snapshot");
 #endif
 
+DEFINE_FLAG(int,
+            snapshot_fill_tasks,
+            2,
+            "Number of helper threads which initialize deserialized objects "
+            "in parallel with the loading thread (0 disables).");
+DEFINE_FLAG(bool,
+            print_snapshot_load_times,
+            false,
+            "Print the time spent deserializing each cluster of a snapshot "
+            "in JSON format.");
+
 #if defined(DART_PRECOMPILER)
 DEFINE_FLAG(charp,
             write_v8_snapshot_profile_to,
             nullptr,
             "Write a snapshot profile in V8 format to a file.");
+DEFINE_FLAG(charp,
+            write_snapshot_size_report_to,
+            nullptr,
+            "Write the size of each cluster of the program snapshot and the "
+            "code size of each library and class to a file in JSON format.");
 DEFINE_FLAG(bool,
             print_array_optimization_candidates,
             false,
@@ -233,6 +251,10 @@ class DeserializationCluster : public ZoneAllocated {
   // Initialize the cluster's objects. Do not touch the memory of other objects.
   virtual void ReadFill(Deserializer* deserializer) = 0;
 
+  // Whether ReadFill only reads the stream and the ref array, so that it can
+  // run on a helper thread concurrently with ReadFill of other clusters.
+  virtual bool CanFillConcurrently() const { return false; }
+
   // Complete any action that requires the full graph to be deserialized, such
   // as rehashing.
   virtual void PostLoad(Deserializer* deserializer, const Array& refs) {
@@ -248,6 +270,7 @@ class DeserializationCluster : public ZoneAllocated {
 
   const char* name() const { return name_; }
   bool is_canonical() const { return is_canonical_; }
+  intptr_t num_objects() const { return stop_index_ - start_index_; }
 
  protected:
   void ReadAllocFixedSize(Deserializer* deserializer, intptr_t instance_size);
@@ -258,6 +281,11 @@ class DeserializationCluster : public ZoneAllocated {
   // The range of the ref array that belongs to this cluster.
   intptr_t start_index_;
   intptr_t stop_index_;
+  // Recorded with --print_snapshot_load_times.
+  int64_t alloc_micros_ = 0;
+  int64_t fill_micros_ = 0;
+
+  friend class Deserializer;
 };
 
 class SerializationRoots {
@@ -353,6 +381,7 @@ class Serializer : public ThreadStackResource {
 
   ZoneGrowableArray<Object*>* Serialize(SerializationRoots* roots);
   void PrintSnapshotSizes();
+  void WriteSizeReport();
 
   NonStreamingWriteStream* stream() { return stream_; }
   intptr_t bytes_written() { return stream_->bytes_written(); }
@@ -585,7 +614,7 @@ class Serializer : public ThreadStackResource {
   }
 
  private:
-  const char* ReadOnlyObjectType(intptr_t cid);
+  const char* ReadOnlyObjectType(intptr_t cid, bool is_canonical);
   void FlushProfile();
 
   Heap* heap_;
@@ -672,6 +701,9 @@ class Deserializer : public ThreadStackResource {
                const uint8_t* instructions_buffer,
                bool is_non_root_unit,
                intptr_t offset = 0);
+  // Creates a deserializer on a helper thread which fills clusters of
+  // |parent| concurrently with it.
+  Deserializer(Thread* thread, const Deserializer& parent);
   ~Deserializer();
 
   // Verifies the image alignment.
@@ -761,6 +793,9 @@ class Deserializer : public ThreadStackResource {
 
   DeserializationCluster* ReadCluster();
 
+  // Fills the cluster whose fill data is at [start, end) of the stream.
+  void ReadFill(DeserializationCluster* cluster, intptr_t start, intptr_t end);
+
   void ReadDispatchTable() {
     ReadDispatchTable(&stream_, /*deferred=*/false, InstructionsTable::Handle(),
                       -1, -1);
@@ -854,6 +889,10 @@ class Deserializer : public ThreadStackResource {
   };
 
  private:
+  // Fills all clusters, concurrently on helper threads if possible.
+  void ReadFill();
+  void PrintLoadTimes() const;
+
   Heap* heap_;
   PageSpace* old_space_;
   FreeList* freelist_;
@@ -1577,6 +1616,8 @@ class TypeArgumentsDeserializationCluster
     BuildCanonicalSetFromLayout(d);
   }
 
+  bool CanFillConcurrently() const override { return true; }
+
   void ReadFill(Deserializer* d_) override {
     Deserializer::Local d(d_);
 
@@ -1682,6 +1723,15 @@ class PatchClassDeserializationCluster : public DeserializationCluster {
   }
 };
 
+#if !defined(DART_PRECOMPILED_RUNTIME)
+// State bits of functions which describe the feedback of a training run and
+// are kept in app-JIT snapshots.
+static constexpr int8_t kPersistedFunctionStateBits =
+    Function::WasExecutedBitBit::mask_in_place() |
+    Function::ProhibitsInstructionHoistingBit::mask_in_place() |
+    Function::ProhibitsBoundsCheckGeneralizationBit::mask_in_place();
+#endif  // !defined(DART_PRECOMPILED_RUNTIME)
+
 #if !defined(DART_PRECOMPILED_RUNTIME)
 class FunctionSerializationCluster : public SerializationCluster {
  public:
@@ -1771,6 +1821,15 @@ class FunctionSerializationCluster : public SerializationCluster {
         s->Write<uint32_t>(func->untag()->packed_fields_);
       }
       s->Write<uint32_t>(func->untag()->kind_tag_);
+      if (kind == Snapshot::kFullJIT) {
+        // Keep the feedback of the training run so that functions which were
+        // hot but not yet optimized do not have to warm up again, and
+        // functions which deoptimized repeatedly are not optimized again.
+        s->Write<int32_t>(func->untag()->usage_counter_);
+        s->Write<int8_t>(func->untag()->deoptimization_counter_);
+        s->Write<int8_t>(func->untag()->state_bits_ &
+                         kPersistedFunctionStateBits);
+      }
     }
   }
 
@@ -1945,6 +2004,22 @@ class FunctionDeserializationCluster : public DeserializationCluster {
       func->untag()->deoptimization_counter_ = 0;
       func->untag()->state_bits_ = 0;
       func->untag()->inlining_depth_ = 0;
+      if (kind == Snapshot::kFullJIT) {
+        const int32_t usage_counter = d.Read<int32_t>();
+        const int8_t deoptimization_counter = d.Read<int8_t>();
+        const int8_t state_bits = d.Read<int8_t>();
+        // The counters are only trusted if the optimization thresholds used by
+        // this VM would let them take effect.
+        if (FLAG_optimization_counter_threshold >= 0) {
+          func->untag()->usage_counter_ = Utils::Minimum<int32_t>(
+              Utils::Maximum<int32_t>(usage_counter, 0),
+              FLAG_optimization_counter_threshold);
+        }
+        if (deoptimization_counter >= 0) {
+          func->untag()->deoptimization_counter_ = deoptimization_counter;
+        }
+        func->untag()->state_bits_ = state_bits & kPersistedFunctionStateBits;
+      }
 #endif
     }
   }
@@ -2227,6 +2302,8 @@ class FieldDeserializationCluster : public DeserializationCluster {
     ReadAllocFixedSize(d, Field::InstanceSize());
   }
 
+  bool CanFillConcurrently() const override { return true; }
+
   void ReadFill(Deserializer* d_) override {
     Deserializer::Local d(d_);
 
@@ -3116,7 +3193,9 @@ class CodeDeserializationCluster : public DeserializationCluster {
 #endif
     for (intptr_t id = start_index_, n = stop_index_; id < n; id++) {
       code ^= refs.At(id);
-#if !defined(DART_PRECOMPILED_RUNTIME) && !defined(PRODUCT)
+#if !defined(PRODUCT)
+      // In the precompiled runtime this reports the snapshot's instructions
+      // to observers such as the perf map writer as soon as they are loaded.
       if (CodeObservers::AreActive()) {
         Code::NotifyCodeObservers(code, code.is_optimized());
       }
@@ -3895,6 +3974,8 @@ class ContextDeserializationCluster : public DeserializationCluster {
     stop_index_ = d->next_index();
   }
 
+  bool CanFillConcurrently() const override { return true; }
+
   void ReadFill(Deserializer* d_) override {
     Deserializer::Local d(d_);
 
@@ -4608,6 +4689,8 @@ class InstanceDeserializationCluster
     stop_index_ = d->next_index();
   }
 
+  bool CanFillConcurrently() const override { return true; }
+
   void ReadFill(Deserializer* d_) override {
     Deserializer::Local d(d_);
 
@@ -4818,6 +4901,8 @@ class TypeDeserializationCluster
     BuildCanonicalSetFromLayout(d);
   }
 
+  bool CanFillConcurrently() const override { return true; }
+
   void ReadFill(Deserializer* d_) override {
     Deserializer::Local d(d_);
 
@@ -4932,6 +5017,8 @@ class FunctionTypeDeserializationCluster
     BuildCanonicalSetFromLayout(d);
   }
 
+  bool CanFillConcurrently() const override { return true; }
+
   void ReadFill(Deserializer* d_) override {
     Deserializer::Local d(d_);
 
@@ -5045,6 +5132,8 @@ class RecordTypeDeserializationCluster
     BuildCanonicalSetFromLayout(d);
   }
 
+  bool CanFillConcurrently() const override { return true; }
+
   void ReadFill(Deserializer* d_) override {
     Deserializer::Local d(d_);
 
@@ -5159,6 +5248,8 @@ class TypeParameterDeserializationCluster
     BuildCanonicalSetFromLayout(d);
   }
 
+  bool CanFillConcurrently() const override { return true; }
+
   void ReadFill(Deserializer* d_) override {
     Deserializer::Local d(d_);
 
@@ -5260,6 +5351,8 @@ class ClosureDeserializationCluster
     ReadAllocFixedSize(d, Closure::InstanceSize());
   }
 
+  bool CanFillConcurrently() const override { return true; }
+
   void ReadFill(Deserializer* d_) override {
     Deserializer::Local d(d_);
 
@@ -5645,6 +5738,8 @@ class RecordDeserializationCluster
     stop_index_ = d->next_index();
   }
 
+  bool CanFillConcurrently() const override { return true; }
+
   void ReadFill(Deserializer* d_) override {
     Deserializer::Local d(d_);
 
@@ -6496,6 +6591,8 @@ class ArrayDeserializationCluster
     stop_index_ = d->next_index();
   }
 
+  bool CanFillConcurrently() const override { return true; }
+
   void ReadFill(Deserializer* d_) override {
     Deserializer::Local d(d_);
 
@@ -6709,6 +6806,8 @@ class StringDeserializationCluster
     BuildCanonicalSetFromLayout(d);
   }
 
+  bool CanFillConcurrently() const override { return true; }
+
   void ReadFill(Deserializer* d_) override {
     Deserializer::Local d(d_);
 
@@ -7802,7 +7901,8 @@ intptr_t Serializer::UnsafeRefId(ObjectPtr object) const {
   FATAL("Reference for object %s is unallocated", handle.ToCString());
 }
 
-const char* Serializer::ReadOnlyObjectType(intptr_t cid) {
+const char* Serializer::ReadOnlyObjectType(intptr_t cid,
+                                           bool is_canonical) {
   switch (cid) {
     case kPcDescriptorsCid:
       return "PcDescriptors";
@@ -7822,6 +7922,13 @@ const char* Serializer::ReadOnlyObjectType(intptr_t cid) {
       return current_loading_unit_id_ <= LoadingUnit::kRootId
                  ? "TwoByteStringCid"
                  : nullptr;
+    case kDoubleCid:
+      // Canonical doubles are never mutated, but JIT snapshots may contain
+      // boxes which unboxed field stores write into.
+      return kind_ == Snapshot::kFullAOT && is_canonical &&
+                     current_loading_unit_id_ <= LoadingUnit::kRootId
+                 ? "CanonicalDouble"
+                 : nullptr;
     default:
       return nullptr;
   }
@@ -7858,7 +7965,7 @@ SerializationCluster* Serializer::NewClusterForClass(intptr_t cid,
   // the memory image, and it might be outside the 4GB region addressable by
   // compressed pointers.
   if (Snapshot::IncludesCode(kind_)) {
-    if (auto const type = ReadOnlyObjectType(cid)) {
+    if (auto const type = ReadOnlyObjectType(cid, is_canonical)) {
       return new (Z) RODataSerializationCluster(Z, type, cid, is_canonical);
     }
   }
@@ -8170,7 +8277,8 @@ void Serializer::PrepareInstructions(
     //    - a binary search table mapping an Instructions entry point to its
     //      stack maps (by offset from the beginning of the Data object);
     //    - followed by stack maps bytes;
-    //    - followed by canonical stack map entries.
+    //    - followed by canonical stack map entries;
+    //    - followed by the lookup index narrowing down the binary search.
     //
     struct StackMapInfo : public ZoneAllocated {
       CompressedStackMapsPtr map;
@@ -8283,6 +8391,7 @@ void Serializer::PrepareInstructions(
 
     // Now that we have offsets to all stack maps we can write binary
     // search table.
+    GrowableArray<uint32_t> entry_offsets(total);
     pc_mapping.SetPosition(
         sizeof(UntaggedInstructionsTable::Data));  // Skip the header.
     for (auto& cmd : writer_commands) {
@@ -8297,11 +8406,34 @@ void Serializer::PrepareInstructions(
 
         pc_mapping.WriteFixed<UntaggedInstructionsTable::DataEntry>(
             {static_cast<uint32_t>(entry), offset});
+        entry_offsets.Add(static_cast<uint32_t>(entry));
       }
     }
     // Restore position so that Steal does not truncate the buffer.
     pc_mapping.SetPosition(total_bytes);
 
+    // Write the lookup index: for every bucket of instructions the index of
+    // the last entry starting at or before the start of the bucket.
+    {
+      using Data = UntaggedInstructionsTable::Data;
+      pc_mapping.Align(sizeof(uint32_t));
+      auto header = reinterpret_cast<Data*>(pc_mapping.buffer());
+      header->lookup_index_offset = pc_mapping.bytes_written();
+      const uint32_t bucket_count =
+          (entry_offsets.Last() >> Data::kLookupBucketBits) + 1;
+      pc_mapping.WriteFixed<uint32_t>(bucket_count);
+      intptr_t entry = 0;
+      for (uint32_t bucket = 0; bucket < bucket_count; bucket++) {
+        const uint32_t bucket_start = bucket << Data::kLookupBucketBits;
+        while (entry + 1 < entry_offsets.length() &&
+               entry_offsets[entry + 1] <= bucket_start) {
+          entry++;
+        }
+        pc_mapping.WriteFixed<uint32_t>(entry);
+      }
+      pc_mapping.WriteFixed<uint32_t>(entry_offsets.length() - 1);
+    }
+
     intptr_t length = 0;
     uint8_t* bytes = pc_mapping.Steal(&length);
 
@@ -8709,12 +8841,32 @@ ZoneGrowableArray<Object*>* Serializer::Serialize(SerializationRoots* roots) {
   }
 #endif
 
+  // The fill section starts with the size of each cluster's fill data, so
+  // that the deserializer can fill clusters in parallel. The sizes are
+  // written once the fill data is known.
+  const intptr_t fill_sizes_position = bytes_written();
+  for (intptr_t i = 0; i < clusters.length(); i++) {
+    stream_->WriteFixed<uint32_t>(0);
+  }
+  GrowableArray<uint32_t> fill_sizes(clusters.length());
   for (SerializationCluster* cluster : clusters) {
+    const intptr_t start = bytes_written();
     cluster->WriteAndMeasureFill(this);
 #if defined(DEBUG)
     Write<int32_t>(kSectionMarker);
 #endif
+    const intptr_t size = bytes_written() - start;
+    if (!Utils::IsUint(32, size)) {
+      FATAL("Fill data of cluster %s is too large", cluster->name());
+    }
+    fill_sizes.Add(static_cast<uint32_t>(size));
   }
+  const intptr_t fill_end_position = bytes_written();
+  stream_->SetPosition(fill_sizes_position);
+  for (uint32_t size : fill_sizes) {
+    stream_->WriteFixed<uint32_t>(size);
+  }
+  stream_->SetPosition(fill_end_position);
 
   roots->WriteRoots(this);
 
@@ -8723,6 +8875,7 @@ ZoneGrowableArray<Object*>* Serializer::Serialize(SerializationRoots* roots) {
 #endif
 
   PrintSnapshotSizes();
+  WriteSizeReport();
 
   heap()->ResetObjectIdTable();
 
@@ -8948,6 +9101,131 @@ void Serializer::PrintSnapshotSizes() {
 #endif  // !defined(DART_PRECOMPILED_RUNTIME)
 }
 
+void Serializer::WriteSizeReport() {
+#if defined(DART_PRECOMPILER)
+  const char* filename = FLAG_write_snapshot_size_report_to;
+  // Only the root loading unit of the program snapshot is reported.
+  if (filename == nullptr || vm_ ||
+      current_loading_unit_id_ > LoadingUnit::kRootId) {
+    return;
+  }
+  if ((Dart::file_write_callback() == nullptr) ||
+      (Dart::file_open_callback() == nullptr) ||
+      (Dart::file_close_callback() == nullptr)) {
+    OS::PrintErr("warning: Could not access file callbacks.");
+    return;
+  }
+
+  JSONWriter js;
+  js.OpenObject();
+  js.PrintProperty("size", bytes_written() + GetDataSize() +
+                               (image_writer_ != nullptr
+                                    ? image_writer_->text_size()
+                                    : 0));
+  js.OpenArray("clusters");
+  for (intptr_t cid = 1; cid < num_cids_; cid++) {
+    for (auto const cluster :
+         {canonical_clusters_by_cid_[cid], clusters_by_cid_[cid]}) {
+      if (cluster == nullptr) continue;
+      js.OpenObject();
+      js.PrintProperty("name", cluster->name());
+      js.PrintProperty("cid", cluster->cid());
+      js.PrintPropertyBool("canonical", cluster->is_canonical());
+      js.PrintProperty("objects", cluster->num_objects());
+      js.PrintProperty("size", cluster->size());
+      js.PrintProperty("heapSize", cluster->target_memory_size());
+      js.CloseObject();
+    }
+  }
+  js.CloseArray();
+
+  // Attribute the instructions to the classes and libraries they belong to.
+  IntMap<intptr_t> class_sizes(zone_);
+  IntMap<intptr_t> library_sizes(zone_);
+  intptr_t other_size = 0;
+  if (image_writer_ != nullptr) {
+    auto& code = Code::Handle(zone_);
+    auto& owner = Object::Handle(zone_);
+    auto& cls = Class::Handle(zone_);
+    auto& lib = Library::Handle(zone_);
+    for (intptr_t i = 0; i < image_writer_->GetTextObjectCount(); i++) {
+      intptr_t size;
+      code = image_writer_->GetTextObject(i, &size);
+      owner = code.IsNull() ? Object::null() : code.owner();
+      if (owner.IsFunction()) {
+        cls = Function::Cast(owner).Owner();
+      } else if (owner.IsClass()) {
+        cls = Class::Cast(owner).ptr();
+      } else {
+        cls = Class::null();
+      }
+      lib = cls.IsNull() ? Library::null() : cls.library();
+      if (lib.IsNull()) {
+        other_size += size;
+        continue;
+      }
+      if (auto* pair = class_sizes.LookupPair(cls.id())) {
+        pair->value += size;
+      } else {
+        class_sizes.Insert(cls.id(), size);
+      }
+      if (auto* pair = library_sizes.LookupPair(lib.index())) {
+        pair->value += size;
+      } else {
+        library_sizes.Insert(lib.index(), size);
+      }
+    }
+  }
+
+  auto class_table = isolate_group()->class_table();
+  const auto& libraries = GrowableObjectArray::Handle(
+      zone_, isolate_group()->object_store()->libraries());
+  auto& cls = Class::Handle(zone_);
+  auto& lib = Library::Handle(zone_);
+  auto& url = String::Handle(zone_);
+  js.OpenArray("libraries");
+  {
+    auto it = library_sizes.GetIterator();
+    while (auto* pair = it.Next()) {
+      lib ^= libraries.At(pair->key);
+      url = lib.url();
+      js.OpenObject();
+      js.PrintProperty("url", url.ToCString());
+      js.PrintProperty("codeSize", pair->value);
+      js.CloseObject();
+    }
+  }
+  js.CloseArray();
+  js.OpenArray("classes");
+  {
+    auto it = class_sizes.GetIterator();
+    while (auto* pair = it.Next()) {
+      cls = class_table->At(pair->key);
+      lib = cls.library();
+      url = lib.url();
+      js.OpenObject();
+      js.PrintProperty("library", url.ToCString());
+      js.PrintProperty("name", cls.ScrubbedNameCString());
+      js.PrintProperty("codeSize", pair->value);
+      js.CloseObject();
+    }
+  }
+  js.CloseArray();
+  js.PrintProperty("otherCodeSize", other_size);
+  js.CloseObject();
+
+  void* file = Dart::file_open_callback()(filename, /*write=*/true);
+  if (file == nullptr) {
+    OS::PrintErr("warning: Failed to write snapshot size report: %s\n",
+                 filename);
+    return;
+  }
+  Dart::file_write_callback()(js.buffer()->buffer(), js.buffer()->length(),
+                              file);
+  Dart::file_close_callback()(file);
+#endif  // defined(DART_PRECOMPILER)
+}
+
 Deserializer::Deserializer(Thread* thread,
                            Snapshot::Kind kind,
                            const uint8_t* buffer,
@@ -8977,6 +9255,25 @@ Deserializer::Deserializer(Thread* thread,
   stream_.SetPosition(offset);
 }
 
+Deserializer::Deserializer(Thread* thread, const Deserializer& parent)
+    : ThreadStackResource(thread),
+      heap_(parent.heap_),
+      old_space_(parent.old_space_),
+      freelist_(parent.freelist_),
+      zone_(thread->zone()),
+      kind_(parent.kind_),
+      stream_(parent.stream_.buffer_,
+              parent.stream_.end_ - parent.stream_.buffer_),
+      image_reader_(parent.image_reader_),
+      num_base_objects_(parent.num_base_objects_),
+      num_objects_(parent.num_objects_),
+      num_clusters_(parent.num_clusters_),
+      refs_(parent.refs_),
+      next_ref_index_(parent.next_ref_index_),
+      clusters_(nullptr),
+      is_non_root_unit_(parent.is_non_root_unit_),
+      instructions_table_(InstructionsTable::Handle(thread->zone())) {}
+
 Deserializer::~Deserializer() {
   delete[] clusters_;
 }
@@ -9019,6 +9316,11 @@ DeserializationCluster* Deserializer::ReadCluster() {
           return new (Z) RODataDeserializationCluster(cid, is_canonical,
                                                       !is_non_root_unit_);
         }
+        break;      case kDoubleCid:
+        if (kind_ == Snapshot::kFullAOT && is_canonical && !is_non_root_unit_) {
+          return new (Z) RODataDeserializationCluster(cid, is_canonical,
+                                                      !is_non_root_unit_);
+        }
         break;
     }
   }
@@ -9514,6 +9816,184 @@ class HeapLocker : public StackResource {
   FreeList* freelist_;
 };
 
+void Deserializer::ReadFill(DeserializationCluster* cluster,
+                            intptr_t start,
+                            intptr_t end) {
+  TIMELINE_DURATION(thread(), Isolate, cluster->name());
+  const int64_t start_micros =
+      FLAG_print_snapshot_load_times ? OS::GetCurrentMonotonicMicros() : 0;
+  stream_.SetPosition(start);
+  cluster->ReadFill(this);
+#if defined(DEBUG)
+  int32_t section_marker = Read<int32_t>();
+  ASSERT(section_marker == kSectionMarker);
+#endif
+  ASSERT_EQUAL(stream_.Position(), end);
+  if (FLAG_print_snapshot_load_times) {
+    cluster->fill_micros_ = OS::GetCurrentMonotonicMicros() - start_micros;
+  }
+}
+
+// State shared by the threads which fill clusters concurrently.
+class ConcurrentFill {
+ public:
+  ConcurrentFill(DeserializationCluster** clusters,
+                 intptr_t num_clusters,
+                 const intptr_t* positions)
+      : clusters_(clusters),
+        num_clusters_(num_clusters),
+        positions_(positions) {}
+
+  // Fills clusters which can be filled concurrently until none are left.
+  void FillClusters(Deserializer* d) {
+    for (;;) {
+      const intptr_t i = next_cluster_.fetch_add(1);
+      if (i >= num_clusters_) return;
+      if (clusters_[i]->CanFillConcurrently()) {
+        d->ReadFill(clusters_[i], positions_[i], positions_[i + 1]);
+      }
+    }
+  }
+
+  void AddTask() {
+    MonitorLocker ml(&monitor_);
+    pending_tasks_++;
+  }
+
+  void TaskDone() {
+    MonitorLocker ml(&monitor_);
+    pending_tasks_--;
+    ml.Notify();
+  }
+
+  void WaitForTasks() {
+    MonitorLocker ml(&monitor_);
+    while (pending_tasks_ > 0) {
+      ml.Wait();
+    }
+  }
+
+ private:
+  DeserializationCluster** const clusters_;
+  const intptr_t num_clusters_;
+  const intptr_t* const positions_;
+  RelaxedAtomic<intptr_t> next_cluster_ = {0};
+  Monitor monitor_;
+  intptr_t pending_tasks_ = 0;
+
+  DISALLOW_COPY_AND_ASSIGN(ConcurrentFill);
+};
+
+class ConcurrentFillTask : public ThreadPool::Task {
+ public:
+  ConcurrentFillTask(IsolateGroup* isolate_group,
+                     const Deserializer* parent,
+                     ConcurrentFill* fill)
+      : isolate_group_(isolate_group), parent_(parent), fill_(fill) {}
+
+  virtual void Run() {
+    bool result = Thread::EnterIsolateGroupAsHelper(
+        isolate_group_, Thread::kDeserializerTask, /*bypass_safepoint=*/true);
+    ASSERT(result);
+    {
+      Thread* thread = Thread::Current();
+      StackZone stack_zone(thread);
+      Deserializer d(thread, *parent_);
+      fill_->FillClusters(&d);
+    }
+    // Exit the isolate group *before* notifying the loading thread, which
+    // may otherwise shut it down first.
+    Thread::ExitIsolateGroupAsHelper(/*bypass_safepoint=*/true);
+    fill_->TaskDone();
+  }
+
+ private:
+  IsolateGroup* const isolate_group_;
+  const Deserializer* const parent_;
+  ConcurrentFill* const fill_;
+
+  DISALLOW_COPY_AND_ASSIGN(ConcurrentFillTask);
+};
+
+// Below this size of concurrently fillable data, starting helper threads
+// costs more than it saves.
+static constexpr intptr_t kMinConcurrentFillSize = 256 * KB;
+
+void Deserializer::ReadFill() {
+  // The fill section starts with the size of each cluster's fill data.
+  intptr_t* positions = zone_->Alloc<intptr_t>(num_clusters_ + 1);
+  positions[0] = stream_.Position() + num_clusters_ * sizeof(uint32_t);
+  intptr_t concurrent_size = 0;
+  for (intptr_t i = 0; i < num_clusters_; i++) {
+    uint32_t size;
+    stream_.ReadBytes(&size, sizeof(size));
+    positions[i + 1] = positions[i] + size;
+    if (clusters_[i]->CanFillConcurrently()) {
+      concurrent_size += size;
+    }
+  }
+  ASSERT_EQUAL(stream_.Position(), positions[0]);
+
+  IsolateGroup* isolate_group = thread()->isolate_group();
+  intptr_t num_tasks = 0;
+  if ((concurrent_size >= kMinConcurrentFillSize) &&
+      (Dart::thread_pool() != nullptr) &&
+      (isolate_group != Dart::vm_isolate_group())) {
+    num_tasks = Utils::Minimum<intptr_t>(
+        FLAG_snapshot_fill_tasks, OS::NumberOfAvailableProcessors() - 1);
+  }
+
+  if (num_tasks <= 0) {
+    for (intptr_t i = 0; i < num_clusters_; i++) {
+      ReadFill(clusters_[i], positions[i], positions[i + 1]);
+    }
+  } else {
+    // The objects are initialized without barriers (see Deserialize), so the
+    // helpers do not need to synchronize with anything but this thread.
+    ConcurrentFill fill(clusters_, num_clusters_, positions);
+    for (intptr_t i = 0; i < num_tasks; i++) {
+      fill.AddTask();
+      if (!Dart::thread_pool()->Run<ConcurrentFillTask>(isolate_group, this,
+                                                        &fill)) {
+        fill.TaskDone();
+      }
+    }
+    // Fill the clusters which must be filled by this thread in order, then
+    // help with the remaining ones.
+    for (intptr_t i = 0; i < num_clusters_; i++) {
+      if (!clusters_[i]->CanFillConcurrently()) {
+        ReadFill(clusters_[i], positions[i], positions[i + 1]);
+      }
+    }
+    fill.FillClusters(this);
+    fill.WaitForTasks();
+  }
+  stream_.SetPosition(positions[num_clusters_]);
+}
+
+void Deserializer::PrintLoadTimes() const {
+  JSONWriter js;
+  js.OpenObject();
+  js.PrintProperty("snapshot",
+                   thread()->isolate_group() == Dart::vm_isolate_group()
+                       ? "vm"
+                       : "isolate");
+  js.OpenArray("clusters");
+  for (intptr_t i = 0; i < num_clusters_; i++) {
+    const DeserializationCluster* cluster = clusters_[i];
+    js.OpenObject();
+    js.PrintProperty("name", cluster->name());
+    js.PrintPropertyBool("canonical", cluster->is_canonical());
+    js.PrintProperty("objects", cluster->num_objects());
+    js.PrintProperty64("allocMicros", cluster->alloc_micros_);
+    js.PrintProperty64("fillMicros", cluster->fill_micros_);
+    js.CloseObject();
+  }
+  js.CloseArray();
+  js.CloseObject();
+  OS::Print("%s\n", js.ToCString());
+}
+
 void Deserializer::Deserialize(DeserializationRoots* roots) {
   const void* clustered_start = AddressOfCurrentPosition();
 
@@ -9578,8 +10058,15 @@ void Deserializer::Deserialize(DeserializationRoots* roots) {
     {
       TIMELINE_DURATION(thread(), Isolate, "ReadAlloc");
       for (intptr_t i = 0; i < num_clusters_; i++) {
+        const int64_t start_micros = FLAG_print_snapshot_load_times
+                                         ? OS::GetCurrentMonotonicMicros()
+                                         : 0;
         clusters_[i] = ReadCluster();
         clusters_[i]->ReadAlloc(this);
+        if (FLAG_print_snapshot_load_times) {
+          clusters_[i]->alloc_micros_ =
+              OS::GetCurrentMonotonicMicros() - start_micros;
+        }
 #if defined(DEBUG)
         intptr_t serializers_next_ref_index_ = Read<int32_t>();
         ASSERT_EQUAL(serializers_next_ref_index_, next_ref_index_);
@@ -9592,13 +10079,7 @@ void Deserializer::Deserialize(DeserializationRoots* roots) {
 
     {
       TIMELINE_DURATION(thread(), Isolate, "ReadFill");
-      for (intptr_t i = 0; i < num_clusters_; i++) {
-        clusters_[i]->ReadFill(this);
-#if defined(DEBUG)
-        int32_t section_marker = Read<int32_t>();
-        ASSERT(section_marker == kSectionMarker);
-#endif
-      }
+      ReadFill();
     }
 
     roots->ReadRoots(this);
@@ -9628,6 +10109,10 @@ void Deserializer::Deserialize(DeserializationRoots* roots) {
     }
   }
 
+  if (FLAG_print_snapshot_load_times) {
+    PrintLoadTimes();
+  }
+
   if (isolate_group->snapshot_is_dontneed_safe()) {
     size_t clustered_length =
         reinterpret_cast<uword>(AddressOfCurrentPosition()) -
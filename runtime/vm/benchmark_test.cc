@@ -18,8 +18,13 @@
 #include "vm/app_snapshot.h"
 #include "vm/dart_api_impl.h"
 #include "vm/datastream.h"
+#include "vm/message_handler.h"
 #include "vm/message_snapshot.h"
+#include "vm/object_graph_copy.h"
+#include "vm/os_thread.h"
+#include "vm/port.h"
 #include "vm/stack_frame.h"
+#include "vm/timeline.h"
 #include "vm/timer.h"
 
 using dart::bin::File;
@@ -564,6 +569,145 @@ BENCHMARK(LargeMap) {
   benchmark->set_score(elapsed_time);
 }
 
+// Measures scavenges of a young generation where a quarter of the allocated
+// objects survive, so both the copying and the root processing are exercised.
+BENCHMARK(ScavengeWithSurvivors) {
+  TransitionNativeToVM transition(thread);
+  StackZone zone(thread);
+  const intptr_t kLoopCount = 100;
+  const intptr_t kAllocationsPerLoop = 10000;
+  const intptr_t kSurvivorsPerLoop = kAllocationsPerLoop / 4;
+  Array& survivors = Array::Handle();
+  Array& element = Array::Handle();
+  Timer timer;
+  timer.Start();
+  for (intptr_t i = 0; i < kLoopCount; i++) {
+    HANDLESCOPE(thread);
+    survivors = Array::New(kSurvivorsPerLoop);
+    for (intptr_t j = 0; j < kAllocationsPerLoop; j++) {
+      element = Array::New(4);
+      if ((j & 3) == 0) {
+        survivors.SetAt(j >> 2, element);
+      }
+    }
+    GCTestHelper::CollectNewSpace();
+  }
+  timer.Stop();
+  int64_t elapsed_time = timer.TotalElapsedTime();
+  benchmark->set_score(elapsed_time);
+}
+
+// Measures the copy of a mutable object graph as done when sending a message
+// to an isolate in the same group.
+BENCHMARK(CopyMutableObjectGraph) {
+  const char* kScript =
+      "makeGraph() {\n"
+      "  final list = [];\n"
+      "  for (int i = 0; i < 10000; ++i) list.add([i, 'a', {i: i}]);\n"
+      "  return list;\n"
+      "}";
+  Dart_Handle h_lib = TestCase::LoadTestScript(kScript, nullptr);
+  EXPECT_VALID(h_lib);
+  Dart_Handle h_result = Dart_Invoke(h_lib, NewString("makeGraph"), 0, nullptr);
+  EXPECT_VALID(h_result);
+  TransitionNativeToVM transition(thread);
+  StackZone zone(thread);
+  const Object& graph = Object::Handle(Api::UnwrapHandle(h_result));
+  const intptr_t kLoopCount = 100;
+  Timer timer;
+  timer.Start();
+  for (intptr_t i = 0; i < kLoopCount; i++) {
+    HANDLESCOPE(thread);
+    CopyMutableObjectGraph(graph);
+  }
+  timer.Stop();
+  int64_t elapsed_time = timer.TotalElapsedTime();
+  benchmark->set_score(elapsed_time);
+}
+
+class BenchmarkMessageHandler : public MessageHandler {
+ public:
+  BenchmarkMessageHandler() {}
+
+  void MessageNotify(Message::Priority priority) {}
+  MessageStatus HandleMessage(std::unique_ptr<Message> message) { return kOK; }
+};
+
+// Measures the port lookup and enqueueing done for every posted message.
+BENCHMARK(PortMapPostMessage) {
+  const intptr_t kLoopCount = 100;
+  const intptr_t kMessagesPerLoop = 10000;
+  BenchmarkMessageHandler handler;
+  Timer timer;
+  timer.Start();
+  for (intptr_t i = 0; i < kLoopCount; i++) {
+    Dart_Port port = PortMap::CreatePort(&handler);
+    for (intptr_t j = 0; j < kMessagesPerLoop; j++) {
+      PortMap::PostMessage(
+          Message::New(port, Smi::New(j), Message::kNormalPriority));
+    }
+    // Closing the port drops the queued messages.
+    PortMap::ClosePort(port);
+  }
+  timer.Stop();
+  int64_t elapsed_time = timer.TotalElapsedTime();
+  benchmark->set_score(elapsed_time);
+}
+
+#if !defined(PRODUCT)
+// Measures the cost of emitting timeline events from several threads at once,
+// which mostly exercises the recorder's handling of per-thread blocks.
+BENCHMARK(TimelineEventEmission) {
+  const intptr_t kThreadCount = 4;
+  const intptr_t kEventsPerThread = 100000;
+  struct EmitterState {
+    Monitor monitor;
+    intptr_t running = kThreadCount;
+    ThreadJoinId join_ids[kThreadCount];
+  };
+  EmitterState state;
+  TimelineStream* stream = Timeline::GetEmbedderStream();
+  const bool was_enabled = stream->enabled();
+  stream->set_enabled(true);
+  Timer timer;
+  timer.Start();
+  for (intptr_t i = 0; i < kThreadCount; i++) {
+    OSThread::Start(
+        "TimelineEventEmitter",
+        [](uword state_ptr) {
+          EmitterState* state = reinterpret_cast<EmitterState*>(state_ptr);
+          TimelineStream* stream = Timeline::GetEmbedderStream();
+          for (intptr_t j = 0; j < kEventsPerThread; j++) {
+            TimelineEvent* event = stream->StartEvent();
+            if (event != nullptr) {
+              event->Instant("TimelineEventEmission");
+              event->Complete();
+            }
+          }
+          MonitorLocker ml(&state->monitor);
+          state->join_ids[--state->running] =
+              OSThread::GetCurrentThreadJoinId(OSThread::Current());
+          ml.Notify();
+        },
+        reinterpret_cast<uword>(&state));
+  }
+  {
+    MonitorLocker ml(&state.monitor);
+    while (state.running > 0) {
+      ml.Wait();
+    }
+  }
+  timer.Stop();
+  for (intptr_t i = 0; i < kThreadCount; i++) {
+    OSThread::Join(state.join_ids[i]);
+  }
+  stream->set_enabled(was_enabled);
+  Timeline::Clear();
+  int64_t elapsed_time = timer.TotalElapsedTime();
+  benchmark->set_score(elapsed_time);
+}
+#endif  // !defined(PRODUCT)
+
 BENCHMARK_MEMORY(InitialRSS) {
   benchmark->set_score(bin::Process::MaxRSS());
 }
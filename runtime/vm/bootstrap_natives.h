@@ -111,10 +111,13 @@ namespace dart {
   V(RegExp_getGroupNameMap, 1)                                                 \
   V(RegExp_ExecuteMatch, 3)                                                    \
   V(RegExp_ExecuteMatchSticky, 3)                                              \
+  V(RegExp_ExecuteHasMatch, 4)                                                 \
+  V(RegExp_interpretsBytecode, 0)                                              \
   V(List_allocate, 2)                                                          \
   V(List_setIndexed, 3)                                                        \
   V(List_getLength, 1)                                                         \
   V(List_slice, 4)                                                             \
+  V(List_copyRange, 5)                                                         \
   V(ImmutableList_from, 4)                                                     \
   V(StringBase_createFromCodePoints, 3)                                        \
   V(StringBase_substringUnchecked, 3)                                          \
@@ -122,6 +125,8 @@ namespace dart {
   V(StringBase_intern, 1)                                                      \
   V(StringBuffer_createStringFromUint16Array, 3)                               \
   V(OneByteString_substringUnchecked, 3)                                       \
+  V(OneByteString_indexOfCodeUnit, 3)                                          \
+  V(Utf8Decoder_decodeWellFormed, 5)                                           \
   V(OneByteString_allocateFromOneByteList, 3)                                  \
   V(TwoByteString_allocateFromTwoByteList, 3)                                  \
   V(String_getHashCode, 1)                                                     \
@@ -142,7 +147,6 @@ namespace dart {
   V(Error_throwWithStackTrace, 2)                                              \
   V(StackTrace_current, 0)                                                     \
   V(TypeError_throwNew, 4)                                                     \
-  V(Stopwatch_now, 0)                                                          \
   V(Stopwatch_frequency, 0)                                                    \
   V(Timeline_getNextTaskId, 0)                                                 \
   V(Timeline_getTraceClock, 0)                                                 \
@@ -150,6 +154,8 @@ namespace dart {
   V(Timeline_reportTaskEvent, 5)                                               \
   V(TypedDataBase_length, 1)                                                   \
   V(TypedDataBase_setClampedRange, 5)                                          \
+  V(TypedDataBase_fillBytes, 4)                                                \
+  V(TypedDataBase_indexOfByte, 4)                                              \
   V(TypedData_GetFloat32, 2)                                                   \
   V(TypedData_SetFloat32, 3)                                                   \
   V(TypedData_GetFloat64, 2)                                                   \
@@ -260,6 +266,7 @@ namespace dart {
   V(GrowableList_getCapacity, 1)                                               \
   V(GrowableList_setLength, 2)                                                 \
   V(GrowableList_setData, 2)                                                   \
+  V(GrowableList_grow, 2)                                                      \
   V(Internal_unsafeCast, 1)                                                    \
   V(Internal_nativeEffect, 1)                                                  \
   V(Internal_collectAllGarbage, 0)                                             \
@@ -268,6 +275,7 @@ namespace dart {
   V(Internal_extractTypeArguments, 2)                                          \
   V(Internal_prependTypeArguments, 4)                                          \
   V(Internal_boundsCheckForPartialInstantiation, 2)                            \
+  V(Internal_crc32c, 4)                                                        \
   V(Internal_allocateOneByteString, 1)                                         \
   V(Internal_allocateTwoByteString, 1)                                         \
   V(Internal_writeIntoOneByteString, 3)                                        \
@@ -296,6 +304,7 @@ namespace dart {
   V(VMService_AddUserTagsToStreamableSampleList, 1)                            \
   V(VMService_RemoveUserTagsFromStreamableSampleList, 1)                       \
   V(Ffi_createNativeCallableListener, 2)                                       \
+  V(Ffi_takeCoalescedNativeCallableListenerCalls, 1)                           \
   V(Ffi_createNativeCallableIsolateLocal, 3)                                   \
   V(Ffi_deleteNativeCallable, 1)                                               \
   V(Ffi_updateNativeCallableKeepIsolateAliveCounter, 1)                        \
@@ -307,6 +316,9 @@ namespace dart {
   V(Ffi_dl_processLibrary, 0)                                                  \
   V(Ffi_dl_executableLibrary, 0)                                               \
   V(Ffi_GetFfiNativeResolver, 0)                                               \
+  V(TypedDataArena_new, 0)                                                     \
+  V(TypedDataArena_allocateUint8List, 2)                                       \
+  V(TypedDataArena_delete, 1)                                                  \
   V(DartApiDLInitializeData, 0)                                                \
   V(DartApiDLMajorVersion, 0)                                                  \
   V(DartApiDLMinorVersion, 0)                                                  \
@@ -368,7 +380,8 @@ namespace dart {
 #define BOOTSTRAP_FFI_NATIVE_LIST(V)                                           \
   V(FinalizerEntry_SetExternalSize, void, (Dart_Handle, intptr_t))             \
   V(Pointer_asTypedListFinalizerAllocateData, void*, ())                       \
-  V(Pointer_asTypedListFinalizerCallbackPointer, void*, ())
+  V(Pointer_asTypedListFinalizerCallbackPointer, void*, ())                    \
+  V(Stopwatch_now, int64_t, ())
 
 class BootstrapNatives : public AllStatic {
  public:
@@ -172,7 +172,8 @@ class CanonicalTypeTraits {
     return obj.key_.ptr();
   }
 };
-typedef UnorderedHashSet<CanonicalTypeTraits> CanonicalTypeSet;
+typedef UnorderedHashSet<CanonicalTypeTraits, AcqRelStorageTraits>
+    CanonicalTypeSet;
 
 class CanonicalFunctionTypeKey {
  public:
@@ -331,7 +332,7 @@ class CanonicalTypeArgumentsTraits {
     return obj.key_.ptr();
   }
 };
-typedef UnorderedHashSet<CanonicalTypeArgumentsTraits>
+typedef UnorderedHashSet<CanonicalTypeArgumentsTraits, AcqRelStorageTraits>
     CanonicalTypeArgumentsSet;
 
 class MetadataMapTraits {
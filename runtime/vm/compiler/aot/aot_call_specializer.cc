@@ -864,6 +864,9 @@ void AotCallSpecializer::VisitInstanceCall(InstanceCallInstr* instr) {
   Definition* callee_receiver = instr->ArgumentAt(receiver_idx);
   const Function& function = flow_graph()->function();
   Class& receiver_class = Class::Handle(Z);
+  // Whether the receiver class is implemented by classes which are not its
+  // subclasses, e.g. an interface.
+  bool receiver_class_is_implemented = false;
 
   if (function.IsDynamicFunction() &&
       flow_graph()->IsReceiver(callee_receiver)) {
@@ -875,15 +878,21 @@ void AotCallSpecializer::VisitInstanceCall(InstanceCallInstr* instr) {
     if (type->ToAbstractType()->IsType() &&
         !type->ToAbstractType()->IsDynamicType() && !type->is_nullable()) {
       receiver_class = type->ToAbstractType()->type_class();
-      if (receiver_class.is_implemented()) {
-        receiver_class = Class::null();
-      }
+      receiver_class_is_implemented = receiver_class.is_implemented();
     }
   }
   if (!receiver_class.IsNull()) {
     GrowableArray<intptr_t> class_ids(6);
-    if (thread()->compiler_state().cha().ConcreteSubclasses(receiver_class,
-                                                            &class_ids)) {
+    // For implemented classes collect all concrete implementors, so that
+    // calls on interfaces with a few implementations become polymorphic
+    // calls (which can be inlined) instead of dispatch table calls.
+    const bool has_class_ids =
+        receiver_class_is_implemented
+            ? CHA::ConcreteSubtypes(receiver_class, &class_ids,
+                                    FLAG_max_exhaustive_polymorphic_checks)
+            : thread()->compiler_state().cha().ConcreteSubclasses(
+                  receiver_class, &class_ids);
+    if (has_class_ids) {
       // First check if all subclasses end up calling the same method.
       // If this is the case we will replace instance call with a direct
       // static call.
@@ -977,7 +986,8 @@ void AotCallSpecializer::VisitInstanceCall(InstanceCallInstr* instr) {
 
     // Detect if o.m(...) is a call through a getter and expand it
     // into o.get:m().call(...).
-    if (TryExpandCallThroughGetter(receiver_class, instr)) {
+    if (!receiver_class_is_implemented &&
+        TryExpandCallThroughGetter(receiver_class, instr)) {
       return;
     }
   }
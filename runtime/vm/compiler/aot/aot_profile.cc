@@ -0,0 +1,206 @@
+// Copyright (c) 2024, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+#include "vm/compiler/aot/aot_profile.h"
+
+#include <stdlib.h>
+
+#include "vm/dart.h"
+#include "vm/flags.h"
+#include "vm/object.h"
+#include "vm/os.h"
+#include "vm/program_visitor.h"
+#include "vm/zone_text_buffer.h"
+
+namespace dart {
+
+DEFINE_FLAG(charp,
+            write_aot_profile_to,
+            nullptr,
+            "Write call counts collected by the JIT into the given file when "
+            "an isolate shuts down, for use with --read-aot-profile-from.");
+
+#if defined(DART_PRECOMPILER)
+DEFINE_FLAG(charp,
+            read_aot_profile_from,
+            nullptr,
+            "Use call counts from the given file (see --write-aot-profile-to) "
+            "to guide inlining during precompilation.");
+#endif  // defined(DART_PRECOMPILER)
+
+// Returns the key identifying |function| in the profile or nullptr if the
+// function can not be identified across runs.
+static const char* FunctionKey(Zone* zone, const Function& function) {
+  const auto& owner = Class::Handle(zone, function.Owner());
+  if (owner.IsNull()) return nullptr;
+  const auto& library = Library::Handle(zone, owner.library());
+  if (library.IsNull()) return nullptr;
+  const auto& url = String::Handle(zone, library.url());
+  return OS::SCreate(zone, "%s\t%s\t%" Pd32, url.ToCString(),
+                     function.QualifiedScrubbedNameCString(),
+                     function.token_pos().Serialize());
+}
+
+class AotProfileWriter : public FunctionVisitor {
+ public:
+  AotProfileWriter(Zone* zone, BaseTextBuffer* buffer)
+      : zone_(zone),
+        buffer_(buffer),
+        ic_data_map_(new (zone) ZoneGrowableArray<const ICData*>()),
+        selector_(String::Handle(zone)) {}
+
+  void VisitFunction(const Function& function) {
+    if (function.ic_data_array() == Array::null()) return;
+    const char* key = FunctionKey(zone_, function);
+    if (key == nullptr) return;
+    ic_data_map_->Clear();
+    function.RestoreICDataMap(ic_data_map_, /*clone_ic_data=*/false);
+    for (intptr_t i = 0; i < ic_data_map_->length(); i++) {
+      const ICData* ic_data = (*ic_data_map_)[i];
+      if (ic_data == nullptr) continue;
+      const intptr_t count = ic_data->AggregateCount();
+      if (count == 0) continue;
+      selector_ = ic_data->target_name();
+      buffer_->Printf("%s\t%" Pd "\t%s\t%" Pd "\n", key, ic_data->deopt_id(),
+                      selector_.ToCString(), count);
+    }
+  }
+
+ private:
+  Zone* const zone_;
+  BaseTextBuffer* const buffer_;
+  ZoneGrowableArray<const ICData*>* const ic_data_map_;
+  String& selector_;
+};
+
+void AotProfile::Write(Thread* thread, const char* filename) {
+  if ((Dart::file_write_callback() == nullptr) ||
+      (Dart::file_open_callback() == nullptr) ||
+      (Dart::file_close_callback() == nullptr)) {
+    OS::PrintErr("warning: Could not access file callbacks.");
+    return;
+  }
+  Zone* zone = thread->zone();
+  ZoneTextBuffer buffer(zone);
+  AotProfileWriter writer(zone, &buffer);
+  ProgramVisitor::WalkProgram(zone, thread->isolate_group(), &writer);
+
+  void* file = Dart::file_open_callback()(filename, /*write=*/true);
+  if (file == nullptr) {
+    OS::PrintErr("warning: Failed to write AOT profile: %s\n", filename);
+    return;
+  }
+  Dart::file_write_callback()(buffer.buffer(), buffer.length(), file);
+  Dart::file_close_callback()(file);
+}
+
+#if defined(DART_PRECOMPILER)
+
+AotProfile* AotProfile::ReadIfRequested(Zone* zone) {
+  const char* filename = FLAG_read_aot_profile_from;
+  if (filename == nullptr) {
+    return nullptr;
+  }
+  if ((Dart::file_read_callback() == nullptr) ||
+      (Dart::file_open_callback() == nullptr) ||
+      (Dart::file_close_callback() == nullptr)) {
+    OS::PrintErr("warning: Could not access file callbacks.");
+    return nullptr;
+  }
+  void* file = Dart::file_open_callback()(filename, /*write=*/false);
+  if (file == nullptr) {
+    OS::PrintErr("warning: Failed to read AOT profile: %s\n", filename);
+    return nullptr;
+  }
+  uint8_t* data = nullptr;
+  intptr_t length = -1;
+  Dart::file_read_callback()(&data, &length, file);
+  Dart::file_close_callback()(file);
+  if (data == nullptr || length < 0) {
+    OS::PrintErr("warning: Failed to read AOT profile: %s\n", filename);
+    return nullptr;
+  }
+  AotProfile* profile =
+      Parse(zone, reinterpret_cast<const char*>(data), length);
+  free(data);
+  return profile;
+}
+
+AotProfile* AotProfile::Parse(Zone* zone,
+                              const char* contents,
+                              intptr_t length) {
+  AotProfile* profile = new (zone) AotProfile(zone);
+  const char* const end = contents + length;
+  const char* line = contents;
+  while (line < end) {
+    const char* line_end = line;
+    while (line_end < end && *line_end != '\n') {
+      line_end++;
+    }
+    // The function key spans the first three fields and the call site key
+    // everything but the trailing count.
+    const char* function_key_end = nullptr;
+    const char* selector_begin = nullptr;
+    const char* last_tab = nullptr;
+    intptr_t tabs = 0;
+    for (const char* p = line; p < line_end; p++) {
+      if (*p == '\t') {
+        ++tabs;
+        if (tabs == 3) function_key_end = p;
+        if (tabs == 4) selector_begin = p + 1;
+        last_tab = p;
+      }
+    }
+    if (tabs == 5) {
+      char* count_end = nullptr;
+      const intptr_t count = strtoll(last_tab + 1, &count_end, 10);
+      if (count_end == line_end && count > 0) {
+        const char* call_key = zone->MakeCopyOfStringN(line, last_tab - line);
+        const char* function_key =
+            zone->MakeCopyOfStringN(line, function_key_end - line);
+        profile->call_counts_.Insert({call_key, count});
+        if (auto* kv = profile->functions_.Lookup(function_key)) {
+          kv->value += count;
+        } else {
+          profile->functions_.Insert({function_key, count});
+        }
+        const char* selector = zone->MakeCopyOfStringN(
+            selector_begin, last_tab - selector_begin);
+        if (auto* kv = profile->selector_counts_.Lookup(selector)) {
+          kv->value += count;
+        } else {
+          profile->selector_counts_.Insert({selector, count});
+        }
+      }
+    }
+    line = line_end + 1;
+  }
+  return profile;
+}
+
+bool AotProfile::HasProfile(const Function& function) const {
+  const char* key = FunctionKey(Thread::Current()->zone(), function);
+  return key != nullptr && functions_.HasKey(key);
+}
+
+intptr_t AotProfile::CallCount(const Function& function,
+                               intptr_t deopt_id,
+                               const String& selector) const {
+  Zone* zone = Thread::Current()->zone();
+  const char* function_key = FunctionKey(zone, function);
+  if (function_key == nullptr) return 0;
+  const char* key = OS::SCreate(zone, "%s\t%" Pd "\t%s", function_key,
+                                deopt_id, selector.ToCString());
+  auto* kv = call_counts_.Lookup(key);
+  return kv != nullptr ? kv->value : 0;
+}
+
+intptr_t AotProfile::SelectorCount(const String& selector) const {
+  auto* kv = selector_counts_.Lookup(selector.ToCString());
+  return kv != nullptr ? kv->value : 0;
+}
+
+#endif  // defined(DART_PRECOMPILER)
+
+}  // namespace dart
@@ -0,0 +1,79 @@
+// Copyright (c) 2024, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+#ifndef RUNTIME_VM_COMPILER_AOT_AOT_PROFILE_H_
+#define RUNTIME_VM_COMPILER_AOT_AOT_PROFILE_H_
+
+#if defined(DART_PRECOMPILED_RUNTIME)
+#error "AOT runtime should not use compiler sources (including header files)"
+#endif  // defined(DART_PRECOMPILED_RUNTIME)
+
+#include "vm/allocation.h"
+#include "vm/hash_map.h"
+
+namespace dart {
+
+// Forward declarations.
+class Function;
+class String;
+class Thread;
+
+// Call site frequencies recorded by a JIT training run and used to guide AOT
+// compilation in place of static estimates.
+//
+// The training run (--write-aot-profile-to=<file>) dumps the call counts of
+// all ICData when an isolate shuts down. gen_snapshot
+// (--read-aot-profile-from=<file>) loads them before compiling. The profile
+// is a text file with one call site per line and tab separated fields:
+//
+//   <library url> <function name> <function token pos> <deopt id> <selector>
+//   <count>
+//
+// Call sites are identified by the deopt id of the call, which is stable as
+// long as the program and the flow graph builder do not change. The selector
+// guards against mismatches.
+class AotProfile : public ZoneAllocated {
+ public:
+  // Writes call counts collected by the current isolate group into the
+  // given file.
+  static void Write(Thread* thread, const char* filename);
+
+#if defined(DART_PRECOMPILER)
+  // Reads the profile given by --read-aot-profile-from, if any.
+  static AotProfile* ReadIfRequested(Zone* zone);
+
+  // Parses the contents of a profile file.
+  static AotProfile* Parse(Zone* zone, const char* contents, intptr_t length);
+
+  // Whether any calls in the given function were recorded.
+  bool HasProfile(const Function& function) const;
+
+  // Returns how often the call with the given deopt id and selector in
+  // |function| was executed in the training run (0 if never).
+  intptr_t CallCount(const Function& function,
+                     intptr_t deopt_id,
+                     const String& selector) const;
+
+  // Returns how often calls with the given selector were executed in the
+  // training run, summed over all call sites.
+  intptr_t SelectorCount(const String& selector) const;
+
+  intptr_t num_call_sites() const { return call_counts_.Length(); }
+
+ private:
+  explicit AotProfile(Zone* zone)
+      : functions_(zone), call_counts_(zone), selector_counts_(zone) {}
+
+  // Maps function keys to the total count of calls in the function.
+  CStringIntMap functions_;
+  // Maps call site keys to their counts.
+  CStringIntMap call_counts_;
+  // Maps selectors to the total count of calls with the selector.
+  CStringIntMap selector_counts_;
+#endif  // defined(DART_PRECOMPILER)
+};
+
+}  // namespace dart
+
+#endif  // RUNTIME_VM_COMPILER_AOT_AOT_PROFILE_H_
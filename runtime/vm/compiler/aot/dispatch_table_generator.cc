@@ -8,14 +8,21 @@
 
 #include <memory>
 
+#include "vm/compiler/aot/aot_profile.h"
 #include "vm/compiler/frontend/kernel_translation_helper.h"
 #include "vm/dispatch_table.h"
+#include "vm/flags.h"
 #include "vm/stub_code.h"
 #include "vm/thread.h"
 
 #define Z zone_
 
 namespace dart {
+
+DEFINE_FLAG(bool,
+            print_dispatch_table_stats,
+            false,
+            "Print the size and fill density of the dispatch table.");
 namespace compiler {
 
 class Interval {
@@ -118,6 +125,12 @@ class SelectorRow {
 
   int32_t CallCount() const { return selector_->call_count; }
 
+  // Calls executed in the training run dominate the number of call sites,
+  // which only orders selectors without profile information.
+  int64_t Popularity() const {
+    return selector_->profile_count + selector_->call_count;
+  }
+
   bool IsAllocated() const {
     return selector_->offset != SelectorMap::kInvalidSelectorOffset;
   }
@@ -405,12 +418,15 @@ void SelectorMap::SetSelectorProperties(int32_t sid,
 DispatchTableGenerator::DispatchTableGenerator(Zone* zone)
     : zone_(zone),
       classes_(nullptr),
+      profile_(nullptr),
       num_selectors_(-1),
       num_classes_(-1),
       selector_map_(zone) {}
 
-void DispatchTableGenerator::Initialize(ClassTable* table) {
+void DispatchTableGenerator::Initialize(ClassTable* table,
+                                        const AotProfile* profile) {
   classes_ = table;
+  profile_ = profile;
 
   HANDLESCOPE(Thread::Current());
   ReadTableSelectorInfo();
@@ -558,6 +574,10 @@ void DispatchTableGenerator::SetupSelectorRows() {
     }
   }
 
+  // All functions with the same selector have the same name.
+  std::unique_ptr<bool[]> has_profile_count(new bool[num_selectors_]());
+  String& name = String::Handle(Z);
+
   // Add implementation intervals to the selector rows for all classes that
   // have concrete implementations of the selector.
   for (classid_t cid = kIllegalCid + 1; cid < num_classes_; cid++) {
@@ -579,6 +599,13 @@ void DispatchTableGenerator::SetupSelectorRows() {
                 // A function handle that survives until the table is built.
                 auto& function_handle = Function::ZoneHandle(Z, function.ptr());
 
+                if (profile_ != nullptr && !has_profile_count[sid]) {
+                  has_profile_count[sid] = true;
+                  name = function.name();
+                  selector_map_.selectors_[sid].profile_count =
+                      profile_->SelectorCount(name);
+                }
+
                 for (intptr_t i = 0; i < subclass_cid_ranges.length(); i++) {
                   Interval& subclass_cid_range = subclass_cid_ranges[i];
                   selector_rows[sid].DefineSelectorImplementationForInterval(
@@ -623,7 +650,10 @@ void DispatchTableGenerator::ComputeSelectorOffsets() {
   // Sort the table rows according to popularity, descending.
   struct PopularitySorter {
     static int Compare(SelectorRow* const* a, SelectorRow* const* b) {
-      return (*b)->CallCount() - (*a)->CallCount();
+      const int64_t a_popularity = (*a)->Popularity();
+      const int64_t b_popularity = (*b)->Popularity();
+      if (a_popularity == b_popularity) return 0;
+      return a_popularity > b_popularity ? -1 : 1;
     }
   };
   table_rows_.Sort(PopularitySorter::Compare);
@@ -637,8 +667,10 @@ void DispatchTableGenerator::ComputeSelectorOffsets() {
   // Sort the table rows according to popularity / size, descending.
   struct PopularitySizeRatioSorter {
     static int Compare(SelectorRow* const* a, SelectorRow* const* b) {
-      return (*b)->CallCount() * (*a)->total_size() -
-             (*a)->CallCount() * (*b)->total_size();
+      const int64_t a_weight = (*a)->Popularity() * (*b)->total_size();
+      const int64_t b_weight = (*b)->Popularity() * (*a)->total_size();
+      if (a_weight == b_weight) return 0;
+      return a_weight > b_weight ? -1 : 1;
     }
   };
   table_rows_.Sort(PopularitySizeRatioSorter::Compare);
@@ -672,9 +704,50 @@ ArrayPtr DispatchTableGenerator::BuildCodeArray() {
     table_rows_[i]->FillTable(classes_, entries);
   }
   entries.MakeImmutable();
+  if (FLAG_print_dispatch_table_stats) {
+    PrintStats(entries);
+  }
   return entries.ptr();
 }
 
+void DispatchTableGenerator::PrintStats(const Array& entries) const {
+  // Rows at small offsets are reached with shorter instruction sequences
+  // and share the cache lines at the start of the table.
+  const intptr_t small_end = Utils::Minimum<intptr_t>(
+      entries.Length(), DispatchTable::kLargestSmallOffset + num_classes_);
+  intptr_t filled = 0;
+  intptr_t small_filled = 0;
+  for (intptr_t i = 0; i < entries.Length(); i++) {
+    if (entries.At(i) != Object::null()) {
+      filled++;
+      if (i < small_end) small_filled++;
+    }
+  }
+  int64_t calls = 0;
+  int64_t small_calls = 0;
+  for (intptr_t i = 0; i < table_rows_.length(); i++) {
+    const SelectorRow* row = table_rows_[i];
+    if (!row->IsAllocated()) continue;
+    calls += row->Popularity();
+    if (row->selector()->offset <= DispatchTable::kLargestSmallOffset) {
+      small_calls += row->Popularity();
+    }
+  }
+  const auto percent = [](int64_t part, int64_t total) {
+    return total == 0 ? 0.0 : 100.0 * part / total;
+  };
+  THR_Print("Dispatch table: %" Pd " selectors, %" Pd " classes\n",
+            table_rows_.length(), static_cast<intptr_t>(num_classes_));
+  THR_Print("  entries: %" Pd ", filled: %" Pd " (%.1f%%)\n",
+            entries.Length(), filled, percent(filled, entries.Length()));
+  THR_Print("  small offset region: %" Pd " entries, filled: %" Pd
+            " (%.1f%%)\n",
+            small_end, small_filled, percent(small_filled, small_end));
+  THR_Print("  %s at small offsets: %.1f%%\n",
+            profile_ != nullptr ? "profiled calls" : "call sites",
+            percent(small_calls, calls));
+}
+
 }  // namespace compiler
 }  // namespace dart
 
@@ -13,7 +13,9 @@
 #include "vm/closure_functions_cache.h"
 #include "vm/code_patcher.h"
 #include "vm/compiler/aot/aot_call_specializer.h"
+#include "vm/compiler/aot/aot_profile.h"
 #include "vm/compiler/aot/precompiler_tracer.h"
+#include "vm/compiler/aot/side_effect_summaries.h"
 #include "vm/compiler/assembler/assembler.h"
 #include "vm/compiler/assembler/disassembler.h"
 #include "vm/compiler/backend/branch_optimizer.h"
@@ -491,12 +493,19 @@ void Precompiler::DoCompileAll() {
       // as well as other type checks.
       HierarchyInfo hierarchy_info(T);
 
+      profile_ = AotProfile::ReadIfRequested(Z);
+      if (profile_ != nullptr && FLAG_trace_precompiler) {
+        THR_Print("Loaded AOT profile with %" Pd " call sites\n",
+                  profile_->num_call_sites());
+      }
+
       dispatch_table_generator_ = new compiler::DispatchTableGenerator(Z);
-      dispatch_table_generator_->Initialize(IG->class_table());
+      dispatch_table_generator_->Initialize(IG->class_table(), profile_);
 
       // After finding all code, and before starting to trace, populate the
       // assets map.
       GetNativeAssetsMap(T);
+      side_effect_summaries_ = new (Z) SideEffectSummaries(Z);
 
       // Precompile constructors to compute information such as
       // optimized instruction count (used in inlining heuristics).
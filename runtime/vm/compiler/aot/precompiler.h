@@ -29,6 +29,8 @@ class GrowableObjectArray;
 class String;
 class Precompiler;
 class FlowGraph;
+class AotProfile;
+class SideEffectSummaries;
 class PrecompilerTracer;
 class RetainedReasonsWriter;
 
@@ -280,6 +282,14 @@ class Precompiler : public ValueObject {
   Thread* thread() const { return thread_; }
   Zone* zone() const { return zone_; }
 
+  // Profile of a training run given by --read-aot-profile-from, if any.
+  AotProfile* profile() const { return profile_; }
+
+  // Fields written by calls to functions, computed on demand.
+  SideEffectSummaries* side_effect_summaries() const {
+    return side_effect_summaries_;
+  }
+
  private:
   static Precompiler* singleton_;
 
@@ -412,6 +422,8 @@ class Precompiler : public ValueObject {
 
   Phase phase_ = Phase::kPreparation;
   PrecompilerTracer* tracer_ = nullptr;
+  AotProfile* profile_ = nullptr;
+  SideEffectSummaries* side_effect_summaries_ = nullptr;
   RetainedReasonsWriter* retained_reasons_writer_ = nullptr;
   bool is_tracing_ = false;
 };
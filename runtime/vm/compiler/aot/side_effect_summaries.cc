@@ -0,0 +1,176 @@
+// Copyright (c) 2024, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+#include "vm/compiler/aot/side_effect_summaries.h"
+
+#include "vm/compiler/backend/flow_graph.h"
+#include "vm/compiler/backend/il.h"
+#include "vm/compiler/compiler_state.h"
+#include "vm/compiler/frontend/kernel_to_il.h"
+#include "vm/compiler/jit/compiler.h"
+#include "vm/flags.h"
+#include "vm/longjump.h"
+#include "vm/parser.h"
+
+namespace dart {
+
+#if defined(DART_PRECOMPILER)
+
+DEFINE_FLAG(int,
+            side_effect_summary_depth,
+            3,
+            "How deep to follow static calls when computing which fields a "
+            "call may write (0 disables side effect summaries).");
+DEFINE_FLAG(bool,
+            trace_side_effect_summaries,
+            false,
+            "Trace side effect summaries computed during precompilation.");
+
+const SideEffectSummaries::FieldList* SideEffectSummaries::WrittenFields(
+    const Function& function) {
+  if (FLAG_side_effect_summary_depth <= 0) {
+    return nullptr;
+  }
+  return Compute(function, /*depth=*/1);
+}
+
+const SideEffectSummaries::FieldList* SideEffectSummaries::Compute(
+    const Function& function,
+    intptr_t depth) {
+  if (Summary* summary = summaries_.LookupValue(&function)) {
+    // Recursive calls are not summarized.
+    return summary->in_progress ? nullptr : summary->fields;
+  }
+  if (depth > FLAG_side_effect_summary_depth || !CanSummarize(function)) {
+    return nullptr;
+  }
+
+  Summary* summary =
+      new (zone_) Summary(&Function::ZoneHandle(zone_, function.ptr()));
+  summaries_.Insert(summary);
+
+  Thread* thread = Thread::Current();
+  FieldList* fields = new (zone_) FieldList();
+  bool known = false;
+  {
+    DeoptIdScope deopt_id_scope(thread, 0);
+    LongJumpScope jump;
+    if (setjmp(*jump.Set()) == 0) {
+      FlowGraph* flow_graph = BuildGraph(function);
+      known = Summarize(function, flow_graph, depth, fields);
+    } else {
+      const Error& error = Error::Handle(thread->StealStickyError());
+      if (!error.IsLanguageError() ||
+          (LanguageError::Cast(error).kind() != Report::kBailout)) {
+        // Propagate errors other than bailouts.
+        thread->long_jump_base()->Jump(1, error);
+        UNREACHABLE();
+      }
+    }
+  }
+
+  summary->in_progress = false;
+  summary->fields = known ? fields : nullptr;
+  if (FLAG_trace_side_effect_summaries) {
+    THR_Print("Side effects of %s: ", function.ToFullyQualifiedCString());
+    if (!known) {
+      THR_Print("unknown\n");
+    } else {
+      for (intptr_t i = 0; i < fields->length(); i++) {
+        THR_Print("%s%s", i > 0 ? ", " : "", fields->At(i)->ToCString());
+      }
+      THR_Print("\n");
+    }
+  }
+  return summary->fields;
+}
+
+bool SideEffectSummaries::CanSummarize(const Function& function) const {
+  if (function.is_native() || function.is_external() ||
+      function.IsSuspendableFunction() || function.ForceOptimize()) {
+    return false;
+  }
+  switch (function.kind()) {
+    case UntaggedFunction::kRegularFunction:
+    case UntaggedFunction::kGetterFunction:
+    case UntaggedFunction::kSetterFunction:
+    case UntaggedFunction::kConstructor:
+    case UntaggedFunction::kImplicitGetter:
+    case UntaggedFunction::kImplicitSetter:
+      return true;
+    default:
+      return false;
+  }
+}
+
+FlowGraph* SideEffectSummaries::BuildGraph(const Function& function) {
+  Thread* thread = Thread::Current();
+  Zone* zone = thread->zone();
+  ParsedFunction* parsed_function = new (zone)
+      ParsedFunction(thread, Function::ZoneHandle(zone, function.ptr()));
+  auto* ic_data_array = new (zone) ZoneGrowableArray<const ICData*>();
+  kernel::FlowGraphBuilder builder(
+      parsed_function, ic_data_array, /*context_level_array=*/nullptr,
+      /*exit_collector=*/nullptr, /*optimizing=*/true,
+      Compiler::kNoOSRDeoptId);
+  FlowGraph* flow_graph = builder.BuildGraph();
+  flow_graph->ComputeSSA(/*inlining_parameters=*/nullptr);
+  return flow_graph;
+}
+
+static bool IsLocalAllocation(Value* instance) {
+  return instance->definition()->OriginalDefinition()->IsAllocation();
+}
+
+static void AddField(SideEffectSummaries::FieldList* fields,
+                     const Field& field,
+                     Zone* zone) {
+  const FieldPtr original = field.Original();
+  for (intptr_t i = 0; i < fields->length(); i++) {
+    if (fields->At(i)->ptr() == original) return;
+  }
+  fields->Add(&Field::ZoneHandle(zone, original));
+}
+
+bool SideEffectSummaries::Summarize(const Function& function,
+                                    FlowGraph* flow_graph,
+                                    intptr_t depth,
+                                    FieldList* fields) {
+  for (BlockIterator block_it = flow_graph->reverse_postorder_iterator();
+       !block_it.Done(); block_it.Advance()) {
+    for (ForwardInstructionIterator it(block_it.Current()); !it.Done();
+         it.Advance()) {
+      Instruction* instr = it.Current();
+      if (auto* store = instr->AsStoreField()) {
+        if (store->slot().IsDartField()) {
+          AddField(fields, store->slot().field(), zone_);
+        } else if (!IsLocalAllocation(store->instance())) {
+          // Native slots and context variables of objects which may be
+          // visible to the caller.
+          return false;
+        }
+      } else if (auto* store = instr->AsStoreStaticField()) {
+        AddField(fields, store->field(), zone_);
+      } else if (auto* store = instr->AsStoreIndexed()) {
+        if (!IsLocalAllocation(store->array())) return false;
+      } else if (instr->IsStoreIndexedUnsafe()) {
+        return false;
+      } else if (auto* call = instr->AsStaticCall()) {
+        if (call->function().ptr() == function.ptr()) continue;
+        const FieldList* callee_fields = Compute(call->function(), depth + 1);
+        if (callee_fields == nullptr) return false;
+        for (intptr_t i = 0; i < callee_fields->length(); i++) {
+          AddField(fields, *callee_fields->At(i), zone_);
+        }
+      } else if (instr->HasUnknownSideEffects()) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+#endif  // defined(DART_PRECOMPILER)
+
+}  // namespace dart
@@ -0,0 +1,83 @@
+// Copyright (c) 2024, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+#ifndef RUNTIME_VM_COMPILER_AOT_SIDE_EFFECT_SUMMARIES_H_
+#define RUNTIME_VM_COMPILER_AOT_SIDE_EFFECT_SUMMARIES_H_
+
+#if defined(DART_PRECOMPILED_RUNTIME)
+#error "AOT runtime should not use compiler sources (including header files)"
+#endif  // defined(DART_PRECOMPILED_RUNTIME)
+
+#include "vm/allocation.h"
+#include "vm/growable_array.h"
+#include "vm/hash_map.h"
+#include "vm/object.h"
+
+namespace dart {
+
+class FlowGraph;
+
+// Summaries of the heap locations which calls to a function may write,
+// computed on demand by the precompiler from the function's flow graph.
+//
+// A summary is either a set of fields (instance or static) or unknown. Calls
+// with a known summary write no other fields, no array elements and no
+// native slots of objects allocated outside of the callee, so that load
+// optimization can keep values loaded from other places across them.
+//
+// Only functions whose flow graph contains nothing but field stores and
+// static calls to other summarized functions get a known summary. Everything
+// else (instance, closure and native calls, indexed stores, ...) makes the
+// summary unknown.
+class SideEffectSummaries : public ZoneAllocated {
+ public:
+  using FieldList = ZoneGrowableArray<const Field*>;
+
+  explicit SideEffectSummaries(Zone* zone) : zone_(zone), summaries_(zone) {}
+
+  // Returns the fields which a call to |function| may write or nullptr if
+  // it may write other locations.
+  const FieldList* WrittenFields(const Function& function);
+
+ private:
+  struct Summary : public ZoneAllocated {
+    explicit Summary(const Function* function) : function(function) {}
+
+    const Function* const function;
+    // nullptr if unknown.
+    FieldList* fields = nullptr;
+    bool in_progress = true;
+  };
+
+  class SummaryKeyValueTrait {
+   public:
+    typedef const Function* Key;
+    typedef Summary* Value;
+    typedef Summary* Pair;
+
+    static Key KeyOf(Pair kv) { return kv->function; }
+    static Value ValueOf(Pair kv) { return kv; }
+    static inline uword Hash(Key key) { return key->Hash(); }
+    static inline bool IsKeyEqual(Pair kv, Key key) {
+      return kv->function->ptr() == key->ptr();
+    }
+  };
+
+  const FieldList* Compute(const Function& function, intptr_t depth);
+  bool CanSummarize(const Function& function) const;
+  FlowGraph* BuildGraph(const Function& function);
+  bool Summarize(const Function& function,
+                 FlowGraph* flow_graph,
+                 intptr_t depth,
+                 FieldList* fields);
+
+  // Zone of the precompiler which outlives the compilation of individual
+  // functions.
+  Zone* const zone_;
+  DirectChainedHashMap<SummaryKeyValueTrait> summaries_;
+};
+
+}  // namespace dart
+
+#endif  // RUNTIME_VM_COMPILER_AOT_SIDE_EFFECT_SUMMARIES_H_
@@ -1814,14 +1814,28 @@ void Assembler::CompareWords(Register reg1,
                              Register count,
                              Register temp,
                              Label* equals) {
-  Label loop;
-  Bind(&loop);
-  decq(count);
-  j(LESS, equals, Assembler::kNearJump);
+  Label loop, last_word, not_equal;
   COMPILE_ASSERT(target::kWordSize == 8);
-  movq(temp, FieldAddress(reg1, count, TIMES_8, offset));
-  cmpq(temp, FieldAddress(reg2, count, TIMES_8, offset));
-  BranchIf(EQUAL, &loop, Assembler::kNearJump);
+  Bind(&loop);
+  cmpq(count, Immediate(2));
+  j(LESS, &last_word, Assembler::kNearJump);
+  subq(count, Immediate(2));
+  movups(FpuTMP, FieldAddress(reg1, count, TIMES_8, offset));
+  movups(XMM0, FieldAddress(reg2, count, TIMES_8, offset));
+  pcmpeqb(FpuTMP, XMM0);
+  pmovmskb(temp, FpuTMP);
+  cmpl(temp, Immediate(0xFFFF));
+  j(EQUAL, &loop, Assembler::kNearJump);
+  jmp(&not_equal, Assembler::kNearJump);
+
+  // At most one word is left.
+  Bind(&last_word);
+  testq(count, count);
+  j(ZERO, equals, Assembler::kNearJump);
+  movq(temp, FieldAddress(reg1, offset));
+  cmpq(temp, FieldAddress(reg2, offset));
+  j(EQUAL, equals, Assembler::kNearJump);
+  Bind(&not_equal);
 }
 
 void Assembler::EnterFrame(intptr_t frame_size) {
@@ -458,6 +458,7 @@ class Assembler : public AssemblerBase {
   XX(L, cvtpd2ps, 0x5A, 0x0F, 0x66)
   XX(L, cvtsd2ss, 0x5A, 0x0F, 0xF2)
   XX(L, cvtss2sd, 0x5A, 0x0F, 0xF3)
+  XX(L, pcmpeqb, 0x74, 0x0F, 0x66)
   XX(L, pxor, 0xEF, 0x0F, 0x66)
   XX(L, subpl, 0xFA, 0x0F, 0x66)
   XX(L, addpl, 0xFE, 0x0F, 0x66)
@@ -1022,6 +1023,7 @@ class Assembler : public AssemblerBase {
   }
 
   void ArithmeticShiftRightImmediate(Register reg, intptr_t shift) override;
+  // Compares two words at a time using SSE2. Clobbers XMM0 and FpuTMP.
   void CompareWords(Register reg1,
                     Register reg2,
                     intptr_t offset,
@@ -5287,6 +5287,24 @@ ASSEMBLER_TEST_RUN(Pxor, test) {
       "ret\n");
 }
 
+ASSEMBLER_TEST_GENERATE(Pcmpeqb, assembler) {
+  __ movaps(XMM1, XMM0);
+  __ pcmpeqb(XMM0, XMM1);
+  __ pmovmskb(RAX, XMM0);
+  __ ret();
+}
+
+ASSEMBLER_TEST_RUN(Pcmpeqb, test) {
+  typedef intptr_t (*PcmpeqbCode)(double d);
+  intptr_t res = reinterpret_cast<PcmpeqbCode>(test->entry())(12.3456e3);
+  EXPECT_EQ(0xFFFF, res);
+  EXPECT_DISASSEMBLY(
+      "movaps xmm1,xmm0\n"
+      "pcmpeqb xmm0,xmm1\n"
+      "pmovmskb rax,xmm0\n"
+      "ret\n");
+}
+
 ASSEMBLER_TEST_GENERATE(SquareRootDouble, assembler) {
   __ sqrtsd(XMM0, XMM0);
   __ ret();
@@ -1375,6 +1375,8 @@ int DisassemblerX64::TwoByteOpcodeInstruction(uint8_t* data) {
           mnemonic = "paddd";
         } else if (opcode == 0xFA) {
           mnemonic = "psubd";
+        } else if (opcode == 0x74) {
+          mnemonic = "pcmpeqb";
         } else if (opcode == 0xEF) {
           mnemonic = "pxor";
         } else {
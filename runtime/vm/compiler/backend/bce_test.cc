@@ -63,6 +63,23 @@ static std::pair<intptr_t, intptr_t> ApplyBCE(const char* script_chars,
   return {num_bc_before, num_bc_after};
 }
 
+// Helper method to count number of bounds checks inside loops.
+static intptr_t CountBoundChecksInLoops(FlowGraph* flow_graph) {
+  flow_graph->GetLoopHierarchy();
+  intptr_t count = 0;
+  for (BlockIterator block_it = flow_graph->reverse_postorder_iterator();
+       !block_it.Done(); block_it.Advance()) {
+    if (block_it.Current()->loop_info() == nullptr) continue;
+    for (ForwardInstructionIterator it(block_it.Current()); !it.Done();
+         it.Advance()) {
+      if (it.Current()->IsCheckBoundBase()) {
+        count++;
+      }
+    }
+  }
+  return count;
+}
+
 static void TestScriptJIT(const char* script_chars,
                           intptr_t expected_before,
                           intptr_t expected_after) {
@@ -294,4 +311,47 @@ ISOLATE_UNIT_TEST_CASE(BCEListNamedAndPlainLength) {
   TestScriptJIT(kScriptChars, 2, 0);
 }
 
+ISOLATE_UNIT_TEST_CASE(BCESplitLoopAOT) {
+  const char* kScriptChars =
+      R"(
+      import 'dart:typed_data';
+      int foo(Uint8List l, int n) {
+        int sum = 0;
+        for (int i = 0; i < n; i++) {
+          sum += l[i];
+        }
+        return sum;
+      }
+      main() {
+        foo(new Uint8List(100), 50);
+      }
+    )";
+  const auto& root_library = Library::Handle(LoadTestScript(kScriptChars));
+  Invoke(root_library, "main");
+  std::initializer_list<CompilerPass::Id> passes = {
+      CompilerPass::kComputeSSA,
+      CompilerPass::kApplyClassIds,
+      CompilerPass::kTypePropagation,
+      CompilerPass::kApplyICData,
+      CompilerPass::kInlining,
+      CompilerPass::kTypePropagation,
+      CompilerPass::kApplyICData,
+      CompilerPass::kOptimizeTypedDataAccesses,
+      CompilerPass::kSelectRepresentations,
+      CompilerPass::kCanonicalize,
+      CompilerPass::kConstantPropagation,
+      CompilerPass::kCSE,
+      CompilerPass::kLICM,
+  };
+  const auto& function = Function::Handle(GetFunction(root_library, "foo"));
+  TestPipeline pipeline(function, CompilerPass::kAOT);
+  FlowGraph* flow_graph = pipeline.RunPasses(passes);
+  EXPECT_EQ(1, CountBoundChecksInLoops(flow_graph));
+  RangeAnalysis range_analysis(flow_graph);
+  range_analysis.Analyze();
+  // The check on l[i] is taken out of the loop, not removed.
+  EXPECT_EQ(1, CountBoundChecks(flow_graph));
+  EXPECT_EQ(0, CountBoundChecksInLoops(flow_graph));
+}
+
 }  // namespace dart
@@ -243,7 +243,8 @@ void BlockScheduler::ReorderBlocksJIT(FlowGraph* flow_graph) {
 // AOT block order is based on reverse post order but with two changes:
 //
 // - Blocks which always throw and their direct predecessors are considered
-// *cold* and moved to the end of the order.
+// *cold* and moved to the end of the order. So are exception handlers and
+// blocks which are only reachable from them.
 // - Blocks which belong to the same loop are kept together (where possible)
 // and not interspersed with other blocks.
 //
@@ -260,6 +261,7 @@ class AOTBlockScheduler {
   }
 
   void ComputeOrder() {
+    MarkColdHandlers();
     ComputeOrderImpl();
 
     const auto codegen_order = flow_graph_->CodegenBlockOrder();
@@ -272,6 +274,26 @@ class AOTBlockScheduler {
   }
 
  private:
+  // Marks catch entries and blocks dominated by them as cold: this code only
+  // runs when an exception is thrown. Blocks in loops within handlers are
+  // conservatively left alone, as their back edges are not processed yet.
+  void MarkColdHandlers() {
+    for (auto block : flow_graph_->reverse_postorder()) {
+      auto& marks = MarksOf(block);
+      if (block->IsCatchBlockEntry()) {
+        marks |= kColdMark;
+        continue;
+      }
+      const intptr_t predecessor_count = block->PredecessorCount();
+      if (predecessor_count == 0) continue;
+      uint8_t cold_mark = kColdMark;
+      for (intptr_t i = 0; i < predecessor_count; i++) {
+        cold_mark &= MarksOf(block->PredecessorAt(i));
+      }
+      marks |= cold_mark;
+    }
+  }
+
   // The algorithm below is almost identical to |FlowGraph::DiscoverBlocks|, but
   // with few tweaks which guarantee improved scheduling for cold code and
   // loops.
@@ -350,7 +372,8 @@ class AOTBlockScheduler {
   static constexpr uint8_t kSeenMark = 1 << 0;
   // The block was visited and all of its successors were added to the stack.
   static constexpr uint8_t kVisitedMark = 1 << 1;
-  // The block terminates with unconditional throw or rethrow.
+  // The block terminates with unconditional throw or rethrow, or belongs to
+  // an exception handler.
   static constexpr uint8_t kColdMark = 1 << 2;
   // The block should not move to cold section.
   static constexpr uint8_t kPinnedMark = 1 << 3;
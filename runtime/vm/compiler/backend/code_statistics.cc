@@ -12,6 +12,10 @@ CombinedCodeStatistics::CombinedCodeStatistics() {
   object_header_bytes_ = 0;
   return_const_count_ = 0;
   return_const_with_load_field_count_ = 0;
+  spill_count_ = 0;
+  reload_count_ = 0;
+  reload_in_loop_count_ = 0;
+  constant_load_count_ = 0;
   intptr_t i = 0;
 
 #define DO(type, attrs)                                                        \
@@ -105,6 +109,12 @@ void CombinedCodeStatistics::DumpStatistics() {
   OS::PrintErr("% 8" Pd " return-constant-with-load-field functions\n",
                return_const_with_load_field_count_);
   OS::PrintErr("--------------------\n");
+  OS::PrintErr("% 8" Pd " spills\n", spill_count_);
+  OS::PrintErr("% 8" Pd " reloads (%" Pd " inside loops)\n", reload_count_,
+               reload_in_loop_count_);
+  OS::PrintErr("% 8" Pd " constants loaded into registers\n",
+               constant_load_count_);
+  OS::PrintErr("--------------------\n");
 }
 
 int CombinedCodeStatistics::CompareEntries(const void* a, const void* b) {
@@ -125,6 +135,10 @@ CodeStatistics::CodeStatistics(compiler::Assembler* assembler)
   instruction_bytes_ = 0;
   unaccounted_bytes_ = 0;
   alignment_bytes_ = 0;
+  spill_count_ = 0;
+  reload_count_ = 0;
+  reload_in_loop_count_ = 0;
+  constant_load_count_ = 0;
 
   stack_index_ = -1;
   for (intptr_t i = 0; i < kStackSize; i++)
@@ -132,6 +146,13 @@ CodeStatistics::CodeStatistics(compiler::Assembler* assembler)
 }
 
 void CodeStatistics::Begin(Instruction* instruction) {
+  if (auto* move = instruction->AsParallelMove()) {
+    CountMoves(move);
+  } else if (auto* jump = instruction->AsGoto()) {
+    if (jump->HasParallelMove()) CountMoves(jump->parallel_move());
+  } else if (auto* block = instruction->AsBlockEntry()) {
+    if (block->HasParallelMove()) CountMoves(block->parallel_move());
+  }
   SpecialBegin(static_cast<intptr_t>(instruction->statistics_tag()));
 }
 
@@ -163,6 +184,32 @@ void CodeStatistics::SpecialEnd(intptr_t tag) {
   stack_index_--;
 }
 
+static bool IsRegisterLocation(Location loc) {
+  return loc.IsRegister() || loc.IsFpuRegister() || loc.IsPairLocation();
+}
+
+static bool IsStackLocation(Location loc) {
+  return loc.IsStackSlot() || loc.IsDoubleStackSlot() || loc.IsQuadStackSlot();
+}
+
+void CodeStatistics::CountMoves(ParallelMoveInstr* move) {
+  const bool in_loop = move->GetBlock()->loop_info() != nullptr;
+  for (intptr_t i = 0; i < move->NumMoves(); i++) {
+    MoveOperands* operands = move->MoveOperandsAt(i);
+    if (operands->IsRedundant()) continue;
+    const Location src = operands->src();
+    const Location dest = operands->dest();
+    if (IsRegisterLocation(src) && IsStackLocation(dest)) {
+      spill_count_++;
+    } else if (IsStackLocation(src) && IsRegisterLocation(dest)) {
+      reload_count_++;
+      if (in_loop) reload_in_loop_count_++;
+    } else if (src.IsConstant() && IsRegisterLocation(dest)) {
+      constant_load_count_++;
+    }
+  }
+}
+
 void CodeStatistics::Finalize() {
   intptr_t function_size = assembler_->CodeSize();
   unaccounted_bytes_ = function_size - instruction_bytes_;
@@ -200,6 +247,10 @@ void CodeStatistics::AppendTo(CombinedCodeStatistics* stat) {
   ASSERT(stat->unaccounted_bytes_ >= 0);
   stat->alignment_bytes_ += alignment_bytes_;
   stat->object_header_bytes_ += Instructions::HeaderSize();
+  stat->spill_count_ += spill_count_;
+  stat->reload_count_ += reload_count_;
+  stat->reload_in_loop_count_ += reload_in_loop_count_;
+  stat->constant_load_count_ += constant_load_count_;
 
   if (returns_constant) stat->return_const_count_++;
   if (returns_const_with_load_field_) {
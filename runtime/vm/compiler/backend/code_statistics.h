@@ -67,6 +67,10 @@ class CombinedCodeStatistics {
   intptr_t object_header_bytes_;
   intptr_t return_const_count_;
   intptr_t return_const_with_load_field_count_;
+  intptr_t spill_count_;
+  intptr_t reload_count_;
+  intptr_t reload_in_loop_count_;
+  intptr_t constant_load_count_;
 };
 
 class CodeStatistics {
@@ -86,6 +90,10 @@ class CodeStatistics {
  private:
   static constexpr int kStackSize = 8;
 
+  // Counts register allocator spills (register to stack), reloads
+  // (stack to register) and constants materialized into registers.
+  void CountMoves(ParallelMoveInstr* move);
+
   compiler::Assembler* assembler_;
 
   typedef struct {
@@ -97,6 +105,10 @@ class CodeStatistics {
   intptr_t instruction_bytes_;
   intptr_t unaccounted_bytes_;
   intptr_t alignment_bytes_;
+  intptr_t spill_count_;
+  intptr_t reload_count_;
+  intptr_t reload_in_loop_count_;
+  intptr_t constant_load_count_;
 
   intptr_t stack_[kStackSize];
   intptr_t stack_index_;
@@ -956,45 +956,6 @@ Definition* AllocateClosureInstr::Canonicalize(FlowGraph* flow_graph) {
   return this;
 }
 
-LocationSummary* AllocateClosureInstr::MakeLocationSummary(Zone* zone,
-                                                           bool opt) const {
-  const intptr_t kNumInputs = InputCount();
-  const intptr_t kNumTemps = 0;
-  LocationSummary* locs = new (zone)
-      LocationSummary(zone, kNumInputs, kNumTemps, LocationSummary::kCall);
-  locs->set_in(kFunctionPos,
-               Location::RegisterLocation(AllocateClosureABI::kFunctionReg));
-  locs->set_in(kContextPos,
-               Location::RegisterLocation(AllocateClosureABI::kContextReg));
-  if (has_instantiator_type_args()) {
-    locs->set_in(kInstantiatorTypeArgsPos,
-                 Location::RegisterLocation(
-                     AllocateClosureABI::kInstantiatorTypeArgsReg));
-  }
-  locs->set_out(0, Location::RegisterLocation(AllocateClosureABI::kResultReg));
-  return locs;
-}
-
-void AllocateClosureInstr::EmitNativeCode(FlowGraphCompiler* compiler) {
-  auto object_store = compiler->isolate_group()->object_store();
-  Code& stub = Code::ZoneHandle(compiler->zone());
-  if (has_instantiator_type_args()) {
-    if (is_generic()) {
-      stub = object_store->allocate_closure_ta_generic_stub();
-    } else {
-      stub = object_store->allocate_closure_ta_stub();
-    }
-  } else {
-    if (is_generic()) {
-      stub = object_store->allocate_closure_generic_stub();
-    } else {
-      stub = object_store->allocate_closure_stub();
-    }
-  }
-  compiler->GenerateStubCall(source(), stub, UntaggedPcDescriptors::kOther,
-                             locs(), deopt_id(), env());
-}
-
 LocationSummary* AllocateTypedDataInstr::MakeLocationSummary(Zone* zone,
                                                              bool opt) const {
   const intptr_t kNumInputs = 1;
@@ -3070,15 +3031,30 @@ Definition* AssertBooleanInstr::Canonicalize(FlowGraph* flow_graph) {
   return this;
 }
 
+// Reports a type check which is removed because the checked value is known
+// to have the destination type, e.g. due to a dominating 'is' test or cast.
+static void PrintRedundantTypeCheck(FlowGraph* flow_graph,
+                                    AssertAssignableInstr* check,
+                                    const AbstractType& dst_type) {
+  if (flow_graph->should_print()) {
+    THR_Print("Removed redundant type check of v%" Pd " (%s) against %s\n",
+              check->value()->definition()->ssa_temp_index(),
+              check->value()->Type()->ToCString(), dst_type.ToCString());
+  }
+}
+
 Definition* AssertAssignableInstr::Canonicalize(FlowGraph* flow_graph) {
   // We need dst_type() to be a constant AbstractType to perform any
   // canonicalization.
   if (!dst_type()->BindsToConstant()) return this;
   const auto& abs_type = AbstractType::Cast(dst_type()->BoundConstant());
 
-  if (abs_type.IsTopTypeForSubtyping() ||
-      (FLAG_eliminate_type_checks &&
-       value()->Type()->IsAssignableTo(abs_type))) {
+  if (abs_type.IsTopTypeForSubtyping()) {
+    return value()->definition();
+  }
+  if (FLAG_eliminate_type_checks &&
+      value()->Type()->IsAssignableTo(abs_type)) {
+    PrintRedundantTypeCheck(flow_graph, this, abs_type);
     return value()->definition();
   }
   if (abs_type.IsInstantiated()) {
@@ -3161,9 +3137,12 @@ Definition* AssertAssignableInstr::Canonicalize(FlowGraph* flow_graph) {
     instantiator_type_arguments()->BindTo(flow_graph->constant_null());
     function_type_arguments()->BindTo(flow_graph->constant_null());
 
-    if (new_dst_type.IsTopTypeForSubtyping() ||
-        (FLAG_eliminate_type_checks &&
-         value()->Type()->IsAssignableTo(new_dst_type))) {
+    if (new_dst_type.IsTopTypeForSubtyping()) {
+      return value()->definition();
+    }
+    if (FLAG_eliminate_type_checks &&
+        value()->Type()->IsAssignableTo(new_dst_type)) {
+      PrintRedundantTypeCheck(flow_graph, this, new_dst_type);
       return value()->definition();
     }
   }
@@ -6942,6 +6921,22 @@ static const intptr_t kMaxElementSizeForEfficientCopy =
     compiler::target::kWordSize;
 #endif
 
+#if defined(TARGET_ARCH_X64) || defined(TARGET_ARCH_ARM64)
+// Both allow unaligned accesses, so unrolled copies can use the widest moves
+// even if the start offsets are not known at compile time (e.g. assigning a
+// Struct through .ref). Copies of constant length up to this many bytes
+// are unrolled.
+static const intptr_t kMaxUnrolledCopyBytes = 64;
+#endif
+
+intptr_t MemoryCopyInstr::MaxUnrolledLength() const {
+#if defined(TARGET_ARCH_X64) || defined(TARGET_ARCH_ARM64)
+  return Utils::Maximum<intptr_t>(4, kMaxUnrolledCopyBytes / element_size_);
+#else
+  return 4;
+#endif
+}
+
 Instruction* MemoryCopyInstr::Canonicalize(FlowGraph* flow_graph) {
   flow_graph->ExtractExternalUntaggedPayload(this, src(), src_cid_);
   flow_graph->ExtractExternalUntaggedPayload(this, dest(), dest_cid_);
@@ -7103,8 +7098,17 @@ void MemoryCopyInstr::EmitUnrolledCopy(FlowGraphCompiler* compiler,
   const intptr_t mov_size =
       Utils::Minimum<intptr_t>(element_size_, compiler::target::kWordSize);
 #endif
-  const intptr_t mov_repeat = num_bytes / mov_size;
   ASSERT(num_bytes % mov_size == 0);
+#if defined(TARGET_ARCH_X64) || defined(TARGET_ARCH_ARM64)
+  // Copy the bulk with the widest moves and the remainder with decreasingly
+  // smaller ones, regardless of the element size.
+  const intptr_t wide_mov_size =
+      Utils::Maximum(mov_size, kMaxElementSizeForEfficientCopy);
+#else
+  const intptr_t wide_mov_size = mov_size;
+#endif
+  const intptr_t wide_mov_repeat = num_bytes / wide_mov_size;
+  const intptr_t remainder = num_bytes % wide_mov_size;
 
 #if defined(TARGET_ARCH_IA32)
   // No TMP on IA32, so we have to allocate one instead.
@@ -7112,9 +7116,8 @@ void MemoryCopyInstr::EmitUnrolledCopy(FlowGraphCompiler* compiler,
 #else
   const Register temp_reg = TMP;
 #endif
-  for (intptr_t i = 0; i < mov_repeat; i++) {
-    const intptr_t offset = (reversed ? (mov_repeat - (i + 1)) : i) * mov_size;
-    switch (mov_size) {
+  auto emit_move = [&](intptr_t offset, intptr_t size) {
+    switch (size) {
       case 1:
         __ LoadFromOffset(temp_reg, src_reg, offset, compiler::kUnsignedByte);
         __ StoreToOffset(temp_reg, dest_reg, offset, compiler::kUnsignedByte);
@@ -7155,6 +7158,31 @@ void MemoryCopyInstr::EmitUnrolledCopy(FlowGraphCompiler* compiler,
       default:
         UNREACHABLE();
     }
+  };
+  // In both directions each move completes before the next one starts, so
+  // the regions are copied correctly even if they overlap.
+  if (reversed) {
+    intptr_t offset = num_bytes;
+    for (intptr_t size = mov_size; size < wide_mov_size; size <<= 1) {
+      if ((remainder & size) != 0) {
+        offset -= size;
+        emit_move(offset, size);
+      }
+    }
+    for (intptr_t i = wide_mov_repeat - 1; i >= 0; i--) {
+      emit_move(i * wide_mov_size, wide_mov_size);
+    }
+  } else {
+    for (intptr_t i = 0; i < wide_mov_repeat; i++) {
+      emit_move(i * wide_mov_size, wide_mov_size);
+    }
+    intptr_t offset = wide_mov_repeat * wide_mov_size;
+    for (intptr_t size = wide_mov_size >> 1; size >= mov_size; size >>= 1) {
+      if ((remainder & size) != 0) {
+        emit_move(offset, size);
+        offset += size;
+      }
+    }
   }
 
   if (FLAG_target_memory_sanitizer) {
@@ -7252,6 +7280,30 @@ const RuntimeEntry& InvokeMathCFunctionInstr::TargetFunction() const {
 }
 
 Definition* InvokeMathCFunctionInstr::Canonicalize(FlowGraph* flow_graph) {
+  // Exponents 0, 1 and 2 have exact results, which the generated code for pow
+  // also special cases (see InvokeDoublePow). When the exponent is constant,
+  // avoid the call and the register spills around it.
+  if ((recognized_kind_ == MethodRecognizer::kMathDoublePow) &&
+      InputAt(1)->BindsToConstant() &&
+      InputAt(1)->BoundConstant().IsDouble()) {
+    const double exponent = Double::Cast(InputAt(1)->BoundConstant()).value();
+    Definition* base = InputAt(0)->definition();
+    if (exponent == 0.0) {
+      return flow_graph->GetConstant(
+          Double::ZoneHandle(Double::NewCanonical(1.0)), kUnboxedDouble);
+    }
+    if (exponent == 1.0) {
+      return base;
+    }
+    if (exponent == 2.0) {
+      auto* square = new BinaryDoubleOpInstr(
+          Token::kMUL, new Value(base), new Value(base), GetDeoptId(),
+          source(), Instruction::kNotSpeculative, kUnboxedDouble);
+      flow_graph->InsertBefore(this, square, env(), FlowGraph::kValue);
+      return square;
+    }
+  }
+
   if (!CompilerState::Current().is_aot() &&
       TargetCPUFeatures::double_truncate_round_supported()) {
     Token::Kind op_kind = Token::kILLEGAL;
@@ -8614,6 +8666,151 @@ void SuspendInstr::EmitNativeCode(FlowGraphCompiler* compiler) {
 #endif
 }
 
+// Whether optimized code allocates closures inline, only calling the
+// allocation stub when the TLAB is exhausted.
+static bool ShouldInlineClosureAllocation(bool opt) {
+#if defined(TARGET_ARCH_IA32)
+  return false;
+#else
+  return opt && FLAG_inline_alloc && !FLAG_use_slow_path;
+#endif
+}
+
+LocationSummary* AllocateClosureInstr::MakeLocationSummary(Zone* zone,
+                                                           bool opt) const {
+  const intptr_t kNumInputs = InputCount();
+  const bool inline_allocation = ShouldInlineClosureAllocation(opt);
+  const intptr_t kNumTemps = inline_allocation ? 1 : 0;
+  LocationSummary* locs = new (zone) LocationSummary(
+      zone, kNumInputs, kNumTemps,
+      inline_allocation ? LocationSummary::kCallOnSlowPath
+                        : LocationSummary::kCall);
+  locs->set_in(kFunctionPos,
+               Location::RegisterLocation(AllocateClosureABI::kFunctionReg));
+  locs->set_in(kContextPos,
+               Location::RegisterLocation(AllocateClosureABI::kContextReg));
+  if (has_instantiator_type_args()) {
+    locs->set_in(kInstantiatorTypeArgsPos,
+                 Location::RegisterLocation(
+                     AllocateClosureABI::kInstantiatorTypeArgsReg));
+  }
+  if (inline_allocation) {
+    locs->set_temp(0,
+                   Location::RegisterLocation(AllocateClosureABI::kScratchReg));
+  }
+  locs->set_out(0, Location::RegisterLocation(AllocateClosureABI::kResultReg));
+  return locs;
+}
+
+static const Code& AllocateClosureStub(FlowGraphCompiler* compiler,
+                                       bool has_instantiator_type_args,
+                                       bool is_generic) {
+  auto object_store = compiler->isolate_group()->object_store();
+  Code& stub = Code::ZoneHandle(compiler->zone());
+  if (has_instantiator_type_args) {
+    if (is_generic) {
+      stub = object_store->allocate_closure_ta_generic_stub();
+    } else {
+      stub = object_store->allocate_closure_ta_stub();
+    }
+  } else {
+    if (is_generic) {
+      stub = object_store->allocate_closure_generic_stub();
+    } else {
+      stub = object_store->allocate_closure_stub();
+    }
+  }
+  return stub;
+}
+
+#if !defined(TARGET_ARCH_IA32)
+class AllocateClosureSlowPath
+    : public TemplateSlowPathCode<AllocateClosureInstr> {
+ public:
+  explicit AllocateClosureSlowPath(AllocateClosureInstr* instruction)
+      : TemplateSlowPathCode(instruction) {}
+
+  virtual void EmitNativeCode(FlowGraphCompiler* compiler) {
+    __ Comment("AllocateClosureSlowPath");
+    __ Bind(entry_label());
+
+    LocationSummary* locs = instruction()->locs();
+    locs->live_registers()->Remove(locs->out(0));
+    compiler->SaveLiveRegisters(locs);
+
+    auto slow_path_env = compiler->SlowPathEnvironmentFor(
+        instruction(), /*num_slow_path_args=*/0);
+    ASSERT(slow_path_env != nullptr);
+
+    const auto& stub = AllocateClosureStub(
+        compiler, instruction()->has_instantiator_type_args(),
+        instruction()->is_generic());
+    compiler->GenerateStubCall(instruction()->source(), stub,
+                               UntaggedPcDescriptors::kOther, locs,
+                               instruction()->deopt_id(), slow_path_env);
+
+    compiler->RestoreLiveRegisters(locs);
+    __ Jump(exit_label());
+  }
+};
+#endif  // !defined(TARGET_ARCH_IA32)
+
+void AllocateClosureInstr::EmitNativeCode(FlowGraphCompiler* compiler) {
+#if !defined(TARGET_ARCH_IA32)
+  if (ShouldInlineClosureAllocation(compiler->is_optimizing())) {
+    // Same as the fast path of the allocation stub, see
+    // StubCodeCompiler::GenerateAllocateClosureStub.
+    const Register result = AllocateClosureABI::kResultReg;
+    const Register scratch = AllocateClosureABI::kScratchReg;
+    ASSERT(locs()->temp(0).reg() == scratch);
+    auto* slow_path = new AllocateClosureSlowPath(this);
+    compiler->AddSlowPathCode(slow_path);
+    const intptr_t instance_size = compiler::target::RoundedAllocationSize(
+        compiler::target::Closure::InstanceSize());
+    __ TryAllocateObject(kClosureCid, instance_size, slow_path->entry_label(),
+                         compiler::Assembler::kFarJump, result, scratch);
+
+    // The object is in new space, so no barriers are needed.
+    __ LoadObject(scratch, Object::null_object());
+    const Register instantiator_type_args =
+        has_instantiator_type_args()
+            ? AllocateClosureABI::kInstantiatorTypeArgsReg
+            : scratch;
+    __ StoreToSlotNoBarrier(instantiator_type_args, result,
+                            Slot::Closure_instantiator_type_arguments());
+    __ StoreToSlotNoBarrier(scratch, result,
+                            Slot::Closure_function_type_arguments());
+    if (!is_generic()) {
+      __ StoreToSlotNoBarrier(scratch, result,
+                              Slot::Closure_delayed_type_arguments());
+    }
+    __ StoreToSlotNoBarrier(AllocateClosureABI::kFunctionReg, result,
+                            Slot::Closure_function());
+    __ StoreToSlotNoBarrier(AllocateClosureABI::kContextReg, result,
+                            Slot::Closure_context());
+    __ StoreToSlotNoBarrier(scratch, result, Slot::Closure_hash());
+    if (is_generic()) {
+      __ LoadObject(scratch, Object::empty_type_arguments());
+      __ StoreToSlotNoBarrier(scratch, result,
+                              Slot::Closure_delayed_type_arguments());
+    }
+#if defined(DART_PRECOMPILER)
+    if (FLAG_precompiled_mode) {
+      __ LoadFromSlot(scratch, AllocateClosureABI::kFunctionReg,
+                      Slot::Function_entry_point());
+      __ StoreToSlotNoBarrier(scratch, result, Slot::Closure_entry_point());
+    }
+#endif
+    __ Bind(slow_path->exit_label());
+    return;
+  }
+#endif  // !defined(TARGET_ARCH_IA32)
+  compiler->GenerateStubCall(
+      source(),
+      AllocateClosureStub(compiler, has_instantiator_type_args(), is_generic()),
+      UntaggedPcDescriptors::kOther, locs(), deopt_id(), env());
+}
+
 LocationSummary* AllocateRecordInstr::MakeLocationSummary(Zone* zone,
                                                           bool opt) const {
   const intptr_t kNumInputs = 0;
@@ -3219,6 +3219,10 @@ class MemoryCopyInstr : public TemplateInstruction<5, NoThrow> {
   // Optimizes MemoryCopyInstr with constant parameters to use larger moves.
   virtual Instruction* Canonicalize(FlowGraph* flow_graph);
 
+  // The largest constant length (in elements) which is copied by unrolled
+  // moves instead of a loop.
+  intptr_t MaxUnrolledLength() const;
+
   PRINT_OPERANDS_TO_SUPPORT
 
   DECLARE_ATTRIBUTE(element_size());
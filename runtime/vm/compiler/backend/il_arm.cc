@@ -185,8 +185,8 @@ LocationSummary* MemoryCopyInstr::MakeLocationSummary(Zone* zone,
   locs->set_in(kDestPos, Location::RequiresRegister());
   locs->set_in(kSrcStartPos, LocationRegisterOrConstant(src_start()));
   locs->set_in(kDestStartPos, LocationRegisterOrConstant(dest_start()));
-  locs->set_in(kLengthPos,
-               LocationWritableRegisterOrSmiConstant(length(), 0, 4));
+  locs->set_in(kLengthPos, LocationWritableRegisterOrSmiConstant(
+                               length(), 0, MaxUnrolledLength()));
   for (intptr_t i = 0; i < kNumTemps; i++) {
     locs->set_temp(i, Location::RequiresRegister());
   }
@@ -171,8 +171,8 @@ LocationSummary* MemoryCopyInstr::MakeLocationSummary(Zone* zone,
   locs->set_in(kDestPos, Location::RequiresRegister());
   locs->set_in(kSrcStartPos, LocationRegisterOrConstant(src_start()));
   locs->set_in(kDestStartPos, LocationRegisterOrConstant(dest_start()));
-  locs->set_in(kLengthPos,
-               LocationWritableRegisterOrSmiConstant(length(), 0, 4));
+  locs->set_in(kLengthPos, LocationWritableRegisterOrSmiConstant(
+                               length(), 0, MaxUnrolledLength()));
   locs->set_temp(0, Location::RequiresRegister());
   locs->set_temp(1, Location::RequiresRegister());
   return locs;
@@ -86,7 +86,8 @@ LocationSummary* MemoryCopyInstr::MakeLocationSummary(Zone* zone,
           !IsTypedDataBaseClassId(dest_cid_)) ||
          opt);
   const bool remove_loop =
-      length()->BindsToSmiConstant() && length()->BoundSmiConstant() <= 4;
+      length()->BindsToSmiConstant() &&
+      length()->BoundSmiConstant() <= MaxUnrolledLength();
   const intptr_t kNumInputs = 5;
   const intptr_t kNumTemps = remove_loop ? 1 : 0;
   LocationSummary* locs = new (zone)
@@ -1757,4 +1757,52 @@ ISOLATE_UNIT_TEST_CASE(IL_RecordCoverageSurvivesOptimizations) {
   EXPECT(flow_graph->graph_entry()->normal_entry()->next()->IsRecordCoverage());
 }
 
+// Verifies that AOT block scheduling moves exception handlers after the code
+// which follows the try-catch statement.
+ISOLATE_UNIT_TEST_CASE(IL_AOTBlockOrderMovesHandlersToEnd) {
+  const char* kScript = R"(
+    @pragma('vm:never-inline')
+    int bar(int x) {
+      if (x == 0) throw 'x';
+      return x;
+    }
+
+    @pragma('vm:never-inline')
+    int foo(int x) {
+      int r;
+      try {
+        r = bar(x);
+      } catch (e) {
+        print(e);
+        r = -1;
+      }
+      return r + 1;
+    }
+
+    main() {
+      foo(0);
+      foo(1);
+    }
+  )";
+
+  const auto& root_library = Library::Handle(LoadTestScript(kScript));
+  const auto& function = Function::Handle(GetFunction(root_library, "foo"));
+  TestPipeline pipeline(function, CompilerPass::kAOT);
+  FlowGraph* flow_graph = pipeline.RunPasses({});
+
+  intptr_t catch_index = -1;
+  intptr_t return_index = -1;
+  const auto& order = *flow_graph->CodegenBlockOrder();
+  for (intptr_t i = 0; i < order.length(); i++) {
+    if (order[i]->IsCatchBlockEntry()) {
+      catch_index = i;
+    } else if (order[i]->last_instruction()->IsDartReturn()) {
+      return_index = i;
+    }
+  }
+  EXPECT(catch_index >= 0);
+  EXPECT(return_index >= 0);
+  EXPECT(catch_index > return_index);
+}
+
 }  // namespace dart
@@ -181,7 +181,8 @@ LocationSummary* MemoryCopyInstr::MakeLocationSummary(Zone* zone,
                needs_writable_inputs
                    ? LocationWritableRegisterOrConstant(dest_start())
                    : LocationRegisterOrConstant(dest_start()));
-  if (length()->BindsToSmiConstant() && length()->BoundSmiConstant() <= 4) {
+  if (length()->BindsToSmiConstant() &&
+      length()->BoundSmiConstant() <= MaxUnrolledLength()) {
     locs->set_in(
         kLengthPos,
         Location::Constant(
@@ -5,6 +5,7 @@
 #include "vm/compiler/backend/inliner.h"
 
 #include "vm/compiler/aot/aot_call_specializer.h"
+#include "vm/compiler/aot/aot_profile.h"
 #include "vm/compiler/aot/precompiler.h"
 #include "vm/compiler/backend/block_scheduler.h"
 #include "vm/compiler/backend/branch_optimizer.h"
@@ -70,6 +71,23 @@ DEFINE_FLAG(int,
             10,
             "Inline only hotter calls, in percents (0 .. 100); "
             "default 10%: calls above-equal 10% of max-count are inlined.");
+DEFINE_FLAG(int,
+            inlining_hot_call_site_percent,
+            100,
+            "Calls at or above this percent of max-count are hot and may "
+            "inline callees beyond the size thresholds, see "
+            "--inlining-hot-size-budget.");
+DEFINE_FLAG(int,
+            inlining_hot_size_budget,
+            0,
+            "Total number of instructions that callees exceeding the size "
+            "thresholds may add to a caller when inlined at hot call sites "
+            "(0 disables).");
+DEFINE_FLAG(int,
+            inlining_closed_type_arguments_size_threshold,
+            60,
+            "Inline generic functions that have threshold or fewer "
+            "instructions at AOT call sites passing closed type arguments.");
 DEFINE_FLAG(int,
             inlining_recursion_depth_threshold,
             1,
@@ -257,6 +275,41 @@ static intptr_t AotCallCountApproximation(intptr_t nesting_depth) {
   }
 }
 
+#if defined(DART_PRECOMPILER)
+static const String* SelectorOf(StaticCallInstr* call) {
+  return &String::Handle(call->function().name());
+}
+
+static const String* SelectorOf(InstanceCallBaseInstr* call) {
+  return &call->function_name();
+}
+
+static const String* SelectorOf(ClosureCallInstr* call) {
+  return nullptr;
+}
+#endif  // defined(DART_PRECOMPILER)
+
+// Returns the number of times |call| in |graph| is expected to execute in
+// AOT: the count recorded by a training run if the function containing the
+// call was profiled, or a static estimate otherwise.
+template <typename CallType>
+static intptr_t AotCallCount(FlowGraph* graph,
+                             CallType* call,
+                             intptr_t nesting_depth) {
+#if defined(DART_PRECOMPILER)
+  const AotProfile* profile = Precompiler::Instance() != nullptr
+                                  ? Precompiler::Instance()->profile()
+                                  : nullptr;
+  if (profile != nullptr && profile->HasProfile(graph->function())) {
+    const String* selector = SelectorOf(call);
+    return selector != nullptr ? profile->CallCount(graph->function(),
+                                                    call->deopt_id(), *selector)
+                               : 0;
+  }
+#endif  // defined(DART_PRECOMPILER)
+  return AotCallCountApproximation(nesting_depth);
+}
+
 // A collection of call sites to consider for inlining.
 class CallSites : public ValueObject {
  public:
@@ -278,7 +331,7 @@ class CallSites : public ValueObject {
           call_depth(call_depth),
           nesting_depth(nesting_depth) {
       if (CompilerState::Current().is_aot()) {
-        call_count = AotCallCountApproximation(nesting_depth);
+        call_count = AotCallCount(caller_graph, call, nesting_depth);
       } else {
         call_count = call->CallCount();
       }
@@ -372,6 +425,26 @@ class CallSites : public ValueObject {
     ComputeCallRatio(*calls_, calls_start_ix, max_count);
   }
 
+  template <typename CallType>
+  static int CompareByCallCount(const CallInfo<CallType>* a,
+                                const CallInfo<CallType>* b) {
+    if (a->call_count != b->call_count) {
+      return a->call_count > b->call_count ? -1 : 1;
+    }
+    // Keep the order deterministic for calls of equal frequency.
+    const intptr_t a_id = a->call->deopt_id();
+    const intptr_t b_id = b->call->deopt_id();
+    return a_id < b_id ? -1 : (a_id > b_id ? 1 : 0);
+  }
+
+  // Orders the call sites hottest first, so that size limits of the caller
+  // and the hot size budget are spent on the most frequent calls.
+  void SortByFrequency() {
+    instance_calls_.Sort(CompareByCallCount<PolymorphicInstanceCallInstr>);
+    static_calls_.Sort(CompareByCallCount<StaticCallInstr>);
+    closure_calls_.Sort(CompareByCallCount<ClosureCallInstr>);
+  }
+
   static void RecordAllNotInlinedFunction(
       FlowGraph* graph,
       intptr_t depth,
@@ -733,6 +806,8 @@ struct InlinedCallData {
   ZoneGrowableArray<Definition*>* parameter_stubs;
   InlineExitCollector* exit_collector;
   const Function& caller;
+  // Frequency of the call relative to the hottest call in the caller.
+  double call_ratio = 0.0;
 };
 
 class CallSiteInliner;
@@ -741,7 +816,8 @@ class PolymorphicInliner : public ValueObject {
  public:
   PolymorphicInliner(CallSiteInliner* owner,
                      PolymorphicInstanceCallInstr* call,
-                     const Function& caller_function);
+                     const Function& caller_function,
+                     double call_ratio);
 
   bool Inline();
 
@@ -771,6 +847,7 @@ class PolymorphicInliner : public ValueObject {
   InlineExitCollector* exit_collector_;
 
   const Function& caller_function_;
+  const double call_ratio_;
 };
 
 static bool IsAThisCallThroughAnUncheckedEntryPoint(Definition* call) {
@@ -984,6 +1061,7 @@ class CallSiteInliner : public ValueObject {
         inlined_(false),
         initial_size_(inliner->flow_graph()->InstructionCount()),
         inlined_size_(0),
+        hot_size_budget_(FLAG_inlining_hot_size_budget),
         inlined_recursive_call_(false),
         inlining_depth_(1),
         inlining_recursion_depth_(0),
@@ -1014,17 +1092,29 @@ class CallSiteInliner : public ValueObject {
     }
   };
 
-  // Inlining heuristics based on Cooper et al. 2008.
+  static constexpr const char* kHotSizeBudget = "--inlining-hot-size-budget";
+
+  static bool IsHotCallSite(double call_ratio) {
+    return (call_ratio * 100) >= FLAG_inlining_hot_call_site_percent;
+  }
+
+  // Inlining heuristics based on Cooper et al. 2008, extended with a budget
+  // for inlining larger callees at the hottest call sites.
   InliningDecision ShouldWeInline(const Function& callee,
                                   intptr_t instr_count,
-                                  intptr_t call_site_count) {
+                                  intptr_t call_site_count,
+                                  double call_ratio,
+                                  bool closed_type_arguments) {
+    const bool fits_hot_size_budget =
+        IsHotCallSite(call_ratio) && instr_count <= hot_size_budget_;
     // Pragma or size heuristics.
     if (inliner_->AlwaysInline(callee)) {
       return InliningDecision::Yes("AlwaysInline");
     } else if (inlined_size_ > FLAG_inlining_caller_size_threshold) {
       // Prevent caller methods becoming humongous and thus slow to compile.
       return InliningDecision::No("--inlining-caller-size-threshold");
-    } else if (instr_count > FLAG_inlining_callee_size_threshold) {
+    } else if (instr_count > FLAG_inlining_callee_size_threshold &&
+               !fits_hot_size_budget) {
       // Prevent inlining of callee methods that exceed certain size.
       return InliningDecision::No("--inlining-callee-size-threshold");
     }
@@ -1042,8 +1132,15 @@ class CallSiteInliner : public ValueObject {
       return InliningDecision::Yes("need to count first");
     } else if (instr_count <= FLAG_inlining_size_threshold) {
       return InliningDecision::Yes("--inlining-size-threshold");
+    } else if (closed_type_arguments &&
+               (instr_count <=
+                FLAG_inlining_closed_type_arguments_size_threshold)) {
+      return InliningDecision::Yes(
+          "--inlining-closed-type-arguments-size-threshold");
     } else if (call_site_count <= FLAG_inlining_callee_call_sites_threshold) {
       return InliningDecision::Yes("--inlining-callee-call-sites-threshold");
+    } else if (fits_hot_size_budget) {
+      return InliningDecision::Yes(kHotSizeBudget);
     }
     return InliningDecision::No("default");
   }
@@ -1082,6 +1179,7 @@ class CallSiteInliner : public ValueObject {
       collected_call_sites_ = inlining_call_sites_;
       inlining_call_sites_ = call_sites_temp;
       collected_call_sites_->Clear();
+      inlining_call_sites_->SortByFrequency();
       // Inline call sites at the current depth.
       bool inlined_instance = InlineInstanceCalls();
       bool inlined_statics = InlineStaticCalls();
@@ -1224,12 +1322,17 @@ class CallSiteInliner : public ValueObject {
     // are not counted yet, which makes this decision approximate.
     GrowableArray<Value*>* arguments = call_data->arguments;
     const intptr_t constant_arg_count = CountConstants(*arguments);
+    const bool closed_type_arguments =
+        CompilerState::Current().is_aot() &&
+        HasClosedTypeArguments(function, *call_data);
+    const bool specialized = constant_arg_count > 0 || closed_type_arguments;
     const intptr_t instruction_count =
-        constant_arg_count == 0 ? function.optimized_instruction_count() : 0;
+        !specialized ? function.optimized_instruction_count() : 0;
     const intptr_t call_site_count =
-        constant_arg_count == 0 ? function.optimized_call_site_count() : 0;
+        !specialized ? function.optimized_call_site_count() : 0;
     InliningDecision decision =
-        ShouldWeInline(function, instruction_count, call_site_count);
+        ShouldWeInline(function, instruction_count, call_site_count,
+                       call_data->call_ratio, closed_type_arguments);
     if (!decision.value) {
       TRACE_INLINING(
           THR_Print("     Bailout: early heuristics (%s) with "
@@ -1479,18 +1582,25 @@ class CallSiteInliner : public ValueObject {
                                            &call_site_count);
 
         // Use heuristics do decide if this call should be inlined.
+        bool uses_hot_size_budget = false;
         {
           COMPILER_TIMINGS_TIMER_SCOPE(thread(), MakeInliningDecision);
           InliningDecision decision =
-              ShouldWeInline(function, instruction_count, call_site_count);
+              ShouldWeInline(function, instruction_count, call_site_count,
+                             call_data->call_ratio, closed_type_arguments);
           if (!decision.value) {
             // If size is larger than all thresholds, don't consider it again.
+            // Callees which might still be inlined at a hot call site within
+            // the hot size budget are kept inlinable.
 
             // TODO(dartbug.com/49665): Make compiler smart enough so it itself
             // can identify highly-specialized functions that should always
             // be considered for inlining, without relying on a pragma.
             if ((instruction_count > FLAG_inlining_size_threshold) &&
-                (call_site_count > FLAG_inlining_callee_call_sites_threshold)) {
+                (call_site_count > FLAG_inlining_callee_call_sites_threshold) &&
+                (instruction_count > FLAG_inlining_hot_size_budget) &&
+                (instruction_count >
+                 FLAG_inlining_closed_type_arguments_size_threshold)) {
               // Will keep trying to inline the function if it can be
               // specialized based on argument types.
               if (!FlowGraphInliner::FunctionHasAlwaysConsiderInliningPragma(
@@ -1534,6 +1644,7 @@ class CallSiteInliner : public ValueObject {
               return false;
             }
           }
+          uses_hot_size_budget = decision.reason == kHotSizeBudget;
         }
 
         // Inline dispatcher methods regardless of the current depth.
@@ -1552,6 +1663,12 @@ class CallSiteInliner : public ValueObject {
         // Build succeeded so we restore the bailout jump.
         inlined_ = true;
         inlined_size_ += instruction_count;
+        if (uses_hot_size_budget) {
+          hot_size_budget_ -= instruction_count;
+          TRACE_INLINING(THR_Print("     Hot call site (ratio %f), remaining "
+                                   "hot size budget: %" Pd "\n",
+                                   call_data->call_ratio, hot_size_budget_));
+        }
         if (is_recursive_call) {
           inlined_recursive_call_ = true;
         }
@@ -1718,6 +1835,45 @@ class CallSiteInliner : public ValueObject {
     return count;
   }
 
+  static bool IsClosedTypeArguments(Value* value) {
+    if (!value->BindsToConstant()) return false;
+    const Object& constant = value->BoundConstant();
+    return constant.IsTypeArguments() &&
+           TypeArguments::Cast(constant).IsInstantiated();
+  }
+
+  // Whether the callee gets closed (constant and instantiated) type arguments
+  // at this call site: explicitly for generic functions and factories, or
+  // through a receiver allocated with them for methods of generic classes.
+  // Inlining then specializes the callee for these type arguments, so that
+  // type argument loads, instantiations and type checks fold away.
+  bool HasClosedTypeArguments(const Function& function,
+                              const InlinedCallData& call_data) {
+    const GrowableArray<Value*>& arguments = *call_data.arguments;
+    if (function.IsGeneric() && call_data.first_arg_index > 0) {
+      return IsClosedTypeArguments(arguments[0]);
+    }
+    if (function.IsFactory()) {
+      return !arguments.is_empty() && IsClosedTypeArguments(arguments[0]);
+    }
+    if (function.is_static() ||
+        arguments.length() <= call_data.first_arg_index) {
+      return false;
+    }
+    const auto& owner = Class::Handle(Z, function.Owner());
+    if (owner.NumTypeArguments() == 0) return false;
+    Definition* receiver = arguments[call_data.first_arg_index]
+                               ->definition()
+                               ->OriginalDefinition();
+    Value* type_arguments = nullptr;
+    if (auto* alloc = receiver->AsAllocateObject()) {
+      type_arguments = alloc->type_arguments();
+    } else if (auto* array = receiver->AsCreateArray()) {
+      type_arguments = array->type_arguments();
+    }
+    return type_arguments != nullptr && IsClosedTypeArguments(type_arguments);
+  }
+
   // Parse a function reusing the cache if possible.
   ParsedFunction* GetParsedFunction(const Function& function, bool* in_cache) {
     // TODO(zerny): Use a hash map for the cache.
@@ -1761,6 +1917,7 @@ class CallSiteInliner : public ValueObject {
       InlinedCallData call_data(
           call, Array::ZoneHandle(Z, call->GetArgumentsDescriptor()),
           call->FirstArgIndex(), &arguments, call_info[call_idx].caller());
+      call_data.call_ratio = call_info[call_idx].ratio;
 
       // Under AOT, calls outside loops may pass our regular heuristics due
       // to a relatively high ratio. So, unless we are optimizing solely for
@@ -1825,6 +1982,7 @@ class CallSiteInliner : public ValueObject {
       InlinedCallData call_data(call, arguments_descriptor,
                                 call->FirstArgIndex(), &arguments,
                                 call_info[call_idx].caller());
+      call_data.call_ratio = call_info[call_idx].ratio;
       if (TryInlining(target, call->argument_names(), &call_data, false)) {
         InlineCall(&call_data);
         inlined = true;
@@ -1847,7 +2005,7 @@ class CallSiteInliner : public ValueObject {
         continue;
       }
       const Function& cl = call_info[call_idx].caller();
-      PolymorphicInliner inliner(this, call, cl);
+      PolymorphicInliner inliner(this, call, cl, call_info[call_idx].ratio);
       if (inliner.Inline()) inlined = true;
     }
     return inlined;
@@ -1958,6 +2116,7 @@ class CallSiteInliner : public ValueObject {
   bool inlined_;
   const intptr_t initial_size_;
   intptr_t inlined_size_;
+  intptr_t hot_size_budget_;
   bool inlined_recursive_call_;
   intptr_t inlining_depth_;
   intptr_t inlining_recursion_depth_;
@@ -1972,7 +2131,8 @@ class CallSiteInliner : public ValueObject {
 
 PolymorphicInliner::PolymorphicInliner(CallSiteInliner* owner,
                                        PolymorphicInstanceCallInstr* call,
-                                       const Function& caller_function)
+                                       const Function& caller_function,
+                                       double call_ratio)
     : owner_(owner),
       call_(call),
       num_variants_(call->NumberOfChecks()),
@@ -1981,7 +2141,8 @@ PolymorphicInliner::PolymorphicInliner(CallSiteInliner* owner,
       non_inlined_variants_(new(zone()) CallTargets(zone())),
       inlined_entries_(num_variants_),
       exit_collector_(new(Z) InlineExitCollector(owner->caller_graph(), call)),
-      caller_function_(caller_function) {}
+      caller_function_(caller_function),
+      call_ratio_(call_ratio) {}
 
 IsolateGroup* PolymorphicInliner::isolate_group() const {
   return owner_->caller_graph()->isolate_group();
@@ -2080,6 +2241,10 @@ bool PolymorphicInliner::TryInliningPoly(const TargetInfo& target_info) {
       Array::ZoneHandle(Z, call_->GetArgumentsDescriptor());
   InlinedCallData call_data(call_, arguments_descriptor, call_->FirstArgIndex(),
                             &arguments, caller_function_);
+  // Each variant is only as hot as its share of the calls.
+  const intptr_t total_count = call_->targets().AggregateCallCount();
+  call_data.call_ratio =
+      total_count > 0 ? call_ratio_ * target_info.count / total_count : 0.0;
   Function& target = Function::ZoneHandle(zone(), target_info.target->ptr());
   if (!owner_->TryInlining(target, call_->argument_names(), &call_data,
                            false)) {
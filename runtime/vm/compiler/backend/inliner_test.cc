@@ -14,6 +14,11 @@
 
 namespace dart {
 
+DECLARE_FLAG(int, inlining_callee_size_threshold);
+DECLARE_FLAG(int, inlining_closed_type_arguments_size_threshold);
+DECLARE_FLAG(int, inlining_hot_size_budget);
+DECLARE_FLAG(int, inlining_size_threshold);
+
 // Test that the redefinition for an inlined polymorphic function used with
 // multiple receiver cids does not have a concrete type.
 ISOLATE_UNIT_TEST_CASE(Inliner_PolyInliningRedefinition) {
@@ -667,4 +672,110 @@ void main() {
   EXPECT_EQ(epilogue_count * 2, prologue_count);
 }
 
+static intptr_t CountStaticCallsTo(FlowGraph* flow_graph, const char* name) {
+  intptr_t count = 0;
+  for (BlockIterator block_it = flow_graph->reverse_postorder_iterator();
+       !block_it.Done(); block_it.Advance()) {
+    for (ForwardInstructionIterator it(block_it.Current()); !it.Done();
+         it.Advance()) {
+      if (auto* call = it.Current()->AsStaticCall()) {
+        if (strcmp(call->function().UserVisibleNameCString(), name) == 0) {
+          count++;
+        }
+      }
+    }
+  }
+  return count;
+}
+
+// Verifies that callees exceeding the size thresholds are inlined at the
+// hottest call site while the hot size budget lasts.
+ISOLATE_UNIT_TEST_CASE(Inliner_HotSizeBudget) {
+  const char* kScript = R"(
+    @pragma('vm:never-inline')
+    int use(int x) => x;
+
+    int big(int x) {
+      var r = use(x);
+      r += use(x + 1);
+      return r * x + (r ~/ 3);
+    }
+
+    int foo(int n) {
+      int s = big(n);
+      for (int i = 0; i < n; i++) {
+        s += big(i);
+      }
+      return s;
+    }
+
+    main() {
+      foo(10);
+    }
+  )";
+
+  const auto& root_library = Library::Handle(LoadTestScript(kScript));
+  const auto& function = Function::Handle(GetFunction(root_library, "foo"));
+
+  SetFlagScope<int> size_threshold(&FLAG_inlining_size_threshold, 1);
+  SetFlagScope<int> callee_size_threshold(&FLAG_inlining_callee_size_threshold,
+                                          1);
+  {
+    SetFlagScope<int> budget(&FLAG_inlining_hot_size_budget, 1000);
+    TestPipeline pipeline(function, CompilerPass::kAOT);
+    FlowGraph* flow_graph = pipeline.RunPasses({});
+    // Only the call outside of the loop remains.
+    EXPECT_EQ(1, CountStaticCallsTo(flow_graph, "big"));
+  }
+  {
+    SetFlagScope<int> budget(&FLAG_inlining_hot_size_budget, 0);
+    TestPipeline pipeline(function, CompilerPass::kAOT);
+    FlowGraph* flow_graph = pipeline.RunPasses({});
+    EXPECT_EQ(2, CountStaticCallsTo(flow_graph, "big"));
+  }
+}
+
+// Verifies that generic callees are inlined, and thereby specialized, at call
+// sites passing closed type arguments.
+ISOLATE_UNIT_TEST_CASE(Inliner_ClosedTypeArguments) {
+  const char* kScript = R"(
+    @pragma('vm:never-inline')
+    void use(Object? o) {}
+
+    void check<T>(Object? value) {
+      use(value as T);
+      use(<T>[]);
+    }
+
+    void foo<S>(Object? x) {
+      check<int>(x);
+      check<S>(x);
+    }
+
+    main() {
+      foo<String>(1);
+    }
+  )";
+
+  const auto& root_library = Library::Handle(LoadTestScript(kScript));
+  const auto& function = Function::Handle(GetFunction(root_library, "foo"));
+
+  SetFlagScope<int> size_threshold(&FLAG_inlining_size_threshold, 1);
+  {
+    SetFlagScope<int> closed_threshold(
+        &FLAG_inlining_closed_type_arguments_size_threshold, 1000);
+    TestPipeline pipeline(function, CompilerPass::kAOT);
+    FlowGraph* flow_graph = pipeline.RunPasses({});
+    // Only the call with open type arguments remains.
+    EXPECT_EQ(1, CountStaticCallsTo(flow_graph, "check"));
+  }
+  {
+    SetFlagScope<int> closed_threshold(
+        &FLAG_inlining_closed_type_arguments_size_threshold, 0);
+    TestPipeline pipeline(function, CompilerPass::kAOT);
+    FlowGraph* flow_graph = pipeline.RunPasses({});
+    EXPECT_EQ(2, CountStaticCallsTo(flow_graph, "check"));
+  }
+}
+
 }  // namespace dart
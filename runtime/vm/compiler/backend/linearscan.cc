@@ -2558,6 +2558,33 @@ void FlowGraphAllocator::AllocateAnyRegister(LiveRange* unallocated) {
 
   ASSERT(candidate != kNoRegister);
 
+  // Inside a loop prefer evicting a register whose current occupants have no
+  // register uses in the loop, so that evicting them does not introduce
+  // reloads into the loop body. Only switch if the alternative is as good for
+  // |unallocated| itself.
+  LoopInfo* loop_info = BlockEntryAt(unallocated->Start())->loop_info();
+  if ((loop_info != nullptr) &&
+      !IsCheapToEvictRegisterInLoop(loop_info, candidate)) {
+    for (int i = 0; i < NumberOfRegisters(); ++i) {
+      int reg = (i + kRegisterAllocationBias) % NumberOfRegisters();
+      if (blocked_registers_[reg] || (reg == candidate)) continue;
+      if (!IsCheapToEvictRegisterInLoop(loop_info, reg)) continue;
+      intptr_t reg_free_until = 0;
+      intptr_t reg_blocked_at = kMaxPosition;
+      if (UpdateFreeUntil(reg, unallocated, &reg_free_until,
+                          &reg_blocked_at) &&
+          (reg_free_until >= register_use_pos) &&
+          (reg_blocked_at >= blocked_at)) {
+        TRACE_ALLOC(THR_Print("  prefer cheaply evictable register "));
+        TRACE_ALLOC(MakeRegisterLocation(reg).Print());
+        TRACE_ALLOC(THR_Print(" in loop B%" Pd "\n",
+                              loop_info->header()->block_id()));
+        candidate = reg;
+        break;
+      }
+    }
+  }
+
   TRACE_ALLOC(THR_Print("assigning blocked register "));
   TRACE_ALLOC(MakeRegisterLocation(candidate).Print());
   TRACE_ALLOC(THR_Print(" to live range v%" Pd " until %" Pd "\n",
@@ -0,0 +1,182 @@
+// Copyright (c) 2024, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+#include "vm/compiler/backend/loop_idioms.h"
+
+#include "vm/compiler/backend/flow_graph.h"
+#include "vm/compiler/backend/il.h"
+#include "vm/compiler/backend/il_printer.h"
+#include "vm/compiler/backend/loops.h"
+#include "vm/compiler/backend/range_analysis.h"
+
+namespace dart {
+
+DEFINE_FLAG(bool, trace_loop_idioms, false, "Trace loop idiom recognition.");
+
+// Returns the definition of the value stored by a copy loop, looking through
+// integer conversions that only feed the store.
+static Definition* StoredValueSource(Value* value, LoopInfo* loop) {
+  Definition* def = value->definition();
+  while (auto* const conv = def->AsIntConverter()) {
+    if (!conv->HasOnlyInputUse(value) || !loop->Contains(conv->GetBlock())) {
+      return nullptr;
+    }
+    value = conv->value();
+    def = value->definition();
+  }
+  return def->HasOnlyInputUse(value) ? def : nullptr;
+}
+
+// Returns true if [def] is available in [block], i.e. defined outside of the
+// loop in a dominating position.
+static bool IsAvailableIn(Definition* def, BlockEntryInstr* block) {
+  return def->GetBlock()->Dominates(block);
+}
+
+bool LoopIdiomRecognizer::TryReplaceCopyLoop(FlowGraph* flow_graph,
+                                             LoopInfo* loop) {
+  const bool is_64_bit = (kUnboxedIntPtr == kUnboxedInt64);
+
+  // The loop consists of the header and a single body block, which is both
+  // the only successor of the header in the loop and the back edge.
+  if (loop->inner() != nullptr || loop->back_edges().length() != 1) {
+    return false;
+  }
+  auto* const header = loop->header()->AsJoinEntry();
+  BlockEntryInstr* const body = loop->back_edges()[0];
+  if (header == nullptr || header->PredecessorCount() != 2 ||
+      !body->IsTargetEntry() || body->PredecessorAt(0) != header ||
+      header->phis() == nullptr || header->phis()->length() != 1) {
+    return false;
+  }
+  const intptr_t entry_index = header->IndexOfPredecessor(body) == 0 ? 1 : 0;
+  BlockEntryInstr* const preheader = header->PredecessorAt(entry_index);
+  PhiInstr* const phi = (*header->phis())[0];
+  const Representation rep = phi->representation();
+  if (rep != kTagged && !(is_64_bit && rep == kUnboxedInt64)) {
+    return false;
+  }
+
+  // Header: [CheckStackOverflow] Branch(phi < end) with the body on true.
+  BranchInstr* branch = nullptr;
+  for (Instruction* instr = header->next(); instr != nullptr;
+       instr = instr->next()) {
+    if (instr->IsCheckStackOverflow()) continue;
+    branch = instr->AsBranch();
+    if (branch == nullptr) return false;
+  }
+  ASSERT(branch != nullptr);
+  RelationalOpInstr* const compare = branch->comparison()->AsRelationalOp();
+  if (compare == nullptr || compare->kind() != Token::kLT ||
+      compare->left()->definition() != phi ||
+      branch->true_successor() != body) {
+    return false;
+  }
+  Definition* const end = compare->right()->definition();
+  Definition* const start = phi->InputAt(entry_index)->definition();
+  if (!IsAvailableIn(end, preheader)) {
+    return false;
+  }
+
+  // Body: dst[phi] = src[phi], phi + 1, [CheckStackOverflow] and converters
+  // of the stored value.
+  LoadIndexedInstr* load = nullptr;
+  StoreIndexedInstr* store = nullptr;
+  Definition* increment = nullptr;
+  for (Instruction* instr = body->next(); !instr->IsGoto();
+       instr = instr->next()) {
+    if (instr->IsCheckStackOverflow() || instr->IsIntConverter()) {
+      continue;
+    } else if (instr->IsLoadIndexed() && load == nullptr) {
+      load = instr->AsLoadIndexed();
+    } else if (instr->IsStoreIndexed() && store == nullptr) {
+      store = instr->AsStoreIndexed();
+    } else if (auto* const op = instr->AsBinaryIntegerOp();
+               op != nullptr && increment == nullptr &&
+               op->op_kind() == Token::kADD && op->left()->definition() == phi &&
+               op->right()->BindsToConstant() &&
+               op->right()->BoundConstant().IsInteger() &&
+               Integer::Cast(op->right()->BoundConstant()).AsInt64Value() ==
+                   1) {
+      increment = op;
+    } else {
+      return false;
+    }
+  }
+  if (load == nullptr || store == nullptr || increment == nullptr ||
+      phi->InputAt(1 - entry_index)->definition() != increment ||
+      StoredValueSource(store->value(), loop) != load) {
+    return false;
+  }
+
+  // Both accesses index internal typed data of the same kind, so the arrays
+  // are either the same object or do not overlap at all.
+  const classid_t cid = load->class_id();
+  const Representation index_rep = rep == kTagged ? kTagged : kUnboxedIntPtr;
+  if (store->class_id() != cid || !IsTypedDataClassId(cid) ||
+      cid == kTypedDataFloat32ArrayCid ||
+      IsClampedTypedDataBaseClassId(cid) || load->IsUntagged() ||
+      store->IsUntagged() || load->index()->definition() != phi ||
+      store->index()->definition() != phi ||
+      load->RequiredInputRepresentation(LoadIndexedInstr::kIndexPos) !=
+          index_rep ||
+      store->RequiredInputRepresentation(StoreIndexedInstr::kIndexPos) !=
+          index_rep ||
+      !IsAvailableIn(load->array()->definition(), preheader) ||
+      !IsAvailableIn(store->array()->definition(), preheader)) {
+    return false;
+  }
+
+  // Range analysis has already removed the bounds checks, so every index in
+  // [start, end) is valid. The copy length end - start must not be negative.
+  if (Range::ConstantMin(end->range()).ConstantValue() <
+      Range::ConstantMax(start->range()).ConstantValue()) {
+    return false;
+  }
+
+  Zone* const zone = flow_graph->zone();
+  Instruction* const last = preheader->last_instruction();
+  Definition* length;
+  if (rep == kTagged) {
+    auto* const sub = new (zone) BinarySmiOpInstr(
+        Token::kSUB, new (zone) Value(end), new (zone) Value(start),
+        DeoptId::kNone);
+    sub->set_can_overflow(false);
+    length = sub;
+  } else {
+    length = new (zone)
+        BinaryInt64OpInstr(Token::kSUB, new (zone) Value(end),
+                           new (zone) Value(start), DeoptId::kNone,
+                           Instruction::kNotSpeculative);
+  }
+  flow_graph->InsertBefore(last, length, nullptr, FlowGraph::kValue);
+  auto* const copy = new (zone) MemoryCopyInstr(
+      new (zone) Value(load->array()->definition()), cid,
+      new (zone) Value(store->array()->definition()), cid,
+      new (zone) Value(start), new (zone) Value(start), new (zone) Value(length),
+      /*unboxed_inputs=*/rep != kTagged);
+  flow_graph->InsertBefore(last, copy, nullptr, FlowGraph::kEffect);
+
+  // Skip the loop. The ranges computed for the loop no longer hold.
+  phi->InputAt(entry_index)->BindTo(end);
+  const Range full = Range::Full(RangeBoundary::kRangeBoundaryInt64);
+  phi->set_range(full);
+  increment->set_range(full);
+
+  if (FLAG_support_il_printer && FLAG_trace_loop_idioms) {
+    THR_Print("Replaced copy loop B%" Pd " with %s\n", header->block_id(),
+              copy->ToCString());
+  }
+  return true;
+}
+
+void LoopIdiomRecognizer::Optimize(FlowGraph* flow_graph) {
+  const LoopHierarchy& loop_hierarchy = flow_graph->GetLoopHierarchy();
+  const auto& headers = loop_hierarchy.headers();
+  for (intptr_t i = 0; i < headers.length(); i++) {
+    TryReplaceCopyLoop(flow_graph, headers[i]->loop_info());
+  }
+}
+
+}  // namespace dart
@@ -0,0 +1,44 @@
+// Copyright (c) 2024, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+#ifndef RUNTIME_VM_COMPILER_BACKEND_LOOP_IDIOMS_H_
+#define RUNTIME_VM_COMPILER_BACKEND_LOOP_IDIOMS_H_
+
+#if defined(DART_PRECOMPILED_RUNTIME)
+#error "AOT runtime should not use compiler sources (including header files)"
+#endif  // defined(DART_PRECOMPILED_RUNTIME)
+
+#include "vm/allocation.h"
+
+namespace dart {
+
+class FlowGraph;
+class LoopInfo;
+
+// Replaces counted loops that copy typed data element by element
+//
+//     for (int i = start; i < end; i++) {
+//       dst[i] = src[i];
+//     }
+//
+// with a single MemoryCopy in the loop preheader. MemoryCopy is lowered to
+// wide (vector) moves on all targets, so this is several times faster than
+// the scalar loads and stores of the loop.
+//
+// The loop itself is left in place, but its header phi now starts at [end],
+// so the body is never entered and the phi still has the right value on exit.
+//
+// Must run after range analysis, which is needed both to prove that no bounds
+// checks remain in the loop and that [start] <= [end].
+class LoopIdiomRecognizer : public AllStatic {
+ public:
+  static void Optimize(FlowGraph* flow_graph);
+
+ private:
+  static bool TryReplaceCopyLoop(FlowGraph* flow_graph, LoopInfo* loop);
+};
+
+}  // namespace dart
+
+#endif  // RUNTIME_VM_COMPILER_BACKEND_LOOP_IDIOMS_H_
@@ -0,0 +1,74 @@
+// Copyright (c) 2024, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+#include "vm/compiler/backend/loop_idioms.h"
+
+#include "vm/compiler/backend/il.h"
+#include "vm/compiler/backend/il_test_helper.h"
+#include "vm/compiler/compiler_pass.h"
+#include "vm/object.h"
+#include "vm/unit_test.h"
+
+namespace dart {
+
+static intptr_t CountMemoryCopies(FlowGraph* flow_graph) {
+  intptr_t count = 0;
+  for (BlockIterator block_it = flow_graph->reverse_postorder_iterator();
+       !block_it.Done(); block_it.Advance()) {
+    for (ForwardInstructionIterator it(block_it.Current()); !it.Done();
+         it.Advance()) {
+      if (it.Current()->IsMemoryCopy()) {
+        count++;
+      }
+    }
+  }
+  return count;
+}
+
+static intptr_t CompileAndCountMemoryCopies(const char* script_chars,
+                                            CompilerPass::PipelineMode mode) {
+  const auto& root_library = Library::Handle(LoadTestScript(script_chars));
+  Invoke(root_library, "main");
+  const auto& function = Function::Handle(GetFunction(root_library, "foo"));
+  TestPipeline pipeline(function, mode);
+  FlowGraph* flow_graph = pipeline.RunPasses({});
+  return CountMemoryCopies(flow_graph);
+}
+
+ISOLATE_UNIT_TEST_CASE(LoopIdioms_CopyLoop) {
+  const char* kScriptChars =
+      R"(
+      import 'dart:typed_data';
+      Uint8List foo(Uint8List src) {
+        final dst = Uint8List(src.length);
+        for (int i = 0; i < src.length; i++) {
+          dst[i] = src[i];
+        }
+        return dst;
+      }
+      main() {
+        for (int i = 0; i < 10; i++) foo(Uint8List(100));
+      }
+      )";
+  EXPECT_EQ(1, CompileAndCountMemoryCopies(kScriptChars, CompilerPass::kJIT));
+}
+
+ISOLATE_UNIT_TEST_CASE(LoopIdioms_ShiftedCopyLoop) {
+  const char* kScriptChars =
+      R"(
+      import 'dart:typed_data';
+      void foo(Uint8List list) {
+        for (int i = 0; i < list.length - 1; i++) {
+          list[i] = list[i + 1];
+        }
+      }
+      main() {
+        for (int i = 0; i < 10; i++) foo(Uint8List(100));
+      }
+      )";
+  // Only identical indices are recognized.
+  EXPECT_EQ(0, CompileAndCountMemoryCopies(kScriptChars, CompilerPass::kJIT));
+}
+
+}  // namespace dart
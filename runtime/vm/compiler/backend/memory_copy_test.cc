@@ -511,4 +511,11 @@ MEMORY_TEST(4, 4, 8, 1)     // promoted to 4.
 MEMORY_TEST(8, 8, 8, 1)     // promoted to 8.
 MEMORY_TEST(16, 16, 16, 1)  // promoted to 16 on ARM64.
 
+// Unaligned offsets with lengths which are unrolled into mixed move sizes.
+MEMORY_TEST(1, 3, 24, 1)
+MEMORY_TEST(3, 1, 31, 1)
+MEMORY_TEST(5, 2, 64, 1)
+MEMORY_TEST(2, 5, 63, 1)
+MEMORY_TEST(1, 2, 14, 2)
+
 }  // namespace dart
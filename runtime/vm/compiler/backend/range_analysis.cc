@@ -14,6 +14,10 @@ DEFINE_FLAG(bool,
             array_bounds_check_elimination,
             true,
             "Eliminate redundant bounds checks.");
+DEFINE_FLAG(bool,
+            loop_bounds_check_splitting,
+            true,
+            "Hoist bounds checks on a loop index out of the loop in AOT.");
 DEFINE_FLAG(bool, trace_range_analysis, false, "Trace range analysis progress");
 DEFINE_FLAG(bool,
             trace_integer_ir_selection,
@@ -67,6 +71,8 @@ void RangeAnalysis::Analyze() {
   iis.Select();
 
   RemoveConstraints();
+
+  SplitLoopsAtBoundsChecks();
 }
 
 // Helper method to chase to a constrained definition.
@@ -1362,9 +1368,178 @@ void RangeAnalysis::EliminateRedundantBoundsChecks() {
         if (auto jit_check = check->AsCheckArrayBound()) {
           generalizer.TryGeneralize(jit_check);
         }
+      } else if (FLAG_loop_bounds_check_splitting) {
+        if (auto aot_check = check->AsGenericCheckBound()) {
+          split_candidates_.Add(aot_check);
+        }
+      }
+    }
+  }
+}
+
+// Without deoptimization, a bounds check on the index of a counted loop
+//
+//     for (i = start; i < limit; i++) {
+//       CheckBound(length, i)
+//       ...
+//     }
+//
+// can still be taken out of the loop if nothing observable happens in an
+// iteration before the check. The loop then only runs while i < length,
+//
+//     end = min(max(limit, 0), length)
+//     for (i = start; i < end; i++) {
+//       ...
+//     }
+//     if (i < limit) CheckBound(length, i)
+//
+// and the check after the loop throws exactly the error the first failing
+// check in the loop would have thrown, with no effects of that iteration
+// having happened. Clamping the limit at 0 does not change the trip count as
+// start is non-negative, and makes end - start and limit - length overflow
+// free.
+bool RangeAnalysis::TrySplitLoopAtBoundsCheck(GenericCheckBoundInstr* check) {
+  if (check->previous() == nullptr ||
+      !GenericCheckBoundInstr::UseUnboxedRepresentation()) {
+    return false;  // Already removed by an earlier split.
+  }
+  BlockEntryInstr* const body = check->GetBlock();
+  LoopInfo* const loop = body->loop_info();
+  if (loop == nullptr || body->InsideTryBlock()) {
+    return false;
+  }
+  JoinEntryInstr* const header = loop->header()->AsJoinEntry();
+  BranchInstr* const branch =
+      header != nullptr ? header->last_instruction()->AsBranch() : nullptr;
+  if (branch == nullptr || branch->true_successor() != body ||
+      loop->Contains(branch->false_successor())) {
+    return false;
+  }
+  RelationalOpInstr* const compare = branch->comparison()->AsRelationalOp();
+  if (compare == nullptr || compare->kind() != Token::kLT ||
+      compare->operation_cid() != kMintCid) {
+    return false;
+  }
+  PhiInstr* const phi = compare->left()->definition()->AsPhi();
+  int64_t stride = 0;
+  if (phi == nullptr || phi->block() != header ||
+      check->index()->definition() != phi ||
+      !InductionVar::IsLinear(loop->LookupInduction(phi), &stride) ||
+      stride != 1) {
+    return false;
+  }
+
+  // The loop is entered from a single preheader ending in a goto.
+  BlockEntryInstr* preheader = nullptr;
+  intptr_t preheader_index = -1;
+  for (intptr_t i = 0; i < header->PredecessorCount(); i++) {
+    if (!loop->Contains(header->PredecessorAt(i))) {
+      if (preheader != nullptr) return false;
+      preheader = header->PredecessorAt(i);
+      preheader_index = i;
+    }
+  }
+  if (preheader == nullptr || !preheader->last_instruction()->IsGoto()) {
+    return false;
+  }
+  Definition* const start = phi->InputAt(preheader_index)->definition();
+  Definition* const limit = compare->right()->definition();
+  Definition* const length = check->length()->definition();
+  if (!limit->GetBlock()->Dominates(preheader) ||
+      !length->GetBlock()->Dominates(preheader) ||
+      Range::ConstantMin(start->range()).ConstantValue() < 0 ||
+      Range::ConstantMin(length->range()).ConstantValue() < 0) {
+    return false;
+  }
+
+  // Nothing observable may happen in an iteration before the check.
+  for (Instruction* instr = body->next(); instr != check;
+       instr = instr->next()) {
+    if (instr->MayHaveVisibleEffect() || instr->CanDeoptimize()) {
+      return false;
+    }
+  }
+
+  // All checks of the index against the same length become redundant in the
+  // loop. The original check is moved after it below.
+  for (BitVector::Iterator it(loop->blocks()); !it.Done(); it.Advance()) {
+    BlockEntryInstr* const block = flow_graph_->preorder()[it.Current()];
+    for (ForwardInstructionIterator instr_it(block); !instr_it.Done();
+         instr_it.Advance()) {
+      auto* const other = instr_it.Current()->AsGenericCheckBound();
+      if (other != nullptr && other->index()->definition() == phi &&
+          other->length()->definition() == length) {
+        other->ReplaceUsesWith(phi);
+        instr_it.RemoveCurrentFromGraph();
       }
     }
   }
+
+  // end = min(max(limit, 0), length), computed without branches.
+  Instruction* const preheader_goto = preheader->last_instruction();
+  Range* const sign_shift =
+      new (Z) Range(RangeBoundary::FromConstant(kBitsPerInt64 - 1),
+                    RangeBoundary::FromConstant(kBitsPerInt64 - 1));
+  ConstantInstr* const sign_shift_count = flow_graph_->GetConstant(
+      Integer::ZoneHandle(Z, Integer::New(kBitsPerInt64 - 1, Heap::kOld)),
+      kUnboxedInt64);
+  auto emit = [&](Definition* def) {
+    flow_graph_->InsertBefore(preheader_goto, def, nullptr, FlowGraph::kValue);
+    return def;
+  };
+  auto emit_binary = [&](Token::Kind op, Definition* left, Definition* right) {
+    return emit(new (Z) BinaryInt64OpInstr(op, new (Z) Value(left),
+                                           new (Z) Value(right), DeoptId::kNone,
+                                           Instruction::kNotSpeculative));
+  };
+  auto emit_min_zero = [&](Definition* value) {
+    Definition* const sign = emit(new (Z) ShiftInt64OpInstr(
+        Token::kSHR, new (Z) Value(value), new (Z) Value(sign_shift_count),
+        DeoptId::kNone, sign_shift));
+    return emit_binary(Token::kBIT_AND, value, sign);
+  };
+  Definition* const clamped_limit =
+      emit_binary(Token::kSUB, limit, emit_min_zero(limit));
+  Definition* const end = emit_binary(
+      Token::kADD, length,
+      emit_min_zero(emit_binary(Token::kSUB, clamped_limit, length)));
+  compare->right()->BindTo(end);
+
+  // Throw on exit if the loop stopped short of the original limit.
+  TargetEntryInstr* const exit = branch->false_successor();
+  Instruction* const exit_first = exit->next();
+  Instruction* const exit_last = exit->last_instruction();
+  TargetEntryInstr* throw_block = nullptr;
+  TargetEntryInstr* continue_block = nullptr;
+  JoinEntryInstr* const join = flow_graph_->NewDiamond(
+      exit, branch,
+      new (Z) RelationalOpInstr(branch->source(), Token::kLT,
+                                new (Z) Value(phi), new (Z) Value(limit),
+                                kMintCid, DeoptId::kNone,
+                                Instruction::kNotSpeculative),
+      &throw_block, &continue_block);
+  join->LinkTo(exit_first);
+  join->set_last_instruction(exit_last);
+  // Reuse the original check, so the error is reported at its position.
+  check->RemoveEnvironment();
+  check->InsertAfter(throw_block);
+
+  if (FLAG_support_il_printer && FLAG_trace_range_analysis) {
+    THR_Print("Split loop B%" Pd " at bounds check on v%" Pd "\n",
+              header->block_id(), phi->ssa_temp_index());
+  }
+  return true;
+}
+
+void RangeAnalysis::SplitLoopsAtBoundsChecks() {
+  bool changed = false;
+  for (GenericCheckBoundInstr* check : split_candidates_) {
+    changed = TrySplitLoopAtBoundsCheck(check) || changed;
+  }
+  if (changed) {
+    flow_graph_->DiscoverBlocks();
+    flow_graph_->ResetLoopHierarchy();
+  }
 }
 
 void RangeAnalysis::MarkUnreachableBlocks() {
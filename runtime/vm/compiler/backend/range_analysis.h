@@ -596,6 +596,11 @@ class RangeAnalysis : public ValueObject {
   // instructions.
   void EliminateRedundantBoundsChecks();
 
+  // Take bounds checks on the index of a counted loop out of the loop, when
+  // they could not be proven redundant and cannot deoptimize.
+  void SplitLoopsAtBoundsChecks();
+  bool TrySplitLoopAtBoundsCheck(GenericCheckBoundInstr* check);
+
   // Find unsatisfiable constraints and mark corresponding blocks unreachable.
   void MarkUnreachableBlocks();
 
@@ -627,6 +632,9 @@ class RangeAnalysis : public ValueObject {
   // All CheckArrayBound/GenericCheckBound instructions.
   GrowableArray<CheckBoundBaseInstr*> bounds_checks_;
 
+  // GenericCheckBound instructions that SplitLoopsAtBoundsChecks may hoist.
+  GrowableArray<GenericCheckBoundInstr*> split_candidates_;
+
   // All Constraints inserted during InsertConstraints phase. They are treated
   // as smi values.
   GrowableArray<ConstraintInstr*> constraints_;
@@ -8,6 +8,8 @@
 
 #include "vm/bit_vector.h"
 #include "vm/class_id.h"
+#include "vm/compiler/aot/precompiler.h"
+#include "vm/compiler/aot/side_effect_summaries.h"
 #include "vm/compiler/backend/flow_graph.h"
 #include "vm/compiler/backend/il.h"
 #include "vm/compiler/backend/il_printer.h"
@@ -2083,6 +2085,51 @@ class LoadOptimizer : public ValueObject {
     return replacement;
   }
 
+  // Returns the places which might be written by an instruction with unknown
+  // side effects. In AOT static calls to functions which only write fields
+  // (see SideEffectSummaries) kill just the places of those fields.
+  const BitVector* KilledByEffects(Instruction* instr) {
+#if defined(DART_PRECOMPILER) && !defined(TARGET_ARCH_IA32)
+    StaticCallInstr* call = instr->AsStaticCall();
+    if (call == nullptr || !CompilerState::Current().is_aot() ||
+        Precompiler::Instance() == nullptr ||
+        Precompiler::Instance()->side_effect_summaries() == nullptr) {
+      return aliased_set_->aliased_by_effects();
+    }
+    const SideEffectSummaries::FieldList* fields =
+        Precompiler::Instance()->side_effect_summaries()->WrittenFields(
+            call->function());
+    if (fields == nullptr) {
+      return aliased_set_->aliased_by_effects();
+    }
+    BitVector* killed = new (Z) BitVector(Z, aliased_set_->max_place_id());
+    const auto& places = aliased_set_->places();
+    for (BitVector::Iterator it(aliased_set_->aliased_by_effects()); !it.Done();
+         it.Advance()) {
+      const Place* place = places[it.Current()];
+      const Field* field = nullptr;
+      if (place->kind() == Place::kStaticField) {
+        field = &place->static_field();
+      } else if ((place->kind() == Place::kInstanceField) &&
+                 place->instance_field().IsDartField()) {
+        field = &place->instance_field().field();
+      } else {
+        continue;
+      }
+      const FieldPtr original = field->Original();
+      for (intptr_t i = 0; i < fields->length(); i++) {
+        if (fields->At(i)->ptr() == original) {
+          killed->Add(it.Current());
+          break;
+        }
+      }
+    }
+    return killed;
+#else
+    return aliased_set_->aliased_by_effects();
+#endif  // defined(DART_PRECOMPILER) && !defined(TARGET_ARCH_IA32)
+  }
+
   // Compute sets of loads generated and killed by each block.
   // Additionally compute upwards exposed and generated loads for each block.
   // Exposed loads are those that can be replaced if a corresponding
@@ -2192,11 +2239,12 @@ class LoadOptimizer : public ValueObject {
 
         // If instruction has effects then kill all loads affected.
         if (instr->HasUnknownSideEffects()) {
-          kill->AddAll(aliased_set_->aliased_by_effects());
+          const BitVector* killed = KilledByEffects(instr);
+          kill->AddAll(killed);
           // There is no need to clear out_values when removing values from GEN
           // set because only those values that are in the GEN set
           // will ever be used.
-          gen->RemoveAll(aliased_set_->aliased_by_effects());
+          gen->RemoveAll(killed);
         }
 
         Definition* defn = instr->AsDefinition();
@@ -3711,6 +3759,115 @@ void AllocationSinking::DiscoverFailedCandidates() {
   candidates_.TruncateTo(j);
 }
 
+// Returns true if the value of the given slot in an object produced by
+// |alloc| is always the value |alloc| was initialized with.
+static bool IsInitializedImmutableSlot(AllocationInstr* alloc,
+                                       const Slot& slot) {
+  if (!slot.is_immutable() && slot.kind() != Slot::Kind::kRecordField) {
+    return false;
+  }
+  return alloc->InputForSlot(slot) >= 0;
+}
+
+// Returns true if every input of |phi| is an allocation which is initialized
+// with the values of all immutable slots loaded from |phi|, and |phi| is
+// never used for anything other than such loads (or in environments).
+static bool IsSplittablePhiOfAllocations(PhiInstr* phi) {
+  if (phi->representation() != kTagged) {
+    return false;
+  }
+  for (intptr_t i = 0; i < phi->InputCount(); i++) {
+    if (!phi->InputAt(i)->definition()->IsAllocation()) {
+      return false;
+    }
+  }
+  bool has_loads = false;
+  for (Value* use = phi->input_use_list(); use != nullptr;
+       use = use->next_use()) {
+    LoadFieldInstr* load = use->instruction()->AsLoadField();
+    if (load == nullptr || load->instance() != use) {
+      return false;
+    }
+    for (intptr_t i = 0; i < phi->InputCount(); i++) {
+      AllocationInstr* alloc = phi->InputAt(i)->definition()->AsAllocation();
+      if (!IsInitializedImmutableSlot(alloc, load->slot())) {
+        return false;
+      }
+    }
+    has_loads = true;
+  }
+  return has_loads;
+}
+
+void AllocationSinking::SplitPhisOfAllocations() {
+  GrowableArray<PhiInstr*> worklist;
+  for (BlockIterator block_it = flow_graph_->reverse_postorder_iterator();
+       !block_it.Done(); block_it.Advance()) {
+    JoinEntryInstr* join = block_it.Current()->AsJoinEntry();
+    if (join == nullptr) continue;
+    for (PhiIterator it(join); !it.Done(); it.Advance()) {
+      if (IsSplittablePhiOfAllocations(it.Current())) {
+        worklist.Add(it.Current());
+      }
+    }
+  }
+
+  GrowableArray<LoadFieldInstr*> loads;
+  GrowableArray<PhiInstr*> field_phis;
+  for (PhiInstr* phi : worklist) {
+    JoinEntryInstr* join = phi->block();
+    loads.Clear();
+    for (Value* use = phi->input_use_list(); use != nullptr;
+         use = use->next_use()) {
+      loads.Add(use->instruction()->AsLoadField());
+    }
+
+    // Create (at most) one phi per loaded slot, merging the values the
+    // allocations were initialized with.
+    field_phis.Clear();
+    for (LoadFieldInstr* load : loads) {
+      PhiInstr* field_phi = nullptr;
+      for (intptr_t i = 0; i < field_phis.length(); i++) {
+        if (loads[i]->slot().IsIdentical(load->slot())) {
+          field_phi = field_phis[i];
+          break;
+        }
+      }
+      if (field_phi == nullptr) {
+        field_phi = new (Z) PhiInstr(join, phi->InputCount());
+        flow_graph_->AllocateSSAIndex(field_phi);
+        field_phi->mark_alive();
+        for (intptr_t i = 0; i < phi->InputCount(); i++) {
+          AllocationInstr* alloc =
+              phi->InputAt(i)->definition()->AsAllocation();
+          Definition* value =
+              alloc->InputAt(alloc->InputForSlot(load->slot()))->definition();
+          Value* input = new (Z) Value(value);
+          field_phi->SetInputAt(i, input);
+          value->AddInputUse(input);
+        }
+        join->InsertPhi(field_phi);
+        if (FLAG_trace_optimization && flow_graph_->should_print()) {
+          THR_Print("split v%" Pd " into v%" Pd " for %s\n",
+                    phi->ssa_temp_index(), field_phi->ssa_temp_index(),
+                    load->slot().Name());
+        }
+      }
+      field_phis.Add(field_phi);
+      load->ReplaceUsesWith(field_phi);
+      load->RemoveFromGraph();
+    }
+
+    // Without other uses the phi is dead and no longer prevents the
+    // allocations flowing into it from being sunk.
+    if (!phi->HasUses()) {
+      phi->UnuseAllInputs();
+      phi->mark_dead();
+      join->RemovePhi(phi);
+    }
+  }
+}
+
 void AllocationSinking::Optimize() {
   // Allocation sinking depends on load forwarding, so give up early if load
   // forwarding is disabled.
@@ -3718,6 +3875,10 @@ void AllocationSinking::Optimize() {
     return;
   }
 
+  // Look through phis of allocations first: loads from such phis are
+  // otherwise unsafe uses which prevent sinking of all merged allocations.
+  SplitPhisOfAllocations();
+
   CollectCandidates();
 
   // Insert MaterializeObject instructions that will describe the state of the
@@ -58,6 +58,15 @@ class AllocationSinking : public ZoneAllocated {
     GrowableArray<Definition*> worklist_;
   };
 
+  // Replaces loads of immutable fields from phis of allocations with phis of
+  // the values those allocations were initialized with, e.g.
+  //
+  //   v3 <- phi(AllocateSmallRecord(v1, v2), AllocateSmallRecord(v4, v5))
+  //   v6 <- LoadField(v3, $1)
+  //
+  // becomes v6 <- phi(v1, v4).
+  void SplitPhisOfAllocations();
+
   void CollectCandidates();
 
   void NormalizeMaterializations();
@@ -7,6 +7,7 @@
 #include <functional>
 #include <utility>
 
+#include "vm/compiler/aot/side_effect_summaries.h"
 #include "vm/compiler/backend/block_builder.h"
 #include "vm/compiler/backend/il_printer.h"
 #include "vm/compiler/backend/il_test_helper.h"
@@ -1199,6 +1200,90 @@ main() {
   EXPECT(store1->instance()->definition() == allocate);
 }
 
+#if defined(DART_PRECOMPILER)
+
+static bool ContainsField(const SideEffectSummaries::FieldList* fields,
+                          const Field& field) {
+  for (intptr_t i = 0; i < fields->length(); i++) {
+    if (fields->At(i)->ptr() == field.Original()) return true;
+  }
+  return false;
+}
+
+ISOLATE_UNIT_TEST_CASE(LoadOptimizer_SideEffectSummaries) {
+  const char* kScript = R"(
+int g = 0;
+int h = 0;
+
+class A {
+  int x;
+  A(this.x);
+}
+
+@pragma('vm:never-inline')
+makeA(int v) => A(v);
+
+@pragma('vm:never-inline')
+setG(bool again) {
+  if (again) setG(false);
+  g = 1;
+  setH();
+}
+
+@pragma('vm:never-inline')
+setH() {
+  h = 1;
+}
+
+@pragma('vm:never-inline')
+escape(List<int> l) {
+  l.add(1);
+}
+
+main() {
+  makeA(1);
+  setG(true);
+  escape(<int>[]);
+}
+  )";
+
+  const auto& root_library = Library::Handle(LoadTestScript(kScript));
+  Invoke(root_library, "main");
+
+  const auto& cls = Class::Handle(GetClass(root_library, "A"));
+  const auto& x = Field::Handle(
+      cls.LookupInstanceFieldAllowPrivate(String::Handle(String::New("x"))));
+  const auto& g = Field::Handle(
+      root_library.LookupFieldAllowPrivate(String::Handle(String::New("g"))));
+  const auto& h = Field::Handle(
+      root_library.LookupFieldAllowPrivate(String::Handle(String::New("h"))));
+
+  CompilerState state(thread, /*is_aot=*/true, /*is_optimizing=*/true);
+  SideEffectSummaries summaries(thread->zone());
+
+  // Allocation and constructor only write fields of the new object.
+  auto fields = summaries.WrittenFields(
+      Function::Handle(GetFunction(root_library, "makeA")));
+  EXPECT(fields != nullptr);
+  EXPECT_EQ(1, fields->length());
+  EXPECT(ContainsField(fields, x));
+
+  // Self recursion is ignored and static callees are included.
+  fields = summaries.WrittenFields(
+      Function::Handle(GetFunction(root_library, "setG")));
+  EXPECT(fields != nullptr);
+  EXPECT_EQ(2, fields->length());
+  EXPECT(ContainsField(fields, g));
+  EXPECT(ContainsField(fields, h));
+
+  // Instance calls may write anything.
+  fields = summaries.WrittenFields(
+      Function::Handle(GetFunction(root_library, "escape")));
+  EXPECT(fields == nullptr);
+}
+
+#endif  // defined(DART_PRECOMPILER)
+
 #endif  // !defined(TARGET_ARCH_IA32)
 
 ISOLATE_UNIT_TEST_CASE(AllocationSinking_Arrays) {
@@ -1468,6 +1553,39 @@ main() {
 
 #if !defined(TARGET_ARCH_IA32)
 
+// Verifies that loads from a phi of record allocations are replaced with
+// phis of the record fields, so that the records are not allocated.
+ISOLATE_UNIT_TEST_CASE(AllocationSinking_PhiOfRecords) {
+  const char* kScript = R"(
+    @pragma('vm:never-inline')
+    int foo(bool b, int x, int y) {
+      final r = b ? (x, y) : (y, x);
+      return r.$1 - r.$2;
+    }
+
+    main() {
+      foo(true, 1, 2);
+      foo(false, 1, 2);
+    }
+  )";
+
+  const auto& root_library = Library::Handle(LoadTestScript(kScript));
+  Invoke(root_library, "main");
+  const auto& function = Function::Handle(GetFunction(root_library, "foo"));
+  TestPipeline pipeline(function, CompilerPass::kAOT);
+  FlowGraph* flow_graph = pipeline.RunPasses({});
+  ASSERT(flow_graph != nullptr);
+
+  for (BlockIterator block_it = flow_graph->reverse_postorder_iterator();
+       !block_it.Done(); block_it.Advance()) {
+    for (ForwardInstructionIterator it(block_it.Current()); !it.Done();
+         it.Advance()) {
+      EXPECT(!it.Current()->IsAllocateSmallRecord());
+      EXPECT(!it.Current()->IsMaterializeObject());
+    }
+  }
+}
+
 ISOLATE_UNIT_TEST_CASE(DelayAllocations_DelayAcrossCalls) {
   const char* kScript = R"(
     class A {
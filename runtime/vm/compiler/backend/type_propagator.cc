@@ -7,6 +7,7 @@
 #include "platform/text_buffer.h"
 
 #include "vm/bit_vector.h"
+#include "vm/class_table.h"
 #include "vm/compiler/compiler_state.h"
 #include "vm/object_store.h"
 #include "vm/regexp_assembler.h"
@@ -383,7 +384,76 @@ void FlowGraphTypePropagator::VisitAssertBoolean(AssertBooleanInstr* instr) {
 
 void FlowGraphTypePropagator::VisitAssertSubtype(AssertSubtypeInstr* instr) {}
 
+// Returns the closest class which is a superclass of all classes with ids in
+// [lower, upper] or null if there is no such class.
+static ClassPtr CommonSuperClass(Thread* thread,
+                                 intptr_t lower,
+                                 intptr_t upper) {
+  ClassTable* class_table = thread->isolate_group()->class_table();
+  if (!class_table->HasValidClassAt(lower)) return Class::null();
+  Zone* zone = thread->zone();
+  auto& candidate = Class::Handle(zone, class_table->At(lower));
+  auto& cls = Class::Handle(zone);
+  for (intptr_t cid = lower + 1; cid <= upper; cid++) {
+    if (!class_table->HasValidClassAt(cid)) continue;
+    cls = class_table->At(cid);
+    while (!candidate.IsNull()) {
+      while (!cls.IsNull() && (cls.ptr() != candidate.ptr())) {
+        cls = cls.SuperClass();
+      }
+      if (!cls.IsNull()) break;
+      candidate = candidate.SuperClass();
+      cls = class_table->At(cid);
+    }
+    if (candidate.IsNull()) return Class::null();
+  }
+  return candidate.ptr();
+}
+
+bool FlowGraphTypePropagator::NarrowByClassIdTest(BranchInstr* branch) {
+  ComparisonInstr* comparison = branch->comparison();
+  LoadClassIdInstr* load_cid = nullptr;
+  intptr_t lower, upper;
+  bool negated;
+  if (auto* test = comparison->AsTestRange()) {
+    // 'is' tests of class types are lowered to class id range checks in
+    // AOT mode.
+    load_cid = test->value()->definition()->AsLoadClassId();
+    lower = test->lower();
+    upper = test->upper();
+    negated = test->kind() == Token::kISNOT;
+  } else if (auto* equality = comparison->AsEqualityCompare()) {
+    if (!equality->right()->BindsToSmiConstant()) return false;
+    load_cid = equality->left()->definition()->AsLoadClassId();
+    lower = upper = Smi::Cast(equality->right()->BoundConstant()).Value();
+    negated = equality->kind() == Token::kNE;
+  } else {
+    return false;
+  }
+  if (load_cid == nullptr) return false;
+
+  BlockEntryInstr* true_successor =
+      negated ? branch->false_successor() : branch->true_successor();
+  Definition* object = load_cid->object()->definition();
+  if (lower == upper) {
+    EnsureMoreAccurateRedefinition(true_successor, object,
+                                   CompileType::FromCid(lower));
+    return true;
+  }
+  const auto& cls = Class::Handle(
+      zone(), CommonSuperClass(Thread::Current(), lower, upper));
+  if (!cls.IsNull() && !cls.IsObjectClass()) {
+    EnsureMoreAccurateRedefinition(
+        true_successor, object,
+        CompileType::FromAbstractType(Type::ZoneHandle(zone(), cls.RareType()),
+                                      CompileType::kCannotBeNull,
+                                      CompileType::kCannotBeSentinel));
+  }
+  return true;
+}
+
 void FlowGraphTypePropagator::VisitBranch(BranchInstr* instr) {
+  if (NarrowByClassIdTest(instr)) return;
   StrictCompareInstr* comparison = instr->comparison()->AsStrictCompare();
   if (comparison == nullptr) return;
   bool negated = comparison->kind() == Token::kNE_STRICT;
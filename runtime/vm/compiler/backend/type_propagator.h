@@ -44,6 +44,11 @@ class FlowGraphTypePropagator : public FlowGraphVisitor {
       PolymorphicInstanceCallInstr* instr);
   virtual void VisitBranch(BranchInstr* instr);
 
+  // Narrows the type of the object in the successor of |branch| which is
+  // reached if its class id is in a tested range. Returns false if the
+  // branch is not a class id test.
+  bool NarrowByClassIdTest(BranchInstr* branch);
+
   void CheckNonNullSelector(Instruction* call,
                             Definition* receiver,
                             const String& function_name);
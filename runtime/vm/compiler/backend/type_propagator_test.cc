@@ -684,6 +684,56 @@ ISOLATE_UNIT_TEST_CASE(TypePropagator_RedefineCanBeSentinelWithCannotBe) {
                   !it.can_be_sentinel());
 }
 
+// Verifies that 'is' tests lowered to class id checks narrow the type of the
+// tested value so that dominated casts are removed.
+ISOLATE_UNIT_TEST_CASE(TypePropagator_ClassIdTestRemovesRedundantCasts) {
+  const char* kScript = R"(
+    class A {
+      @pragma('vm:never-inline')
+      int foo() => 1;
+    }
+    class B extends A {}
+    class C extends A {}
+    class D {}
+
+    @pragma('vm:never-inline')
+    int test(Object o) {
+      int result = 0;
+      if (o is A) {
+        result += (o as A).foo();
+      }
+      if (o is D) {
+        o as D;
+        result++;
+      }
+      return result;
+    }
+
+    List<Object> objects = [A(), B(), C(), D(), 1];
+
+    void main() {
+      for (final o in objects) {
+        test(o);
+      }
+    }
+  )";
+
+  const auto& root_library = Library::Handle(LoadTestScript(kScript));
+  Invoke(root_library, "main");
+  const auto& function = Function::Handle(GetFunction(root_library, "test"));
+
+  TestPipeline pipeline(function, CompilerPass::kAOT);
+  FlowGraph* flow_graph = pipeline.RunPasses({});
+
+  for (BlockIterator block_it = flow_graph->reverse_postorder_iterator();
+       !block_it.Done(); block_it.Advance()) {
+    for (ForwardInstructionIterator it(block_it.Current()); !it.Done();
+         it.Advance()) {
+      EXPECT(!it.Current()->IsAssertAssignable());
+    }
+  }
+}
+
 #endif  // defined(DART_PRECOMPILER)
 
 // This test verifies that static type is propagated through a LoadField
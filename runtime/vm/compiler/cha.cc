@@ -118,6 +118,43 @@ bool CHA::ConcreteSubclasses(const Class& cls,
   return true;
 }
 
+static bool CollectConcreteSubtypes(const Class& cls,
+                                    GrowableArray<intptr_t>* class_ids,
+                                    intptr_t max_count) {
+  if (cls.InVMIsolateHeap()) return false;
+  if (cls.IsObjectClass()) return false;
+  if (cls.has_dynamically_extendable_subtypes()) return false;
+
+  if (!cls.is_abstract() && !class_ids->Contains(cls.id())) {
+    if (class_ids->length() == max_count) return false;
+    class_ids->Add(cls.id());
+  }
+
+  Zone* zone = Thread::Current()->zone();
+  GrowableObjectArray& subtypes = GrowableObjectArray::Handle(zone);
+  Class& subtype = Class::Handle(zone);
+  for (intptr_t kind = 0; kind < 2; kind++) {
+    subtypes = (kind == 0) ? cls.direct_subclasses_unsafe()
+                           : cls.direct_implementors_unsafe();
+    if (subtypes.IsNull()) continue;
+    for (intptr_t i = 0; i < subtypes.Length(); i++) {
+      subtype ^= subtypes.At(i);
+      if (!CollectConcreteSubtypes(subtype, class_ids, max_count)) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+bool CHA::ConcreteSubtypes(const Class& cls,
+                           GrowableArray<intptr_t>* class_ids,
+                           intptr_t max_count) {
+  // Subclasses and implementors are only complete in the precompiler.
+  ASSERT(FLAG_precompiled_mode);
+  return CollectConcreteSubtypes(cls, class_ids, max_count);
+}
+
 bool CHA::IsImplemented(const Class& cls) {
   // Can't track dependencies for classes on the VM heap since those are
   // read-only.
@@ -37,6 +37,14 @@ class CHA : public ValueObject {
   static bool ConcreteSubclasses(const Class& cls,
                                  GrowableArray<intptr_t>* class_ids);
 
+  // Collect the concrete classes which are subtypes of 'cls', including
+  // implementors of 'cls' and their subclasses, into 'class_ids'. Returns
+  // false if there are more than 'max_count' such classes or they can not
+  // be tracked (see ConcreteSubclasses). Precompiler only.
+  static bool ConcreteSubtypes(const Class& cls,
+                               GrowableArray<intptr_t>* class_ids,
+                               intptr_t max_count);
+
   // Return true if the class is implemented by some other class that is not a
   // subclass.
   static bool IsImplemented(const Class& cls);
@@ -103,4 +103,50 @@ TEST_CASE(ClassHierarchyAnalysis) {
   EXPECT(!cha.HasSubclasses(closure_class.id()));
 }
 
+TEST_CASE(ClassHierarchyAnalysis_ConcreteSubtypes) {
+  const char* kScriptChars =
+      "abstract class I {}\n"
+      "class X implements I {}\n"
+      "class Y implements I {}\n"
+      "class Z extends X {}\n"
+      "abstract class W implements I {}\n"
+      "class V extends W implements X {}\n";
+
+  TestCase::LoadTestScript(kScriptChars, nullptr);
+
+  TransitionNativeToVM transition(thread);
+  EXPECT(ClassFinalizer::ProcessPendingClasses());
+  const String& name = String::Handle(String::New(TestCase::url()));
+  const Library& lib = Library::Handle(Library::LookupLibrary(thread, name));
+  EXPECT(!lib.IsNull());
+
+  Class& cls = Class::Handle();
+  GrowableArray<intptr_t> expected_cids;
+  for (const char* class_name : {"I", "X", "Y", "Z", "W", "V"}) {
+    cls = lib.LookupClass(String::Handle(Symbols::New(thread, class_name)));
+    EXPECT(!cls.IsNull());
+    EXPECT(cls.EnsureIsFinalized(thread) == Error::null());
+    if (!cls.is_abstract()) {
+      expected_cids.Add(cls.id());
+    }
+  }
+  const Class& class_i =
+      Class::Handle(lib.LookupClass(String::Handle(Symbols::New(thread, "I"))));
+
+  SetFlagScope<bool> sfs(&FLAG_precompiled_mode, true);
+
+  // Implementors, their subclasses and classes reachable by several paths
+  // are collected once.
+  GrowableArray<intptr_t> cids;
+  EXPECT(CHA::ConcreteSubtypes(class_i, &cids, /*max_count=*/4));
+  EXPECT_EQ(expected_cids.length(), cids.length());
+  for (intptr_t i = 0; i < expected_cids.length(); i++) {
+    EXPECT(cids.Contains(expected_cids[i]));
+  }
+
+  // Too many subtypes.
+  cids.Clear();
+  EXPECT(!CHA::ConcreteSubtypes(class_i, &cids, /*max_count=*/3));
+}
+
 }  // namespace dart
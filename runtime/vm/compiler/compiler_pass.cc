@@ -12,6 +12,7 @@
 #include "vm/compiler/backend/il_printer.h"
 #include "vm/compiler/backend/inliner.h"
 #include "vm/compiler/backend/linearscan.h"
+#include "vm/compiler/backend/loop_idioms.h"
 #include "vm/compiler/backend/range_analysis.h"
 #include "vm/compiler/backend/redundancy_elimination.h"
 #include "vm/compiler/backend/type_propagator.h"
@@ -85,7 +86,13 @@ DEFINE_OPTION_HANDLER(CompilerPass::ParseFiltersFromFlag,
                       "Do --compiler-passes=help for more information.");
 DECLARE_FLAG(bool, print_flow_graph);
 DECLARE_FLAG(bool, print_flow_graph_optimized);
+DECLARE_FLAG(bool, print_huge_methods);
 DEFINE_FLAG(bool, test_il_serialization, false, "Test IL serialization.");
+DEFINE_FLAG(int,
+            huge_method_cutoff_in_instructions,
+            30000,
+            "Huge method cutoff in IL instructions after inlining in JIT mode: "
+            "Disables optimizations for huge flow graphs.");
 
 void CompilerPassState::set_flow_graph(FlowGraph* flow_graph) {
   flow_graph_ = flow_graph;
@@ -338,6 +345,7 @@ FlowGraph* CompilerPass::RunPipeline(PipelineMode mode,
   INVOKE_PASS(DSE);
   INVOKE_PASS(TypePropagation);
   INVOKE_PASS(RangeAnalysis);
+  INVOKE_PASS(RecognizeLoopIdioms);
   INVOKE_PASS(OptimizeBranches);
   INVOKE_PASS(TypePropagation);
   INVOKE_PASS(TryCatchOptimization);
@@ -398,6 +406,21 @@ COMPILER_PASS(Inlining, {
       flow_graph, &state->inline_id_to_function, &state->inline_id_to_token_pos,
       &state->caller_inline_id, state->speculative_policy, state->precompiler);
   state->inlining_depth = inliner.Inline();
+
+  // Methods can become huge through inlining. In JIT mode, skip the passes
+  // that run in quadratic time for them just like for methods that were huge
+  // to begin with, as they would delay the optimized code for too long.
+  if (!CompilerState::Current().is_aot() && !flow_graph->is_huge_method() &&
+      (flow_graph->InstructionCount() >
+       FLAG_huge_method_cutoff_in_instructions)) {
+    if (FLAG_print_huge_methods) {
+      OS::PrintErr(
+          "Warning: \'%s\' is too large after inlining. Some optimizations "
+          "have been disabled.\n",
+          flow_graph->function().QualifiedUserVisibleNameCString());
+    }
+    flow_graph->mark_huge_method();
+  }
 });
 
 COMPILER_PASS(TypePropagation,
@@ -480,6 +503,13 @@ COMPILER_PASS(RangeAnalysis, {
   range_analysis.Analyze();
 });
 
+COMPILER_PASS(RecognizeLoopIdioms, {
+  if (flow_graph->is_huge_method()) {
+    return false;  // Relies on range analysis.
+  }
+  LoopIdiomRecognizer::Optimize(flow_graph);
+});
+
 COMPILER_PASS(OptimizeBranches, {
   // Constant propagation can use information from range analysis to
   // find unreachable branch targets and eliminate branches that have
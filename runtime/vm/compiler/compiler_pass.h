@@ -44,6 +44,7 @@ namespace dart {
   V(OptimizeBranches)                                                          \
   V(OptimizeTypedDataAccesses)                                                 \
   V(RangeAnalysis)                                                             \
+  V(RecognizeLoopIdioms)                                                       \
   V(ReorderBlocks)                                                             \
   V(SelectRepresentations)                                                     \
   V(SelectRepresentations_Final)                                               \
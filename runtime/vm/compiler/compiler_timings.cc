@@ -4,6 +4,9 @@
 
 #include "vm/compiler/compiler_timings.h"
 
+#include "vm/json_stream.h"
+#include "vm/runtime_entry.h"
+
 namespace dart {
 
 namespace {
@@ -11,6 +14,9 @@ namespace {
 const char* timer_names[] = {COMPILER_TIMERS_LIST(DEFINE_NAME)};
 #undef DEFINE_NAME
 
+const char* tier_names[] = {"unoptimized", "optimized", "optimized (osr)"};
+const char* tier_json_names[] = {"unoptimized", "optimized", "optimizedOSR"};
+
 }  // namespace
 
 void CompilerTimings::PrintTimers(
@@ -103,4 +109,164 @@ void CompilerTimings::Print() {
                try_inlining_failure_.FormatElapsedHumanReadable(zone));
 }
 
+JitTierTimings::TierStats JitTierTimings::stats_[JitTierTimings::kNumTiers];
+
+void JitTierTimings::Record(Tier tier,
+                            const Timer& total,
+                            const Timer& build_graph,
+                            intptr_t code_size) {
+  TierStats& stats = stats_[tier];
+  stats.total.AddTotal(total);
+  stats.build_graph.AddTotal(build_graph);
+  stats.count.fetch_add(1);
+  stats.code_size.fetch_add(code_size);
+  const int64_t elapsed = total.TotalElapsedTime();
+  int64_t max = stats.max_elapsed.load();
+  while (elapsed > max &&
+         !stats.max_elapsed.compare_exchange_weak(max, elapsed)) {
+  }
+}
+
+void JitTierTimings::Print() {
+  OS::PrintErr("JIT compilation by tier:\n");
+  OS::PrintErr("  %-16s %8s %12s %12s %12s %12s\n", "tier", "count",
+               "total (ms)", "graph (ms)", "max (ms)", "code (KB)");
+  for (intptr_t i = 0; i < kNumTiers; i++) {
+    const TierStats& stats = stats_[i];
+    OS::PrintErr("  %-16s %8" Pd " %12.2f %12.2f %12.2f %12" Pd "\n",
+                 tier_names[i], stats.count.load(),
+                 MicrosecondsToMilliseconds(stats.total.TotalElapsedTime()),
+                 MicrosecondsToMilliseconds(
+                     stats.build_graph.TotalElapsedTime()),
+                 MicrosecondsToMilliseconds(stats.max_elapsed.load()),
+                 stats.code_size.load() / KB);
+  }
+}
+
+JitFunctionStatistics::Entry::~Entry() {
+  free(name);
+  for (intptr_t i = 0; i < inlined.length(); i++) {
+    free(inlined[i]);
+  }
+}
+
+JitFunctionStatistics::~JitFunctionStatistics() {
+  Clear();
+}
+
+JitFunctionStatistics::Entry* JitFunctionStatistics::LookupOrAdd(
+    const char* name) {
+  intptr_t index = index_.LookupValue(name);
+  if (index == CStringIntMapKeyValueTrait::kNoValue) {
+    Entry* entry = new Entry(name);
+    index = entries_.length();
+    entries_.Add(entry);
+    // The key is owned by the entry.
+    index_.Insert({entry->name, index});
+  }
+  return entries_[index];
+}
+
+void JitFunctionStatistics::RecordCompilation(const Function& function,
+                                              JitTierTimings::Tier tier,
+                                              const Timer& total,
+                                              const Timer& build_graph,
+                                              const Code& code) {
+  Zone* zone = Thread::Current()->zone();
+  const char* name = function.ToFullyQualifiedCString();
+  // Resolve inlined callee names before taking the lock.
+  const Array& inlined = Array::Handle(zone, code.inlined_id_to_function());
+  GrowableArray<const char*> inlined_names;
+  if (!inlined.IsNull()) {
+    Function& callee = Function::Handle(zone);
+    // Index 0 is the function itself.
+    for (intptr_t i = 1; i < inlined.Length(); i++) {
+      callee ^= inlined.At(i);
+      if (!callee.IsNull()) {
+        inlined_names.Add(callee.ToFullyQualifiedCString());
+      }
+    }
+  }
+
+  MutexLocker ml(&mutex_);
+  Entry* entry = LookupOrAdd(name);
+  TierStats& stats = entry->tiers[tier];
+  stats.count++;
+  stats.total_micros += total.TotalElapsedTime();
+  stats.build_graph_micros += build_graph.TotalElapsedTime();
+  entry->code_size = code.Size();
+  if (tier != JitTierTimings::kUnoptimized) {
+    for (intptr_t i = 0; i < entry->inlined.length(); i++) {
+      free(entry->inlined[i]);
+    }
+    entry->inlined.Clear();
+    for (intptr_t i = 0; i < inlined_names.length(); i++) {
+      entry->inlined.Add(Utils::StrDup(inlined_names[i]));
+    }
+  }
+}
+
+void JitFunctionStatistics::RecordDeoptimization(
+    const Function& function,
+    ICData::DeoptReasonId reason) {
+  const char* name = function.ToFullyQualifiedCString();
+  MutexLocker ml(&mutex_);
+  Entry* entry = LookupOrAdd(name);
+  entry->deopt_count++;
+  if (reason >= 0 && reason < ICData::kDeoptNumReasons) {
+    entry->deopt_reasons[reason]++;
+  }
+}
+
+#ifndef PRODUCT
+void JitFunctionStatistics::PrintJSON(JSONStream* js) {
+  MutexLocker ml(&mutex_);
+  JSONObject jsobj(js);
+  jsobj.AddProperty("type", "_JitFunctionStatistics");
+  JSONArray functions(&jsobj, "functions");
+  for (intptr_t i = 0; i < entries_.length(); i++) {
+    const Entry* entry = entries_[i];
+    JSONObject function(&functions);
+    function.AddProperty("name", entry->name);
+    function.AddProperty("codeSize", entry->code_size);
+    {
+      JSONObject tiers(&function, "compilations");
+      for (intptr_t t = 0; t < JitTierTimings::kNumTiers; t++) {
+        const TierStats& stats = entry->tiers[t];
+        if (stats.count == 0) continue;
+        JSONObject tier(&tiers, tier_json_names[t]);
+        tier.AddProperty("count", stats.count);
+        tier.AddProperty64("totalMicros", stats.total_micros);
+        tier.AddProperty64("buildGraphMicros", stats.build_graph_micros);
+      }
+    }
+    function.AddProperty("deoptimizations", entry->deopt_count);
+    {
+      JSONObject reasons(&function, "deoptReasons");
+      for (intptr_t r = 0; r < ICData::kDeoptNumReasons; r++) {
+        if (entry->deopt_reasons[r] == 0) continue;
+        reasons.AddProperty(
+            DeoptReasonToCString(static_cast<ICData::DeoptReasonId>(r)),
+            entry->deopt_reasons[r]);
+      }
+    }
+    {
+      JSONArray inlined(&function, "inlined");
+      for (intptr_t j = 0; j < entry->inlined.length(); j++) {
+        inlined.AddValue(entry->inlined[j]);
+      }
+    }
+  }
+}
+#endif  // !PRODUCT
+
+void JitFunctionStatistics::Clear() {
+  MutexLocker ml(&mutex_);
+  for (intptr_t i = 0; i < entries_.length(); i++) {
+    delete entries_[i];
+  }
+  entries_.Clear();
+  index_.Clear();
+}
+
 }  // namespace dart
@@ -9,6 +9,9 @@
 
 #include "platform/allocation.h"
 #include "vm/compiler/compiler_pass.h"
+#include "vm/hash_map.h"
+#include "vm/object.h"
+#include "vm/os_thread.h"
 #include "vm/thread.h"
 #include "vm/timer.h"
 
@@ -58,6 +61,8 @@
 
 namespace dart {
 
+class JSONStream;
+
 // |CompilerTimings| provides a way to track time taken by various compiler
 // passes via a fixed number of timers (specified in |COMPILER_TIMERS_LIST|).
 //
@@ -143,6 +148,99 @@ class CompilerTimings : public MallocAllocated {
   Timer try_inlining_failure_;
 };
 
+// Process wide totals of JIT compilations broken down by tier, printed at
+// shutdown with --print-jit-tier-timings.
+//
+// Unlike CompilerTimings, which is attached to the single thread running the
+// precompiler, these are updated concurrently by mutators compiling
+// unoptimized code and by the background compiler.
+class JitTierTimings : public AllStatic {
+ public:
+  enum Tier {
+    kUnoptimized,
+    kOptimized,
+    kOptimizedOSR,
+    kNumTiers,
+  };
+
+  // Records a successful compilation which took |total| time overall and
+  // |build_graph| time building the flow graph.
+  static void Record(Tier tier,
+                     const Timer& total,
+                     const Timer& build_graph,
+                     intptr_t code_size);
+
+  static void Print();
+
+ private:
+  struct TierStats {
+    Timer total;
+    Timer build_graph;
+    RelaxedAtomic<intptr_t> count = 0;
+    RelaxedAtomic<intptr_t> code_size = 0;
+    RelaxedAtomic<int64_t> max_elapsed = 0;
+  };
+
+  static TierStats stats_[kNumTiers];
+};
+
+// Per-function JIT compilation and deoptimization history of an isolate
+// group, collected with --collect-jit-function-statistics and reported by
+// the _getJitFunctionStatistics service RPC.
+//
+// Functions are identified by their fully qualified name so that entries
+// survive hot reload and do not keep Function objects alive.
+class JitFunctionStatistics : public MallocAllocated {
+ public:
+  JitFunctionStatistics() {}
+  ~JitFunctionStatistics();
+
+  // Records a successful compilation of |function| into |code|.
+  void RecordCompilation(const Function& function,
+                         JitTierTimings::Tier tier,
+                         const Timer& total,
+                         const Timer& build_graph,
+                         const Code& code);
+
+  void RecordDeoptimization(const Function& function,
+                            ICData::DeoptReasonId reason);
+
+#ifndef PRODUCT
+  void PrintJSON(JSONStream* js);
+#endif  // !PRODUCT
+
+  void Clear();
+
+ private:
+  struct TierStats {
+    intptr_t count = 0;
+    int64_t total_micros = 0;
+    int64_t build_graph_micros = 0;
+  };
+
+  struct Entry : public MallocAllocated {
+    explicit Entry(const char* name) : name(Utils::StrDup(name)) {}
+    ~Entry();
+
+    char* name;
+    TierStats tiers[JitTierTimings::kNumTiers];
+    intptr_t code_size = 0;
+    intptr_t deopt_count = 0;
+    intptr_t deopt_reasons[ICData::kDeoptNumReasons] = {};
+    // Names of the functions inlined into the most recent optimized code.
+    MallocGrowableArray<char*> inlined;
+  };
+
+  Entry* LookupOrAdd(const char* name);
+
+  Mutex mutex_;
+  MallocGrowableArray<Entry*> entries_;
+  // Maps function names to indices into |entries_|.
+  MallocDirectChainedHashMap<CStringIntMapKeyValueTrait> index_;
+
+  DISALLOW_COPY_AND_ASSIGN(JitFunctionStatistics);
+};
+
 #define TIMER_SCOPE_NAME2(counter) timer_scope_##counter
 #define TIMER_SCOPE_NAME(counter) TIMER_SCOPE_NAME2(counter)
 
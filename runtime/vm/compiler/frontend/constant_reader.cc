@@ -4,6 +4,7 @@
 
 #include "vm/compiler/frontend/constant_reader.h"
 
+#include "vm/kernel_loader.h"
 #include "vm/object_store.h"
 
 namespace dart {
@@ -391,6 +392,10 @@ InstancePtr ConstantReader::ReadConstantInternal(intptr_t constant_index) {
         constant = ReadConstant(entry_index);
         data.SetAt(j, constant);
       }
+      if (FLAG_precompiled_mode) {
+        // Avoid building the index on first access at runtime.
+        map.ComputeAndSetIndex();
+      }
 
       instance = map.ptr();
       break;
@@ -480,6 +485,10 @@ InstancePtr ConstantReader::ReadConstantInternal(intptr_t constant_index) {
         constant = ReadConstant(entry_index);
         data.SetAt(j, constant);
       }
+      if (FLAG_precompiled_mode) {
+        // Avoid building the index on first access at runtime.
+        set.ComputeAndSetIndex();
+      }
 
       instance = set.ptr();
       break;
@@ -487,7 +496,8 @@ InstancePtr ConstantReader::ReadConstantInternal(intptr_t constant_index) {
     case kInstanceConstant: {
       const NameIndex index = reader.ReadCanonicalNameReference();
       const auto& klass = Class::Handle(Z, H.LookupClassByKernelClass(index));
-      if (!klass.is_declaration_loaded()) {
+      if (!klass.is_declaration_loaded() &&
+          !KernelLoader::LoadClassDeclarationLazily(klass)) {
         FATAL(
             "Trying to evaluate an instance constant whose references class "
             "%s is not loaded yet.",
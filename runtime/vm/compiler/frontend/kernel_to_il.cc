@@ -338,6 +338,31 @@ Fragment FlowGraphBuilder::CloneContext(
     const ZoneGrowableArray<const Slot*>& context_slots) {
   LocalVariable* context_variable = parsed_function_->current_context_var();
 
+  if (CompilerState::Current().is_aot()) {
+    // Copy the context explicitly instead of calling the runtime, so that
+    // load forwarding can see through the copy and allocation sinking can
+    // eliminate both contexts if closures capturing loop variables do not
+    // escape. Not done in JIT mode, where deoptimizing after the allocation
+    // would resume unoptimized code with a context that was not filled in.
+    Fragment instructions = AllocateContext(context_slots);
+    LocalVariable* new_context = MakeTemporary();
+    instructions += LoadLocal(new_context);
+    instructions += LoadLocal(context_variable);
+    instructions += LoadNativeField(Slot::Context_parent());
+    instructions += StoreNativeField(Slot::Context_parent(),
+                                     StoreFieldInstr::Kind::kInitializing);
+    for (const Slot* slot : context_slots) {
+      instructions += LoadLocal(new_context);
+      instructions += LoadLocal(context_variable);
+      instructions += LoadNativeField(*slot);
+      instructions +=
+          StoreNativeField(*slot, StoreFieldInstr::Kind::kInitializing);
+    }
+    instructions += StoreLocal(TokenPosition::kNoSource, context_variable);
+    instructions += Drop();
+    return instructions;
+  }
+
   Fragment instructions = LoadLocal(context_variable);
 
   CloneContextInstr* clone_instruction = new (Z) CloneContextInstr(
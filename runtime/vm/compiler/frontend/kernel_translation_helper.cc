@@ -10,6 +10,7 @@
 #include "vm/compiler/backend/flow_graph_compiler.h"
 #include "vm/compiler/frontend/constant_reader.h"
 #include "vm/flags.h"
+#include "vm/kernel_loader.h"
 #include "vm/log.h"
 #include "vm/object_store.h"
 #include "vm/parser.h"  // for ParsedFunction
@@ -542,35 +543,36 @@ LibraryPtr TranslationHelper::LookupLibraryByKernelLibrary(
 ClassPtr TranslationHelper::LookupClassByKernelClass(NameIndex kernel_class,
                                                      bool required) {
   ASSERT(IsClass(kernel_class));
-  {
-    name_index_handle_ = Smi::New(kernel_class);
-    ClassPtr raw_class = info_.LookupClass(thread_, name_index_handle_);
-    NoSafepointScope no_safepoint_scope(thread_);
-    if (raw_class != Class::null()) {
-      return raw_class;
+  name_index_handle_ = Smi::New(kernel_class);
+  Class& klass =
+      Class::Handle(Z, info_.LookupClass(thread_, name_index_handle_));
+  if (klass.IsNull()) {
+    const String& class_name = DartClassName(kernel_class);
+    NameIndex kernel_library = CanonicalNameParent(kernel_class);
+    Library& library = Library::Handle(
+        Z, LookupLibraryByKernelLibrary(kernel_library, /*required=*/false));
+    if (library.IsNull()) {
+      if (required) {
+        LookupFailed(kernel_class);
+      }
+      return Class::null();
     }
-  }
-
-  const String& class_name = DartClassName(kernel_class);
-  NameIndex kernel_library = CanonicalNameParent(kernel_class);
-  Library& library = Library::Handle(
-      Z, LookupLibraryByKernelLibrary(kernel_library, /*required=*/false));
-  if (library.IsNull()) {
-    if (required) {
-      LookupFailed(kernel_class);
+    klass = library.LookupClassAllowPrivate(class_name);
+    if (klass.IsNull()) {
+      if (required) {
+        LookupFailed(kernel_class);
+      }
+      return Class::null();
     }
-    return Class::null();
+    name_index_handle_ = Smi::New(kernel_class);
+    klass = info_.InsertClass(thread_, name_index_handle_, klass);
   }
-  const Class& klass =
-      Class::Handle(Z, library.LookupClassAllowPrivate(class_name));
-  if (klass.IsNull()) {
-    if (required) {
-      LookupFailed(kernel_class);
-    }
-    return Class::null();
+  // Classes of libraries loaded with --lazy-kernel-class-loading are loaded
+  // when they are first looked up.
+  if (!klass.is_declaration_loaded()) {
+    KernelLoader::LoadClassDeclarationLazily(klass);
   }
-  name_index_handle_ = Smi::New(kernel_class);
-  return info_.InsertClass(thread_, name_index_handle_, klass);
+  return klass.ptr();
 }
 
 ClassPtr TranslationHelper::LookupClassByKernelClassOrLibrary(
@@ -22,6 +22,7 @@
 #include "vm/compiler/cha.h"
 #include "vm/compiler/compiler_pass.h"
 #include "vm/compiler/compiler_state.h"
+#include "vm/compiler/compiler_timings.h"
 #include "vm/compiler/ffi/callback.h"
 #include "vm/compiler/frontend/flow_graph_builder.h"
 #include "vm/compiler/frontend/kernel_to_il.h"
@@ -67,6 +68,16 @@ DEFINE_FLAG(bool,
             false,
             "Print the deopt-id to ICData map in optimizing compiler.");
 DEFINE_FLAG(bool, print_code_source_map, false, "Print code source map.");
+DEFINE_FLAG(bool,
+            collect_jit_function_statistics,
+            false,
+            "Record per-function compilation and deoptimization statistics "
+            "for the _getJitFunctionStatistics service RPC.");
+DEFINE_FLAG(bool,
+            print_jit_tier_timings,
+            false,
+            "Print the number, duration and code size of JIT compilations "
+            "by tier at shutdown.");
 DEFINE_FLAG(bool,
             stress_test_background_compilation,
             false,
@@ -312,6 +323,9 @@ class CompileParsedFunctionHelper : public ValueObject {
 
   CodePtr Compile(CompilationPipeline* pipeline);
 
+  // Time spent building flow graphs in Compile, including retries.
+  const Timer& build_graph_timer() const { return build_graph_timer_; }
+
  private:
   ParsedFunction* parsed_function() const { return parsed_function_; }
   bool optimized() const { return optimized_; }
@@ -326,6 +340,7 @@ class CompileParsedFunctionHelper : public ValueObject {
   const bool optimized_;
   const intptr_t osr_id_;
   Thread* const thread_;
+  Timer build_graph_timer_;
 
   DISALLOW_COPY_AND_ASSIGN(CompileParsedFunctionHelper);
 };
@@ -430,6 +445,7 @@ CodePtr CompileParsedFunctionHelper::FinalizeCompilation(
       } else {
         // OSR is not compiled in background.
         ASSERT(!Compiler::IsBackgroundCompilation());
+        function.AddOsrCode(osr_id(), code);
       }
       ASSERT(code.owner() == function.ptr());
     } else {
@@ -544,8 +560,10 @@ CodePtr CompileParsedFunctionHelper::Compile(CompilationPipeline* pipeline) {
         }
 
         TIMELINE_DURATION(thread(), CompilerVerbose, "BuildFlowGraph");
+        build_graph_timer_.Start();
         flow_graph = pipeline->BuildFlowGraph(
             zone, parsed_function(), ic_data_array, osr_id(), optimized());
+        build_graph_timer_.Stop();
       }
 
       const bool print_flow_graph =
@@ -791,6 +809,22 @@ static ObjectPtr CompileFunctionHelper(CompilationPipeline* pipeline,
 
     per_compile_timer.Stop();
 
+    if (FLAG_print_jit_tier_timings || FLAG_collect_jit_function_statistics) {
+      const auto tier = !optimized ? JitTierTimings::kUnoptimized
+                        : (osr_id == Compiler::kNoOSRDeoptId)
+                            ? JitTierTimings::kOptimized
+                            : JitTierTimings::kOptimizedOSR;
+      if (FLAG_print_jit_tier_timings) {
+        JitTierTimings::Record(tier, per_compile_timer,
+                               helper.build_graph_timer(), result.Size());
+      }
+      if (FLAG_collect_jit_function_statistics) {
+        thread->isolate_group()->jit_function_statistics()->RecordCompilation(
+            function, tier, per_compile_timer, helper.build_graph_timer(),
+            result);
+      }
+    }
+
     if (trace_compiler) {
       const auto& code = Code::Handle(function.CurrentCode());
       THR_Print("--> '%s' entry: %#" Px " size: %" Pd " time: %" Pd64 " us\n",
@@ -1017,7 +1051,8 @@ class QueueElement {
 };
 
 // Allocated in C-heap. Handles both input and output of background compilation.
-// It implements a FIFO queue, using Peek, Add, Remove operations.
+// It implements a priority queue, using Peek, Add, Remove and RemoveHottest
+// operations.
 class BackgroundCompilationQueue {
  public:
   BackgroundCompilationQueue() : first_(nullptr), last_(nullptr) {}
@@ -1034,6 +1069,14 @@ class BackgroundCompilationQueue {
 
   bool IsEmpty() const { return first_ == nullptr; }
 
+  intptr_t Length() const {
+    intptr_t length = 0;
+    for (QueueElement* p = first_; p != nullptr; p = p->next()) {
+      length++;
+    }
+    return length;
+  }
+
   void Add(QueueElement* value) {
     ASSERT(value != nullptr);
     ASSERT(value->next() == nullptr);
@@ -1066,9 +1109,47 @@ class BackgroundCompilationQueue {
     if (first_ == nullptr) {
       last_ = nullptr;
     }
+    result->set_next(nullptr);
     return result;
   }
 
+  // Removes the given element, which must be in the queue.
+  void Remove(QueueElement* value) {
+    QueueElement* prev = nullptr;
+    QueueElement* p = first_;
+    while (p != value) {
+      ASSERT(p != nullptr);
+      prev = p;
+      p = p->next();
+    }
+    Unlink(prev, p);
+  }
+
+  // Removes the element whose function has the highest usage counter, the
+  // oldest one among equally hot functions.
+  //
+  // Functions get their usage counter reset when they are queued, so it
+  // reflects how often they were called while waiting for compilation.
+  QueueElement* RemoveHottest(Zone* zone) {
+    ASSERT(first_ != nullptr);
+    auto& function = Function::Handle(zone);
+    QueueElement* hottest_prev = nullptr;
+    QueueElement* hottest = first_;
+    function = hottest->Function();
+    int32_t hottest_counter = function.usage_counter();
+    for (QueueElement *prev = first_, *p = first_->next(); p != nullptr;
+         prev = p, p = p->next()) {
+      function = p->Function();
+      if (function.usage_counter() > hottest_counter) {
+        hottest_prev = prev;
+        hottest = p;
+        hottest_counter = function.usage_counter();
+      }
+    }
+    Unlink(hottest_prev, hottest);
+    return hottest;
+  }
+
   bool ContainsObj(const Object& obj) const {
     QueueElement* p = first_;
     while (p != nullptr) {
@@ -1089,6 +1170,18 @@ class BackgroundCompilationQueue {
   }
 
  private:
+  void Unlink(QueueElement* prev, QueueElement* value) {
+    if (prev == nullptr) {
+      first_ = value->next();
+    } else {
+      prev->set_next(value->next());
+    }
+    if (last_ == value) {
+      last_ = prev;
+    }
+    value->set_next(nullptr);
+  }
+
   QueueElement* first_;
   QueueElement* last_;
 
@@ -1113,13 +1206,15 @@ BackgroundCompiler::BackgroundCompiler(IsolateGroup* isolate_group)
     : isolate_group_(isolate_group),
       monitor_(),
       function_queue_(new BackgroundCompilationQueue()),
+      compiling_functions_(new BackgroundCompilationQueue()),
       running_(false),
-      done_(true),
+      active_tasks_(0),
       disabled_depth_(0) {}
 
 // Fields all deleted in ::Stop; here clear them.
 BackgroundCompiler::~BackgroundCompiler() {
   delete function_queue_;
+  delete compiling_functions_;
 }
 
 void BackgroundCompiler::Run() {
@@ -1136,26 +1231,29 @@ void BackgroundCompiler::Run() {
     {
       SafepointMonitorLocker ml(&monitor_);
       if (running_ && !function_queue()->IsEmpty()) {
-        element = function_queue()->Remove();
+        element = function_queue()->RemoveHottest(zone);
         function ^= element->function();
+        // Keep the function visible to EnqueueCompilation so that other
+        // tasks do not compile it at the same time.
+        compiling_functions_->Add(element);
       }
     }
     if (element != nullptr) {
-      delete element;
       Compiler::CompileOptimizedFunction(thread, function,
                                          Compiler::kNoOSRDeoptId);
 
       // If an optimizable method is not optimized, put it back on
       // the background queue (unless it was passed to foreground).
-      if ((!function.HasOptimizedCode() && function.IsOptimizable()) ||
-          FLAG_stress_test_background_compilation) {
-        if (Compiler::CanOptimizeFunction(thread, function)) {
-          SafepointMonitorLocker ml(&monitor_);
-          if (running_) {
-            QueueElement* repeat_qelem = new QueueElement(function);
-            function_queue()->Add(repeat_qelem);
-          }
-        }
+      const bool repeat =
+          ((!function.HasOptimizedCode() && function.IsOptimizable()) ||
+           FLAG_stress_test_background_compilation) &&
+          Compiler::CanOptimizeFunction(thread, function);
+      SafepointMonitorLocker ml(&monitor_);
+      compiling_functions_->Remove(element);
+      if (repeat && running_) {
+        function_queue()->Add(element);
+      } else {
+        delete element;
       }
     }
   }
@@ -1165,12 +1263,11 @@ void BackgroundCompiler::Run() {
     if (running_ && !function_queue()->IsEmpty() &&
         Dart::thread_pool()->Run<BackgroundCompilerTask>(this)) {
       // Successfully scheduled a new task.
-    } else {
+    } else if (--active_tasks_ == 0) {
       // Background compiler done. This notification must happen after the
       // thread leaves to group to avoid a shutdown race with the thread
       // registry.
       running_ = false;
-      done_ = true;
       ml.NotifyAll();
     }
   }
@@ -1183,32 +1280,47 @@ bool BackgroundCompiler::EnqueueCompilation(const Function& function) {
 
   SafepointMonitorLocker ml(&monitor_);
   if (disabled_depth_ > 0) return false;
-  if (!running_ && done_) {
+  if (!running_ && active_tasks_ == 0) {
     running_ = true;
-    done_ = false;
-    // If we ever wanted to run the BG compiler on the
-    // `IsolateGroup::mutator_pool()` we would need to ensure the BG compiler
-    // stops when it's idle - otherwise the [MutatorThreadPool]-based idle
-    // notification would not work anymore.
-    if (!Dart::thread_pool()->Run<BackgroundCompilerTask>(this)) {
+    if (!StartTaskLocked()) {
       running_ = false;
-      done_ = true;
       return false;
     }
   }
 
   ASSERT(running_);
-  if (function_queue()->ContainsObj(function)) {
+  if (function_queue()->ContainsObj(function) ||
+      compiling_functions_->ContainsObj(function)) {
     return true;
   }
   QueueElement* elem = new QueueElement(function);
   function_queue()->Add(elem);
+  // Add tasks while functions wait in the queue, up to the limit. Each task
+  // compiles one function and reschedules itself while the queue is not
+  // empty.
+  if (active_tasks_ < FLAG_background_compilation_threads &&
+      active_tasks_ < function_queue()->Length()) {
+    StartTaskLocked();
+  }
   ml.NotifyAll();
   return true;
 }
 
+bool BackgroundCompiler::StartTaskLocked() {
+  // If we ever wanted to run the BG compiler on the
+  // `IsolateGroup::mutator_pool()` we would need to ensure the BG compiler
+  // stops when it's idle - otherwise the [MutatorThreadPool]-based idle
+  // notification would not work anymore.
+  if (!Dart::thread_pool()->Run<BackgroundCompilerTask>(this)) {
+    return false;
+  }
+  active_tasks_++;
+  return true;
+}
+
 void BackgroundCompiler::VisitPointers(ObjectPointerVisitor* visitor) {
   function_queue_->VisitObjectPointers(visitor);
+  compiling_functions_->VisitObjectPointers(visitor);
 }
 
 void BackgroundCompiler::Stop() {
@@ -1224,7 +1336,7 @@ void BackgroundCompiler::StopLocked(Thread* thread,
                                     SafepointMonitorLocker* locker) {
   running_ = false;
   function_queue_->Clear();
-  while (!done_) {
+  while (active_tasks_ > 0) {
     locker->Wait();
   }
 }
@@ -1248,7 +1360,7 @@ void BackgroundCompiler::Disable() {
 
   SafepointMonitorLocker ml(&monitor_);
   disabled_depth_++;
-  if (done_) return;
+  if (active_tasks_ == 0) return;
   StopLocked(thread, &ml);
 }
 
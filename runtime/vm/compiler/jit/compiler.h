@@ -145,14 +145,19 @@ class BackgroundCompiler {
   void StopLocked(Thread* thread, SafepointMonitorLocker* done_locker);
   void Enable();
   void Disable();
-  bool IsRunning() { return !done_; }
+  bool IsRunning() { return active_tasks_ > 0; }
+
+  // Schedules another compiler task on the thread pool.
+  bool StartTaskLocked();
 
   IsolateGroup* isolate_group_;
 
-  Monitor monitor_;  // Controls access to the queue and running state.
+  Monitor monitor_;  // Controls access to the queues and running state.
   BackgroundCompilationQueue* function_queue_;
-  bool running_;  // While true, will try to read queue and compile.
-  bool done_;     // True if the thread is done.
+  // Functions currently being compiled by one of the tasks.
+  BackgroundCompilationQueue* compiling_functions_;
+  bool running_;           // While true, will try to read queue and compile.
+  intptr_t active_tasks_;  // Number of scheduled or running compiler tasks.
   int16_t disabled_depth_;
 
   DISALLOW_IMPLICIT_CONSTRUCTORS(BackgroundCompiler);
@@ -510,6 +510,9 @@ class Class : public AllStatic {
 
   // Whether to trace allocation for this klass.
   static bool TraceAllocation(const dart::Class& klass);
+
+  // Whether instances of [klass] should be allocated in old space.
+  static bool IsPretenured(const dart::Class& klass);
 };
 
 class Instance : public AllStatic {
@@ -100,6 +100,53 @@ ISOLATE_UNIT_TEST_CASE(OptimizeCompileFunctionOnHelperThread) {
   delete m;
 }
 
+ISOLATE_UNIT_TEST_CASE(OptimizeCompileFunctionsOnParallelHelperThreads) {
+  const char* kScriptChars =
+      "class A {\n"
+      "  static foo() { return 42; }\n"
+      "  static bar() { return 24; }\n"
+      "}\n";
+  Dart_Handle library;
+  {
+    TransitionVMToNative transition(thread);
+    library = TestCase::LoadTestScript(kScriptChars, nullptr);
+  }
+  const Library& lib =
+      Library::Handle(Library::RawCast(Api::UnwrapHandle(library)));
+  EXPECT(ClassFinalizer::ProcessPendingClasses());
+  Class& cls =
+      Class::Handle(lib.LookupClass(String::Handle(Symbols::New(thread, "A"))));
+  EXPECT(!cls.IsNull());
+  const auto& error = cls.EnsureIsFinalized(thread);
+  EXPECT(error == Error::null());
+  Function& foo = Function::Handle(
+      cls.LookupStaticFunction(String::Handle(String::New("foo"))));
+  Function& bar = Function::Handle(
+      cls.LookupStaticFunction(String::Handle(String::New("bar"))));
+  CompilerTest::TestCompileFunction(foo);
+  CompilerTest::TestCompileFunction(bar);
+  EXPECT(!foo.HasOptimizedCode());
+  EXPECT(!bar.HasOptimizedCode());
+#if !defined(PRODUCT)
+  // Constant in product mode.
+  FLAG_background_compilation = true;
+#endif
+  SetFlagScope<int> sfs(&FLAG_background_compilation_threads, 2);
+  auto background_compiler = thread->isolate_group()->background_compiler();
+  // Duplicate requests are ignored.
+  EXPECT(background_compiler->EnqueueCompilation(foo));
+  EXPECT(background_compiler->EnqueueCompilation(foo));
+  EXPECT(background_compiler->EnqueueCompilation(bar));
+  Monitor* m = new Monitor();
+  {
+    SafepointMonitorLocker ml(m);
+    while (!foo.HasOptimizedCode() || !bar.HasOptimizedCode()) {
+      ml.Wait(1);
+    }
+  }
+  delete m;
+}
+
 ISOLATE_UNIT_TEST_CASE(CompileFunctionOnHelperThread) {
   // Create a simple function and compile it without optimization.
   const char* kScriptChars =
@@ -127,6 +174,46 @@ ISOLATE_UNIT_TEST_CASE(CompileFunctionOnHelperThread) {
   EXPECT(func.HasCode());
 }
 
+ISOLATE_UNIT_TEST_CASE(OsrCodeCache) {
+  const char* kScriptChars =
+      "class A {\n"
+      "  static foo() { return 42; }\n"
+      "}\n";
+  Dart_Handle library;
+  {
+    TransitionVMToNative transition(thread);
+    library = TestCase::LoadTestScript(kScriptChars, nullptr);
+  }
+  const Library& lib =
+      Library::Handle(Library::RawCast(Api::UnwrapHandle(library)));
+  EXPECT(ClassFinalizer::ProcessPendingClasses());
+  Class& cls =
+      Class::Handle(lib.LookupClass(String::Handle(Symbols::New(thread, "A"))));
+  EXPECT(!cls.IsNull());
+  const auto& error = cls.EnsureIsFinalized(thread);
+  EXPECT(error == Error::null());
+  Function& func = Function::Handle(
+      cls.LookupStaticFunction(String::Handle(String::New("foo"))));
+  CompilerTest::TestCompileFunction(func);
+  EXPECT(func.HasCode());
+  EXPECT(func.FindOsrCode(1) == Code::null());
+
+  const auto& result = Object::Handle(Compiler::CompileOptimizedFunction(
+      thread, func, Compiler::kNoOSRDeoptId));
+  EXPECT(result.IsCode());
+  const auto& code = Code::Cast(result);
+  {
+    SafepointWriteRwLocker ml(thread, thread->isolate_group()->program_lock());
+    func.AddOsrCode(1, code);
+  }
+  EXPECT(func.FindOsrCode(1) == code.ptr());
+  EXPECT(func.FindOsrCode(2) == Code::null());
+
+  // Code invalidated by a dependency is not reused.
+  code.DisableDartCode();
+  EXPECT(func.FindOsrCode(1) == Code::null());
+}
+
 ISOLATE_UNIT_TEST_CASE(RegenerateAllocStubs) {
   const char* kScriptChars =
       "class A {\n"
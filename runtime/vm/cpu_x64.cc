@@ -29,6 +29,7 @@ const char* CPU::Id() {
 const char* HostCPUFeatures::hardware_ = nullptr;
 bool HostCPUFeatures::sse2_supported_ = true;
 bool HostCPUFeatures::sse4_1_supported_ = false;
+bool HostCPUFeatures::sse4_2_supported_ = false;
 bool HostCPUFeatures::popcnt_supported_ = false;
 bool HostCPUFeatures::abm_supported_ = false;
 
@@ -42,6 +43,8 @@ void HostCPUFeatures::Init() {
   hardware_ = CpuInfo::GetCpuModel();
   sse4_1_supported_ = CpuInfo::FieldContains(kCpuInfoFeatures, "sse4_1") ||
                       CpuInfo::FieldContains(kCpuInfoFeatures, "sse4.1");
+  sse4_2_supported_ = CpuInfo::FieldContains(kCpuInfoFeatures, "sse4_2") ||
+                      CpuInfo::FieldContains(kCpuInfoFeatures, "sse4.2");
   popcnt_supported_ = CpuInfo::FieldContains(kCpuInfoFeatures, "popcnt");
   abm_supported_ = CpuInfo::FieldContains(kCpuInfoFeatures, "abm");
 #if defined(DEBUG)
@@ -66,6 +69,7 @@ void HostCPUFeatures::Init() {
   CpuInfo::Init();
   hardware_ = CpuInfo::GetCpuModel();
   sse4_1_supported_ = false;
+  sse4_2_supported_ = false;
   popcnt_supported_ = false;
   abm_supported_ = false;
 #if defined(DEBUG)
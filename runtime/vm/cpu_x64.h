@@ -32,6 +32,10 @@ class HostCPUFeatures : public AllStatic {
     DEBUG_ASSERT(initialized_);
     return sse4_1_supported_ && FLAG_use_sse41 && !FLAG_target_unknown_cpu;
   }
+  static bool sse4_2_supported() {
+    DEBUG_ASSERT(initialized_);
+    return sse4_2_supported_ && !FLAG_target_unknown_cpu;
+  }
   static bool popcnt_supported() {
     DEBUG_ASSERT(initialized_);
     return popcnt_supported_ && !FLAG_target_unknown_cpu;
@@ -45,6 +49,7 @@ class HostCPUFeatures : public AllStatic {
   static const char* hardware_;
   static bool sse2_supported_;
   static bool sse4_1_supported_;
+  static bool sse4_2_supported_;
   static bool popcnt_supported_;
   static bool abm_supported_;
 #if defined(DEBUG)
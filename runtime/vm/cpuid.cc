@@ -23,6 +23,7 @@ DEFINE_FLAG(bool, trace_cpuid, false, "Trace CPU ID discovery")
 
 bool CpuId::sse2_ = false;
 bool CpuId::sse41_ = false;
+bool CpuId::sse42_ = false;
 bool CpuId::popcnt_ = false;
 bool CpuId::abm_ = false;
 
@@ -70,12 +71,13 @@ void CpuId::Init() {
     }
   }
   CpuId::sse41_ = (info[2] & (1 << 19)) != 0;
+  CpuId::sse42_ = (info[2] & (1 << 20)) != 0;
   CpuId::sse2_ = (info[3] & (1 << 26)) != 0;
   CpuId::popcnt_ = (info[2] & (1 << 23)) != 0;
   if (FLAG_trace_cpuid) {
-    OS::PrintErr("sse41? %s sse2? %s popcnt? %s\n",
-                 CpuId::sse41_ ? "yes" : "no", CpuId::sse2_ ? "yes" : "no",
-                 CpuId::popcnt_ ? "yes" : "no");
+    OS::PrintErr("sse41? %s sse42? %s sse2? %s popcnt? %s\n",
+                 CpuId::sse41_ ? "yes" : "no", CpuId::sse42_ ? "yes" : "no",
+                 CpuId::sse2_ ? "yes" : "no", CpuId::popcnt_ ? "yes" : "no");
   }
 
   GetCpuId(0x80000001, info);
@@ -146,6 +148,9 @@ const char* CpuId::field(CpuInfoIndices idx) {
       if (sse41()) {
         p += snprintf(p, q - p, "sse4.1 ");
       }
+      if (sse42()) {
+        p += snprintf(p, q - p, "sse4.2 ");
+      }
       if (popcnt()) {
         p += snprintf(p, q - p, "popcnt ");
       }
@@ -33,11 +33,13 @@ class CpuId : public AllStatic {
 
   static bool sse2() { return sse2_; }
   static bool sse41() { return sse41_; }
+  static bool sse42() { return sse42_; }
   static bool popcnt() { return popcnt_; }
   static bool abm() { return abm_; }
 
   static bool sse2_;
   static bool sse41_;
+  static bool sse42_;
   static bool popcnt_;
   static bool abm_;
   static const char* id_string_;
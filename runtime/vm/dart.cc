@@ -12,6 +12,9 @@
 
 #include "vm/app_snapshot.h"
 #include "vm/code_observers.h"
+#if !defined(DART_PRECOMPILED_RUNTIME)
+#include "vm/compiler/compiler_timings.h"
+#endif  // !defined(DART_PRECOMPILED_RUNTIME)
 #include "vm/compiler/runtime_offsets_extracted.h"
 #include "vm/compiler/runtime_offsets_list.h"
 #include "vm/cpu.h"
@@ -58,11 +61,21 @@
 namespace dart {
 
 DECLARE_FLAG(bool, print_class_table);
+#if !defined(DART_PRECOMPILED_RUNTIME)
+DECLARE_FLAG(bool, print_jit_tier_timings);
+#endif  // !defined(DART_PRECOMPILED_RUNTIME)
 DEFINE_FLAG(bool, trace_shutdown, false, "Trace VM shutdown on stderr");
+DEFINE_FLAG(int,
+            native_port_thread_pool_size,
+            0,
+            "If positive, native ports handle their messages on a dedicated "
+            "thread pool with at most this many threads instead of the "
+            "shared VM thread pool.");
 
 Isolate* Dart::vm_isolate_ = nullptr;
 int64_t Dart::start_time_micros_ = 0;
 ThreadPool* Dart::thread_pool_ = nullptr;
+ThreadPool* Dart::native_port_thread_pool_ = nullptr;
 DebugInfo* Dart::pprof_symbol_generator_ = nullptr;
 ReadOnlyHandles* Dart::predefined_handles_ = nullptr;
 Snapshot::Kind Dart::vm_snapshot_kind_ = Snapshot::kInvalid;
@@ -357,6 +370,11 @@ char* Dart::DartInit(const Dart_InitializeParams* params) {
   // Create the VM isolate and finish the VM initialization.
   ASSERT(thread_pool_ == nullptr);
   thread_pool_ = new ThreadPool();
+  ASSERT(native_port_thread_pool_ == nullptr);
+  if (FLAG_native_port_thread_pool_size > 0) {
+    native_port_thread_pool_ =
+        new ThreadPool(FLAG_native_port_thread_pool_size);
+  }
   {
     ASSERT(vm_isolate_ == nullptr);
     ASSERT(Flags::Initialized());
@@ -486,6 +504,9 @@ char* Dart::DartInit(const Dart_InitializeParams* params) {
 #endif
   }
   NOT_IN_PRODUCT(Profiler::Init());
+#if !defined(PRODUCT) || defined(FORCE_INCLUDE_SAMPLING_HEAP_PROFILER)
+  HeapProfileSampler::Init();
+#endif
   // Allocate the "persistent" scoped handles for the predefined API
   // values (such as Dart_True, Dart_False and Dart_Null).
   Api::InitHandles();
@@ -696,12 +717,23 @@ char* Dart::Cleanup() {
   // before shutting down the thread pool.
   WaitForIsolateShutdown();
 
+#if !defined(DART_PRECOMPILED_RUNTIME)
+  if (FLAG_print_jit_tier_timings) {
+    JitTierTimings::Print();
+  }
+#endif  // !defined(DART_PRECOMPILED_RUNTIME)
+
   // Shutdown the thread pool. On return, all thread pool threads have exited.
   if (FLAG_trace_shutdown) {
     OS::PrintErr("[+%" Pd64 "ms] SHUTDOWN: Deleting thread pool\n",
                  UptimeMillis());
   }
   DartInitializationState::SetUnInitialized();
+  if (native_port_thread_pool_ != nullptr) {
+    native_port_thread_pool_->Shutdown();
+    delete native_port_thread_pool_;
+    native_port_thread_pool_ = nullptr;
+  }
   thread_pool_->Shutdown();
   delete thread_pool_;
   thread_pool_ = nullptr;
@@ -71,6 +71,12 @@ class Dart : public AllStatic {
     return vm_isolate_->group();
   }
   static ThreadPool* thread_pool() { return thread_pool_; }
+  // The pool that runs the message handlers of native ports. This is the
+  // shared [thread_pool] unless --native-port-thread-pool-size is set.
+  static ThreadPool* native_port_thread_pool() {
+    return native_port_thread_pool_ != nullptr ? native_port_thread_pool_
+                                               : thread_pool_;
+  }
 
   static int64_t UptimeMicros();
   static int64_t UptimeMillis() {
@@ -157,6 +163,7 @@ class Dart : public AllStatic {
   static Isolate* vm_isolate_;
   static int64_t start_time_micros_;
   static ThreadPool* thread_pool_;
+  static ThreadPool* native_port_thread_pool_;
   static DebugInfo* pprof_symbol_generator_;
   static ReadOnlyHandles* predefined_handles_;
   static Snapshot::Kind vm_snapshot_kind_;
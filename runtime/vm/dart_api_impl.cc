@@ -1203,6 +1203,39 @@ DART_EXPORT bool Dart_IsVMFlagSet(const char* flag_name) {
 DART_API_ISOLATE_GROUP_METRIC_LIST(ISOLATE_GROUP_METRIC_API)
 #undef ISOLATE_GROUP_METRIC_API
 
+DART_EXPORT bool Dart_IsolateGroupHistogramMetric(
+    Dart_IsolateGroup isolate_group,
+    const char* name,
+    Dart_HistogramMetric* histogram) {
+  if (isolate_group == nullptr) {
+    FATAL("%s expects argument 'isolate_group' to be non-null.", CURRENT_FUNC);
+  }
+  if (name == nullptr) {
+    FATAL("%s expects argument 'name' to be non-null.", CURRENT_FUNC);
+  }
+  if (histogram == nullptr) {
+    FATAL("%s expects argument 'histogram' to be non-null.", CURRENT_FUNC);
+  }
+  IsolateGroup* group = reinterpret_cast<IsolateGroup*>(isolate_group);
+  HistogramMetric* metric = nullptr;
+#define LOOKUP_HISTOGRAM(type, variable, metric_name, unit)                    \
+  if (strcmp(name, metric_name) == 0) {                                        \
+    metric = group->Get##variable##Metric();                                   \
+  }
+  ISOLATE_GROUP_HISTOGRAM_METRIC_LIST(LOOKUP_HISTOGRAM)
+#undef LOOKUP_HISTOGRAM
+  if (metric == nullptr) {
+    return false;
+  }
+  histogram->count = metric->count();
+  histogram->sum = metric->sum();
+  histogram->p50 = metric->Percentile(50);
+  histogram->p90 = metric->Percentile(90);
+  histogram->p99 = metric->Percentile(99);
+  histogram->max = metric->max();
+  return true;
+}
+
 #if !defined(PRODUCT)
 #define ISOLATE_METRIC_API(type, variable, name, unit)                         \
   DART_EXPORT int64_t Dart_Isolate##variable##Metric(Dart_Isolate isolate) {   \
@@ -1223,6 +1256,21 @@ ISOLATE_METRIC_LIST(ISOLATE_METRIC_API)
 #undef ISOLATE_METRIC_API
 #endif  // !defined(PRODUCT)
 
+DART_EXPORT void Dart_GetIsolateResourceUsage(
+    Dart_Isolate isolate,
+    Dart_IsolateResourceUsage* usage) {
+  if (isolate == nullptr) {
+    FATAL("%s expects argument 'isolate' to be non-null.", CURRENT_FUNC);
+  }
+  if (usage == nullptr) {
+    FATAL("%s expects argument 'usage' to be non-null.", CURRENT_FUNC);
+  }
+  Isolate* iso = reinterpret_cast<Isolate*>(isolate);
+  usage->cpu_time_micros = iso->cpu_time_micros();
+  usage->allocated_bytes = iso->allocated_bytes();
+  usage->gc_time_micros = iso->gc_time_micros();
+}
+
 // --- Isolates ---
 
 static Dart_Isolate CreateIsolate(IsolateGroup* group,
@@ -1979,6 +2027,28 @@ DART_EXPORT Dart_MessageNotifyCallback Dart_GetMessageNotifyCallback() {
   return isolate->message_notify_callback();
 }
 
+DART_EXPORT void Dart_SetIsolateSchedulingClass(
+    Dart_IsolateSchedulingClass scheduling_class) {
+  Isolate* isolate = Isolate::Current();
+  CHECK_ISOLATE(isolate);
+  MessageHandler::SchedulingClass handler_class = MessageHandler::kNormal;
+  switch (scheduling_class) {
+    case Dart_IsolateSchedulingClass_LatencySensitive:
+      handler_class = MessageHandler::kLatencySensitive;
+      break;
+    case Dart_IsolateSchedulingClass_Default:
+      handler_class = MessageHandler::kNormal;
+      break;
+    case Dart_IsolateSchedulingClass_Batch:
+      handler_class = MessageHandler::kBatch;
+      break;
+    default:
+      FATAL("%s: invalid scheduling class %d", CURRENT_FUNC,
+            static_cast<int>(scheduling_class));
+  }
+  isolate->message_handler()->set_scheduling_class(handler_class);
+}
+
 struct RunLoopData {
   Monitor* monitor;
   bool done;
@@ -4953,6 +5023,39 @@ DART_EXPORT Dart_Handle Dart_SetNativeInstanceField(Dart_Handle obj,
   return Api::Success();
 }
 
+DART_EXPORT Dart_Handle Dart_GetNativeInstanceFields(Dart_Handle obj,
+                                                     int num_fields,
+                                                     intptr_t* field_values) {
+  Thread* thread = Thread::Current();
+  CHECK_ISOLATE(thread->isolate());
+  TransitionNativeToVM transition(thread);
+  if (field_values == nullptr) {
+    RETURN_NULL_ERROR(field_values);
+  }
+  bool is_null = false;
+  intptr_t field_count = 0;
+  {
+    ReusableObjectHandleScope reused_obj_handle(thread);
+    const Instance& instance =
+        Api::UnwrapInstanceHandle(reused_obj_handle, obj);
+    if (!instance.IsNull()) {
+      field_count = instance.NumNativeFields();
+      if ((num_fields == field_count) && (num_fields > 0)) {
+        instance.GetNativeFields(num_fields, field_values);
+        return Api::Success();
+      }
+    } else {
+      is_null = true;
+    }
+  }
+  if (is_null) {
+    RETURN_TYPE_ERROR(thread->zone(), obj, Instance);
+  }
+  return Api::NewError(
+      "%s: expected %" Pd " 'num_fields' but was passed in %d.", CURRENT_FUNC,
+      field_count, num_fields);
+}
+
 DART_EXPORT void* Dart_GetNativeIsolateGroupData(Dart_NativeArguments args) {
   NativeArguments* arguments = reinterpret_cast<NativeArguments*>(args);
   Isolate* isolate = arguments->thread()->isolate();
@@ -5836,6 +5939,10 @@ static Dart_Handle DeferredLoadComplete(intptr_t loading_unit_id,
     return Api::NewError("Unit already loaded");
   }
 
+#if defined(SUPPORT_TIMELINE)
+  T->isolate()->RecordDeferredLoadLatency(loading_unit_id);
+#endif  // defined(SUPPORT_TIMELINE)
+
   if (error) {
     CHECK_NULL(error_message);
     return Api::NewHandle(
@@ -5845,6 +5952,10 @@ static Dart_Handle DeferredLoadComplete(intptr_t loading_unit_id,
 #if defined(SUPPORT_TIMELINE)
     TimelineBeginEndScope tbes(T, Timeline::GetIsolateStream(),
                                "ReadUnitSnapshot");
+    if (tbes.enabled()) {
+      tbes.SetNumArguments(1);
+      tbes.FormatArgument(0, "loadingUnit", "%" Pd, loading_unit_id);
+    }
 #endif  // defined(SUPPORT_TIMELINE)
     const Snapshot* snapshot = Snapshot::SetupFromBuffer(snapshot_data);
     if (snapshot == nullptr) {
@@ -5884,6 +5995,29 @@ Dart_DeferredLoadCompleteError(intptr_t loading_unit_id,
                               error_message, transient);
 }
 
+DART_EXPORT Dart_Handle Dart_DeferredLoadPrefetch(intptr_t loading_unit_id) {
+  DARTSCOPE(Thread::Current());
+  API_TIMELINE_DURATION(T);
+  auto IG = T->isolate_group();
+  CHECK_CALLBACK_STATE(T);
+
+  if (!T->isolate()->HasDeferredLoadHandler()) {
+    return Api::NewError("%s: No deferred load handler is set", CURRENT_FUNC);
+  }
+  const Array& loading_units =
+      Array::Handle(Z, IG->object_store()->loading_units());
+  if (loading_units.IsNull() || (loading_unit_id < LoadingUnit::kRootId) ||
+      (loading_unit_id >= loading_units.Length())) {
+    return Api::NewError("Invalid loading unit");
+  }
+  LoadingUnit& unit = LoadingUnit::Handle(Z);
+  unit ^= loading_units.At(loading_unit_id);
+  if (unit.loaded() || unit.load_outstanding()) {
+    return Api::Success();
+  }
+  return Api::NewHandle(T, unit.IssueLoad());
+}
+
 DART_EXPORT Dart_Handle
 Dart_SetNativeResolver(Dart_Handle library,
                        Dart_NativeEntryResolver resolver,
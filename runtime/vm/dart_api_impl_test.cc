@@ -4764,6 +4764,30 @@ VM_UNIT_TEST_CASE(DartAPI_LocalZoneMemory) {
   Dart_ShutdownIsolate();
 }
 
+VM_UNIT_TEST_CASE(DartAPI_ReuseNestedScopes) {
+  TestCase::CreateTestIsolate();
+  Thread* thread = Thread::Current();
+  ApiLocalScope* scope = thread->api_top_scope();
+  Dart_EnterScope();
+  ApiLocalScope* outer = thread->api_top_scope();
+  Dart_EnterScope();
+  ApiLocalScope* inner = thread->api_top_scope();
+  Dart_ScopeAllocate(16);
+  Dart_ExitScope();
+  Dart_ExitScope();
+  EXPECT(scope == thread->api_top_scope());
+
+  // Both exited scopes are reused when the scopes are entered again.
+  Dart_EnterScope();
+  EXPECT(outer == thread->api_top_scope());
+  Dart_EnterScope();
+  EXPECT(inner == thread->api_top_scope());
+  EXPECT_EQ(0, thread->ZoneSizeInBytes());
+  Dart_ExitScope();
+  Dart_ExitScope();
+  Dart_ShutdownIsolate();
+}
+
 VM_UNIT_TEST_CASE(DartAPI_Isolates) {
   // This test currently assumes that the Dart_Isolate type is an opaque
   // representation of Isolate*.
@@ -5713,8 +5737,12 @@ static void TestNativeFields(Dart_Handle retobj) {
   const int kNativeFld4 = 4;
   int field_count = 0;
   intptr_t field_value = 0;
+  intptr_t field_values[] = {-1, -1, -1, -1};
   EXPECT_VALID(Dart_GetNativeInstanceFieldCount(retobj, &field_count));
   EXPECT_EQ(4, field_count);
+  EXPECT_VALID(Dart_GetNativeInstanceFields(retobj, 4, field_values));
+  EXPECT_EQ(0, field_values[0]);
+  EXPECT_EQ(0, field_values[3]);
   result = Dart_GetNativeInstanceField(retobj, kNativeFld4, &field_value);
   EXPECT(Dart_IsError(result));
   result = Dart_GetNativeInstanceField(retobj, kNativeFld0, &field_value);
@@ -5742,6 +5770,14 @@ static void TestNativeFields(Dart_Handle retobj) {
   result = Dart_GetNativeInstanceField(retobj, kNativeFld3, &field_value);
   EXPECT_VALID(result);
   EXPECT_EQ(4000, field_value);
+  result = Dart_GetNativeInstanceFields(retobj, 3, field_values);
+  EXPECT(Dart_IsError(result));
+  result = Dart_GetNativeInstanceFields(retobj, 4, field_values);
+  EXPECT_VALID(result);
+  EXPECT_EQ(4, field_values[0]);
+  EXPECT_EQ(40, field_values[1]);
+  EXPECT_EQ(400, field_values[2]);
+  EXPECT_EQ(4000, field_values[3]);
 
   // Now re-access various dart instance fields of the returned object
   // to ensure that there was no corruption while setting native fields.
@@ -10577,4 +10613,22 @@ TEST_CASE(DartAPI_WriteHeapSnapshot) {
 }
 #endif  // defined(DART_ENABLE_HEAP_SNAPSHOT_WRITER)
 
+static Dart_Handle NoopDeferredLoadHandler(intptr_t loading_unit_id) {
+  return Dart_Null();
+}
+
+TEST_CASE(DartAPI_DeferredLoadPrefetch) {
+  Dart_Handle result = Dart_DeferredLoadPrefetch(2);
+  EXPECT_ERROR(result, "No deferred load handler is set");
+
+  result = Dart_SetDeferredLoadHandler(NoopDeferredLoadHandler);
+  EXPECT_VALID(result);
+  // The program is not split into loading units.
+  result = Dart_DeferredLoadPrefetch(2);
+  EXPECT_ERROR(result, "Invalid loading unit");
+
+  result = Dart_SetDeferredLoadHandler(nullptr);
+  EXPECT_VALID(result);
+}
+
 }  // namespace dart
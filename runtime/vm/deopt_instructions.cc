@@ -11,6 +11,7 @@
 #include "vm/compiler/assembler/disassembler.h"
 #include "vm/compiler/backend/il.h"
 #include "vm/compiler/backend/locations.h"
+#include "vm/compiler/compiler_timings.h"
 #include "vm/compiler/jit/compiler.h"
 #include "vm/parser.h"
 #include "vm/stack_frame.h"
@@ -23,6 +24,7 @@ DEFINE_FLAG(bool,
             compress_deopt_info,
             true,
             "Compress the size of the deoptimization info for optimized code.");
+DECLARE_FLAG(bool, collect_jit_function_statistics);
 DECLARE_FLAG(bool, trace_deoptimization);
 DECLARE_FLAG(bool, trace_deoptimization_verbose);
 
@@ -115,6 +117,11 @@ DeoptContext::DeoptContext(const StackFrame* frame,
     // kDestIsAllocated is used by the debugger to generate a stack trace
     // and does not signal a real deopt.
     deopt_start_micros_ = OS::GetCurrentMonotonicMicros();
+    if (FLAG_collect_jit_function_statistics) {
+      thread_->isolate_group()
+          ->jit_function_statistics()
+          ->RecordDeoptimization(function, deopt_reason());
+    }
   }
 
   if (FLAG_trace_deoptimization || FLAG_trace_deoptimization_verbose) {
@@ -5,9 +5,11 @@
 #include "vm/elf.h"
 
 #include "platform/elf.h"
+#include "platform/lz4.h"
 #include "platform/unwinding_records.h"
 #include "vm/cpu.h"
 #include "vm/dwarf.h"
+#include "vm/flags.h"
 #include "vm/hash_map.h"
 #include "vm/image_snapshot.h"
 #include "vm/stack_frame.h"
@@ -19,6 +21,12 @@ namespace dart {
 
 #if defined(DART_PRECOMPILER)
 
+DEFINE_FLAG(bool,
+            compress_elf_rodata,
+            false,
+            "Compress the .rodata section of ELF snapshots. Such snapshots "
+            "can only be loaded by the Dart ELF loader, not by dlopen.");
+
 // A wrapper around BaseWriteStream that provides methods useful for
 // writing ELF files (e.g., using ELF definitions of data sizes).
 class ElfWriteStream : public ValueObject {
@@ -893,6 +901,12 @@ class BitsContainer : public Section {
 
   void Write(ElfWriteStream* stream) const {
     if (type == elf::SectionHeaderType::SHT_NOBITS) return;
+    WriteContents(stream);
+  }
+
+  // Writes the contents of the section, even if it has no contents in the
+  // file.
+  void WriteContents(ElfWriteStream* stream) const {
     intptr_t start_position = stream->Position();  // Used for checks.
     for (const auto& portion : portions_) {
       stream->Align(alignment);
@@ -944,6 +958,16 @@ class ConcatenableBitsContainer : public BitsContainer {
                             intptr_t alignment)
       : BitsContainer(type, executable, writable, alignment) {}
 
+  ConcatenableBitsContainer(elf::SectionHeaderType type,
+                            bool executable,
+                            bool writable,
+                            intptr_t alignment)
+      : BitsContainer(type,
+                      /*allocate=*/true,
+                      executable,
+                      writable,
+                      alignment) {}
+
   virtual bool CanMergeWith(const Section& other) const = 0;
   virtual void Merge(const Section& other) {
     ASSERT(other.IsBitsContainer());
@@ -972,17 +996,31 @@ class TextSection : public ConcatenableBitsContainer {
 
 class DataSection : public ConcatenableBitsContainer {
  public:
-  explicit DataSection(Elf::Type t)
-      : ConcatenableBitsContainer(t,
-                                  /*executable=*/false,
-                                  /*writable=*/false,
-                                  ImageWriter::kRODataAlignment) {}
+  // Compressed data sections have no file contents, as these are instead
+  // written compressed to a separate unallocated section (see
+  // Elf::CompressROData). They are page aligned so that the loader can fill
+  // them in without touching the pages mapped from the file.
+  DataSection(Elf::Type t, bool compressed)
+      : ConcatenableBitsContainer(
+            (compressed || t != Elf::Type::Snapshot)
+                ? elf::SectionHeaderType::SHT_NOBITS
+                : elf::SectionHeaderType::SHT_PROGBITS,
+            /*executable=*/false,
+            /*writable=*/false,
+            compressed ? Elf::kPageSize : ImageWriter::kRODataAlignment),
+        compressed_(compressed) {}
 
   DEFINE_TYPE_CHECK_FOR(DataSection);
 
+  bool IsCompressed() const { return compressed_; }
+
   virtual bool CanMergeWith(const Section& other) const {
-    return other.IsDataSection();
+    return other.IsDataSection() &&
+           other.AsDataSection()->IsCompressed() == compressed_;
   }
+
+ private:
+  const bool compressed_;
 };
 
 class BssSection : public ConcatenableBitsContainer {
@@ -1232,7 +1270,8 @@ void Elf::AddROData(const char* name,
                     intptr_t size,
                     const ZoneGrowableArray<Relocation>* relocations,
                     const ZoneGrowableArray<SymbolData>* symbols) {
-  auto* const container = new (zone_) DataSection(type_);
+  auto* const container =
+      new (zone_) DataSection(type_, FLAG_compress_elf_rodata);
   container->AddPortion(bytes, size, relocations, symbols, name, label);
   section_table_->Add(container, kDataName);
 }
@@ -1660,12 +1699,23 @@ ProgramTable* SectionTable::CreateProgramTable(SymbolTable* symtab) {
     add_to_reordered_sections(build_id);
   }
 
+  // Compressed data sections have no file contents in snapshots, so they must
+  // come after the other sections in the segment. They are also put last in
+  // separate debugging information, so the memory offsets of all sections
+  // match those in the snapshot.
+  auto is_compressed_data = [](Section* section) -> bool {
+    return section->IsDataSection() &&
+           section->AsDataSection()->IsCompressed();
+  };
+
   // Now add the other non-writable, non-executable allocated sections.
   add_sections_matching([&](Section* section) -> bool {
     if (section == build_id) return false;  // Already added.
+    if (is_compressed_data(section)) return false;
     return section->IsAllocated() && !section->IsWritable() &&
            !section->IsExecutable();
   });
+  add_sections_matching(is_compressed_data);
 
   // Now add the executable sections in a new segment.
   add_sections_matching([](Section* section) -> bool {
@@ -1744,6 +1794,19 @@ void Elf::Finalize() {
   FinalizeEhFrame();
   FinalizeDwarfSections();
 
+  if (type_ == Type::Snapshot) {
+    auto* const data_section = section_table_->Find(kDataName);
+    if (data_section != nullptr &&
+        data_section->AsDataSection()->IsCompressed()) {
+      // The contents are added by CompressROData once the relocations in the
+      // data section can be resolved.
+      auto* const compressed = new (zone_) BitsContainer(
+          elf::SectionHeaderType::SHT_PROGBITS, compiler::target::kWordSize);
+      compressed->link = data_section->index;
+      section_table_->Add(compressed, kCompressedDataName);
+    }
+  }
+
   // Create and initialize the dynamic and static symbol tables and any
   // other associated sections now that all other sections have been added.
   InitializeSymbolTables();
@@ -1914,16 +1977,6 @@ void Elf::ComputeOffsets() {
   }
 
   const auto& sections = section_table_->sections();
-  for (; section_index < sections.length(); section_index++) {
-    auto* const section = sections[section_index];
-    ASSERT(!section->IsAllocated());
-    calculate_section_offsets(section);
-  }
-
-  ASSERT_EQUAL(section_index, sections.length());
-  // Now that all sections have been handled, set the file offset for the
-  // section table, as it will be written after the last section.
-  calculate_section_offsets(section_table_);
 
 #if defined(DEBUG)
   // Double check that segment starts are aligned as expected.
@@ -1948,6 +2001,74 @@ void Elf::ComputeOffsets() {
     ASSERT_EQUAL(symtab_->index, elf::SHN_UNDEF);
     symtab_->Finalize(address_map);
   }
+
+  // Relocations can now be resolved, so compressed contents can be computed
+  // before the offsets of unallocated sections are needed.
+  CompressROData();
+
+  for (; section_index < sections.length(); section_index++) {
+    auto* const section = sections[section_index];
+    ASSERT(!section->IsAllocated());
+    calculate_section_offsets(section);
+  }
+
+  ASSERT_EQUAL(section_index, sections.length());
+  // Now that all sections have been handled, set the file offset for the
+  // section table, as it will be written after the last section.
+  calculate_section_offsets(section_table_);
+}
+
+void Elf::CompressROData() {
+  auto* const section = section_table_->Find(kCompressedDataName);
+  if (section == nullptr) return;
+  auto* const compressed = section->AsBitsContainer();
+  auto* const data = section_table_->Find(kDataName)->AsBitsContainer();
+  ASSERT_EQUAL(compressed->link, data->index);
+  ASSERT(data->HasBytes());
+
+  // Write the contents with resolved relocations, as they would be written
+  // to an uncompressed snapshot.
+  ZoneWriteStream contents(zone_, data->MemorySize());
+  {
+    ElfWriteStream wrapped(&contents, *this);
+    data->WriteContents(&wrapped);
+  }
+  const intptr_t size = contents.bytes_written();
+  ASSERT_EQUAL(size, data->MemorySize());
+
+  // Compress the contents in frames, so that frames can be decompressed
+  // independently.
+  const intptr_t num_frames =
+      Utils::RoundUp(size, kCompressedFrameSize) / kCompressedFrameSize;
+  ZoneWriteStream frames(zone_, Lz4::MaxCompressedSize(size));
+  GrowableArray<uint32_t> frame_offsets(zone_, num_frames + 1);
+  uint8_t* const buffer =
+      zone_->Alloc<uint8_t>(Lz4::MaxCompressedSize(kCompressedFrameSize));
+  for (intptr_t start = 0; start < size; start += kCompressedFrameSize) {
+    frame_offsets.Add(frames.bytes_written());
+    const intptr_t frame_size =
+        Utils::Minimum(kCompressedFrameSize, size - start);
+    const intptr_t compressed_size =
+        Lz4::Compress(contents.buffer() + start, frame_size, buffer);
+    frames.WriteBytes(buffer, compressed_size);
+  }
+  frame_offsets.Add(frames.bytes_written());
+  ASSERT_EQUAL(frame_offsets.length(), num_frames + 1);
+
+  ZoneWriteStream stream(zone_, sizeof(elf::CompressedSectionHeader) +
+                                    frame_offsets.length() * sizeof(uint32_t) +
+                                    frames.bytes_written());
+  stream.WriteFixed<decltype(elf::CompressedSectionHeader::size)>(size);
+  stream.WriteFixed<decltype(elf::CompressedSectionHeader::frame_size)>(
+      kCompressedFrameSize);
+  stream.WriteFixed<decltype(elf::CompressedSectionHeader::num_frames)>(
+      num_frames);
+  ASSERT_EQUAL(stream.Position(), sizeof(elf::CompressedSectionHeader));
+  for (const uint32_t offset : frame_offsets) {
+    stream.WriteFixed(offset);
+  }
+  stream.WriteBytes(frames.buffer(), frames.bytes_written());
+  compressed->AddPortion(stream.buffer(), stream.bytes_written());
 }
 
 void ElfHeader::Write(ElfWriteStream* stream) const {
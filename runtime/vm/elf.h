@@ -149,6 +149,10 @@ class Elf : public ZoneAllocated {
   static constexpr const char kDataName[] = ".rodata";
   static constexpr const char kBssName[] = ".bss";
   static constexpr const char kDynamicTableName[] = ".dynamic";
+  // Must start with elf::kCompressedSectionPrefix.
+  static constexpr const char kCompressedDataName[] = ".lz4.rodata";
+  // The size of the independently compressed frames of compressed sections.
+  static constexpr intptr_t kCompressedFrameSize = 64 * KB;
 
   void CreateBSS();
   void GenerateBuildId();
@@ -156,6 +160,7 @@ class Elf : public ZoneAllocated {
   void FinalizeDwarfSections();
   void FinalizeEhFrame();
   void ComputeOffsets();
+  void CompressROData();
 
   Zone* const zone_;
   BaseWriteStream* const unwrapped_stream_;
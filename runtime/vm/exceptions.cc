@@ -704,16 +704,16 @@ static FieldPtr LookupStackTraceField(const Instance& instance) {
   }
   Thread* thread = Thread::Current();
   Zone* zone = thread->zone();
-  auto isolate_group = thread->isolate_group();
-  const auto& error_class =
-      Class::Handle(zone, isolate_group->object_store()->error_class());
+  ObjectStore* object_store = thread->isolate_group()->object_store();
+  const auto& error_class = Class::Handle(zone, object_store->error_class());
   // If instance class extends 'class Error' return '_stackTrace' field.
   Class& test_class = Class::Handle(zone, instance.clazz());
   AbstractType& type = AbstractType::Handle(zone, AbstractType::null());
   while (true) {
     if (test_class.ptr() == error_class.ptr()) {
-      return error_class.LookupInstanceFieldAllowPrivate(
-          Symbols::_stackTrace());
+      // Cached in the object store, as looking the field up by name is
+      // relatively expensive and happens on every throw of an Error.
+      return object_store->error_stack_trace_field();
     }
     type = test_class.super_type();
     if (type.IsNull()) return Field::null();
@@ -55,6 +55,11 @@ void FfiCallbackMetadata::EnsureStubPageLocked() {
 }
 
 FfiCallbackMetadata::~FfiCallbackMetadata() {
+  // The persistent handles died with their isolate groups.
+  for (intptr_t i = 0; i < pending_async_callbacks_.length(); ++i) {
+    delete pending_async_callbacks_[i].args;
+  }
+
   // Unmap all the trampoline pages. 'VirtualMemory's are new-allocated.
   delete stub_page_;
   for (intptr_t i = 0; i < trampoline_pages_.length(); ++i) {
@@ -216,9 +221,60 @@ void FfiCallbackMetadata::DeleteCallbackLocked(Metadata* entry) {
     ASSERT(api_state != nullptr);
     api_state->FreePersistentHandle(entry->closure_handle());
   }
+  if (entry->trampoline_type_ == TrampolineType::kAsync) {
+    ASSERT(entry->target_isolate_ != nullptr);
+    FreePendingAsyncCallbacks(entry->send_port(),
+                              entry->target_isolate_->group()->api_state());
+  }
   AddToFreeListLocked(entry);
 }
 
+bool FfiCallbackMetadata::AddPendingAsyncCallback(Dart_Port send_port,
+                                                  PersistentHandle* args) {
+  MutexLocker locker(&pending_lock_);
+  for (intptr_t i = 0; i < pending_async_callbacks_.length(); ++i) {
+    if (pending_async_callbacks_[i].send_port == send_port) {
+      pending_async_callbacks_[i].args->Add(args);
+      return false;
+    }
+  }
+  auto* pending = new MallocGrowableArray<PersistentHandle*>();
+  pending->Add(args);
+  pending_async_callbacks_.Add({send_port, pending});
+  return true;
+}
+
+void FfiCallbackMetadata::TakePendingAsyncCallbacks(
+    Dart_Port send_port,
+    MallocGrowableArray<PersistentHandle*>* args) {
+  MallocGrowableArray<PersistentHandle*>* pending = nullptr;
+  {
+    MutexLocker locker(&pending_lock_);
+    for (intptr_t i = 0; i < pending_async_callbacks_.length(); ++i) {
+      if (pending_async_callbacks_[i].send_port == send_port) {
+        pending = pending_async_callbacks_[i].args;
+        pending_async_callbacks_.RemoveAt(i);
+        break;
+      }
+    }
+  }
+  if (pending == nullptr) return;
+  for (intptr_t i = 0; i < pending->length(); ++i) {
+    args->Add(pending->At(i));
+  }
+  delete pending;
+}
+
+void FfiCallbackMetadata::FreePendingAsyncCallbacks(Dart_Port send_port,
+                                                    ApiState* api_state) {
+  ASSERT(lock_.IsOwnedByCurrentThread());
+  MallocGrowableArray<PersistentHandle*> pending;
+  TakePendingAsyncCallbacks(send_port, &pending);
+  for (intptr_t i = 0; i < pending.length(); ++i) {
+    api_state->FreePersistentHandle(pending[i]);
+  }
+}
+
 void FfiCallbackMetadata::DeleteAllCallbacks(Metadata** list_head) {
   MutexLocker locker(&lock_);
   for (Metadata* entry = *list_head; entry != nullptr;) {
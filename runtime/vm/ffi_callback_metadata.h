@@ -12,6 +12,7 @@
 
 namespace dart {
 
+class ApiState;
 class PersistentHandle;
 
 // Stores metadata related to FFI callbacks (Dart functions that are assigned a
@@ -76,6 +77,21 @@ class FfiCallbackMetadata {
   // Deletes all the trampolines in the list.
   void DeleteAllCallbacks(Metadata** list_head);
 
+  // With --coalesce-ffi-listener-callbacks, invocations of an async callback
+  // are queued here instead of being sent as one message each. Only the first
+  // invocation queued for a port posts a message. The receiving isolate then
+  // takes all invocations queued so far and runs them in a loop.
+  //
+  // Queues the arguments of an invocation for |send_port|. Returns true if
+  // nothing was queued for the port yet, in which case the caller must post a
+  // message to the port.
+  bool AddPendingAsyncCallback(Dart_Port send_port, PersistentHandle* args);
+
+  // Moves the invocations queued for |send_port| into |args|, oldest first.
+  // The caller owns the persistent handles.
+  void TakePendingAsyncCallbacks(Dart_Port send_port,
+                                 MallocGrowableArray<PersistentHandle*>* args);
+
   // FFI callback metadata for any sync or async trampoline.
   class Metadata {
     Isolate* target_isolate_;
@@ -302,9 +318,21 @@ class FfiCallbackMetadata {
   static PersistentHandle* CreatePersistentHandle(Isolate* isolate,
                                                   const Closure& closure);
 
+  struct PendingAsyncCallbacks {
+    Dart_Port send_port;
+    MallocGrowableArray<PersistentHandle*>* args;
+  };
+
+  void FreePendingAsyncCallbacks(Dart_Port send_port, ApiState* api_state);
+
   static FfiCallbackMetadata* singleton_;
 
   mutable Mutex lock_;
+  // Guards pending_async_callbacks_. Acquired after lock_, if both are held.
+  Mutex pending_lock_;
+  // Ports with queued invocations. Usually only a few ports have invocations
+  // queued at any time, so a list is used.
+  MallocGrowableArray<PendingAsyncCallbacks> pending_async_callbacks_;
   VirtualMemory* stub_page_ = nullptr;
   MallocGrowableArray<VirtualMemory*> trampoline_pages_;
   uword offset_of_first_trampoline_in_page_ = 0;
@@ -263,6 +263,47 @@ VM_UNIT_TEST_CASE(FfiCallbackMetadata_CreateAsyncFfiCallback) {
   }
 }
 
+ISOLATE_UNIT_TEST_CASE(FfiCallbackMetadata_PendingAsyncCallbacks) {
+  auto* fcm = FfiCallbackMetadata::Instance();
+  auto* api_state = thread->isolate_group()->api_state();
+  const Dart_Port port1 = 0x1234;
+  const Dart_Port port2 = 0x5678;
+
+  PersistentHandle* handles[3];
+  for (intptr_t i = 0; i < 3; ++i) {
+    handles[i] = api_state->AllocatePersistentHandle();
+    handles[i]->set_ptr(Smi::New(i));
+  }
+
+  // Only the first invocation queued for a port needs a message.
+  EXPECT(fcm->AddPendingAsyncCallback(port1, handles[0]));
+  EXPECT(fcm->AddPendingAsyncCallback(port2, handles[1]));
+  EXPECT(!fcm->AddPendingAsyncCallback(port1, handles[2]));
+
+  MallocGrowableArray<PersistentHandle*> pending;
+  fcm->TakePendingAsyncCallbacks(port1, &pending);
+  EXPECT_EQ(2, pending.length());
+  EXPECT_EQ(handles[0], pending[0]);
+  EXPECT_EQ(handles[2], pending[1]);
+
+  // Taking the invocations resets the port.
+  pending.Clear();
+  fcm->TakePendingAsyncCallbacks(port1, &pending);
+  EXPECT_EQ(0, pending.length());
+  EXPECT(fcm->AddPendingAsyncCallback(port1, handles[0]));
+
+  pending.Clear();
+  fcm->TakePendingAsyncCallbacks(port1, &pending);
+  fcm->TakePendingAsyncCallbacks(port2, &pending);
+  EXPECT_EQ(2, pending.length());
+  EXPECT_EQ(handles[0], pending[0]);
+  EXPECT_EQ(handles[1], pending[1]);
+
+  for (intptr_t i = 0; i < 3; ++i) {
+    api_state->FreePersistentHandle(handles[i]);
+  }
+}
+
 VM_UNIT_TEST_CASE(FfiCallbackMetadata_CreateIsolateLocalFfiCallback) {
   auto* fcm = FfiCallbackMetadata::Instance();
   FfiCallbackMetadata::Trampoline tramp1 = 0;
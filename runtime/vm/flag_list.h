@@ -86,6 +86,9 @@ constexpr bool FLAG_support_il_printer = false;
     "Add static symbols for objects in snapshot read-only data")               \
   P(background_compilation, bool, true,                                        \
     "Run optimizing compilation in background")                                \
+  P(background_compilation_threads, int, 1,                                    \
+    "The maximum number of threads running background compilation in each "    \
+    "isolate group.")                                                          \
   P(check_token_positions, bool, false,                                        \
     "Check validity of token positions while compiling flow graphs")           \
   P(collect_dynamic_function_names, bool, true,                                \
@@ -134,6 +137,8 @@ constexpr bool FLAG_support_il_printer = false;
   P(marker_tasks, int, 2,                                                      \
     "The number of tasks to spawn during old gen GC marking (0 means "         \
     "perform all marking on main thread).")                                    \
+  P(sweeper_tasks, int, 2,                                                     \
+    "The number of tasks to spawn during concurrent old gen sweeping.")        \
   P(hash_map_probes_limit, int, kMaxInt32,                                     \
     "Limit number of probes while doing lookups in hash maps.")                \
   P(max_polymorphic_checks, int, 4,                                            \
@@ -180,6 +180,10 @@ static constexpr uword kZapUninitializedWord = 0xabababababababab;
 #endif
 static constexpr intptr_t kAllocationCanary = 123;
 
+// Assumed size of a cache line, used to keep data written by different threads
+// from sharing a line.
+static constexpr intptr_t kCacheLineSize = 64;
+
 // Macros to get the contents of the fp register.
 #if defined(DART_HOST_OS_WINDOWS)
 
@@ -0,0 +1,88 @@
+// Copyright (c) 2024, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+#include "vm/hardware_counters.h"
+
+#if defined(DART_HOST_OS_LINUX) || defined(DART_HOST_OS_ANDROID)
+#include <linux/perf_event.h>  // NOLINT
+#include <sys/syscall.h>       // NOLINT
+#include <unistd.h>            // NOLINT
+#endif
+
+#include "platform/utils.h"
+
+namespace dart {
+
+#if defined(DART_HOST_OS_LINUX) || defined(DART_HOST_OS_ANDROID)
+
+static int OpenCounter(uint64_t config, int group_fd) {
+  struct perf_event_attr attr;
+  memset(&attr, 0, sizeof(attr));
+  attr.type = PERF_TYPE_HARDWARE;
+  attr.size = sizeof(attr);
+  attr.config = config;
+  attr.read_format = PERF_FORMAT_GROUP;
+  attr.exclude_kernel = 1;
+  attr.exclude_hv = 1;
+  // Count the calling thread on whichever CPU it runs.
+  return static_cast<int>(syscall(__NR_perf_event_open, &attr, /*pid=*/0,
+                                  /*cpu=*/-1, group_fd, PERF_FLAG_FD_CLOEXEC));
+}
+
+HardwareCounters::HardwareCounters() {
+  group_fd_ = OpenCounter(PERF_COUNT_HW_CPU_CYCLES, -1);
+  if (group_fd_ == -1) {
+    return;
+  }
+  instructions_fd_ = OpenCounter(PERF_COUNT_HW_INSTRUCTIONS, group_fd_);
+  cache_misses_fd_ = OpenCounter(PERF_COUNT_HW_CACHE_MISSES, group_fd_);
+  if ((instructions_fd_ == -1) || (cache_misses_fd_ == -1)) {
+    // Some virtualized environments only expose a subset of the events. Only
+    // report complete groups.
+    if (instructions_fd_ != -1) close(instructions_fd_);
+    if (cache_misses_fd_ != -1) close(cache_misses_fd_);
+    close(group_fd_);
+    group_fd_ = instructions_fd_ = cache_misses_fd_ = -1;
+  }
+}
+
+HardwareCounters::~HardwareCounters() {
+  if (group_fd_ == -1) {
+    return;
+  }
+  close(cache_misses_fd_);
+  close(instructions_fd_);
+  close(group_fd_);
+}
+
+bool HardwareCounters::Read(Values* values) const {
+  if (group_fd_ == -1) {
+    return false;
+  }
+  // With PERF_FORMAT_GROUP a read of the leader returns the number of events
+  // followed by their values, in the order they were opened.
+  uint64_t buffer[4];
+  const ssize_t result = read(group_fd_, buffer, sizeof(buffer));
+  if ((result != sizeof(buffer)) || (buffer[0] != 3)) {
+    return false;
+  }
+  values->cycles = static_cast<int64_t>(buffer[1]);
+  values->instructions = static_cast<int64_t>(buffer[2]);
+  values->cache_misses = static_cast<int64_t>(buffer[3]);
+  return true;
+}
+
+#else
+
+HardwareCounters::HardwareCounters() {}
+
+HardwareCounters::~HardwareCounters() {}
+
+bool HardwareCounters::Read(Values* values) const {
+  return false;
+}
+
+#endif  // defined(DART_HOST_OS_LINUX) || defined(DART_HOST_OS_ANDROID)
+
+}  // namespace dart
@@ -0,0 +1,47 @@
+// Copyright (c) 2024, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+#ifndef RUNTIME_VM_HARDWARE_COUNTERS_H_
+#define RUNTIME_VM_HARDWARE_COUNTERS_H_
+
+#include "vm/allocation.h"
+#include "vm/globals.h"
+
+namespace dart {
+
+// Hardware performance counters of a single thread: CPU cycles, retired
+// instructions and last level cache misses.
+//
+// Backed by perf_event_open on Linux and Android. Elsewhere, or when the
+// kernel does not grant access (see /proc/sys/kernel/perf_event_paranoid),
+// the counters are unavailable and Read always fails.
+class HardwareCounters : public MallocAllocated {
+ public:
+  struct Values {
+    int64_t cycles = 0;
+    int64_t instructions = 0;
+    int64_t cache_misses = 0;
+  };
+
+  // Opens the counters for the calling thread.
+  HardwareCounters();
+  ~HardwareCounters();
+
+  bool available() const { return group_fd_ != -1; }
+
+  // Returns false if the counters are unavailable. Must be called on the
+  // thread the counters were opened on.
+  bool Read(Values* values) const;
+
+ private:
+  int group_fd_ = -1;
+  int instructions_fd_ = -1;
+  int cache_misses_fd_ = -1;
+
+  DISALLOW_COPY_AND_ASSIGN(HardwareCounters);
+};
+
+}  // namespace dart
+
+#endif  // RUNTIME_VM_HARDWARE_COUNTERS_H_
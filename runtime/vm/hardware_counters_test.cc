@@ -0,0 +1,31 @@
+// Copyright (c) 2024, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+#include "vm/hardware_counters.h"
+#include "platform/assert.h"
+#include "vm/unit_test.h"
+
+namespace dart {
+
+VM_UNIT_TEST_CASE(HardwareCounters_Read) {
+  HardwareCounters counters;
+  HardwareCounters::Values before;
+  if (!counters.available()) {
+    // Not supported on this platform or not permitted by the kernel.
+    EXPECT(!counters.Read(&before));
+    return;
+  }
+  EXPECT(counters.Read(&before));
+  volatile intptr_t sum = 0;
+  for (intptr_t i = 0; i < 100000; i++) {
+    sum = sum + i;
+  }
+  HardwareCounters::Values after;
+  EXPECT(counters.Read(&after));
+  EXPECT(after.instructions > before.instructions);
+  EXPECT(after.cycles >= before.cycles);
+  EXPECT(after.cache_misses >= before.cache_misses);
+}
+
+}  // namespace dart
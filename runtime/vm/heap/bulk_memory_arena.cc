@@ -0,0 +1,69 @@
+// Copyright (c) 2024, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+#include "vm/heap/bulk_memory_arena.h"
+
+#include "platform/utils.h"
+#include "vm/virtual_memory.h"
+
+namespace dart {
+
+BulkMemoryArena::BulkMemoryArena() : regions_(4) {}
+
+BulkMemoryArena::~BulkMemoryArena() {
+  Release();
+}
+
+VirtualMemory* BulkMemoryArena::AllocateRegion(intptr_t size) {
+  size = Utils::RoundUp(size, VirtualMemory::PageSize());
+  VirtualMemory* memory =
+      VirtualMemory::Allocate(size, /*is_executable=*/false,
+                              /*is_compressed=*/false, "dart-bulk-memory");
+  if (memory == nullptr) {
+    return nullptr;
+  }
+  regions_.Add(memory);
+  reserved_bytes_ += memory->size();
+  return memory;
+}
+
+uint8_t* BulkMemoryArena::Allocate(intptr_t size) {
+  ASSERT(size >= 0);
+  if (size > kMaxInt32) {
+    return nullptr;
+  }
+  size = Utils::RoundUp(Utils::Maximum<intptr_t>(size, 1), kAlignment);
+  if (size > kLargeAllocationSize) {
+    VirtualMemory* memory = AllocateRegion(size);
+    if (memory == nullptr) {
+      return nullptr;
+    }
+    allocated_bytes_ += size;
+    return reinterpret_cast<uint8_t*>(memory->start());
+  }
+  if (size > static_cast<intptr_t>(end_ - top_)) {
+    VirtualMemory* memory = AllocateRegion(kRegionSize);
+    if (memory == nullptr) {
+      return nullptr;
+    }
+    top_ = memory->start();
+    end_ = memory->end();
+  }
+  uword result = top_;
+  top_ += size;
+  allocated_bytes_ += size;
+  return reinterpret_cast<uint8_t*>(result);
+}
+
+void BulkMemoryArena::Release() {
+  for (intptr_t i = 0; i < regions_.length(); i++) {
+    delete regions_[i];
+  }
+  regions_.Clear();
+  top_ = end_ = 0;
+  allocated_bytes_ = 0;
+  reserved_bytes_ = 0;
+}
+
+}  // namespace dart
@@ -0,0 +1,57 @@
+// Copyright (c) 2024, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+#ifndef RUNTIME_VM_HEAP_BULK_MEMORY_ARENA_H_
+#define RUNTIME_VM_HEAP_BULK_MEMORY_ARENA_H_
+
+#include "platform/globals.h"
+#include "vm/allocation.h"
+#include "vm/growable_array.h"
+#include "vm/globals.h"
+
+namespace dart {
+
+class VirtualMemory;
+
+// A region allocator for the backing stores of short-lived, large typed data.
+//
+// Memory is bump-allocated from regions that are mapped directly from the OS
+// and is neither traced nor accounted by the GC. All of it is returned to the
+// OS at once by Release, after which any typed data viewing it must no longer
+// be accessed.
+class BulkMemoryArena : public MallocAllocated {
+ public:
+  BulkMemoryArena();
+  ~BulkMemoryArena();
+
+  // Returns nullptr if the memory cannot be reserved.
+  uint8_t* Allocate(intptr_t size);
+
+  // Unmaps all regions. The arena may be reused afterwards.
+  void Release();
+
+  intptr_t allocated_bytes() const { return allocated_bytes_; }
+  intptr_t reserved_bytes() const { return reserved_bytes_; }
+
+  static constexpr intptr_t kRegionSize = 1 * MB;
+  // Requests larger than this get a region of their own, so that the tail of
+  // the current region is not wasted.
+  static constexpr intptr_t kLargeAllocationSize = kRegionSize / 4;
+  static constexpr intptr_t kAlignment = 16;
+
+ private:
+  VirtualMemory* AllocateRegion(intptr_t size);
+
+  MallocGrowableArray<VirtualMemory*> regions_;
+  uword top_ = 0;
+  uword end_ = 0;
+  intptr_t allocated_bytes_ = 0;
+  intptr_t reserved_bytes_ = 0;
+
+  DISALLOW_COPY_AND_ASSIGN(BulkMemoryArena);
+};
+
+}  // namespace dart
+
+#endif  // RUNTIME_VM_HEAP_BULK_MEMORY_ARENA_H_
@@ -0,0 +1,61 @@
+// Copyright (c) 2024, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+#ifndef RUNTIME_VM_HEAP_FREELIST_CACHE_H_
+#define RUNTIME_VM_HEAP_FREELIST_CACHE_H_
+
+#include "platform/assert.h"
+#include "platform/utils.h"
+#include "vm/allocation.h"
+#include "vm/globals.h"
+
+namespace dart {
+
+class FreeListElement;
+
+// A thread-local cache of old-space free-list elements, segregated by size
+// for the smallest object sizes. Each list is refilled in bulk by carving a
+// single chunk taken from the shared FreeList, so most small old-space
+// allocations do not take the FreeList's lock.
+//
+// Cached elements remain FreeListElements, so the heap stays iterable, but
+// they are accounted as used. PageSpace returns them to the FreeList before
+// each old-space GC and when the thread is suspended.
+class FreeListCache {
+ public:
+  static constexpr intptr_t kNumSizes = 8;
+  static constexpr intptr_t kMaxSize = kNumSizes * kObjectAlignment;
+
+  // Bytes taken from the FreeList by one refill.
+  static constexpr intptr_t kRefillSize = 2 * KB;
+
+  FreeListCache() {
+    for (intptr_t i = 0; i < kNumSizes; i++) {
+      lists_[i] = nullptr;
+    }
+  }
+
+  static bool IsCachedSize(intptr_t size) { return size <= kMaxSize; }
+
+  bool IsEmpty() const { return cached_bytes_ == 0; }
+
+ private:
+  static intptr_t IndexForSize(intptr_t size) {
+    ASSERT(size >= kObjectAlignment);
+    ASSERT(Utils::IsAligned(size, kObjectAlignment));
+    ASSERT(IsCachedSize(size));
+    return (size >> kObjectAlignmentLog2) - 1;
+  }
+
+  FreeListElement* lists_[kNumSizes];
+  intptr_t cached_bytes_ = 0;
+
+  friend class PageSpace;
+
+  DISALLOW_COPY_AND_ASSIGN(FreeListCache);
+};
+
+}  // namespace dart
+
+#endif  // RUNTIME_VM_HEAP_FREELIST_CACHE_H_
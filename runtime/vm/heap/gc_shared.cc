@@ -37,6 +37,18 @@ void GCLinkedLists::FlushInto(GCLinkedLists* to) {
 #undef FOREACH
 }
 
+void GCLinkedLists::DistributeInto(GCLinkedLists* const* to,
+                                   intptr_t count) {
+  ASSERT(count > 0);
+  // Consecutive elements were usually discovered together, so runs keep some
+  // locality for whoever processes them.
+  const intptr_t kRunLength = 64;
+#define FOREACH(type, var)                                                     \
+  var.DistributeInto(to, count, &GCLinkedLists::var, kRunLength);
+  GC_LINKED_LIST(FOREACH)
+#undef FOREACH
+}
+
 // clang-format on
 
 Heap::Space SpaceForExternal(FinalizerEntryPtr raw_entry) {
@@ -62,6 +62,24 @@ class GCLinkedList {
     Release();
   }
 
+  // Moves the elements into the 'list' member of each of 'to', in runs of
+  // 'run_length' consecutive elements.
+  template <typename Lists>
+  void DistributeInto(Lists* const* to,
+                      intptr_t count,
+                      GCLinkedList<Type, PtrType> Lists::*list,
+                      intptr_t run_length) {
+    intptr_t n = 0;
+    PtrType current = Release();
+    while (current != Type::null()) {
+      PtrType next = current->untag()->next_seen_by_gc();
+      current->untag()->next_seen_by_gc_ = Type::null();
+      (to[(n / run_length) % count]->*list).Enqueue(current);
+      n++;
+      current = next;
+    }
+  }
+
   PtrType Release() {
     PtrType return_value = head_;
     head_ = Type::null();
@@ -80,6 +98,10 @@ struct GCLinkedLists {
   void Release();
   bool IsEmpty();
   void FlushInto(GCLinkedLists* to);
+  // Moves the elements of every list into the corresponding lists of 'to',
+  // dealing them out in runs so each of the 'count' destinations gets a
+  // similar share.
+  void DistributeInto(GCLinkedLists* const* to, intptr_t count);
 
 #define FOREACH(type, var) GCLinkedList<type, type##Ptr> var;
   GC_LINKED_LIST(FOREACH)
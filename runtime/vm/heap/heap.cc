@@ -49,6 +49,7 @@ Heap::Heap(IsolateGroup* isolate_group,
       is_vm_isolate_(is_vm_isolate),
       new_space_(this, max_new_gen_semi_words),
       old_space_(this, max_old_gen_words),
+      pretenuring_(isolate_group),
       read_only_(false),
       assume_scavenge_will_fail_(false),
       gc_on_nth_allocation_(kNoForcedGarbageCollection) {
@@ -118,7 +119,10 @@ uword Heap::AllocateOld(Thread* thread, intptr_t size, bool is_exec) {
 
   if (!thread->force_growth()) {
     CollectForDebugging(thread);
-    uword addr = old_space_.TryAllocate(size, is_exec);
+    // Threads that bypass safepoints would keep their cache across a GC.
+    uword addr = (is_exec || thread->BypassSafepoints())
+                     ? old_space_.TryAllocate(size, is_exec)
+                     : old_space_.TryAllocateCached(thread, size);
     if (addr != 0) {
       return addr;
     }
@@ -384,6 +388,9 @@ void Heap::NotifyIdle(int64_t deadline) {
     // intergenerational garbage (make old-space GC free more memory).
     if (new_space_.ShouldPerformIdleScavenge(deadline)) {
       CollectNewSpaceGarbage(thread, GCType::kScavenge, GCReason::kIdle);
+    } else {
+      // Not worth a scavenge yet, but do part of the next one's root scan.
+      new_space_.PruneStoreBuffer(thread);
     }
 
     // Check if we want to collect old-space, in decreasing order of cost.
@@ -448,6 +455,16 @@ Dart_PerformanceMode Heap::SetMode(Dart_PerformanceMode new_mode) {
   return old_mode;
 }
 
+bool Heap::PruneStoreBuffer(Thread* thread) {
+  GcSafepointOperationScope safepoint_operation(thread);
+  if (!new_space_.PruneStoreBuffer(thread)) {
+    return false;
+  }
+  // Leave headroom, or the next few stores would overflow it again.
+  return isolate_group()->store_buffer()->Size() <=
+         (StoreBuffer::kMaxNonEmpty / 2);
+}
+
 void Heap::CollectNewSpaceGarbage(Thread* thread,
                                   GCType type,
                                   GCReason reason) {
@@ -1010,11 +1027,24 @@ void Heap::RecordBeforeGC(GCType type, GCReason reason) {
   stats_.before_.new_ = new_space_.GetCurrentUsage();
   stats_.before_.old_ = old_space_.GetCurrentUsage();
   stats_.before_.store_buffer_ = isolate_group_->store_buffer()->Size();
+  if (type == GCType::kScavenge && last_scavenge_micros_ != 0) {
+    const int64_t elapsed = stats_.before_.micros_ - last_scavenge_micros_;
+    const intptr_t allocated = stats_.before_.new_.used_in_words -
+                               last_scavenge_new_used_in_words_;
+    if (elapsed > 0 && allocated > 0) {
+      isolate_group_->GetAllocationRateMetric()->Add(
+          allocated * kWordSize * kMicrosecondsPerSecond / elapsed);
+    }
+  }
 }
 
 void Heap::RecordAfterGC(GCType type) {
   stats_.after_.micros_ = OS::GetCurrentMonotonicMicros();
   int64_t delta = stats_.after_.micros_ - stats_.before_.micros_;
+  // The isolate is not active during GC, but the mutator stays scheduled.
+  if (Isolate* isolate = Thread::Current()->scheduled_dart_mutator_isolate()) {
+    isolate->AddGCTime(delta);
+  }
   if (stats_.type_ == GCType::kScavenge) {
     new_space_.AddGCTime(delta);
     new_space_.IncrementCollections();
@@ -1025,6 +1055,14 @@ void Heap::RecordAfterGC(GCType type) {
   stats_.after_.new_ = new_space_.GetCurrentUsage();
   stats_.after_.old_ = old_space_.GetCurrentUsage();
   stats_.after_.store_buffer_ = isolate_group_->store_buffer()->Size();
+  if (stats_.type_ == GCType::kScavenge) {
+    isolate_group_->GetGCScavengePauseMetric()->Add(delta);
+    last_scavenge_micros_ = stats_.after_.micros_;
+    last_scavenge_new_used_in_words_ = stats_.after_.new_.used_in_words;
+  } else if (stats_.type_ != GCType::kStartConcurrentMark) {
+    isolate_group_->GetHeapOldLiveMetric()->set_value(
+        stats_.after_.old_.used_in_words * kWordSize);
+  }
 #ifndef PRODUCT
   // For now we'll emit the same GC events on all isolates.
   if (Service::gc_stream.enabled()) {
@@ -1135,6 +1173,17 @@ void Heap::PrintStatsToTimeline(TimelineEventScope* event, GCReason reason) {
                         RoundWordsToKB(stats_.before_.old_.external_in_words));
   event->FormatArgument(arguments + 12, "After.Old.External (kB)", "%" Pd "",
                         RoundWordsToKB(stats_.after_.old_.external_in_words));
+
+  if ((stats_.type_ == GCType::kScavenge) ||
+      (stats_.type_ == GCType::kEvacuate)) {
+    const ScavengeStats& scavenge = new_space_.LastStats();
+    arguments = event->GetNumArguments();
+    event->SetNumArguments(arguments + 2);
+    event->FormatArgument(arguments + 0, "Steals", "%" Pd "",
+                          scavenge.steals());
+    event->FormatArgument(arguments + 1, "Idle (us)", "%" Pd64 "",
+                          scavenge.idle_micros());
+  }
 #endif  // defined(SUPPORT_TIMELINE)
 }
 
@@ -16,6 +16,7 @@
 #include "vm/flags.h"
 #include "vm/globals.h"
 #include "vm/heap/pages.h"
+#include "vm/heap/pretenuring.h"
 #include "vm/heap/scavenger.h"
 #include "vm/heap/spaces.h"
 #include "vm/heap/weak_table.h"
@@ -61,6 +62,7 @@ class Heap {
 
   Scavenger* new_space() { return &new_space_; }
   PageSpace* old_space() { return &old_space_; }
+  Pretenuring* pretenuring() { return &pretenuring_; }
 
   uword Allocate(Thread* thread, intptr_t size, Space space) {
     ASSERT(!read_only_);
@@ -113,6 +115,11 @@ class Heap {
   void CollectAllGarbage(GCReason reason = GCReason::kFull,
                          bool compact = false);
 
+  // Drops store buffer entries that no longer point into new space (see
+  // --prune_store_buffer). Returns true if the store buffer is now small enough
+  // that a scavenge is not needed to shrink it.
+  bool PruneStoreBuffer(Thread* thread);
+
   void CheckCatchUp(Thread* thread);
   void CheckConcurrentMarking(Thread* thread, GCReason reason, intptr_t size);
   void CheckFinalizeMarking(Thread* thread);
@@ -352,6 +359,7 @@ class Heap {
   // The different spaces used for allocation.
   Scavenger new_space_;
   PageSpace old_space_;
+  Pretenuring pretenuring_;
 
   WeakTable* new_weak_tables_[kNumWeakSelectors];
   WeakTable* old_weak_tables_[kNumWeakSelectors];
@@ -359,6 +367,11 @@ class Heap {
   // GC stats collection.
   GCStats stats_;
 
+  // End of the last scavenge and new-space usage after it, for sampling the
+  // allocation rate.
+  int64_t last_scavenge_micros_ = 0;
+  intptr_t last_scavenge_new_used_in_words_ = 0;
+
   RelaxedAtomic<Dart_PerformanceMode> mode_ = {Dart_PerformanceMode_Default};
 
   // This heap is in read-only mode: No allocation is allowed.
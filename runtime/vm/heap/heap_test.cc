@@ -14,6 +14,7 @@
 #include "vm/dart_api_impl.h"
 #include "vm/globals.h"
 #include "vm/heap/become.h"
+#include "vm/heap/bulk_memory_arena.h"
 #include "vm/heap/heap.h"
 #include "vm/message_handler.h"
 #include "vm/message_snapshot.h"
@@ -25,6 +26,7 @@
 namespace dart {
 
 DECLARE_FLAG(int, early_tenuring_threshold);
+DECLARE_FLAG(bool, prune_store_buffer);
 
 TEST_CASE(OldGC) {
   const char* kScriptChars =
@@ -1367,4 +1369,87 @@ ISOLATE_UNIT_TEST_CASE(CardRememberedWeakArray) {
   TestCardRememberedWeakArray(false);
 }
 
+ISOLATE_UNIT_TEST_CASE(PruneStoreBuffer) {
+  SetFlagScope<bool> sfs(&FLAG_prune_store_buffer, true);
+  GCTestHelper::CollectAllGarbage();
+  GCTestHelper::WaitForGCTasks();
+
+  const Array& young = Array::Handle(Array::New(1, Heap::kNew));
+  const Array& live = Array::Handle(Array::New(1, Heap::kOld));
+  const Array& stale = Array::Handle(Array::New(1, Heap::kOld));
+  live.SetAt(0, young);
+  stale.SetAt(0, young);
+  stale.SetAt(0, Object::null_object());
+  EXPECT(live.ptr()->untag()->IsRemembered());
+  EXPECT(stale.ptr()->untag()->IsRemembered());
+
+  thread->heap()->PruneStoreBuffer(thread);
+  EXPECT(live.ptr()->untag()->IsRemembered());
+  EXPECT(!stale.ptr()->untag()->IsRemembered());
+  EXPECT(young.IsNew());
+
+  // The pruned remembered set is still sufficient for a scavenge.
+  GCTestHelper::CollectNewSpace();
+  EXPECT(Array::Cast(Object::Handle(live.At(0))).Length() == 1);
+}
+
+ISOLATE_UNIT_TEST_CASE(OldSpaceFreeListCache) {
+  EXPECT(FreeListCache::IsCachedSize(Array::InstanceSize(1)));
+  const intptr_t kNumArrays = 1000;
+  const Array& list = Array::Handle(Array::New(kNumArrays, Heap::kOld));
+  Array& element = Array::Handle();
+  uword previous = 0;
+  intptr_t adjacent = 0;
+  for (intptr_t i = 0; i < kNumArrays; i++) {
+    element = Array::New(1, Heap::kOld);
+    element.SetAt(0, Smi::Handle(Smi::New(i)));
+    list.SetAt(i, element);
+    const uword addr = UntaggedObject::ToAddr(element.ptr());
+    if (addr == previous + Array::InstanceSize(1)) {
+      adjacent++;
+    }
+    previous = addr;
+  }
+  // Most allocations are carved from chunks refilled in bulk.
+  EXPECT(adjacent > kNumArrays / 2);
+  EXPECT(!thread->old_space_cache()->IsEmpty());
+
+  GCTestHelper::CollectOldSpace();
+  EXPECT(thread->old_space_cache()->IsEmpty());
+  for (intptr_t i = 0; i < kNumArrays; i++) {
+    element ^= list.At(i);
+    EXPECT_EQ(i, Smi::Value(Smi::RawCast(element.At(0))));
+  }
+}
+
+VM_UNIT_TEST_CASE(BulkMemoryArena) {
+  BulkMemoryArena arena;
+  uint8_t* small1 = arena.Allocate(10);
+  uint8_t* small2 = arena.Allocate(100);
+  EXPECT(small1 != nullptr);
+  EXPECT(small2 != nullptr);
+  EXPECT(Utils::IsAligned(small1, BulkMemoryArena::kAlignment));
+  EXPECT(Utils::IsAligned(small2, BulkMemoryArena::kAlignment));
+  // Small allocations are bump-allocated from the same region.
+  EXPECT_EQ(small1 + 16, small2);
+  EXPECT_EQ(BulkMemoryArena::kRegionSize, arena.reserved_bytes());
+
+  // Large allocations get their own region and are zero-filled.
+  const intptr_t kLarge = 2 * BulkMemoryArena::kRegionSize;
+  uint8_t* large = arena.Allocate(kLarge);
+  EXPECT(large != nullptr);
+  EXPECT_EQ(0, large[0]);
+  EXPECT_EQ(0, large[kLarge - 1]);
+  large[kLarge - 1] = 1;
+  EXPECT_EQ(16 + 112 + kLarge, arena.allocated_bytes());
+  EXPECT_EQ(BulkMemoryArena::kRegionSize + kLarge, arena.reserved_bytes());
+
+  arena.Release();
+  EXPECT_EQ(0, arena.allocated_bytes());
+  EXPECT_EQ(0, arena.reserved_bytes());
+
+  // The arena can be reused after being released.
+  EXPECT(arena.Allocate(10) != nullptr);
+}
+
 }  // namespace dart
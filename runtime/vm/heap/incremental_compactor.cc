@@ -10,6 +10,7 @@
 #include "vm/heap/become.h"
 #include "vm/heap/freelist.h"
 #include "vm/heap/heap.h"
+#include "vm/heap/numa.h"
 #include "vm/heap/pages.h"
 #include "vm/log.h"
 #include "vm/thread_barrier.h"
@@ -18,13 +19,14 @@
 
 namespace dart {
 
-void GCIncrementalCompactor::Prologue(PageSpace* old_space) {
+bool GCIncrementalCompactor::Prologue(PageSpace* old_space, bool full) {
   ASSERT(Thread::Current()->OwnsGCSafepoint());
   TIMELINE_FUNCTION_GC_DURATION(Thread::Current(), "StartIncrementalCompact");
-  if (!SelectEvacuationCandidates(old_space)) {
-    return;
+  if (!SelectEvacuationCandidates(old_space, full)) {
+    return false;
   }
   CheckFreeLists(old_space);
+  return true;
 }
 
 bool GCIncrementalCompactor::Epilogue(PageSpace* old_space) {
@@ -194,15 +196,22 @@ class PrologueTask : public ThreadPool::Task {
   DISALLOW_COPY_AND_ASSIGN(PrologueTask);
 };
 
-bool GCIncrementalCompactor::SelectEvacuationCandidates(PageSpace* old_space) {
-  // Only evacuate pages that are at least half empty.
-  constexpr intptr_t kEvacuationThreshold = kPageSize / 2;
+bool GCIncrementalCompactor::SelectEvacuationCandidates(PageSpace* old_space,
+                                                        bool full) {
+  // Only evacuate pages that are at least half empty. A full compaction also
+  // takes pages that are a quarter empty.
+  const intptr_t kEvacuationThreshold =
+      full ? (kPageSize / 4) * 3 : kPageSize / 2;
 
   // Evacuate no more than this amount of objects. This puts a bound on the
   // stop-the-world evacuate step that is similar to the existing longest
-  // stop-the-world step of the scavenger.
+  // stop-the-world step of the scavenger. A full compaction has already
+  // accepted a long pause, and is bounded only by the number of pages.
   const intptr_t kMaxEvacuatedBytes =
-      (old_space->heap_->new_space()->ThresholdInWords() << kWordSizeLog2) / 4;
+      full ? kIntptrMax
+           : (old_space->heap_->new_space()->ThresholdInWords()
+              << kWordSizeLog2) /
+                 4;
 
   PrologueState state;
   {
@@ -557,20 +566,24 @@ class EpilogueState {
                 StoreBufferBlock* block,
                 Page* new_page,
                 Mutex* pages_lock)
-      : evac_page_(evac_page),
-        block_(block),
-        new_page_(new_page),
-        pages_lock_(pages_lock) {}
-
-  bool NextEvacPage(Page** page) {
-    // Needs to be the old_space pages lock since evacuation may also allocate
-    // new pages and race with page->next_.
+      : block_(block), new_page_(new_page), pages_lock_(pages_lock) {
+    // Group the candidates by NUMA node so workers can start with the pages
+    // local to them. Collected before any worker starts, so page->next_ is not
+    // yet racing with evacuation allocating new pages.
+    for (Page* page = evac_page; page != nullptr; page = page->next()) {
+      if (!page->is_evacuation_candidate()) continue;
+      const intptr_t node = Utils::Maximum<intptr_t>(page->numa_node(), 0);
+      evac_pages_[node % Numa::NumNodes()].Add(page);
+    }
+  }
+
+  bool NextEvacPage(intptr_t node, Page** page) {
     MutexLocker ml(pages_lock_);
-    while (evac_page_ != nullptr) {
-      Page* current = evac_page_;
-      evac_page_ = current->next();
-      if (current->is_evacuation_candidate()) {
-        *page = current;
+    const intptr_t num_nodes = Numa::NumNodes();
+    for (intptr_t i = 0; i < num_nodes; i++) {
+      MallocGrowableArray<Page*>* pages = &evac_pages_[(node + i) % num_nodes];
+      if (!pages->is_empty()) {
+        *page = pages->RemoveLast();
         return true;
       }
     }
@@ -613,7 +626,7 @@ class EpilogueState {
   intptr_t NewFreeSize() { return new_free_size_; }
 
  private:
-  Page* evac_page_;
+  MallocGrowableArray<Page*> evac_pages_[Numa::kMaxNodes];
   StoreBufferBlock* block_;
   Page* new_page_;
   Mutex* pages_lock_;
@@ -728,8 +741,9 @@ class EpilogueTask : public ThreadPool::Task {
 
     bool any_failed = false;
     intptr_t bytes_evacuated = 0;
+    const intptr_t node = Numa::CurrentNode();
     Page* page;
-    while (state_->NextEvacPage(&page)) {
+    while (state_->NextEvacPage(node, &page)) {
       ASSERT(page->is_evacuation_candidate());
 
       bool page_failed = false;
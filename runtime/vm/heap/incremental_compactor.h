@@ -17,14 +17,20 @@ class IncrementalForwardingVisitor;
 // An evacuating compactor that is incremental in the sense that building the
 // remembered set is interleaved with the mutator. The evacuation and forwarding
 // is not interleaved with the mutator, which would require a read barrier.
+//
+// It also serves full compactions: when 'full' is passed to Prologue, every
+// sufficiently fragmented page is selected without a bound on the evacuated
+// bytes, so the cost of the compaction is proportional to the surviving bytes
+// on those pages rather than to the size of the heap.
 class GCIncrementalCompactor : public AllStatic {
  public:
-  static void Prologue(PageSpace* old_space);
+  // Returns whether any evacuation candidates were selected.
+  static bool Prologue(PageSpace* old_space, bool full = false);
   static bool Epilogue(PageSpace* old_space);
   static void Abort(PageSpace* old_space);
 
  private:
-  static bool SelectEvacuationCandidates(PageSpace* old_space);
+  static bool SelectEvacuationCandidates(PageSpace* old_space, bool full);
   static void CheckFreeLists(PageSpace* old_space);
 
   static bool HasEvacuationCandidates(PageSpace* old_space);
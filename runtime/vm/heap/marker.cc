@@ -43,7 +43,10 @@ class MarkingVisitorBase : public ObjectPointerVisitor {
         marked_micros_(0),
         concurrent_(true),
         has_evacuation_candidate_(false) {}
-  ~MarkingVisitorBase() { ASSERT(delayed_.IsEmpty()); }
+  ~MarkingVisitorBase() {
+    ASSERT(delayed_.IsEmpty());
+    ASSERT(prefetch_count_ == 0);
+  }
 
   uintptr_t marked_bytes() const { return marked_bytes_; }
   int64_t marked_micros() const { return marked_micros_; }
@@ -102,8 +105,59 @@ class MarkingVisitorBase : public ObjectPointerVisitor {
     return more_to_mark;
   }
 
+  // Pops the next object to visit. Objects taken from the work lists pass
+  // through a small FIFO and are prefetched on entry, so their headers are
+  // likely cached by the time they are visited.
+  DART_FORCE_INLINE
+  bool PopPrefetched(ObjectPtr* object) {
+    ObjectPtr next;
+    while ((prefetch_count_ < kPrefetchDepth) &&
+           MarkerWorkList::Pop(&old_work_list_, &new_work_list_, &next)) {
+      Utils::PrefetchForRead(
+          reinterpret_cast<void*>(UntaggedObject::ToAddr(next)));
+      prefetch_buffer_[(prefetch_head_ + prefetch_count_) % kPrefetchDepth] =
+          next;
+      prefetch_count_++;
+    }
+    if (prefetch_count_ == 0) {
+      return false;
+    }
+    *object = prefetch_buffer_[prefetch_head_];
+    prefetch_head_ = (prefetch_head_ + 1) % kPrefetchDepth;
+    prefetch_count_--;
+    return true;
+  }
+
+  // Puts prefetched objects back on the work lists, where they are visible
+  // to other markers and to a scavenge during a yield.
+  void ReturnPrefetched() {
+    while (prefetch_count_ > 0) {
+      ObjectPtr obj = prefetch_buffer_[prefetch_head_];
+      prefetch_head_ = (prefetch_head_ + 1) % kPrefetchDepth;
+      prefetch_count_--;
+      if (obj->IsNewObject()) {
+        new_work_list_.Push(obj);
+      } else {
+        old_work_list_.Push(obj);
+      }
+    }
+  }
+
+  // Arrays dominate pointer-heavy heaps. Visiting them directly skips the
+  // predefined class dispatch in VisitPointersNonvirtual.
+  DART_FORCE_INLINE
+  intptr_t VisitArray(ArrayPtr obj) {
+    ASSERT(obj->IsArray() || obj->IsImmutableArray());
+    ASSERT(!obj->untag()->IsCardRemembered());
+    const intptr_t length = Smi::Value(obj->untag()->length());
+    VisitCompressedPointers(obj.heap_base(), obj->untag()->from(),
+                            obj->untag()->to(length));
+    return obj->untag()->HeapSize();
+  }
+
   DART_NOINLINE
   void YieldConcurrentMarking() {
+    ReturnPrefetched();
     old_work_list_.Flush();
     new_work_list_.Flush();
     tlab_deferred_work_list_.Flush();
@@ -119,7 +173,7 @@ class MarkingVisitorBase : public ObjectPointerVisitor {
     Thread* thread = Thread::Current();
     do {
       ObjectPtr obj;
-      while (MarkerWorkList::Pop(&old_work_list_, &new_work_list_, &obj)) {
+      while (PopPrefetched(&obj)) {
         ASSERT(!has_evacuation_candidate_);
 
         if (obj->IsNewObject()) {
@@ -159,6 +213,8 @@ class MarkingVisitorBase : public ObjectPointerVisitor {
         } else if (obj->untag()->IsCardRemembered()) {
           ASSERT((class_id == kArrayCid) || (class_id == kImmutableArrayCid));
           size = VisitCards(static_cast<ArrayPtr>(obj));
+        } else if ((class_id == kArrayCid) || (class_id == kImmutableArrayCid)) {
+          size = VisitArray(static_cast<ArrayPtr>(obj));
         } else {
           size = obj->untag()->VisitPointersNonvirtual(this);
         }
@@ -236,7 +292,7 @@ class MarkingVisitorBase : public ObjectPointerVisitor {
     Thread* thread = Thread::Current();
     do {
       ObjectPtr obj;
-      while (MarkerWorkList::Pop(&old_work_list_, &new_work_list_, &obj)) {
+      while (PopPrefetched(&obj)) {
         ASSERT(!has_evacuation_candidate_);
 
         const intptr_t class_id = obj->GetClassId();
@@ -257,6 +313,9 @@ class MarkingVisitorBase : public ObjectPointerVisitor {
           if (obj->untag()->IsCardRemembered()) {
             ASSERT((class_id == kArrayCid) || (class_id == kImmutableArrayCid));
             size = VisitCards(static_cast<ArrayPtr>(obj));
+          } else if ((class_id == kArrayCid) ||
+                     (class_id == kImmutableArrayCid)) {
+            size = VisitArray(static_cast<ArrayPtr>(obj));
           } else {
             size = obj->untag()->VisitPointersNonvirtual(this);
           }
@@ -330,6 +389,9 @@ class MarkingVisitorBase : public ObjectPointerVisitor {
           if (obj->untag()->IsCardRemembered()) {
             ASSERT((class_id == kArrayCid) || (class_id == kImmutableArrayCid));
             size = VisitCards(static_cast<ArrayPtr>(obj));
+          } else if ((class_id == kArrayCid) ||
+                     (class_id == kImmutableArrayCid)) {
+            size = VisitArray(static_cast<ArrayPtr>(obj));
           } else {
             size = obj->untag()->VisitPointersNonvirtual(this);
           }
@@ -597,11 +659,6 @@ class MarkingVisitorBase : public ObjectPointerVisitor {
     delayed_.FlushInto(global_list);
   }
 
-  void Adopt(GCLinkedLists* other) {
-    ASSERT(delayed_.IsEmpty());
-    other->FlushInto(&delayed_);
-  }
-
   void AbandonWork() {
     old_work_list_.AbandonWork();
     new_work_list_.AbandonWork();
@@ -693,6 +750,11 @@ class MarkingVisitorBase : public ObjectPointerVisitor {
   bool concurrent_;
   bool has_evacuation_candidate_;
 
+  static constexpr intptr_t kPrefetchDepth = 8;
+  ObjectPtr prefetch_buffer_[kPrefetchDepth];
+  intptr_t prefetch_head_ = 0;
+  intptr_t prefetch_count_ = 0;
+
   DISALLOW_IMPLICIT_CONSTRUCTORS(MarkingVisitorBase);
 };
 
@@ -779,11 +841,16 @@ void GCMarker::IterateRoots(ObjectPointerVisitor* visitor) {
 
 enum WeakSlices {
   kWeakHandles = 0,
-  kWeakTables,
   kRememberedSet,
-  kNumWeakSlices,
+  kWeakTables,
 };
 
+// Each weak table is split into this many ranges.
+static constexpr intptr_t kWeakTableSlices = 4;
+static constexpr intptr_t kNumWeakTableSlices =
+    2 * Heap::kNumWeakSelectors * kWeakTableSlices;
+static constexpr intptr_t kNumWeakSlices = kWeakTables + kNumWeakTableSlices;
+
 void GCMarker::IterateWeakRoots(Thread* thread) {
   for (;;) {
     intptr_t slice = weak_slices_started_.fetch_add(1);
@@ -795,14 +862,13 @@ void GCMarker::IterateWeakRoots(Thread* thread) {
       case kWeakHandles:
         ProcessWeakHandles(thread);
         break;
-      case kWeakTables:
-        ProcessWeakTables(thread);
-        break;
       case kRememberedSet:
         ProcessRememberedSet(thread);
         break;
       default:
-        UNREACHABLE();
+        ASSERT(slice >= kWeakTables);
+        ProcessWeakTables(thread, slice - kWeakTables);
+        break;
     }
   }
 }
@@ -815,43 +881,43 @@ void GCMarker::ProcessWeakHandles(Thread* thread) {
   isolate_group_->VisitWeakPersistentHandles(&visitor);
 }
 
-void GCMarker::ProcessWeakTables(Thread* thread) {
-  TIMELINE_FUNCTION_GC_DURATION(thread, "ProcessWeakTables");
-  for (int sel = 0; sel < Heap::kNumWeakSelectors; sel++) {
-    Dart_HeapSamplingDeleteCallback cleanup = nullptr;
+void GCMarker::ProcessWeakTables(Thread* thread, intptr_t slice) {
+  ASSERT((slice >= 0) && (slice < kNumWeakTableSlices));
+  const intptr_t sel = slice / (2 * kWeakTableSlices);
+  const Heap::Space space =
+      ((slice / kWeakTableSlices) % 2) == 0 ? Heap::kOld : Heap::kNew;
+  const intptr_t part = slice % kWeakTableSlices;
+
+  Dart_HeapSamplingDeleteCallback cleanup = nullptr;
 #if !defined(PRODUCT) || defined(FORCE_INCLUDE_SAMPLING_HEAP_PROFILER)
-    if (sel == Heap::kHeapSamplingData) {
-      cleanup = HeapProfileSampler::delete_callback();
-    }
+  if (sel == Heap::kHeapSamplingData) {
+    cleanup = HeapProfileSampler::delete_callback();
+  }
 #endif
-    WeakTable* table =
-        heap_->GetWeakTable(Heap::kOld, static_cast<Heap::WeakSelector>(sel));
-    intptr_t size = table->size();
-    for (intptr_t i = 0; i < size; i++) {
-      if (table->IsValidEntryAtExclusive(i)) {
-        // The object has been collected.
-        ObjectPtr obj = table->ObjectAtExclusive(i);
-        if (obj->IsHeapObject() && !obj->untag()->IsMarked()) {
-          if (cleanup != nullptr) {
-            cleanup(reinterpret_cast<void*>(table->ValueAtExclusive(i)));
-          }
-          table->InvalidateAtExclusive(i);
-        }
-      }
-    }
-    table =
-        heap_->GetWeakTable(Heap::kNew, static_cast<Heap::WeakSelector>(sel));
-    size = table->size();
-    for (intptr_t i = 0; i < size; i++) {
-      if (table->IsValidEntryAtExclusive(i)) {
-        // The object has been collected.
-        ObjectPtr obj = table->ObjectAtExclusive(i);
-        if (obj->IsHeapObject() && !obj->untag()->IsMarked()) {
-          if (cleanup != nullptr) {
-            cleanup(reinterpret_cast<void*>(table->ValueAtExclusive(i)));
-          }
-          table->InvalidateAtExclusive(i);
+
+  WeakTable* table =
+      heap_->GetWeakTable(space, static_cast<Heap::WeakSelector>(sel));
+  const intptr_t size = table->size();
+  intptr_t start = (size * part) / kWeakTableSlices;
+  intptr_t end = (size * (part + 1)) / kWeakTableSlices;
+  if (cleanup != nullptr) {
+    // The embedder's callback need not be thread-safe.
+    if (part != 0) return;
+    start = 0;
+    end = size;
+  }
+  if (start == end) return;
+
+  TIMELINE_FUNCTION_GC_DURATION(thread, "ProcessWeakTables");
+  for (intptr_t i = start; i < end; i++) {
+    if (table->IsValidEntryAtExclusive(i)) {
+      // The object has been collected.
+      ObjectPtr obj = table->ObjectAtExclusive(i);
+      if (obj->IsHeapObject() && !obj->untag()->IsMarked()) {
+        if (cleanup != nullptr) {
+          cleanup(reinterpret_cast<void*>(table->ValueAtExclusive(i)));
         }
+        table->InvalidateAtExclusive(i);
       }
     }
   }
@@ -1348,8 +1414,21 @@ void GCMarker::MarkObjects(PageSpace* page_space) {
         // enough, and we must fail to visit objects but they're sitting in
         // such a visitor's local blocks.
         visitor->Flush(&global_list_);
-        // Need to move weak property list too.
+      }
+
+      // Share the weak objects found by concurrent marking among all tasks,
+      // so the ephemeron fixpoint and mourning in the pause are parallel.
+      {
+        GCLinkedLists** delayed = new GCLinkedLists*[num_tasks];
+        for (intptr_t i = 0; i < num_tasks; i++) {
+          delayed[i] = visitors_[i]->delayed();
+        }
+        global_list_.DistributeInto(delayed, num_tasks);
+        delete[] delayed;
+      }
 
+      for (intptr_t i = 0; i < num_tasks; ++i) {
+        SyncMarkingVisitor* visitor = visitors_[i];
         if (i < (num_tasks - 1)) {
           // Begin marking on a helper thread.
           bool result = Dart::thread_pool()->Run<ParallelMarkTask>(
@@ -1358,7 +1437,6 @@ void GCMarker::MarkObjects(PageSpace* page_space) {
           ASSERT(result);
         } else {
           // Last worker is the main thread.
-          visitor->Adopt(&global_list_);
           ParallelMarkTask task(this, isolate_group_, &old_marking_stack_,
                                 barrier, visitor, &num_busy);
           task.RunEnteredIsolateGroup();
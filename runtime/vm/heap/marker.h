@@ -60,7 +60,9 @@ class GCMarker {
   void IterateRoots(ObjectPointerVisitor* visitor);
   void IterateWeakRoots(Thread* thread);
   void ProcessWeakHandles(Thread* thread);
-  void ProcessWeakTables(Thread* thread);
+  // Prunes one slice of the old and new weak tables. Slices cover disjoint
+  // ranges of entries, so several tasks can prune at once.
+  void ProcessWeakTables(Thread* thread, intptr_t slice);
   void ProcessRememberedSet(Thread* thread);
 
   // Called by anyone: finalize and accumulate stats from 'visitor'.
@@ -0,0 +1,102 @@
+// Copyright (c) 2024, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+#include "vm/heap/numa.h"
+
+#if defined(DART_HOST_OS_LINUX)
+#include <stdio.h>        // NOLINT
+#include <sys/syscall.h>  // NOLINT
+#include <unistd.h>       // NOLINT
+#endif
+
+#include "platform/utils.h"
+#include "vm/flags.h"
+
+namespace dart {
+
+DEFINE_FLAG(bool,
+            numa,
+            false,
+            "Bind heap pages to the NUMA node of the allocating thread and "
+            "prefer node-local pages in parallel GC tasks.");
+
+intptr_t Numa::num_nodes_ = 1;
+
+#if defined(DART_HOST_OS_LINUX)
+// From <linux/mempolicy.h>; not all sysroots ship the libnuma headers.
+static constexpr int kMPolPreferred = 1;
+
+// Parses a sysfs node list such as "0", "0-1" or "0,2-3" and returns the
+// highest node id, or -1.
+static intptr_t HighestNodeIn(const char* list) {
+  intptr_t highest = -1;
+  intptr_t current = -1;
+  for (const char* p = list; *p != '\0'; p++) {
+    if ((*p >= '0') && (*p <= '9')) {
+      current = (current < 0 ? 0 : current * 10) + (*p - '0');
+    } else {
+      highest = Utils::Maximum(highest, current);
+      current = -1;
+    }
+  }
+  return Utils::Maximum(highest, current);
+}
+#endif  // defined(DART_HOST_OS_LINUX)
+
+void Numa::Init() {
+  num_nodes_ = 1;
+  if (!FLAG_numa) {
+    return;
+  }
+#if defined(DART_HOST_OS_LINUX)
+  FILE* file = fopen("/sys/devices/system/node/online", "r");
+  if (file == nullptr) {
+    return;
+  }
+  char buffer[256];
+  const bool read = fgets(buffer, sizeof(buffer), file) != nullptr;
+  fclose(file);
+  if (!read) {
+    return;
+  }
+  const intptr_t highest = HighestNodeIn(buffer);
+  if (highest > 0) {
+    num_nodes_ = Utils::Minimum(highest + 1, kMaxNodes);
+  }
+#endif  // defined(DART_HOST_OS_LINUX)
+}
+
+intptr_t Numa::CurrentNode() {
+#if defined(DART_HOST_OS_LINUX) && defined(SYS_getcpu)
+  if (!IsEnabled()) {
+    return 0;
+  }
+  unsigned cpu = 0;
+  unsigned node = 0;
+  if (syscall(SYS_getcpu, &cpu, &node, nullptr) != 0) {
+    return 0;
+  }
+  return static_cast<intptr_t>(node) < num_nodes_ ? node : 0;
+#else
+  return 0;
+#endif
+}
+
+bool Numa::BindToNode(void* address, intptr_t size, intptr_t node) {
+#if defined(DART_HOST_OS_LINUX) && defined(SYS_mbind)
+  if (!IsEnabled()) {
+    return false;
+  }
+  ASSERT((node >= 0) && (node < num_nodes_));
+  unsigned long mask = 1UL << node;  // NOLINT
+  // Only affects pages that are faulted in later; already resident pages are
+  // not migrated.
+  return syscall(SYS_mbind, address, size, kMPolPreferred, &mask,
+                 sizeof(mask) * kBitsPerByte, 0) == 0;
+#else
+  return false;
+#endif
+}
+
+}  // namespace dart
@@ -0,0 +1,42 @@
+// Copyright (c) 2024, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+#ifndef RUNTIME_VM_HEAP_NUMA_H_
+#define RUNTIME_VM_HEAP_NUMA_H_
+
+#include "vm/allocation.h"
+#include "vm/globals.h"
+
+namespace dart {
+
+// Minimal NUMA support for heap pages, enabled with --numa.
+//
+// When enabled on a host with more than one node, heap pages are bound to the
+// node of the thread that allocates them and tagged with that node (see
+// Page::numa_node), so GC tasks can prefer pages local to the CPU they run on.
+// Everywhere else all memory is reported as node 0.
+class Numa : public AllStatic {
+ public:
+  // Node ids must fit in Page's flags and in one word of a node mask.
+  static constexpr intptr_t kMaxNodes = 32;
+
+  static void Init();
+
+  static bool IsEnabled() { return num_nodes_ > 1; }
+  static intptr_t NumNodes() { return num_nodes_; }
+
+  // The node of the CPU the calling thread is running on, or 0.
+  static intptr_t CurrentNode();
+
+  // Asks the OS to back the not yet touched parts of [address, address + size)
+  // with memory from 'node'. Returns false if the request was not honored.
+  static bool BindToNode(void* address, intptr_t size, intptr_t node);
+
+ private:
+  static intptr_t num_nodes_;
+};
+
+}  // namespace dart
+
+#endif  // RUNTIME_VM_HEAP_NUMA_H_
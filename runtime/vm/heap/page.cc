@@ -10,6 +10,7 @@
 #include "vm/heap/become.h"
 #include "vm/heap/compactor.h"
 #include "vm/heap/marker.h"
+#include "vm/heap/numa.h"
 #include "vm/heap/safepoint.h"
 #include "vm/heap/sweeper.h"
 #include "vm/lockers.h"
@@ -26,11 +27,30 @@ namespace dart {
 static constexpr intptr_t kPageCacheCapacity = 8 * kWordSize;
 static Mutex* page_cache_mutex = nullptr;
 static VirtualMemory* page_cache[kPageCacheCapacity] = {nullptr};
+static intptr_t page_cache_node[kPageCacheCapacity] = {0};
 static intptr_t page_cache_size = 0;
 
 void Page::Init() {
   ASSERT(page_cache_mutex == nullptr);
   page_cache_mutex = new Mutex(NOT_IN_PRODUCT("page_cache_mutex"));
+  Numa::Init();
+}
+
+// Takes a cached page bound to 'node', or any cached page when NUMA is not
+// enabled.
+static VirtualMemory* TakeCachedPage(intptr_t node) {
+  ASSERT(page_cache_size >= 0);
+  ASSERT(page_cache_size <= kPageCacheCapacity);
+  for (intptr_t i = page_cache_size - 1; i >= 0; i--) {
+    if (page_cache_node[i] == node) {
+      VirtualMemory* memory = page_cache[i];
+      page_cache_size--;
+      page_cache[i] = page_cache[page_cache_size];
+      page_cache_node[i] = page_cache_node[page_cache_size];
+      return memory;
+    }
+  }
+  return nullptr;
 }
 
 void Page::ClearCache() {
@@ -63,6 +83,8 @@ Page* Page::Allocate(intptr_t size, uword flags) {
   const bool compressed = !executable;
   const char* name = executable ? "dart-code" : "dart-heap";
 
+  const intptr_t node = Numa::CurrentNode();
+  bool bound = false;
   VirtualMemory* memory = nullptr;
   if (CanUseCache(flags)) {
     // We don't automatically use the cache based on size and type because a
@@ -71,15 +93,16 @@ Page* Page::Allocate(intptr_t size, uword flags) {
     // cached pages are dirty.
     ASSERT(size == kPageSize);
     MutexLocker ml(page_cache_mutex);
-    ASSERT(page_cache_size >= 0);
-    ASSERT(page_cache_size <= kPageCacheCapacity);
-    if (page_cache_size > 0) {
-      memory = page_cache[--page_cache_size];
-    }
+    memory = TakeCachedPage(node);
+    bound = (memory != nullptr) && Numa::IsEnabled();
   }
   if (memory == nullptr) {
     memory = VirtualMemory::AllocateAligned(size, kPageSize, executable,
                                             compressed, name);
+    if (memory != nullptr) {
+      // Before the memory is touched below.
+      bound = Numa::BindToNode(memory->address(), memory->size(), node);
+    }
   }
   if (memory == nullptr) {
     return nullptr;  // Out of memory.
@@ -103,7 +126,11 @@ Page* Page::Allocate(intptr_t size, uword flags) {
 
   Page* result = reinterpret_cast<Page*>(memory->address());
   ASSERT(result != nullptr);
+  ASSERT((flags & (kNumaNodeMask << kNumaNodeShift)) == 0);
   result->flags_ = flags;
+  if (bound) {
+    result->flags_ |= static_cast<uword>(node + 1) << kNumaNodeShift;
+  }
   result->memory_ = memory;
   result->next_ = nullptr;
   result->forwarding_page_ = nullptr;
@@ -164,6 +191,8 @@ void Page::Deallocate() {
       }
 #endif
       MSAN_POISON(memory->address(), size);
+      page_cache_node[page_cache_size] = Utils::Maximum<intptr_t>(
+          numa_node(), 0);
       page_cache[page_cache_size++] = memory;
       memory = nullptr;
     }
@@ -171,6 +200,29 @@ void Page::Deallocate() {
   delete memory;
 }
 
+#ifndef PRODUCT
+void Page::AccumulateNumaCapacity(const Page* pages,
+                                  intptr_t* capacity_per_node) {
+  for (const Page* page = pages; page != nullptr; page = page->next()) {
+    const intptr_t node = Utils::Maximum<intptr_t>(page->numa_node(), 0);
+    capacity_per_node[node] += page->memory_->size();
+  }
+}
+
+void Page::PrintNumaCapacityToJSON(JSONObject* space,
+                                   const intptr_t* capacity_per_node) {
+  if (!Numa::IsEnabled()) {
+    return;
+  }
+  JSONArray nodes(space, "numaNodes");
+  for (intptr_t i = 0; i < Numa::NumNodes(); i++) {
+    JSONObject node(&nodes);
+    node.AddProperty("node", i);
+    node.AddProperty64("capacity", capacity_per_node[i]);
+  }
+}
+#endif  // !PRODUCT
+
 void Page::VisitObjects(ObjectVisitor* visitor) const {
   ASSERT(Thread::Current()->OwnsGCSafepoint() ||
          (Thread::Current()->task_kind() == Thread::kIncrementalCompactorTask));
@@ -234,43 +286,50 @@ void Page::VisitRememberedCards(PredicateObjectPointerVisitor* visitor,
   const size_t size_in_words =
       Utils::RoundUp(size_in_bits, kBitsPerWord) >> kBitsPerWordLog2;
   for (;;) {
-    const size_t word_offset = progress_bar_.fetch_add(1);
-    if (word_offset >= size_in_words) break;
-
-    uword cell = card_table_[word_offset];
-    if (cell == 0) continue;
-
-    for (intptr_t bit_offset = 0; bit_offset < kBitsPerWord; bit_offset++) {
-      const uword bit_mask = static_cast<uword>(1) << bit_offset;
-      if ((cell & bit_mask) == 0) continue;
-      const intptr_t i = (word_offset << kBitsPerWordLog2) + bit_offset;
-
-      CompressedObjectPtr* card_from =
-          reinterpret_cast<CompressedObjectPtr*>(this) +
-          (i << kSlotsPerCardLog2);
-      CompressedObjectPtr* card_to =
-          reinterpret_cast<CompressedObjectPtr*>(card_from) +
-          (1 << kSlotsPerCardLog2) - 1;
-      // Minus 1 because to is inclusive.
-
-      if (card_from < obj_from) {
-        // First card overlaps with header.
-        card_from = obj_from;
-      }
-      if (card_to > obj_to) {
-        // Last card(s) may extend past the object. Array truncation can make
-        // this happen for more than one card.
-        card_to = obj_to;
-      }
-
-      bool has_new_target = visitor->PredicateVisitCompressedPointers(
-          heap_base, card_from, card_to);
-
-      if (!has_new_target) {
-        cell ^= bit_mask;
+    // Avoid contending on the progress bar of a page that is already done.
+    if (static_cast<size_t>(progress_bar_.load()) >= size_in_words) break;
+    const size_t chunk_start = progress_bar_.fetch_add(kCardWordsPerChunk);
+    if (chunk_start >= size_in_words) break;
+    const size_t chunk_end =
+        Utils::Minimum(chunk_start + kCardWordsPerChunk, size_in_words);
+
+    for (size_t word_offset = chunk_start; word_offset < chunk_end;
+         word_offset++) {
+      uword cell = card_table_[word_offset];
+      if (cell == 0) continue;
+
+      for (intptr_t bit_offset = 0; bit_offset < kBitsPerWord; bit_offset++) {
+        const uword bit_mask = static_cast<uword>(1) << bit_offset;
+        if ((cell & bit_mask) == 0) continue;
+        const intptr_t i = (word_offset << kBitsPerWordLog2) + bit_offset;
+
+        CompressedObjectPtr* card_from =
+            reinterpret_cast<CompressedObjectPtr*>(this) +
+            (i << kSlotsPerCardLog2);
+        CompressedObjectPtr* card_to =
+            reinterpret_cast<CompressedObjectPtr*>(card_from) +
+            (1 << kSlotsPerCardLog2) - 1;
+        // Minus 1 because to is inclusive.
+
+        if (card_from < obj_from) {
+          // First card overlaps with header.
+          card_from = obj_from;
+        }
+        if (card_to > obj_to) {
+          // Last card(s) may extend past the object. Array truncation can make
+          // this happen for more than one card.
+          card_to = obj_to;
+        }
+
+        bool has_new_target = visitor->PredicateVisitCompressedPointers(
+            heap_base, card_from, card_to);
+
+        if (!has_new_target) {
+          cell ^= bit_mask;
+        }
       }
+      card_table_[word_offset] = cell;
     }
-    card_table_[word_offset] = cell;
   }
 }
 
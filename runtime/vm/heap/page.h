@@ -15,6 +15,7 @@
 namespace dart {
 
 class ForwardingPage;
+class JSONObject;
 class ObjectVisitor;
 class ObjectPointerVisitor;
 class Thread;
@@ -74,6 +75,10 @@ class Page {
     kEvacuationCandidate = 1 << 5,
     kNeverEvacuate = 1 << 6,
   };
+  // The NUMA node the page is bound to, plus one, is kept in the flags above
+  // these bits. Zero means unknown.
+  static constexpr intptr_t kNumaNodeShift = 8;
+  static constexpr uword kNumaNodeMask = 0xFF;
   bool is_executable() const { return (flags_ & kExecutable) != 0; }
   bool is_large() const { return (flags_ & kLarge) != 0; }
   bool is_image() const { return (flags_ & kImage) != 0; }
@@ -99,6 +104,22 @@ class Page {
     }
   }
 
+  // The NUMA node the page's memory was bound to, or -1 if unknown.
+  intptr_t numa_node() const {
+    return static_cast<intptr_t>((flags_ >> kNumaNodeShift) & kNumaNodeMask) -
+           1;
+  }
+
+#ifndef PRODUCT
+  // Adds the size of each page in the list to its node's entry in
+  // 'capacity_per_node' (Numa::kMaxNodes entries; unknown counts as node 0).
+  static void AccumulateNumaCapacity(const Page* pages,
+                                     intptr_t* capacity_per_node);
+  // Adds a "numaNodes" property if NUMA is enabled.
+  static void PrintNumaCapacityToJSON(JSONObject* space,
+                                      const intptr_t* capacity_per_node);
+#endif  // !PRODUCT
+
   Page* next() const { return next_; }
   void set_next(Page* next) { next_ = next; }
 
@@ -180,6 +201,11 @@ class Page {
     return memory_->size() >> kBytesPerCardLog2;
   }
 
+  // Scavenger workers claim the words of a card table this many at a time, so
+  // that a huge card-remembered array is shared among them without every
+  // word costing an atomic increment.
+  static constexpr intptr_t kCardWordsPerChunk = 8;
+
   static intptr_t card_table_offset() { return OFFSET_OF(Page, card_table_); }
 
   void RememberCard(ObjectPtr const* slot) {
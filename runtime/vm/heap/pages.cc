@@ -12,6 +12,7 @@
 #include "vm/heap/compactor.h"
 #include "vm/heap/incremental_compactor.h"
 #include "vm/heap/marker.h"
+#include "vm/heap/numa.h"
 #include "vm/heap/safepoint.h"
 #include "vm/heap/sweeper.h"
 #include "vm/lockers.h"
@@ -19,6 +20,7 @@
 #include "vm/object.h"
 #include "vm/object_set.h"
 #include "vm/os_thread.h"
+#include "vm/thread_registry.h"
 #include "vm/unwinding_records.h"
 #include "vm/virtual_memory.h"
 
@@ -45,6 +47,13 @@ DEFINE_FLAG(bool,
             false,
             "Print free list statistics after a GC");
 DEFINE_FLAG(bool, log_growth, false, "Log PageSpace growth policy decisions.");
+DEFINE_FLAG(int,
+            old_gen_gc_cpu_target,
+            0,
+            "If non-zero, size the old generation so that about this "
+            "percentage of time is spent in old gen GC, instead of using the "
+            "growth ratios");
+DECLARE_FLAG(bool, huge_pages);
 
 // The initial estimate of how many words we can mark per microsecond (usage
 // before / mark-sweep time). This is a conservative value observed running
@@ -64,6 +73,8 @@ PageSpace::PageSpace(Heap* heap, intptr_t max_capacity_in_words)
       tasks_(0),
       concurrent_marker_tasks_(0),
       concurrent_marker_tasks_active_(0),
+      concurrent_sweeper_tasks_(0),
+      concurrent_sweeper_tasks_large_(0),
       pause_concurrent_marking_(0),
       phase_(kDone),
 #if defined(DEBUG)
@@ -103,6 +114,8 @@ PageSpace::~PageSpace() {
   FreePages(exec_pages_);
   FreePages(large_pages_);
   FreePages(image_pages_);
+  FreePages(sweep_regular_);
+  FreePages(sweep_large_);
   ASSERT(marker_ == nullptr);
   delete[] freelists_;
 }
@@ -429,6 +442,70 @@ uword PageSpace::TryAllocateInternal(intptr_t size,
   return result;
 }
 
+uword PageSpace::TryRefillCache(Thread* thread, intptr_t size) {
+  ASSERT(FreeListCache::IsCachedSize(size));
+  FreeListCache* cache = thread->old_space_cache();
+  const intptr_t index = FreeListCache::IndexForSize(size);
+  ASSERT(cache->lists_[index] == nullptr);
+
+  // Take one chunk from the shared freelist and carve it into elements of
+  // 'size'. If the freelist has no such chunk, let the caller take the regular
+  // path, which may grow the heap or trigger a GC.
+  const intptr_t count = FreeListCache::kRefillSize / size;
+  const intptr_t chunk_size = count * size;
+  FreeList* freelist = &freelists_[kDataFreelist];
+  uword chunk = freelist->TryAllocate(chunk_size, /*is_protected=*/false);
+  if (chunk == 0) {
+    return 0;
+  }
+  // The whole chunk is accounted as used while cached, like a bump region.
+  Page::Of(chunk)->add_live_bytes(chunk_size);
+  usage_.used_in_words += (chunk_size >> kWordSizeLog2);
+
+  // The first element is the result. The rest are kept as free-list elements
+  // so the page remains iterable.
+  FreeListElement* head = nullptr;
+  for (uword addr = chunk + chunk_size - size; addr > chunk; addr -= size) {
+    FreeListElement* element = FreeListElement::AsElement(addr, size);
+    element->set_next(head);
+    head = element;
+  }
+  cache->lists_[index] = head;
+  cache->cached_bytes_ += chunk_size - size;
+  return chunk;
+}
+
+void PageSpace::ReleaseCache(Thread* thread) {
+  FreeListCache* cache = thread->old_space_cache();
+  if (cache->IsEmpty()) {
+    return;
+  }
+  FreeList* freelist = &freelists_[kDataFreelist];
+  {
+    MutexLocker ml(freelist->mutex());
+    for (intptr_t i = 0; i < FreeListCache::kNumSizes; i++) {
+      const intptr_t size = (i + 1) << kObjectAlignmentLog2;
+      FreeListElement* element = cache->lists_[i];
+      while (element != nullptr) {
+        FreeListElement* next = element->next();
+        uword addr = reinterpret_cast<uword>(element);
+        Page::Of(addr)->sub_live_bytes(size);
+        freelist->FreeLocked(addr, size);
+        element = next;
+      }
+      cache->lists_[i] = nullptr;
+    }
+  }
+  usage_.used_in_words -= (cache->cached_bytes_ >> kWordSizeLog2);
+  cache->cached_bytes_ = 0;
+}
+
+void PageSpace::ReleaseCaches() {
+  ASSERT(Thread::Current()->OwnsGCSafepoint());
+  heap_->isolate_group()->thread_registry()->ForEachThread(
+      [&](Thread* thread) { ReleaseCache(thread); });
+}
+
 void PageSpace::AcquireLock(FreeList* freelist) {
   freelist->mutex()->Lock();
 }
@@ -744,6 +821,21 @@ void PageSpace::PrintToJSONObject(JSONObject* object) const {
   space.AddProperty64("capacity", CapacityInWords() * kWordSize);
   space.AddProperty64("external", ExternalInWords() * kWordSize);
   space.AddProperty("time", MicrosecondsToSeconds(gc_time_micros()));
+  if (Numa::IsEnabled()) {
+    intptr_t capacity_per_node[Numa::kMaxNodes] = {0};
+    {
+      MutexLocker ml(&pages_lock_);
+      Page::AccumulateNumaCapacity(pages_, capacity_per_node);
+      Page::AccumulateNumaCapacity(exec_pages_, capacity_per_node);
+      Page::AccumulateNumaCapacity(large_pages_, capacity_per_node);
+    }
+    Page::PrintNumaCapacityToJSON(&space, capacity_per_node);
+  }
+  if (FLAG_huge_pages) {
+    JSONObject huge_pages(&space, "hugePages");
+    huge_pages.AddProperty64("advised", VirtualMemory::huge_page_bytes());
+    huge_pages.AddProperty64("failures", VirtualMemory::huge_page_failures());
+  }
   if (collections() > 0) {
     int64_t run_time = isolate_group->UptimeMicros();
     run_time = Utils::Maximum(run_time, static_cast<int64_t>(0));
@@ -1027,6 +1119,10 @@ void PageSpace::CollectGarbageHelper(Thread* thread,
       [&](Isolate* isolate) { isolate->field_table()->FreeOldTables(); },
       /*at_safepoint=*/true);
 
+  // Cached free-list elements must be visible to the sweeper and to the
+  // selection of evacuation candidates.
+  ReleaseCaches();
+
   NoSafepointScope no_safepoints(thread);
 
   if (FLAG_print_free_list_before_gc) {
@@ -1047,12 +1143,19 @@ void PageSpace::CollectGarbageHelper(Thread* thread,
   // Save old value before GCMarker visits the weak persistent handles.
   SpaceUsage usage_before = GetCurrentUsage();
 
+  // A compaction requested when no concurrent marking is in progress is done
+  // by evacuating fragmented pages instead of sliding the whole heap.
+  bool evacuating_compact = false;
+
   // Mark all reachable old-gen objects.
   if (marker_ == nullptr) {
     ASSERT(phase() == kDone);
     marker_ = new GCMarker(isolate_group, heap_);
     if (FLAG_use_incremental_compactor) {
-      GCIncrementalCompactor::Prologue(this);
+      const bool full = compact && finalize;
+      if (GCIncrementalCompactor::Prologue(this, full) && full) {
+        evacuating_compact = true;
+      }
     }
   } else {
     ASSERT(phase() == kAwaitingFinalization);
@@ -1067,7 +1170,10 @@ void PageSpace::CollectGarbageHelper(Thread* thread,
   // Abandon the remainder of the bump allocation block.
   ReleaseBumpAllocation();
 
+  const int64_t mark_start = OS::GetCurrentMonotonicMicros();
   marker_->MarkObjects(this);
+  isolate_group->GetGCMarkPauseMetric()->Add(OS::GetCurrentMonotonicMicros() -
+                                             mark_start);
   usage_.used_in_words = marker_->marked_words() + allocated_black_in_words_;
   allocated_black_in_words_ = 0;
   mark_words_per_micro_ = marker_->MarkedWordsPerMicro();
@@ -1088,12 +1194,18 @@ void PageSpace::CollectGarbageHelper(Thread* thread,
   if (FLAG_use_incremental_compactor) {
     new_space_is_swept = GCIncrementalCompactor::Epilogue(this);
   }
+  if (evacuating_compact) {
+    // The fragmented pages have been evacuated and freed; the rest are swept
+    // as in a mark-sweep.
+    compact = false;
+  }
 
   // Reset the freelists and setup sweeping.
   for (intptr_t i = 0; i < num_freelists_; i++) {
     freelists_[i].Reset();
   }
 
+  const int64_t sweep_start = OS::GetCurrentMonotonicMicros();
   {
     // Executable pages are always swept immediately to simplify
     // code protection.
@@ -1145,6 +1257,9 @@ void PageSpace::CollectGarbageHelper(Thread* thread,
     Sweep(/*exclusive*/ true);
     set_phase(kDone);
   }
+  // Concurrent sweeper tasks record their own time.
+  isolate_group->GetGCSweepTimeMetric()->Add(OS::GetCurrentMonotonicMicros() -
+                                             sweep_start);
 
   if (FLAG_verify_after_gc && !is_concurrent_sweep_running) {
     heap_->VerifyGC("Verifying after sweeping", kForbidMarked);
@@ -1350,7 +1465,7 @@ void PageSpace::SweepLarge() {
 
   GCSweeper sweeper;
   MutexLocker ml(&pages_lock_);
-  while (sweep_large_ != nullptr) {
+  while (sweep_large_ != nullptr && !abandon_sweeping_) {
     Page* page = sweep_large_;
     sweep_large_ = page->next();
     page->set_next(nullptr);
@@ -1386,7 +1501,7 @@ void PageSpace::Sweep(bool exclusive) {
   }
 
   MutexLocker ml(&pages_lock_);
-  while (sweep_regular_ != nullptr) {
+  while (sweep_regular_ != nullptr && !abandon_sweeping_) {
     Page* page = sweep_regular_;
     sweep_regular_ = page->next();
     page->set_next(nullptr);
@@ -1518,6 +1633,9 @@ void PageSpace::SetupImagePage(void* pointer, uword size, bool is_executable) {
 
   VirtualMemory* memory = VirtualMemory::ForImagePage(pointer, size);
   ASSERT(memory != nullptr);
+  // Fails harmlessly where the embedder's mapping doesn't support it, e.g.,
+  // file-backed mappings without read-only THP support.
+  VirtualMemory::AdviseHugePages(pointer, size);
   Page* page = reinterpret_cast<Page*>(malloc(sizeof(Page)));
   uword flags = Page::kImage;
   if (is_executable) {
@@ -1604,6 +1722,15 @@ void PageSpaceController::EvaluateGarbageCollection(SpaceUsage before,
   history_.AddGarbageCollectionTime(start, end);
   const int gc_time_fraction = history_.GarbageCollectionTimeFraction();
 
+  if (FLAG_old_gen_gc_cpu_target > 0 && FLAG_old_gen_gc_cpu_target < 100) {
+    intptr_t grow_heap = GrowthForCpuTarget(before, after, start, end);
+    last_usage_ = after;
+    last_gc_end_ = end;
+    RecordUpdate(before, after, grow_heap, "gc-cpu-target");
+    return;
+  }
+  last_gc_end_ = end;
+
   // Assume garbage increases linearly with allocation:
   // G = kA, and estimate k from the previous cycle.
   const intptr_t allocated_since_previous_gc =
@@ -1701,6 +1828,97 @@ void PageSpaceController::EvaluateGarbageCollection(SpaceUsage before,
   RecordUpdate(before, after, grow_heap, "gc");
 }
 
+intptr_t PageSpaceController::GrowthForCpuTarget(SpaceUsage before,
+                                                 SpaceUsage after,
+                                                 int64_t start,
+                                                 int64_t end) {
+  // Estimates are smoothed so a single unusual cycle doesn't swing the
+  // threshold.
+  const double kWeight = 0.5;
+  const double gc_micros = Utils::Maximum<int64_t>(1, end - start);
+  const double gc_throughput = before.CombinedUsedInWords() / gc_micros;
+  gc_throughput_ = (gc_throughput_ == 0.0)
+                       ? gc_throughput
+                       : (kWeight * gc_throughput_) +
+                             ((1.0 - kWeight) * gc_throughput);
+  const intptr_t allocated =
+      before.CombinedUsedInWords() - last_usage_.CombinedUsedInWords();
+  if ((last_gc_end_ != 0) && (start > last_gc_end_) && (allocated > 0)) {
+    const double allocation_rate =
+        allocated / static_cast<double>(start - last_gc_end_);
+    allocation_rate_ = (allocation_rate_ == 0.0)
+                           ? allocation_rate
+                           : (kWeight * allocation_rate_) +
+                                 ((1.0 - kWeight) * allocation_rate);
+  }
+
+  // The next GC is expected to cost (L + A) / T, where L is the usage after
+  // this GC, A the allocation budget and T the GC throughput, and the mutator
+  // to take A / R to allocate the budget, where R is the allocation rate.
+  // Solving cost / (cost + A / R) = f for A gives
+  //   A = L (1 - f) / T / (f / R - (1 - f) / T).
+  // The budget is capped at 4x the usage after GC so that a mutator with bursty
+  // allocation doesn't make the heap overshoot.
+  const double f = FLAG_old_gen_gc_cpu_target / 100.0;
+  const double live = after.CombinedUsedInWords();
+  const intptr_t max_growth_in_pages =
+      Utils::Maximum(static_cast<intptr_t>(heap_growth_max_),
+                     static_cast<intptr_t>(4 * live / kPageSizeInWords));
+  intptr_t growth_in_pages;
+  if (allocation_rate_ == 0.0) {
+    // No allocation rate measured yet.
+    growth_in_pages = heap_growth_max_;
+  } else {
+    const double denominator =
+        (f / allocation_rate_) - ((1.0 - f) / gc_throughput_);
+    if (denominator <= 0.0) {
+      // The GC cannot keep up with the target at any heap size.
+      growth_in_pages = max_growth_in_pages;
+    } else {
+      const double budget = (live * (1.0 - f) / gc_throughput_) / denominator;
+      growth_in_pages = static_cast<intptr_t>(Utils::Minimum(
+          budget / kPageSizeInWords, static_cast<double>(max_growth_in_pages)));
+    }
+  }
+  const intptr_t min_growth_in_pages = (2 * MB) / kPageSize;
+  growth_in_pages = Utils::Maximum(min_growth_in_pages, growth_in_pages);
+
+  intptr_t max_capacity_in_words = heap_->old_space()->max_capacity_in_words_;
+  if (max_capacity_in_words != 0) {
+    const intptr_t available_in_pages =
+        (max_capacity_in_words - after.CombinedUsedInWords()) /
+        kPageSizeInWords;
+    growth_in_pages = Utils::Maximum(
+        min_growth_in_pages, Utils::Minimum(growth_in_pages, available_in_pages));
+  }
+
+#if defined(SUPPORT_TIMELINE)
+  Thread* thread = Thread::Current();
+  if (thread != nullptr) {
+    TIMELINE_FUNCTION_GC_DURATION(thread, "GrowthForCpuTarget");
+    tbes.SetNumArguments(4);
+    tbes.FormatArgument(0, "Target (%)", "%" Pd "",
+                        static_cast<intptr_t>(FLAG_old_gen_gc_cpu_target));
+    tbes.FormatArgument(1, "GC Throughput (kB/ms)", "%.1f",
+                        gc_throughput_ * kWordSize);
+    tbes.FormatArgument(2, "Allocation Rate (kB/ms)", "%.1f",
+                        allocation_rate_ * kWordSize);
+    tbes.FormatArgument(3, "Growth (kB)", "%" Pd "",
+                        growth_in_pages * (kPageSize / KB));
+  }
+#endif
+
+  if (FLAG_log_growth || FLAG_verbose_gc) {
+    THR_Print("%s: gc_throughput=%.1fkB/ms, allocation_rate=%.1fkB/ms, "
+              "growth=%" Pd "MB\n",
+              heap_->isolate_group()->source()->name,
+              gc_throughput_ * kWordSize, allocation_rate_ * kWordSize,
+              growth_in_pages * kPageSize / MB);
+  }
+
+  return growth_in_pages;
+}
+
 void PageSpaceController::EvaluateAfterLoading(SpaceUsage after) {
   // Number of pages we can allocate and still be within the desired growth
   // ratio.
@@ -84,6 +84,14 @@ class PageSpaceController {
  private:
   friend class PageSpace;  // For MergeOtherPageSpaceController
 
+  // Returns the growth in pages that keeps the fraction of time spent in
+  // old-space GC near --old_gen_gc_cpu_target, based on the measured GC
+  // throughput and mutator allocation rate.
+  intptr_t GrowthForCpuTarget(SpaceUsage before,
+                              SpaceUsage after,
+                              int64_t start,
+                              int64_t end);
+
   void RecordUpdate(SpaceUsage before, SpaceUsage after, const char* reason);
   void RecordUpdate(SpaceUsage before,
                     SpaceUsage after,
@@ -121,6 +129,12 @@ class PageSpaceController {
 
   PageSpaceGarbageCollectionHistory history_;
 
+  // Smoothed estimates used by the GC CPU target mode, in words per
+  // microsecond. Zero until the first measurement.
+  double gc_throughput_ = 0.0;
+  double allocation_rate_ = 0.0;
+  int64_t last_gc_end_ = 0;
+
   DISALLOW_IMPLICIT_CONSTRUCTORS(PageSpaceController);
 };
 
@@ -147,6 +161,31 @@ class PageSpace {
         size, &freelists_[is_executable ? kExecutableFreelist : kDataFreelist],
         is_executable, growth_policy, is_protected, is_locked);
   }
+  // Allocates small data objects from the thread's FreeListCache, refilling
+  // it from the data freelist in bulk.
+  DART_FORCE_INLINE
+  uword TryAllocateCached(Thread* thread, intptr_t size) {
+    if (FreeListCache::IsCachedSize(size)) {
+      FreeListCache* cache = thread->old_space_cache();
+      const intptr_t index = FreeListCache::IndexForSize(size);
+      FreeListElement* element = cache->lists_[index];
+      if (LIKELY(element != nullptr)) {
+        cache->lists_[index] = element->next();
+        cache->cached_bytes_ -= size;
+        return reinterpret_cast<uword>(element);
+      }
+      uword result = TryRefillCache(thread, size);
+      if (result != 0) {
+        return result;
+      }
+    }
+    return TryAllocate(size);
+  }
+  // Returns the elements cached by 'thread' to the data freelist.
+  void ReleaseCache(Thread* thread);
+  // Returns the elements cached by all threads. Must be at a safepoint.
+  void ReleaseCaches();
+
   DART_FORCE_INLINE
   uword TryAllocatePromoLocked(FreeList* freelist, intptr_t size) {
     if (LIKELY(IsAllocatableViaFreeLists(size))) {
@@ -335,6 +374,24 @@ class PageSpace {
     DEBUG_ASSERT(tasks_lock_.IsOwnedByCurrentThread());
     concurrent_marker_tasks_active_ = val;
   }
+  intptr_t concurrent_sweeper_tasks() const {
+    DEBUG_ASSERT(tasks_lock_.IsOwnedByCurrentThread());
+    return concurrent_sweeper_tasks_;
+  }
+  void set_concurrent_sweeper_tasks(intptr_t val) {
+    ASSERT(val >= 0);
+    DEBUG_ASSERT(tasks_lock_.IsOwnedByCurrentThread());
+    concurrent_sweeper_tasks_ = val;
+  }
+  intptr_t concurrent_sweeper_tasks_large() const {
+    DEBUG_ASSERT(tasks_lock_.IsOwnedByCurrentThread());
+    return concurrent_sweeper_tasks_large_;
+  }
+  void set_concurrent_sweeper_tasks_large(intptr_t val) {
+    ASSERT(val >= 0);
+    DEBUG_ASSERT(tasks_lock_.IsOwnedByCurrentThread());
+    concurrent_sweeper_tasks_large_ = val;
+  }
   bool pause_concurrent_marking() const {
     return pause_concurrent_marking_.load() != 0;
   }
@@ -347,6 +404,9 @@ class PageSpace {
   void ReleaseBumpAllocation();
   // Have threads release marking stack blocks, etc.
   void AbandonMarkingForShutdown();
+  // Have concurrent sweepers stop after their current page. The pages not yet
+  // swept are freed wholesale by the destructor.
+  void AbandonSweepingForShutdown() { abandon_sweeping_ = true; }
 
   bool enable_concurrent_mark() const { return enable_concurrent_mark_; }
   void set_enable_concurrent_mark(bool enable_concurrent_mark) {
@@ -393,6 +453,8 @@ class PageSpace {
                                     bool is_executable,
                                     GrowthPolicy growth_policy);
 
+  uword TryRefillCache(Thread* thread, intptr_t size);
+
   // Attempt to allocate from bump block rather than normal freelist.
   uword TryAllocateDataBumpLocked(FreeList* freelist, intptr_t size);
   uword TryAllocatePromoLockedSlow(FreeList* freelist, intptr_t size);
@@ -464,6 +526,7 @@ class PageSpace {
   Page* image_pages_ = nullptr;
   Page* sweep_regular_ = nullptr;
   Page* sweep_large_ = nullptr;
+  RelaxedAtomic<bool> abandon_sweeping_ = {false};
 
   // Various sizes being tracked for this generation.
   intptr_t max_capacity_in_words_;
@@ -478,6 +541,10 @@ class PageSpace {
   intptr_t tasks_;
   intptr_t concurrent_marker_tasks_;
   intptr_t concurrent_marker_tasks_active_;
+  // Sweeper tasks that are still running, and that have not yet finished
+  // sweeping large pages.
+  intptr_t concurrent_sweeper_tasks_;
+  intptr_t concurrent_sweeper_tasks_large_;
   AcqRelAtomic<uword> pause_concurrent_marking_;
   Phase phase_;
 
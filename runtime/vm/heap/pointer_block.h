@@ -7,6 +7,7 @@
 
 #include "platform/assert.h"
 #include "vm/globals.h"
+#include "vm/heap/work_stealing_deque.h"
 #include "vm/os_thread.h"
 #include "vm/tagged_pointer.h"
 
@@ -283,6 +284,131 @@ class BlockWorkList : public ValueObject {
   Stack* stack_;
 };
 
+// A BlockWorkList whose full blocks are published to a per-worker
+// WorkStealingDeque instead of the shared stack, so idle workers can take them
+// without contending on the stack's monitor. The shared stack only receives
+// blocks that overflow the deque.
+template <typename Stack>
+class StealingBlockWorkList : public ValueObject {
+ public:
+  typedef typename Stack::Block Block;
+
+  explicit StealingBlockWorkList(Stack* stack) : stack_(stack) {
+    local_output_ = stack_->PopEmptyBlock();
+    local_input_ = stack_->PopEmptyBlock();
+  }
+
+  ~StealingBlockWorkList() {
+    ASSERT(local_output_ == nullptr);
+    ASSERT(local_input_ == nullptr);
+    ASSERT(stack_ == nullptr);
+  }
+
+  // Returns false if no more local or shared work was found.
+  DART_FORCE_INLINE
+  bool Pop(ObjectPtr* object) {
+    ASSERT(local_input_ != nullptr);
+    if (UNLIKELY(local_input_->IsEmpty())) {
+      if (!local_output_->IsEmpty()) {
+        auto temp = local_output_;
+        local_output_ = local_input_;
+        local_input_ = temp;
+      } else {
+        Block* new_work = nullptr;
+        if (!deque_.Pop(&new_work)) {
+          new_work = stack_->PopNonEmptyBlock();
+          if (new_work == nullptr) {
+            return false;
+          }
+        }
+        ReplaceInput(new_work);
+      }
+    }
+    *object = local_input_->Pop();
+    return true;
+  }
+
+  void Push(ObjectPtr raw_obj) {
+    if (UNLIKELY(local_output_->IsFull())) {
+      if (!deque_.Push(local_output_)) {
+        stack_->PushBlock(local_output_);
+      }
+      local_output_ = stack_->PopEmptyBlock();
+    }
+    local_output_->Push(raw_obj);
+  }
+
+  // Takes the oldest published block from another worker's deque. Returns
+  // false if the victim had nothing to steal or lost the race for it.
+  bool StealFrom(StealingBlockWorkList* victim) {
+    ASSERT(local_input_->IsEmpty());
+    Block* new_work = nullptr;
+    if (!victim->deque_.Steal(&new_work)) {
+      return false;
+    }
+    ReplaceInput(new_work);
+    return true;
+  }
+
+  // Takes a block that overflowed into the shared stack.
+  bool TakeShared() {
+    ASSERT(local_input_->IsEmpty());
+    Block* new_work = stack_->PopNonEmptyBlock();
+    if (new_work == nullptr) {
+      return false;
+    }
+    ReplaceInput(new_work);
+    return true;
+  }
+
+  void Finalize() {
+    ASSERT(deque_.IsEmpty());
+    ASSERT(local_output_->IsEmpty());
+    stack_->PushBlock(local_output_);
+    local_output_ = nullptr;
+    ASSERT(local_input_->IsEmpty());
+    stack_->PushBlock(local_input_);
+    local_input_ = nullptr;
+    // Fail fast on attempts to push after finalizing.
+    stack_ = nullptr;
+  }
+
+  void AbandonWork() {
+    Block* block;
+    while (deque_.Pop(&block)) {
+      stack_->PushBlock(block);
+    }
+    stack_->PushBlock(local_output_);
+    local_output_ = nullptr;
+    stack_->PushBlock(local_input_);
+    local_input_ = nullptr;
+    stack_ = nullptr;
+  }
+
+  bool IsLocalEmpty() {
+    return local_input_->IsEmpty() && local_output_->IsEmpty() &&
+           deque_.IsEmpty();
+  }
+
+  bool IsEmpty() { return IsLocalEmpty() && stack_->IsEmpty(); }
+
+ private:
+  void ReplaceInput(Block* new_work) {
+    ASSERT(local_input_->IsEmpty());
+    stack_->PushBlock(local_input_);
+    local_input_ = new_work;
+  }
+
+  static constexpr intptr_t kDequeCapacityLog2 = 10;
+
+  Block* local_output_;
+  Block* local_input_;
+  Stack* stack_;
+  WorkStealingDeque<Block*, kDequeCapacityLog2> deque_;
+
+  DISALLOW_COPY_AND_ASSIGN(StealingBlockWorkList);
+};
+
 static constexpr int kStoreBufferBlockSize = 1024;
 class StoreBuffer : public BlockStack<kStoreBufferBlockSize> {
  public:
@@ -326,7 +452,7 @@ class PromotionStack : public BlockStack<kPromotionStackBlockSize> {
 };
 
 typedef PromotionStack::Block PromotionStackBlock;
-typedef BlockWorkList<PromotionStack> PromotionWorkList;
+typedef StealingBlockWorkList<PromotionStack> PromotionWorkList;
 
 template <int Size, typename T>
 class LocalBlockWorkList : public ValueObject {
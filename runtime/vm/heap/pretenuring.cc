@@ -0,0 +1,141 @@
+// Copyright (c) 2024, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+#include "vm/heap/pretenuring.h"
+
+#include <new>
+
+#include "vm/class_id.h"
+#include "vm/class_table.h"
+#include "vm/flags.h"
+#include "vm/isolate.h"
+#include "vm/lockers.h"
+#include "vm/log.h"
+#include "vm/object.h"
+#include "vm/thread.h"
+
+namespace dart {
+
+DEFINE_FLAG(int,
+            pretenuring_threshold,
+            0,
+            "Allocate instances of a class directly in old space when at least "
+            "this percentage of its scavenge survivors survive a second "
+            "scavenge (0 disables pretenuring).");
+DEFINE_FLAG(bool, trace_pretenuring, false, "Trace pretenuring decisions.");
+
+Pretenuring::Pretenuring(IsolateGroup* isolate_group)
+    : isolate_group_(isolate_group) {}
+
+Pretenuring::~Pretenuring() {}
+
+bool Pretenuring::IsEnabled() {
+#if defined(DART_PRECOMPILED_RUNTIME)
+  // AOT allocation stubs cannot be regenerated.
+  return false;
+#else
+  return FLAG_pretenuring_threshold > 0;
+#endif
+}
+
+bool Pretenuring::IsCandidate(intptr_t cid) {
+  return cid >= kNumPredefinedCids;
+}
+
+bool Pretenuring::ShouldAllocateOld(intptr_t cid) {
+  if (!IsPretenured(cid)) {
+    return false;
+  }
+  // Keep a trickle of instances in new space so the scavenger can tell when
+  // the prediction stops holding.
+  return (states_[cid].allocation_count.fetch_add(1) % kProbeInterval) != 0;
+}
+
+void Pretenuring::EnsureLength(intptr_t num_cids) {
+  const intptr_t old_length = states_.length();
+  if (num_cids <= old_length) {
+    return;
+  }
+  states_.Resize(num_cids);
+  for (intptr_t i = old_length; i < num_cids; i++) {
+    new (&states_[i]) State();
+  }
+}
+
+void Pretenuring::Update(const intptr_t* copied_bytes,
+                         const intptr_t* promoted_bytes,
+                         intptr_t num_cids) {
+  EnsureLength(num_cids);
+  const intptr_t threshold = FLAG_pretenuring_threshold;
+  for (intptr_t cid = kNumPredefinedCids; cid < num_cids; cid++) {
+    State* state = &states_[cid];
+    const intptr_t candidates = state->copied_bytes;
+    state->copied_bytes = copied_bytes[cid];
+
+    // While pretenured, only the probes are measured.
+    const intptr_t min_sample =
+        state->pretenured ? kMinSampleBytes / kProbeInterval : kMinSampleBytes;
+    if (candidates < min_sample) {
+      continue;
+    }
+    // Objects promoted now were (mostly) those copied by the previous
+    // scavenge, so this approximates their rate of surviving a second time.
+    const intptr_t survival = Utils::Minimum(
+        static_cast<intptr_t>(100), promoted_bytes[cid] * 100 / candidates);
+    bool change;
+    if (state->pretenured) {
+      change = survival < (threshold / 2);
+    } else {
+      change = survival >= threshold;
+    }
+    if (!change) {
+      continue;
+    }
+    state->pretenured = !state->pretenured;
+    if (FLAG_trace_pretenuring) {
+      THR_Print("%s pretenuring cid %" Pd " (%" Pd "%% of %" Pd
+                " bytes survived)\n",
+                state->pretenured ? "Start" : "Stop", cid, survival,
+                candidates);
+    }
+    MutexLocker ml(&pending_lock_);
+    pending_cids_.Add(cid);
+    has_pending_changes_ = true;
+  }
+}
+
+void Pretenuring::Reset() {
+  for (intptr_t cid = 0; cid < states_.length(); cid++) {
+    states_[cid].copied_bytes = 0;
+  }
+}
+
+void Pretenuring::ApplyPendingChanges(Thread* thread) {
+#if !defined(DART_PRECOMPILED_RUNTIME)
+  ASSERT(thread->IsDartMutatorThread());
+  MallocGrowableArray<intptr_t> cids;
+  {
+    MutexLocker ml(&pending_lock_);
+    if (!has_pending_changes_) return;
+    for (intptr_t i = 0; i < pending_cids_.length(); i++) {
+      cids.Add(pending_cids_[i]);
+    }
+    pending_cids_.Clear();
+    has_pending_changes_ = false;
+  }
+
+  HANDLESCOPE(thread);
+  ClassTable* class_table = isolate_group_->class_table();
+  Class& cls = Class::Handle(thread->zone());
+  for (intptr_t i = 0; i < cids.length(); i++) {
+    const intptr_t cid = cids[i];
+    if (!class_table->HasValidClassAt(cid)) continue;
+    cls = class_table->At(cid);
+    // The next allocation regenerates the stub, consulting IsPretenured.
+    cls.DisableAllocationStub();
+  }
+#endif  // !defined(DART_PRECOMPILED_RUNTIME)
+}
+
+}  // namespace dart
@@ -0,0 +1,102 @@
+// Copyright (c) 2024, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+#ifndef RUNTIME_VM_HEAP_PRETENURING_H_
+#define RUNTIME_VM_HEAP_PRETENURING_H_
+
+#include "platform/atomic.h"
+#include "platform/growable_array.h"
+#include "vm/allocation.h"
+#include "vm/globals.h"
+#include "vm/os_thread.h"
+
+namespace dart {
+
+class IsolateGroup;
+class Thread;
+
+// Per-class survival feedback gathered by the scavenger, used to allocate
+// instances of classes whose objects are nearly always long-lived directly in
+// old space instead of copying and then promoting them.
+//
+// A class becomes pretenured when at least --pretenuring_threshold percent of
+// the bytes that survived their first scavenge also survive their second one.
+// A pretenured class is still allocated in new space every kProbeInterval-th
+// time so its survival rate keeps being measured; it reverts to new-space
+// allocation when that rate drops below half the threshold.
+//
+// Decisions are made by the scavenger at a safepoint. They take effect for
+// generated code once a mutator calls ApplyPendingChanges, which disables the
+// affected allocation stubs so they are regenerated with or without the inline
+// new-space fast path.
+class Pretenuring {
+ public:
+  explicit Pretenuring(IsolateGroup* isolate_group);
+  ~Pretenuring();
+
+  static bool IsEnabled();
+
+  // Classes below this id are not allocated through per-class allocation stubs
+  // and are not considered.
+  static bool IsCandidate(intptr_t cid);
+
+  // Mutator side: whether a runtime allocation of an instance of 'cid' should
+  // go to old space.
+  bool ShouldAllocateOld(intptr_t cid);
+
+  // Whether 'cid' is currently pretenured. Used when generating its allocation
+  // stub.
+  bool IsPretenured(intptr_t cid) const {
+    return (cid < states_.length()) && states_[cid].pretenured;
+  }
+
+  // Scavenger side. Called at a safepoint after a successful scavenge with the
+  // bytes per class id that were copied within new space and promoted.
+  // 'num_cids' is the length of both arrays.
+  void Update(const intptr_t* copied_bytes,
+              const intptr_t* promoted_bytes,
+              intptr_t num_cids);
+
+  // Forgets the bytes copied by the last scavenge, e.g. because the next
+  // scavenge promotes all survivors and so measures nothing.
+  void Reset();
+
+  bool HasPendingChanges() const { return has_pending_changes_.load(); }
+
+  // Mutator side. Disables the allocation stubs of classes whose pretenuring
+  // decision changed.
+  void ApplyPendingChanges(Thread* thread);
+
+  // Only sample 1 / kProbeInterval allocations of a pretenured class into new
+  // space.
+  static constexpr intptr_t kProbeInterval = 8;
+
+  // Classes with fewer first-survivor bytes than this are not considered, to
+  // avoid acting on noise.
+  static constexpr intptr_t kMinSampleBytes = 256 * KB;
+
+ private:
+  struct State {
+    bool pretenured = false;
+    // Bytes of this class copied within new space by the last scavenge, i.e.
+    // objects that are now candidates for promotion.
+    intptr_t copied_bytes = 0;
+    RelaxedAtomic<uintptr_t> allocation_count = {0};
+  };
+
+  void EnsureLength(intptr_t num_cids);
+
+  IsolateGroup* isolate_group_;
+  MallocGrowableArray<State> states_;
+
+  Mutex pending_lock_;
+  MallocGrowableArray<intptr_t> pending_cids_;
+  RelaxedAtomic<bool> has_pending_changes_ = {false};
+
+  DISALLOW_COPY_AND_ASSIGN(Pretenuring);
+};
+
+}  // namespace dart
+
+#endif  // RUNTIME_VM_HEAP_PRETENURING_H_
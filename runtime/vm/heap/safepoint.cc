@@ -7,6 +7,7 @@
 #include "vm/heap/heap.h"
 #include "vm/thread.h"
 #include "vm/thread_registry.h"
+#include "vm/timeline.h"
 
 namespace dart {
 
@@ -82,6 +83,8 @@ void SafepointHandler::SafepointThreads(Thread* T, SafepointLevel level) {
   ASSERT(T->current_safepoint_level() >= level);
 
   MallocGrowableArray<Dart_Port> oob_isolates;
+  int64_t start = 0;
+  intptr_t num_threads_to_wait_for = 0;
   {
     MonitorLocker tl(threads_lock());
 
@@ -119,7 +122,9 @@ void SafepointHandler::SafepointThreads(Thread* T, SafepointLevel level) {
     handlers_[level]->SetSafepointInProgress(T);
 
     // Ensure a thread is at a safepoint or notify it to get to one.
-    handlers_[level]->NotifyThreadsToGetToSafepointLevel(T, &oob_isolates);
+    start = OS::GetCurrentMonotonicMicros();
+    num_threads_to_wait_for =
+        handlers_[level]->NotifyThreadsToGetToSafepointLevel(T, &oob_isolates);
   }
 
   for (auto main_port : oob_isolates) {
@@ -130,6 +135,10 @@ void SafepointHandler::SafepointThreads(Thread* T, SafepointLevel level) {
   // Now wait for all threads that are not already at a safepoint to check-in.
   handlers_[level]->WaitUntilThreadsReachedSafepointLevel();
 
+  if (num_threads_to_wait_for > 0) {
+    ReportTimeToSafepoint(level, start, num_threads_to_wait_for);
+  }
+
   // No other mutator is running at this point. We'll set ourselves as owners of
   // all the lower levels as well - since higher levels provide even more
   // guarantees that lower levels (e.g. others being stopped at places where
@@ -159,10 +168,57 @@ void SafepointHandler::AssertWeDoNotOwnLowerLevelSafepoints(
   }
 }
 
-void SafepointHandler::LevelHandler::NotifyThreadsToGetToSafepointLevel(
+void SafepointHandler::ReportTimeToSafepoint(SafepointLevel level,
+                                             int64_t start,
+                                             intptr_t num_threads) {
+  const char* last_parked_thread = handlers_[level]->last_parked_thread_;
+  const char* level_name = SafepointLevelToCString(level);
+  const int64_t end = OS::GetCurrentMonotonicMicros();
+  isolate_group_->GetTimeToSafepointMetric()->Add(end - start);
+  if (FLAG_trace_safepoint) {
+    OS::PrintErr("Safepoint (%s) reached in %" Pd64 " us, waited for %" Pd
+                 " threads, last to check in: %s\n",
+                 level_name, end - start, num_threads,
+                 last_parked_thread[0] != '\0' ? last_parked_thread : "-");
+  }
+#if defined(SUPPORT_TIMELINE)
+  TimelineStream* stream = Timeline::GetGCStream();
+  ASSERT(stream != nullptr);
+  // Threads cannot check in while recording an event, so this cannot wait for
+  // a parked thread.
+  TimelineEvent* event = stream->StartEvent();
+  if (event != nullptr) {
+    event->Duration("SafepointThreads", start, end);
+    event->SetNumArguments(3);
+    event->CopyArgument(0, "level", level_name);
+    event->FormatArgument(1, "threads", "%" Pd, num_threads);
+    event->CopyArgument(2, "lastToCheckIn", last_parked_thread);
+    event->Complete();
+  }
+#endif  // defined(SUPPORT_TIMELINE)
+}
+
+const char* SafepointHandler::SafepointLevelToCString(SafepointLevel level) {
+  switch (level) {
+    case SafepointLevel::kGC:
+      return "GC";
+    case SafepointLevel::kGCAndDeopt:
+      return "GCAndDeopt";
+    case SafepointLevel::kGCAndDeoptAndReload:
+      return "GCAndDeoptAndReload";
+    default:
+      UNREACHABLE();
+      return nullptr;
+  }
+}
+
+intptr_t SafepointHandler::LevelHandler::NotifyThreadsToGetToSafepointLevel(
     Thread* T,
     MallocGrowableArray<Dart_Port>* oob_isolates) {
   ASSERT(num_threads_not_parked_ == 0);
+  last_parked_thread_[0] = '\0';
+  num_threads_not_parked_ = 1;
+  intptr_t num_threads = 0;
   for (auto current = isolate_group()->thread_registry()->active_list();
        current != nullptr; current = current->next()) {
     MonitorLocker tl(current->thread_lock());
@@ -189,11 +245,14 @@ void SafepointHandler::LevelHandler::NotifyThreadsToGetToSafepointLevel(
             current->ScheduleInterrupts(Thread::kVMInterrupt);
           }
         }
-        MonitorLocker sl(&parked_lock_);
-        num_threads_not_parked_++;
+        // The thread cannot check in before we release its lock.
+        num_threads_not_parked_.fetch_add(1, std::memory_order_relaxed);
+        num_threads++;
       }
     }
   }
+  DecrementThreadsNotParked(nullptr);
+  return num_threads;
 }
 
 void SafepointHandler::ResumeThreads(Thread* T, SafepointLevel level) {
@@ -348,12 +407,28 @@ void SafepointHandler::EnterSafepointLocked(Thread* T,
 
 void SafepointHandler::LevelHandler::NotifyWeAreParked(Thread* T) {
   ASSERT(owner_ != nullptr);
+  DecrementThreadsNotParked(T);
+}
+
+void SafepointHandler::LevelHandler::DecrementThreadsNotParked(Thread* T) {
+  int32_t count = num_threads_not_parked_.load(std::memory_order_relaxed);
+  while (count > 1) {
+    if (num_threads_not_parked_.compare_exchange_weak(
+            count, count - 1, std::memory_order_acq_rel)) {
+      return;
+    }
+  }
+  // We hold the last count, which nobody else can take. Drop it while holding
+  // [parked_lock_] so the waiting thread sees [last_parked_thread_].
+  ASSERT(count == 1);
   MonitorLocker sl(&parked_lock_);
-  ASSERT(num_threads_not_parked_ > 0);
-  num_threads_not_parked_ -= 1;
-  if (num_threads_not_parked_ == 0) {
-    sl.Notify();
+  if (T != nullptr) {
+    const char* name = T->os_thread()->name();
+    Utils::SNPrint(last_parked_thread_, sizeof(last_parked_thread_), "%s",
+                   name != nullptr ? name : "<unnamed>");
   }
+  num_threads_not_parked_.store(0, std::memory_order_release);
+  sl.Notify();
 }
 
 void SafepointHandler::ExitSafepointLocked(Thread* T,
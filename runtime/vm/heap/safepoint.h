@@ -151,10 +151,13 @@ class SafepointHandler {
     friend class SafepointHandler;
 
     // Helper methods for [SafepointThreads]
-    void NotifyThreadsToGetToSafepointLevel(
+    //
+    // Returns the number of threads which were not at a safepoint yet.
+    intptr_t NotifyThreadsToGetToSafepointLevel(
         Thread* T,
         MallocGrowableArray<Dart_Port>* oob_isolates);
     void WaitUntilThreadsReachedSafepointLevel();
+    void DecrementThreadsNotParked(Thread* T);
 
     // Helper methods for [ResumeThreads]
     void NotifyThreadsToContinue(Thread* T);
@@ -162,8 +165,9 @@ class SafepointHandler {
     IsolateGroup* isolate_group_;
     SafepointLevel level_;
 
-    // Monitor used by thread initiating a safepoint operation to track threads
-    // not at a safepoint and wait for these threads to reach a safepoint.
+    // Monitor used by thread initiating a safepoint operation to wait for
+    // threads to reach a safepoint. Only the thread which checks in last takes
+    // it.
     Monitor parked_lock_;
 
     // If a safepoint operation is currently in progress, this field contains
@@ -175,8 +179,14 @@ class SafepointHandler {
     std::atomic<int32_t> operation_count_ = 0;
 
     // Count the number of threads the currently in-progress safepoint operation
-    // is waiting for to check-in.
-    int32_t num_threads_not_parked_ = 0;
+    // is waiting for to check-in. While the initiating thread notifies the
+    // other threads it holds one extra count, so that it does not drop to zero
+    // before all of them were asked to check in.
+    std::atomic<int32_t> num_threads_not_parked_ = 0;
+
+    // Name of the thread which checked in last, if the initiating thread had
+    // to wait for it. Protected by [parked_lock_].
+    char last_parked_thread_[64] = {};
   };
 
   void SafepointThreads(Thread* T, SafepointLevel level);
@@ -190,6 +200,12 @@ class SafepointHandler {
   // Helper methods for [ResumeThreads]
   void ReleaseLowerLevelSafepoints(Thread* T, SafepointLevel level);
 
+  // Reports the time it took to bring [num_threads] threads to a safepoint.
+  void ReportTimeToSafepoint(SafepointLevel level,
+                             int64_t start,
+                             intptr_t num_threads);
+  static const char* SafepointLevelToCString(SafepointLevel level);
+
   void EnterSafepointLocked(Thread* T, MonitorLocker* tl, SafepointLevel level);
   void ExitSafepointLocked(Thread* T, MonitorLocker* tl, SafepointLevel level);
 
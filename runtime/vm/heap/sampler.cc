@@ -7,14 +7,17 @@
 #include <math.h>
 #include <algorithm>
 
+#include "vm/flags.h"
 #include "vm/heap/safepoint.h"
 #include "vm/heap/sampler.h"
 #include "vm/isolate.h"
 #include "vm/lockers.h"
 #include "vm/os.h"
+#include "vm/profiler.h"
 #include "vm/random.h"
 #include "vm/thread.h"
 #include "vm/thread_registry.h"
+#include "vm/timeline.h"
 
 #define ASSERT_TLAB_BOUNDARIES_VALID(__thread)                                 \
   do {                                                                         \
@@ -34,6 +37,17 @@
 
 namespace dart {
 
+DEFINE_FLAG(bool,
+            heap_sampling_profile,
+            false,
+            "Record the Dart stack of each sampled allocation in the CPU "
+            "profiler's sample buffer, where getAllocationTraces reports it, "
+            "and count the sampled bytes on the GC timeline stream.");
+DEFINE_FLAG(int,
+            heap_sampling_interval,
+            512 * KB,
+            "The mean number of bytes allocated between heap samples.");
+
 bool HeapProfileSampler::enabled_ = false;
 Dart_HeapSamplingCreateCallback HeapProfileSampler::create_callback_ = nullptr;
 Dart_HeapSamplingDeleteCallback HeapProfileSampler::delete_callback_ = nullptr;
@@ -44,6 +58,18 @@ intptr_t HeapProfileSampler::sampling_interval_ =
 HeapProfileSampler::HeapProfileSampler(Thread* thread)
     : interval_to_next_sample_(kUninitialized), thread_(thread) {}
 
+void HeapProfileSampler::Init() {
+  if (FLAG_heap_sampling_interval > 0) {
+    sampling_interval_ = FLAG_heap_sampling_interval;
+  }
+#if !defined(PRODUCT)
+  if (FLAG_heap_sampling_profile) {
+    // Threads pick up the enabled state at their next interrupt check.
+    enabled_ = true;
+  }
+#endif
+}
+
 void HeapProfileSampler::Enable(bool enabled) {
   // Don't try and change enabled state if sampler instances are currently
   // doing work.
@@ -199,13 +225,34 @@ void HeapProfileSampler::HandleNewTLAB(intptr_t old_tlab_remaining_space,
 
 void* HeapProfileSampler::InvokeCallbackForLastSample(intptr_t cid) {
   ASSERT(enabled_);
-  ASSERT(create_callback_ != nullptr);
   ReadRwLocker locker(thread_, lock_);
-  ClassTable* table = IsolateGroup::Current()->class_table();
-  void* result = create_callback_(
-      reinterpret_cast<Dart_Isolate>(thread_->isolate()),
-      reinterpret_cast<Dart_IsolateGroup>(thread_->isolate_group()),
-      table->UserVisibleNameFor(cid), last_sample_size_);
+#if !defined(PRODUCT)
+  if (FLAG_heap_sampling_profile && (thread_->isolate() != nullptr)) {
+    Profiler::SampleAllocation(thread_, cid, /*identity_hash=*/0,
+                               last_sample_size_);
+#if defined(SUPPORT_TIMELINE)
+    static RelaxedAtomic<int64_t> sampled_bytes = 0;
+    const int64_t total = sampled_bytes.fetch_add(last_sample_size_) +
+                          last_sample_size_;
+    TimelineStream* stream = Timeline::GetGCStream();
+    TimelineEvent* event = stream->StartEvent();
+    if (event != nullptr) {
+      event->Counter("SampledAllocations");
+      event->SetNumArguments(1);
+      event->FormatArgument(0, "bytes", "%" Pd64 "", total);
+      event->Complete();
+    }
+#endif  // defined(SUPPORT_TIMELINE)
+  }
+#endif  // !defined(PRODUCT)
+  void* result = nullptr;
+  if (create_callback_ != nullptr) {
+    ClassTable* table = IsolateGroup::Current()->class_table();
+    result = create_callback_(
+        reinterpret_cast<Dart_Isolate>(thread_->isolate()),
+        reinterpret_cast<Dart_IsolateGroup>(thread_->isolate_group()),
+        table->UserVisibleNameFor(cid), last_sample_size_);
+  }
   last_sample_size_ = kUninitialized;
   return result;
 }
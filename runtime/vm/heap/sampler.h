@@ -29,6 +29,10 @@ class HeapProfileSampler {
  public:
   explicit HeapProfileSampler(Thread* thread);
 
+  // Applies --heap_sampling_profile and --heap_sampling_interval. Called once
+  // during VM initialization, before any mutator threads exist.
+  static void Init();
+
   // Enables or disables heap profiling for all threads.
   //
   // NOTE: the enabled state will update on a thread-by-thread basis once
@@ -119,6 +123,9 @@ class HeapProfileSampler {
   // allocations.
   void HandleNewTLAB(intptr_t old_tlab_remaining_space, bool is_first_tlab);
 
+  // Reports the last sample to the embedder's callback, if any, and to the
+  // built-in allocation profile when --heap_sampling_profile is set. Returns
+  // the callback's result, or nullptr.
   void* InvokeCallbackForLastSample(intptr_t cid);
 
   bool HasOutstandingSample() const {
@@ -15,8 +15,10 @@
 #include "vm/heap/become.h"
 #include "vm/heap/gc_shared.h"
 #include "vm/heap/marker.h"
+#include "vm/heap/numa.h"
 #include "vm/heap/pages.h"
 #include "vm/heap/pointer_block.h"
+#include "vm/heap/pretenuring.h"
 #include "vm/heap/safepoint.h"
 #include "vm/heap/verifier.h"
 #include "vm/heap/weak_table.h"
@@ -46,6 +48,16 @@ DEFINE_FLAG(int,
             90,
             "Grow new gen when less than this percentage is garbage.");
 DEFINE_FLAG(int, new_gen_growth_factor, 2, "Grow new gen by this factor.");
+DEFINE_FLAG(bool,
+            prune_store_buffer,
+            false,
+            "Drop store buffer entries that no longer point into new space in "
+            "short pauses outside of scavenges (store buffer overflow, idle "
+            "time), shortening the root scan of the next scavenge.");
+
+// Number of fruitless passes over the other workers' deques an idle scavenger
+// task makes before it starts sleeping between attempts.
+static constexpr intptr_t kStealSpinRounds = 1000;
 
 // Scavenger uses the kCardRememberedBit to distinguish forwarded and
 // non-forwarded objects. We must choose a bit that is clear for all new-space
@@ -145,7 +157,11 @@ class ScavengerVisitorBase : public ObjectPointerVisitor,
         visiting_old_object_(nullptr),
         pending_(nullptr),
         promoted_list_(promotion_stack) {}
-  ~ScavengerVisitorBase() { ASSERT(pending_ == nullptr); }
+  ~ScavengerVisitorBase() {
+    ASSERT(pending_ == nullptr);
+    free(copied_by_cid_);
+    free(promoted_by_cid_);
+  }
 
 #ifdef DEBUG
   constexpr static const char* const kName = "Scavenger";
@@ -332,8 +348,44 @@ class ScavengerVisitorBase : public ObjectPointerVisitor,
            !promoted_list_.IsEmpty();
   }
 
+  // Called by an idle parallel worker. Steals promoted work from the other
+  // workers until some is found (returns true) or every worker is idle
+  // (returns false).
   bool WaitForWork(RelaxedAtomic<uintptr_t>* num_busy) {
-    return promoted_list_.WaitForWork(num_busy, scavenger_->abort_);
+    ASSERT(parallel);
+    const int64_t start = OS::GetCurrentMonotonicMicros();
+    const bool found = StealWork(num_busy);
+    idle_micros_ += OS::GetCurrentMonotonicMicros() - start;
+    return found;
+  }
+
+  void set_peers(ScavengerVisitorBase<parallel>** peers,
+                 intptr_t num_peers,
+                 intptr_t index) {
+    peers_ = peers;
+    num_peers_ = num_peers;
+    next_victim_ = index + 1;
+  }
+  intptr_t steals() const { return steals_; }
+  int64_t idle_micros() const { return idle_micros_; }
+
+  // Count surviving bytes per class id for pretenuring feedback.
+  void TrackSurvivalByClass(intptr_t num_cids) {
+    ASSERT(copied_by_cid_ == nullptr);
+    num_tracked_cids_ = num_cids;
+    copied_by_cid_ =
+        reinterpret_cast<intptr_t*>(calloc(num_cids, sizeof(intptr_t)));
+    promoted_by_cid_ =
+        reinterpret_cast<intptr_t*>(calloc(num_cids, sizeof(intptr_t)));
+  }
+
+  // Adds this worker's survival counts to the given arrays.
+  void AccumulateSurvivalByClass(intptr_t* copied_by_cid,
+                                 intptr_t* promoted_by_cid) const {
+    for (intptr_t i = 0; i < num_tracked_cids_; i++) {
+      copied_by_cid[i] += copied_by_cid_[i];
+      promoted_by_cid[i] += promoted_by_cid_[i];
+    }
   }
 
   void ProcessWeak() {
@@ -517,6 +569,13 @@ class ScavengerVisitorBase : public ObjectPointerVisitor,
           promoted_list_.Push(new_obj);
           bytes_promoted_ += size;
         }
+        if (UNLIKELY(copied_by_cid_ != nullptr) && cid < num_tracked_cids_) {
+          if (new_obj->IsOldObject()) {
+            promoted_by_cid_[cid] += size;
+          } else {
+            copied_by_cid_[cid] += size;
+          }
+        }
       } else {
         ASSERT(IsForwarding(header));
         if (new_obj->IsOldObject()) {
@@ -581,6 +640,8 @@ class ScavengerVisitorBase : public ObjectPointerVisitor,
   void ProcessToSpace();
   void ProcessPromotedList();
   void ProcessWeakPropertiesScoped();
+  bool StealWork(RelaxedAtomic<uintptr_t>* num_busy);
+  bool TrySteal();
 
   void MournWeakProperties() {
     weak_property_list_.Process([](WeakPropertyPtr weak_property) {
@@ -630,6 +691,18 @@ class ScavengerVisitorBase : public ObjectPointerVisitor,
   Page* tail_ = nullptr;  // Allocating from here.
   Page* scan_ = nullptr;  // Resolving from here.
 
+  // The other workers of a parallel scavenge, for work stealing.
+  ScavengerVisitorBase<parallel>** peers_ = nullptr;
+  intptr_t num_peers_ = 0;
+  intptr_t next_victim_ = 0;
+  intptr_t steals_ = 0;
+  int64_t idle_micros_ = 0;
+
+  // Surviving bytes per class id, only allocated when pretenuring is enabled.
+  intptr_t num_tracked_cids_ = 0;
+  intptr_t* copied_by_cid_ = nullptr;
+  intptr_t* promoted_by_cid_ = nullptr;
+
   DISALLOW_COPY_AND_ASSIGN(ScavengerVisitorBase);
 };
 
@@ -1167,6 +1240,110 @@ void Scavenger::Epilogue(SemiSpace* from) {
   }
 }
 
+// Finds whether an old object still has any pointer into new space.
+class NewTargetVisitor : public ObjectPointerVisitor {
+ public:
+  explicit NewTargetVisitor(IsolateGroup* isolate_group)
+      : ObjectPointerVisitor(isolate_group) {}
+
+  void VisitPointers(ObjectPtr* first, ObjectPtr* last) override {
+    for (ObjectPtr* ptr = first; ptr <= last; ptr++) {
+      if ((*ptr)->IsNewObject()) {
+        has_new_target_ = true;
+        return;
+      }
+    }
+  }
+
+#if defined(DART_COMPRESSED_POINTERS)
+  void VisitCompressedPointers(uword heap_base,
+                               CompressedObjectPtr* first,
+                               CompressedObjectPtr* last) override {
+    for (CompressedObjectPtr* ptr = first; ptr <= last; ptr++) {
+      if (ptr->Decompress(heap_base)->IsNewObject()) {
+        has_new_target_ = true;
+        return;
+      }
+    }
+  }
+#endif
+
+  bool HasNewTarget(ObjectPtr obj) {
+    has_new_target_ = false;
+    obj->untag()->VisitPointers(this);
+    return has_new_target_;
+  }
+
+ private:
+  bool has_new_target_ = false;
+
+  DISALLOW_COPY_AND_ASSIGN(NewTargetVisitor);
+};
+
+bool Scavenger::PruneStoreBuffer(Thread* thread) {
+  ASSERT(thread->OwnsGCSafepoint());
+  if (!FLAG_prune_store_buffer) {
+    return false;
+  }
+  if (heap_->old_space()->marker() != nullptr) {
+    // While marking, the store buffer also remembers pointers to evacuation
+    // candidates of the incremental compactor.
+    return false;
+  }
+  TIMELINE_FUNCTION_GC_DURATION(thread, "PruneStoreBuffer");
+
+  IsolateGroup* isolate_group = heap_->isolate_group();
+  isolate_group->ReleaseStoreBuffers();
+  StoreBuffer* store_buffer = isolate_group->store_buffer();
+  StoreBufferBlock* blocks = store_buffer->PopAll();
+
+  NewTargetVisitor visitor(isolate_group);
+  StoreBufferBlock* output = store_buffer->PopEmptyBlock();
+  intptr_t before = 0;
+  intptr_t after = 0;
+  while (blocks != nullptr) {
+    StoreBufferBlock* block = blocks;
+    blocks = block->next();
+    block->set_next(nullptr);
+    // Generated code appends to store buffers; tell MemorySanitizer.
+    MSAN_UNPOISON(block, sizeof(*block));
+    while (!block->IsEmpty()) {
+      ObjectPtr obj = block->Pop();
+      ASSERT(obj->untag()->IsRemembered());
+      before++;
+      // Weak objects are kept: the scavenger decides which of their slots
+      // count as references.
+      const intptr_t cid = obj->GetClassId();
+      if ((cid != kWeakPropertyCid) && (cid != kWeakReferenceCid) &&
+          (cid != kWeakArrayCid) && (cid != kFinalizerEntryCid) &&
+          !visitor.HasNewTarget(obj)) {
+        obj->untag()->ClearRememberedBit();
+        continue;
+      }
+      after++;
+      output->Push(obj);
+      if (output->IsFull()) {
+        store_buffer->PushBlock(output, StoreBuffer::kIgnoreThreshold);
+        output = store_buffer->PopEmptyBlock();
+      }
+    }
+    block->Reset();
+    store_buffer->PushBlock(block, StoreBuffer::kIgnoreThreshold);
+  }
+  store_buffer->PushBlock(output, StoreBuffer::kIgnoreThreshold);
+
+  // Restore write-barrier assumptions for objects held in temporaries, as
+  // after a scavenge.
+  isolate_group->RememberLiveTemporaries();
+
+#if defined(SUPPORT_TIMELINE)
+  tbes.SetNumArguments(2);
+  tbes.FormatArgument(0, "before", "%" Pd, before);
+  tbes.FormatArgument(1, "after", "%" Pd, after);
+#endif
+  return true;
+}
+
 bool Scavenger::ShouldPerformIdleScavenge(int64_t deadline) {
   // To make a consistent decision, we should not yield for a safepoint in the
   // middle of deciding whether to perform an idle GC.
@@ -1358,6 +1535,51 @@ void ScavengerVisitorBase<parallel>::ProcessPromotedList() {
   }
 }
 
+template <bool parallel>
+bool ScavengerVisitorBase<parallel>::TrySteal() {
+  ASSERT(promoted_list_.IsLocalEmpty());
+  // Start from the victim we last succeeded with (or our neighbor) so that
+  // thieves spread out over the workers instead of all hitting the first one.
+  for (intptr_t i = 0; i < num_peers_; i++) {
+    intptr_t index = (next_victim_ + i) % num_peers_;
+    ScavengerVisitorBase<parallel>* victim = peers_[index];
+    if (victim == this) continue;
+    if (promoted_list_.StealFrom(&victim->promoted_list_)) {
+      next_victim_ = index;
+      return true;
+    }
+  }
+  return promoted_list_.TakeShared();
+}
+
+template <bool parallel>
+bool ScavengerVisitorBase<parallel>::StealWork(
+    RelaxedAtomic<uintptr_t>* num_busy) {
+  // A worker only becomes idle once its own deque is empty, so when no worker
+  // is busy there is nothing left to steal. A successful thief counts itself
+  // busy again after taking the block; if the count reached zero in the
+  // meantime the others may leave early, but the stolen block is still
+  // processed by the thief before it reaches the barrier.
+  num_busy->fetch_sub(1u);
+  intptr_t rounds = 0;
+  for (;;) {
+    if (scavenger_->abort_) {
+      return false;
+    }
+    if (TrySteal()) {
+      num_busy->fetch_add(1u);
+      steals_++;
+      return true;
+    }
+    if (num_busy->load() == 0) {
+      return false;
+    }
+    if (++rounds > kStealSpinRounds) {
+      OS::SleepMicros(1);
+    }
+  }
+}
+
 template <bool parallel>
 void ScavengerVisitorBase<parallel>::ProcessWeakPropertiesScoped() {
   if (scavenger_->abort_) return;
@@ -1796,6 +2018,14 @@ void Scavenger::AddRegionsToObjectSet(ObjectSet* set) const {
   }
 }
 
+// Attributes the bytes allocated in a released TLAB to the isolate whose
+// mutator owned it.
+static void AccountTLABAllocation(Thread* thread, intptr_t allocated) {
+  if (Isolate* isolate = thread->scheduled_dart_mutator_isolate()) {
+    isolate->AddAllocatedBytes(allocated);
+  }
+}
+
 void Scavenger::TryAllocateNewTLAB(Thread* thread,
                                    intptr_t min_size,
                                    bool can_safepoint) {
@@ -1873,6 +2103,7 @@ intptr_t Scavenger::AbandonRemainingTLAB(Thread* thread) {
     allocated = page->Release(thread);
   }
   ASSERT(thread->top() == 0);
+  AccountTLABAllocation(thread, allocated);
   return allocated;
 }
 
@@ -1911,6 +2142,7 @@ void Scavenger::Scavenge(Thread* thread, GCType type, GCReason reason) {
     // Forces the next scavenge to promote all the objects in the new space.
     early_tenure_ = true;
   }
+  const bool early_tenure = early_tenure_;
 
   if (FLAG_verify_before_gc) {
     heap_->WaitForSweeperTasksAtSafepoint(thread);
@@ -1928,7 +2160,9 @@ void Scavenger::Scavenge(Thread* thread, GCType type, GCReason reason) {
   SpaceUsage usage_before = GetCurrentUsage();
   intptr_t promo_candidate_words = 0;
   for (Page* page = to_->head(); page != nullptr; page = page->next()) {
-    page->Release();
+    if (Thread* owner = page->owner()) {
+      AccountTLABAllocation(owner, page->Release(owner));
+    }
     if (early_tenure_) {
       page->EarlyTenure();
     }
@@ -1937,11 +2171,24 @@ void Scavenger::Scavenge(Thread* thread, GCType type, GCReason reason) {
   heap_->old_space()->PauseConcurrentMarking();
   SemiSpace* from = Prologue(reason);
 
+  if (Pretenuring::IsEnabled()) {
+    tracked_cids_ = heap_->isolate_group()->class_table()->NumCids();
+    copied_by_cid_ =
+        reinterpret_cast<intptr_t*>(calloc(tracked_cids_, sizeof(intptr_t)));
+    promoted_by_cid_ =
+        reinterpret_cast<intptr_t*>(calloc(tracked_cids_, sizeof(intptr_t)));
+  }
+
   intptr_t bytes_promoted;
+  intptr_t steals = 0;
+  int64_t idle_micros = 0;
   if (FLAG_scavenger_tasks == 0) {
     bytes_promoted = SerialScavenge(from);
   } else {
-    bytes_promoted = ParallelScavenge(from);
+    bytes_promoted = ParallelScavenge(from, &steals, &idle_micros);
+  }
+  if (copied_by_cid_ != nullptr) {
+    UpdatePretenuring(thread, early_tenure);
   }
   if (abort_) {
     ReverseScavenge(&from);
@@ -1959,7 +2206,8 @@ void Scavenger::Scavenge(Thread* thread, GCType type, GCReason reason) {
   int64_t end = OS::GetCurrentMonotonicMicros();
   stats_history_.Add(ScavengeStats(
       start, end, usage_before, GetCurrentUsage(), promo_candidate_words,
-      bytes_promoted >> kWordSizeLog2, abandoned_bytes >> kWordSizeLog2));
+      bytes_promoted >> kWordSizeLog2, abandoned_bytes >> kWordSizeLog2,
+      steals, idle_micros));
   Epilogue(from);
   heap_->old_space()->ResumeConcurrentMarking();
 
@@ -1979,19 +2227,47 @@ void Scavenger::Scavenge(Thread* thread, GCType type, GCReason reason) {
          failed_to_promote_);
 }
 
+void Scavenger::UpdatePretenuring(Thread* thread, bool early_tenure) {
+  Pretenuring* pretenuring = heap_->pretenuring();
+  if (abort_ || early_tenure || failed_to_promote_) {
+    // Survivors were not aged normally, so the counts say nothing about how
+    // long objects live.
+    pretenuring->Reset();
+  } else {
+    pretenuring->Update(copied_by_cid_, promoted_by_cid_, tracked_cids_);
+    if (pretenuring->HasPendingChanges() && thread->IsDartMutatorThread()) {
+      // Allocation stubs are updated outside of GC.
+      thread->ScheduleInterrupts(Thread::kVMInterrupt);
+    }
+  }
+  free(copied_by_cid_);
+  copied_by_cid_ = nullptr;
+  free(promoted_by_cid_);
+  promoted_by_cid_ = nullptr;
+  tracked_cids_ = 0;
+}
+
 intptr_t Scavenger::SerialScavenge(SemiSpace* from) {
   FreeList* freelist = heap_->old_space()->DataFreeList(0);
   SerialScavengerVisitor visitor(heap_->isolate_group(), this, from, freelist,
                                  &promotion_stack_);
+  if (copied_by_cid_ != nullptr) {
+    visitor.TrackSurvivalByClass(tracked_cids_);
+  }
   visitor.ProcessRoots();
   visitor.ProcessAll();
   visitor.ProcessWeak();
   visitor.Finalize(heap_->isolate_group()->store_buffer());
+  if (copied_by_cid_ != nullptr) {
+    visitor.AccumulateSurvivalByClass(copied_by_cid_, promoted_by_cid_);
+  }
   to_->AddList(visitor.head(), visitor.tail());
   return visitor.bytes_promoted();
 }
 
-intptr_t Scavenger::ParallelScavenge(SemiSpace* from) {
+intptr_t Scavenger::ParallelScavenge(SemiSpace* from,
+                                     intptr_t* steals,
+                                     int64_t* idle_micros) {
   intptr_t bytes_promoted = 0;
   const intptr_t num_tasks = FLAG_scavenger_tasks;
   ASSERT(num_tasks > 0);
@@ -2001,10 +2277,18 @@ intptr_t Scavenger::ParallelScavenge(SemiSpace* from) {
 
   ParallelScavengerVisitor** visitors =
       new ParallelScavengerVisitor*[num_tasks];
+  // All visitors must exist before any task starts so that idle tasks can
+  // steal from any of them.
   for (intptr_t i = 0; i < num_tasks; i++) {
     FreeList* freelist = heap_->old_space()->DataFreeList(i);
     visitors[i] = new ParallelScavengerVisitor(
         heap_->isolate_group(), this, from, freelist, &promotion_stack_);
+    visitors[i]->set_peers(visitors, num_tasks, i);
+    if (copied_by_cid_ != nullptr) {
+      visitors[i]->TrackSurvivalByClass(tracked_cids_);
+    }
+  }
+  for (intptr_t i = 0; i < num_tasks; i++) {
     if (i < (num_tasks - 1)) {
       // Begin scavenging on a helper thread.
       bool result = Dart::thread_pool()->Run<ParallelScavengerTask>(
@@ -2026,6 +2310,11 @@ intptr_t Scavenger::ParallelScavenge(SemiSpace* from) {
     visitor->Finalize(store_buffer);
     to_->AddList(visitor->head(), visitor->tail());
     bytes_promoted += visitor->bytes_promoted();
+    *steals += visitor->steals();
+    *idle_micros += visitor->idle_micros();
+    if (copied_by_cid_ != nullptr) {
+      visitor->AccumulateSurvivalByClass(copied_by_cid_, promoted_by_cid_);
+    }
     delete visitor;
   }
 
@@ -2152,6 +2441,14 @@ void Scavenger::PrintToJSONObject(JSONObject* object) const {
   space.AddProperty64("capacity", CapacityInWords() * kWordSize);
   space.AddProperty64("external", ExternalInWords() * kWordSize);
   space.AddProperty("time", MicrosecondsToSeconds(gc_time_micros()));
+  if (Numa::IsEnabled()) {
+    intptr_t capacity_per_node[Numa::kMaxNodes] = {0};
+    {
+      MutexLocker ml(&space_lock_);
+      Page::AccumulateNumaCapacity(to_->head(), capacity_per_node);
+    }
+    Page::PrintNumaCapacityToJSON(&space, capacity_per_node);
+  }
 }
 #endif  // !PRODUCT
 
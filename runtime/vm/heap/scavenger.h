@@ -80,14 +80,18 @@ class ScavengeStats {
                 SpaceUsage after,
                 intptr_t promo_candidates_in_words,
                 intptr_t promoted_in_words,
-                intptr_t abandoned_in_words)
+                intptr_t abandoned_in_words,
+                intptr_t steals,
+                int64_t idle_micros)
       : start_micros_(start_micros),
         end_micros_(end_micros),
         before_(before),
         after_(after),
         promo_candidates_in_words_(promo_candidates_in_words),
         promoted_in_words_(promoted_in_words),
-        abandoned_in_words_(abandoned_in_words) {}
+        abandoned_in_words_(abandoned_in_words),
+        steals_(steals),
+        idle_micros_(idle_micros) {}
 
   // Of all data before scavenge, what fraction was found to be garbage?
   // If this scavenge included growth, assume the extra capacity would become
@@ -111,6 +115,12 @@ class ScavengeStats {
 
   int64_t DurationMicros() const { return end_micros_ - start_micros_; }
 
+  // Number of promotion work blocks taken from another task's deque.
+  intptr_t steals() const { return steals_; }
+
+  // Time spent by all tasks looking for work to steal, summed.
+  int64_t idle_micros() const { return idle_micros_; }
+
  private:
   int64_t start_micros_;
   int64_t end_micros_;
@@ -119,6 +129,8 @@ class ScavengeStats {
   intptr_t promo_candidates_in_words_;
   intptr_t promoted_in_words_;
   intptr_t abandoned_in_words_;
+  intptr_t steals_;
+  int64_t idle_micros_;
 };
 
 class Scavenger {
@@ -184,6 +196,11 @@ class Scavenger {
 
   bool ShouldPerformIdleScavenge(int64_t deadline);
 
+  // Removes remembered objects that no longer point into new space, moving that
+  // part of the next scavenge's root scan into a separate, shorter pause.
+  // Returns false if pruning is disabled or not currently possible.
+  bool PruneStoreBuffer(Thread* thread);
+
   void AddGCTime(int64_t micros) { gc_time_micros_ += micros; }
 
   int64_t gc_time_micros() const { return gc_time_micros_; }
@@ -192,6 +209,9 @@ class Scavenger {
 
   intptr_t collections() const { return collections_; }
 
+  // Statistics of the most recent scavenge. Only valid if collections() > 0.
+  const ScavengeStats& LastStats() const { return stats_history_.Get(0); }
+
 #ifndef PRODUCT
   void PrintToJSONObject(JSONObject* object) const;
 #endif  // !PRODUCT
@@ -274,7 +294,9 @@ class Scavenger {
   void TryAllocateNewTLAB(Thread* thread, intptr_t size, bool can_safepoint);
 
   SemiSpace* Prologue(GCReason reason);
-  intptr_t ParallelScavenge(SemiSpace* from);
+  intptr_t ParallelScavenge(SemiSpace* from,
+                            intptr_t* steals,
+                            int64_t* idle_micros);
   intptr_t SerialScavenge(SemiSpace* from);
   void ReverseScavenge(SemiSpace** from);
   void IterateIsolateRoots(ObjectPointerVisitor* visitor);
@@ -286,6 +308,7 @@ class Scavenger {
   template <bool parallel>
   void IterateRoots(ScavengerVisitorBase<parallel>* visitor);
   void IterateWeak();
+  void UpdatePretenuring(Thread* thread, bool early_tenure);
   void MournWeakHandles();
   void MournWeakTables();
   void Epilogue(SemiSpace* from);
@@ -326,6 +349,12 @@ class Scavenger {
   RelaxedAtomic<intptr_t> external_size_ = {0};
   intptr_t freed_in_words_ = 0;
 
+  // Surviving bytes per class id during a scavenge, when pretenuring is
+  // enabled.
+  intptr_t tracked_cids_ = 0;
+  intptr_t* copied_by_cid_ = nullptr;
+  intptr_t* promoted_by_cid_ = nullptr;
+
   RelaxedAtomic<bool> failed_to_promote_ = {false};
   RelaxedAtomic<bool> abort_ = {false};
 
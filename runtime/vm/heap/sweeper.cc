@@ -169,10 +169,6 @@ class ConcurrentSweeperTask : public ThreadPool::Task {
   explicit ConcurrentSweeperTask(IsolateGroup* isolate_group)
       : isolate_group_(isolate_group) {
     ASSERT(isolate_group != nullptr);
-    PageSpace* old_space = isolate_group->heap()->old_space();
-    MonitorLocker ml(old_space->tasks_lock());
-    old_space->set_tasks(old_space->tasks() + 1);
-    old_space->set_phase(PageSpace::kSweepingLarge);
   }
 
   virtual void Run() {
@@ -184,17 +180,26 @@ class ConcurrentSweeperTask : public ThreadPool::Task {
       Thread* thread = Thread::Current();
       ASSERT(thread->BypassSafepoints());  // Or we should be checking in.
       TIMELINE_FUNCTION_GC_DURATION(thread, "ConcurrentSweep");
+      const int64_t start = OS::GetCurrentMonotonicMicros();
 
       old_space->SweepLarge();
 
+      // The large page list is complete only once every task has finished
+      // its last large page.
       {
         MonitorLocker ml(old_space->tasks_lock());
         ASSERT(old_space->phase() == PageSpace::kSweepingLarge);
-        old_space->set_phase(PageSpace::kSweepingRegular);
-        ml.NotifyAll();
+        intptr_t remaining = old_space->concurrent_sweeper_tasks_large() - 1;
+        old_space->set_concurrent_sweeper_tasks_large(remaining);
+        if (remaining == 0) {
+          old_space->set_phase(PageSpace::kSweepingRegular);
+          ml.NotifyAll();
+        }
       }
 
       old_space->Sweep(/*exclusive*/ false);
+      isolate_group_->GetGCSweepTimeMetric()->Add(
+          OS::GetCurrentMonotonicMicros() - start);
     }
     // Exit isolate cleanly *before* notifying it, to avoid shutdown race.
     Thread::ExitIsolateGroupAsNonMutator();
@@ -202,8 +207,12 @@ class ConcurrentSweeperTask : public ThreadPool::Task {
     {
       MonitorLocker ml(old_space->tasks_lock());
       old_space->set_tasks(old_space->tasks() - 1);
-      ASSERT(old_space->phase() == PageSpace::kSweepingRegular);
-      old_space->set_phase(PageSpace::kDone);
+      intptr_t remaining = old_space->concurrent_sweeper_tasks() - 1;
+      old_space->set_concurrent_sweeper_tasks(remaining);
+      if (remaining == 0) {
+        ASSERT(old_space->phase() == PageSpace::kSweepingRegular);
+        old_space->set_phase(PageSpace::kDone);
+      }
       ml.NotifyAll();
     }
   }
@@ -213,8 +222,20 @@ class ConcurrentSweeperTask : public ThreadPool::Task {
 };
 
 void GCSweeper::SweepConcurrent(IsolateGroup* isolate_group) {
-  bool result = Dart::thread_pool()->Run<ConcurrentSweeperTask>(isolate_group);
-  ASSERT(result);
+  const intptr_t num_tasks = Utils::Maximum(FLAG_sweeper_tasks, 1);
+  PageSpace* old_space = isolate_group->heap()->old_space();
+  {
+    MonitorLocker ml(old_space->tasks_lock());
+    old_space->set_tasks(old_space->tasks() + num_tasks);
+    old_space->set_concurrent_sweeper_tasks(num_tasks);
+    old_space->set_concurrent_sweeper_tasks_large(num_tasks);
+    old_space->set_phase(PageSpace::kSweepingLarge);
+  }
+  for (intptr_t i = 0; i < num_tasks; i++) {
+    bool result =
+        Dart::thread_pool()->Run<ConcurrentSweeperTask>(isolate_group);
+    ASSERT(result);
+  }
 }
 
 }  // namespace dart
@@ -131,13 +131,24 @@ void WeakTable::Reset() {
 void WeakTable::Forward(ObjectPointerVisitor* visitor) {
   if (used_ == 0) return;
 
+  bool moved = false;
   for (intptr_t i = 0; i < size_; i++) {
     if (IsValidEntryAtExclusive(i)) {
-      visitor->VisitPointer(ObjectPointerAt(i));
+      ObjectPtr* key = ObjectPointerAt(i);
+      ObjectPtr before = *key;
+      visitor->VisitPointer(key);
+      moved |= (*key != before);
     }
   }
 
-  Rehash();
+  // Evacuating compaction usually leaves most keys in place. Without moved
+  // keys the probe sequences are still valid, so only rehash to shrink the
+  // table or to clear out deleted entries.
+  const bool should_shrink = (size() > kMinSize) && (count() <= size() / 4);
+  const bool mostly_deleted = (used() - count()) > count();
+  if (moved || should_shrink || mostly_deleted) {
+    Rehash();
+  }
 }
 
 #if !defined(PRODUCT) || defined(FORCE_INCLUDE_SAMPLING_HEAP_PROFILER)
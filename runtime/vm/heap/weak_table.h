@@ -8,6 +8,7 @@
 #include "vm/globals.h"
 
 #include "platform/assert.h"
+#include "platform/atomic.h"
 #include "vm/lockers.h"
 #include "vm/raw_object.h"
 
@@ -48,7 +49,7 @@ class WeakTable {
 
   intptr_t size() const { return size_; }
   intptr_t used() const { return used_; }
-  intptr_t count() const { return count_; }
+  intptr_t count() const { return count_.load(); }
 
   // The following methods can be called concurrently and are guarded by a lock.
 
@@ -86,6 +87,7 @@ class WeakTable {
     return (data_[ValueIndex(i)] != 0);
   }
 
+  // Also safe to call from several GC tasks at once for distinct entries.
   void InvalidateAtExclusive(intptr_t i) {
     ASSERT(IsValidEntryAtExclusive(i));
     SetValueAt(i, 0);
@@ -200,7 +202,8 @@ class WeakTable {
     // Setting a value of 0 is equivalent to invalidating the entry.
     if (val == 0) {
       data_[ObjectIndex(i)] = kDeletedEntry;
-      set_count(count() - 1);
+      intptr_t old_count = count_.fetch_sub(1);
+      ASSERT(old_count > 0);
     }
     data_[ValueIndex(i)] = val;
   }
@@ -218,9 +221,10 @@ class WeakTable {
   // size_ keeps the number of entries in data_. used_ maintains the number of
   // non-NULL entries and will trigger rehashing if needed. count_ stores the
   // number valid entries, and will determine the size_ after rehashing.
+  // count_ is atomic so that pruning can run in parallel.
   intptr_t size_;
   intptr_t used_;
-  intptr_t count_;
+  RelaxedAtomic<intptr_t> count_;
 
   DISALLOW_COPY_AND_ASSIGN(WeakTable);
 };
@@ -59,4 +59,36 @@ ISOLATE_UNIT_TEST_CASE(WeakTables) {
   EXPECT_EQ(kNoValue, heap->GetObjectId(imm_obj.ptr()));
 }
 
+ISOLATE_UNIT_TEST_CASE(WeakTables_PruneAndForwardMany) {
+  const intptr_t kLength = 1000;
+  Heap* heap = thread->heap();
+  const Array& live = Array::Handle(Array::New(kLength, Heap::kOld));
+  {
+    HANDLESCOPE(thread);
+    String& str = String::Handle();
+    for (intptr_t i = 0; i < kLength; i++) {
+      str = String::New("weak", Heap::kOld);
+      heap->SetObjectId(str.ptr(), i + 1);
+      if ((i % 2) == 0) {
+        live.SetAt(i, str);
+      }
+    }
+  }
+  WeakTable* table = heap->GetWeakTable(Heap::kOld, Heap::kObjectIds);
+  EXPECT_EQ(kLength, table->count());
+
+  // Unreachable keys are pruned, across all slices of the table.
+  GCTestHelper::CollectOldSpace();
+  table = heap->GetWeakTable(Heap::kOld, Heap::kObjectIds);
+  EXPECT_EQ(kLength / 2, table->count());
+
+  // Surviving keys are still found after being moved.
+  GCTestHelper::CollectAllGarbage(/*compact=*/true);
+  Object& obj = Object::Handle();
+  for (intptr_t i = 0; i < kLength; i += 2) {
+    obj = live.At(i);
+    EXPECT_EQ(i + 1, heap->GetObjectId(obj.ptr()));
+  }
+}
+
 }  // namespace dart
@@ -0,0 +1,123 @@
+// Copyright (c) 2024, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+#ifndef RUNTIME_VM_HEAP_WORK_STEALING_DEQUE_H_
+#define RUNTIME_VM_HEAP_WORK_STEALING_DEQUE_H_
+
+#include <atomic>
+
+#include "platform/assert.h"
+#include "platform/utils.h"
+#include "vm/allocation.h"
+#include "vm/globals.h"
+
+namespace dart {
+
+// A bounded Chase-Lev work-stealing deque.
+//
+// The owning thread pushes and pops at the bottom without synchronization in
+// the common case. Any other thread may steal from the top; a CAS on top_
+// resolves races between thieves and between a thief and the owner taking the
+// last element.
+//
+// See "Correct and Efficient Work-Stealing for Weak Memory Models" (Lê, Pop,
+// Cohen, Zappa Nardelli, PPoPP 2013) for the memory-ordering argument.
+//
+// The deque does not grow. Push returns false when it is full, and the caller
+// is expected to spill the element to a shared overflow structure.
+template <typename T, intptr_t kCapacityLog2>
+class WorkStealingDeque {
+ public:
+  static constexpr intptr_t kCapacity = static_cast<intptr_t>(1)
+                                        << kCapacityLog2;
+  static constexpr intptr_t kMask = kCapacity - 1;
+
+  WorkStealingDeque() : top_(0), bottom_(0) {
+    for (intptr_t i = 0; i < kCapacity; i++) {
+      buffer_[i].store(T(), std::memory_order_relaxed);
+    }
+  }
+
+  // Owner only. Returns false if the deque is full.
+  DART_FORCE_INLINE bool Push(T value) {
+    const intptr_t b = bottom_.load(std::memory_order_relaxed);
+    const intptr_t t = top_.load(std::memory_order_acquire);
+    if ((b - t) >= kCapacity) {
+      return false;
+    }
+    buffer_[b & kMask].store(value, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    bottom_.store(b + 1, std::memory_order_relaxed);
+    return true;
+  }
+
+  // Owner only. Takes the most recently pushed element. Returns false if the
+  // deque is empty or the last element was taken by a concurrent thief.
+  DART_FORCE_INLINE bool Pop(T* value) {
+    const intptr_t b = bottom_.load(std::memory_order_relaxed) - 1;
+    bottom_.store(b, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    intptr_t t = top_.load(std::memory_order_relaxed);
+    if (t > b) {
+      // Empty.
+      bottom_.store(b + 1, std::memory_order_relaxed);
+      return false;
+    }
+    *value = buffer_[b & kMask].load(std::memory_order_relaxed);
+    if (t < b) {
+      // More than one element; no thief can reach this slot.
+      return true;
+    }
+    // Single last element: race against thieves for it.
+    const bool won = top_.compare_exchange_strong(
+        t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+    bottom_.store(b + 1, std::memory_order_relaxed);
+    return won;
+  }
+
+  // Any thread. Takes the least recently pushed element. Returns false if the
+  // deque was empty or another thread won the race for the element.
+  bool Steal(T* value) {
+    intptr_t t = top_.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    const intptr_t b = bottom_.load(std::memory_order_acquire);
+    if (t >= b) {
+      return false;
+    }
+    T result = buffer_[t & kMask].load(std::memory_order_relaxed);
+    if (!top_.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                      std::memory_order_relaxed)) {
+      return false;
+    }
+    *value = result;
+    return true;
+  }
+
+  // Approximate when called concurrently with thieves; exact for the owner
+  // when no other thread is accessing the deque.
+  bool IsEmpty() const {
+    const intptr_t b = bottom_.load(std::memory_order_relaxed);
+    const intptr_t t = top_.load(std::memory_order_relaxed);
+    return b <= t;
+  }
+
+  intptr_t Size() const {
+    const intptr_t b = bottom_.load(std::memory_order_relaxed);
+    const intptr_t t = top_.load(std::memory_order_relaxed);
+    return b > t ? b - t : 0;
+  }
+
+ private:
+  // Thieves and the owner contend on top_, while only the owner writes
+  // bottom_. Keep them on separate cache lines.
+  alignas(kCacheLineSize) std::atomic<intptr_t> top_;
+  alignas(kCacheLineSize) std::atomic<intptr_t> bottom_;
+  alignas(kCacheLineSize) std::atomic<T> buffer_[kCapacity];
+
+  DISALLOW_COPY_AND_ASSIGN(WorkStealingDeque);
+};
+
+}  // namespace dart
+
+#endif  // RUNTIME_VM_HEAP_WORK_STEALING_DEQUE_H_
@@ -0,0 +1,146 @@
+// Copyright (c) 2024, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+#include "vm/heap/work_stealing_deque.h"
+
+#include "platform/assert.h"
+#include "vm/dart.h"
+#include "vm/lockers.h"
+#include "vm/thread_pool.h"
+#include "vm/unit_test.h"
+
+namespace dart {
+
+VM_UNIT_TEST_CASE(WorkStealingDeque_PushPop) {
+  WorkStealingDeque<intptr_t, 3> deque;
+  intptr_t value = -1;
+  EXPECT(deque.IsEmpty());
+  EXPECT(!deque.Pop(&value));
+  EXPECT(!deque.Steal(&value));
+
+  for (intptr_t i = 0; i < 8; i++) {
+    EXPECT(deque.Push(i));
+  }
+  // Bounded: a ninth element does not fit.
+  EXPECT(!deque.Push(8));
+  EXPECT_EQ(8, deque.Size());
+
+  // Owner pops LIFO, thieves steal FIFO.
+  EXPECT(deque.Pop(&value));
+  EXPECT_EQ(7, value);
+  EXPECT(deque.Steal(&value));
+  EXPECT_EQ(0, value);
+  EXPECT(deque.Steal(&value));
+  EXPECT_EQ(1, value);
+  EXPECT(deque.Pop(&value));
+  EXPECT_EQ(6, value);
+  EXPECT_EQ(4, deque.Size());
+
+  // Space freed by steals is reusable after wrapping around.
+  for (intptr_t i = 100; i < 104; i++) {
+    EXPECT(deque.Push(i));
+  }
+  EXPECT(!deque.Push(104));
+  for (intptr_t i = 103; i >= 100; i--) {
+    EXPECT(deque.Pop(&value));
+    EXPECT_EQ(i, value);
+  }
+  for (intptr_t i = 2; i < 6; i++) {
+    EXPECT(deque.Steal(&value));
+    EXPECT_EQ(i, value);
+  }
+  EXPECT(deque.IsEmpty());
+  EXPECT(!deque.Pop(&value));
+  EXPECT(!deque.Steal(&value));
+}
+
+typedef WorkStealingDeque<intptr_t, 6> TestDeque;
+
+class StealingTask : public ThreadPool::Task {
+ public:
+  StealingTask(TestDeque* deque,
+               RelaxedAtomic<bool>* done,
+               RelaxedAtomic<intptr_t>* sum,
+               RelaxedAtomic<intptr_t>* count,
+               Monitor* monitor,
+               intptr_t* live_tasks)
+      : deque_(deque),
+        done_(done),
+        sum_(sum),
+        count_(count),
+        monitor_(monitor),
+        live_tasks_(live_tasks) {}
+
+  virtual void Run() {
+    intptr_t value;
+    for (;;) {
+      if (deque_->Steal(&value)) {
+        sum_->fetch_add(value);
+        count_->fetch_add(1);
+      } else if (done_->load()) {
+        // The owner has stopped pushing; drain whatever is left.
+        if (deque_->IsEmpty()) break;
+      }
+    }
+    MonitorLocker ml(monitor_);
+    (*live_tasks_)--;
+    ml.Notify();
+  }
+
+ private:
+  TestDeque* deque_;
+  RelaxedAtomic<bool>* done_;
+  RelaxedAtomic<intptr_t>* sum_;
+  RelaxedAtomic<intptr_t>* count_;
+  Monitor* monitor_;
+  intptr_t* live_tasks_;
+};
+
+// Every element pushed is consumed exactly once, whether taken by the owner or
+// by one of several concurrent thieves.
+VM_UNIT_TEST_CASE(WorkStealingDeque_ConcurrentSteal) {
+  const intptr_t kTasks = 4;
+  const intptr_t kElements = 100000;
+  TestDeque deque;
+  RelaxedAtomic<bool> done = {false};
+  RelaxedAtomic<intptr_t> sum = {0};
+  RelaxedAtomic<intptr_t> count = {0};
+  Monitor monitor;
+  intptr_t live_tasks = kTasks;
+  for (intptr_t i = 0; i < kTasks; i++) {
+    Dart::thread_pool()->Run<StealingTask>(&deque, &done, &sum, &count,
+                                           &monitor, &live_tasks);
+  }
+
+  intptr_t value;
+  for (intptr_t i = 1; i <= kElements; i++) {
+    while (!deque.Push(i)) {
+      // Full: behave like a worker consuming its own work.
+      if (deque.Pop(&value)) {
+        sum.fetch_add(value);
+        count.fetch_add(1);
+      }
+    }
+    if ((i % 3) == 0 && deque.Pop(&value)) {
+      sum.fetch_add(value);
+      count.fetch_add(1);
+    }
+  }
+  while (deque.Pop(&value)) {
+    sum.fetch_add(value);
+    count.fetch_add(1);
+  }
+  done.store(true);
+
+  {
+    MonitorLocker ml(&monitor);
+    while (live_tasks > 0) {
+      ml.Wait();
+    }
+  }
+  EXPECT_EQ(kElements, count.load());
+  EXPECT_EQ(kElements * (kElements + 1) / 2, sum.load());
+}
+
+}  // namespace dart
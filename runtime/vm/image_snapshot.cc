@@ -291,6 +291,8 @@ intptr_t ImageWriter::SizeInSnapshot(ObjectPtr raw_object) {
       return compiler::target::String::InstanceSize(
           String::LengthOf(raw_str) * TwoByteString::kBytesPerElement);
     }
+    case kDoubleCid:
+      return compiler::target::Double::InstanceSize();
     default: {
       const Class& clazz = Class::Handle(Object::Handle(raw_object).clazz());
       FATAL("Unsupported class %s in rodata section.\n", clazz.ToCString());
@@ -340,6 +342,17 @@ void ImageWriter::GetTrampolineInfo(intptr_t* count, intptr_t* size) const {
   }
 }
 
+CodePtr ImageWriter::GetTextObject(intptr_t index, intptr_t* size) const {
+  ASSERT(size != nullptr);
+  const auto& data = instructions_[index];
+  if (data.trampoline_length != 0) {
+    *size = data.trampoline_length;
+    return Code::null();
+  }
+  *size = SizeInSnapshot(data.raw_insns_);
+  return data.raw_code_;
+}
+
 // Returns nullptr if there is no profile writer.
 const char* ImageWriter::ObjectTypeForProfile(const Object& object) const {
   if (profile_writer_ == nullptr) return nullptr;
@@ -585,6 +598,12 @@ void ImageWriter::WriteROData(NonStreamingWriteStream* stream, bool vm) {
           str.Length() * (str.IsOneByteString()
                               ? OneByteString::kBytesPerElement
                               : TwoByteString::kBytesPerElement));
+    } else if (obj.IsDouble()) {
+      while (stream->Position() - object_start <
+             compiler::target::Double::value_offset()) {
+        stream->WriteByte(0);
+      }
+      stream->WriteFixed<double>(Double::Cast(obj).value());
     } else {
       const Class& clazz = Class::Handle(obj.clazz());
       FATAL("Unsupported class %s in rodata section.\n", clazz.ToCString());
@@ -423,6 +423,10 @@ class ImageWriter : public ValueObject {
   intptr_t text_size() const { return next_text_offset_; }
   intptr_t GetTextObjectCount() const;
   void GetTrampolineInfo(intptr_t* count, intptr_t* size) const;
+  // Returns the Code object of the text object with the given index, or null
+  // for trampolines, and sets |size| to the size of the object in the
+  // snapshot. Only valid before Write.
+  CodePtr GetTextObject(intptr_t index, intptr_t* size) const;
 
   void DumpStatistics();
 
@@ -47,6 +47,7 @@
 #include "vm/service_isolate.h"
 #include "vm/simulator.h"
 #include "vm/stack_frame.h"
+#include "vm/stack_trace.h"
 #include "vm/stub_code.h"
 #include "vm/symbols.h"
 #include "vm/tags.h"
@@ -57,7 +58,9 @@
 #include "vm/visitor.h"
 
 #if !defined(DART_PRECOMPILED_RUNTIME)
+#include "vm/compiler/aot/aot_profile.h"
 #include "vm/compiler/assembler/assembler.h"
+#include "vm/compiler/compiler_timings.h"
 #include "vm/compiler/stub_code_compiler.h"
 #endif
 
@@ -77,6 +80,10 @@ DECLARE_FLAG(bool, reload_every_back_off);
 DECLARE_FLAG(bool, trace_reload);
 #endif  // !defined(PRODUCT) && !defined(DART_PRECOMPILED_RUNTIME)
 
+#if !defined(DART_PRECOMPILED_RUNTIME)
+DECLARE_FLAG(charp, write_aot_profile_to);
+#endif  // !defined(DART_PRECOMPILED_RUNTIME)
+
 static void DeterministicModeHandler(bool value) {
   if (value) {
     FLAG_background_compilation = false;  // Timing dependent.
@@ -98,6 +105,12 @@ DEFINE_FLAG(bool,
             "Disables the limit of the thread pool (simulates custom embedder "
             "with custom message handler on unlimited number of threads).");
 
+DEFINE_FLAG(int,
+            isolate_pool_size,
+            0,
+            "Number of isolates each isolate group creates ahead of time for "
+            "lightweight spawns such as Isolate.run.");
+
 // Quick access to the locally defined thread() and isolate() methods.
 #define T (thread())
 #define I (isolate())
@@ -335,6 +348,12 @@ IsolateGroup::IsolateGroup(std::shared_ptr<IsolateGroupSource> source,
       embedder_data_(embedder_data),
       thread_pool_(),
       isolates_lock_(new SafepointRwLock()),
+#if defined(DART_PRECOMPILED_RUNTIME)
+      stack_frame_symbol_cache_(new StackFrameSymbolCache()),
+#endif
+#if !defined(DART_PRECOMPILED_RUNTIME)
+      jit_function_statistics_(new JitFunctionStatistics()),
+#endif
       isolates_(),
       start_time_micros_(OS::GetCurrentMonotonicMicros()),
       is_system_isolate_group_(source->flags.is_system_isolate),
@@ -424,6 +443,7 @@ IsolateGroup::IsolateGroup(std::shared_ptr<IsolateGroupSource> source,
 }
 
 IsolateGroup::~IsolateGroup() {
+  ASSERT(isolate_pool_.is_empty());
   // Ensure we destroy the heap before the other members.
   heap_ = nullptr;
   ASSERT(old_marking_stack_ == nullptr);
@@ -455,6 +475,57 @@ void IsolateGroup::RegisterIsolate(Isolate* isolate) {
   isolate_count_++;
 }
 
+Isolate* IsolateGroup::TakePooledIsolate() {
+  MutexLocker ml(&isolate_pool_mutex_);
+  if (isolate_pool_.is_empty()) {
+    return nullptr;
+  }
+  return isolate_pool_.RemoveLast();
+}
+
+bool IsolateGroup::AddPooledIsolate(Isolate* isolate) {
+  MutexLocker ml(&isolate_pool_mutex_);
+  if (isolate_pool_closed_ ||
+      isolate_pool_.length() >= FLAG_isolate_pool_size) {
+    return false;
+  }
+  isolate_pool_.Add(isolate);
+  return true;
+}
+
+bool IsolateGroup::IsolatePoolNeedsRefill() {
+  MutexLocker ml(&isolate_pool_mutex_);
+  return !isolate_pool_closed_ &&
+         isolate_pool_.length() < FLAG_isolate_pool_size;
+}
+
+void IsolateGroup::ShutdownIsolatePoolIfUnused() {
+  MallocGrowableArray<Isolate*> pooled_isolates;
+  {
+    MutexLocker ml(&isolate_pool_mutex_);
+    if (isolate_pool_.is_empty()) {
+      return;
+    }
+    {
+      SafepointReadRwLocker rl(Thread::Current(), isolates_lock_.get());
+      // Pooled isolates are only added while another isolate of the group is
+      // alive, so no isolate can be added once only pooled ones are left.
+      if (isolate_count_ != isolate_pool_.length()) {
+        return;
+      }
+    }
+    isolate_pool_closed_ = true;
+    while (!isolate_pool_.is_empty()) {
+      pooled_isolates.Add(isolate_pool_.RemoveLast());
+    }
+  }
+  // Shutting down the last pooled isolate deletes the group.
+  for (intptr_t i = 0; i < pooled_isolates.length(); i++) {
+    Dart_EnterIsolate(reinterpret_cast<Dart_Isolate>(pooled_isolates[i]));
+    Dart_ShutdownIsolate();
+  }
+}
+
 bool IsolateGroup::ContainsOnlyOneIsolate() {
   SafepointReadRwLocker ml(Thread::Current(), isolates_lock_.get());
   // We do allow 0 here as well, because the background compiler might call
@@ -526,9 +597,12 @@ void IsolateGroup::Shutdown() {
 
   // Wait for any pending GC tasks.
   if (heap_ != nullptr) {
-    // Wait for any concurrent GC tasks to finish before shutting down.
-    // TODO(rmacnak): Interrupt tasks for faster shutdown.
+    // Wait for any concurrent GC tasks to finish before shutting down. Nothing
+    // will allocate in this heap anymore, so sweeping is cut short and the
+    // unswept pages are freed together with the rest of the heap.
+    // TODO(rmacnak): Interrupt marking tasks for faster shutdown.
     PageSpace* old_space = heap_->old_space();
+    old_space->AbandonSweepingForShutdown();
     MonitorLocker ml(old_space->tasks_lock());
     while (old_space->tasks() > 0) {
       ml.Wait();
@@ -663,6 +737,20 @@ void IsolateGroup::PrintToJSONObject(JSONObject* jsobj, bool ref) {
       isolate_array.AddValue(isolate, /*ref=*/true);
     }
   }
+
+  {
+    JSONObject type_checks(jsobj, "_typeCheckRuntimeCalls");
+    const TypeCheckCounters& counters = type_check_counters_;
+    type_checks.AddProperty64("fromLazySpecializeStub",
+                              counters.from_lazy_specialize_stub);
+    type_checks.AddProperty64("fromSlowStub", counters.from_slow_stub);
+    type_checks.AddProperty64("fromInline", counters.from_inline);
+    type_checks.AddProperty64("stubsSpecialized", counters.stubs_specialized);
+    type_checks.AddProperty64("stubsRespecialized",
+                              counters.stubs_respecialized);
+    type_checks.AddProperty64("subtypeTestCacheUpdates",
+                              counters.cache_updates);
+  }
 }
 
 void IsolateGroup::PrintMemoryUsageJSON(JSONStream* stream) {
@@ -1084,6 +1172,7 @@ class IsolateMessageHandler : public MessageHandler {
 #ifndef PRODUCT
   void NotifyPauseOnStart();
   void NotifyPauseOnExit();
+  void NotifyTaskStarted(int64_t queueing_delay_micros, bool resumed);
 #endif  // !PRODUCT
 
 #if defined(DEBUG)
@@ -1472,6 +1561,15 @@ MessageHandler::MessageStatus IsolateMessageHandler::HandleMessage(
 }
 
 #ifndef PRODUCT
+void IsolateMessageHandler::NotifyTaskStarted(int64_t queueing_delay_micros,
+                                              bool resumed) {
+  I->GetSchedulingDelayMetric()->set_value(queueing_delay_micros);
+  I->GetSchedulingDelayMaxMetric()->SetValue(queueing_delay_micros);
+  if (resumed) {
+    I->GetSchedulingYieldsMetric()->increment();
+  }
+}
+
 void IsolateMessageHandler::NotifyPauseOnStart() {
   if (Isolate::IsSystemIsolate(I)) {
     return;
@@ -1940,6 +2038,13 @@ ObjectPtr IsolateGroup::CallTagHandler(Dart_LibraryTag tag,
 
 ObjectPtr Isolate::CallDeferredLoadHandler(intptr_t id) {
   Thread* thread = Thread::Current();
+#if defined(SUPPORT_TIMELINE)
+  while (deferred_load_request_micros_.length() <= id) {
+    deferred_load_request_micros_.Add(0);
+  }
+  deferred_load_request_micros_[id] =
+      OS::GetCurrentMonotonicMicrosForTimeline();
+#endif  // defined(SUPPORT_TIMELINE)
   Api::Scope api_scope(thread);
   Dart_Handle api_result;
   {
@@ -1950,6 +2055,28 @@ ObjectPtr Isolate::CallDeferredLoadHandler(intptr_t id) {
   return Api::UnwrapHandle(api_result);
 }
 
+#if defined(SUPPORT_TIMELINE)
+void Isolate::RecordDeferredLoadLatency(intptr_t id) {
+  if (id >= deferred_load_request_micros_.length() ||
+      deferred_load_request_micros_[id] == 0) {
+    // The embedder loaded the unit without being asked to.
+    return;
+  }
+  const int64_t start = deferred_load_request_micros_[id];
+  deferred_load_request_micros_[id] = 0;
+  TimelineStream* stream = Timeline::GetIsolateStream();
+  ASSERT(stream != nullptr);
+  TimelineEvent* event = stream->StartEvent();
+  if (event != nullptr) {
+    event->Duration("DeferredLoad", start,
+                    OS::GetCurrentMonotonicMicrosForTimeline());
+    event->SetNumArguments(1);
+    event->FormatArgument(0, "loadingUnit", "%" Pd, id);
+    event->Complete();
+  }
+}
+#endif  // defined(SUPPORT_TIMELINE)
+
 void IsolateGroup::SetupImagePage(const uint8_t* image_buffer,
                                   bool is_executable) {
   Image image(image_buffer);
@@ -2571,6 +2698,15 @@ void Isolate::Shutdown() {
 #endif
   }
 
+#if !defined(DART_PRECOMPILED_RUNTIME)
+  // Dump call counts of a training run while the program is still intact.
+  if (FLAG_write_aot_profile_to != nullptr && !Isolate::IsSystemIsolate(this)) {
+    StackZone zone(thread);
+    HandleScope handle_scope(thread);
+    AotProfile::Write(thread, FLAG_write_aot_profile_to);
+  }
+#endif  // !defined(DART_PRECOMPILED_RUNTIME)
+
 #if !defined(PRODUCT) && !defined(DART_PRECOMPILED_RUNTIME)
   if (FLAG_check_reloaded && is_runnable() && !Isolate::IsSystemIsolate(this)) {
     if (!group()->HasAttemptedReload()) {
@@ -2690,6 +2826,9 @@ void Isolate::LowLevelCleanup(Isolate* isolate) {
     // TODO(dartbug.com/36097): An isolate just died. A significant amount of
     // memory might have become unreachable. We should evaluate how to best
     // inform the GC about this situation.
+
+    // Must come last: it might delete the group.
+    isolate_group->ShutdownIsolatePoolIfUnused();
   }
 }
 
@@ -58,6 +58,7 @@ class IsolateGroupReloadContext;
 class IsolateMessageHandler;
 class IsolateObjectStore;
 class IsolateProfilerData;
+class JitFunctionStatistics;
 class Log;
 class Message;
 class MessageHandler;
@@ -79,6 +80,7 @@ class SendPort;
 class SerializedObjectBuffer;
 class ServiceIdZone;
 class Simulator;
+class StackFrameSymbolCache;
 class StackResource;
 class StackZone;
 class StoreBuffer;
@@ -326,6 +328,20 @@ class IsolateGroup : public IntrusiveDListEntry<IsolateGroup> {
 
   bool ContainsOnlyOneIsolate();
 
+  // Isolates created ahead of time for lightweight spawns (see
+  // --isolate-pool-size). A pooled isolate is initialized by the embedder but
+  // not runnable, and no thread has it entered.
+  //
+  // Returns nullptr if the pool is empty.
+  Isolate* TakePooledIsolate();
+  // Returns false if the pool is full or was shut down, in which case the
+  // caller has to shut down [isolate].
+  bool AddPooledIsolate(Isolate* isolate);
+  bool IsolatePoolNeedsRefill();
+  // Shuts down the pooled isolates once they are the only isolates left in
+  // the group. The group might be deleted when this returns.
+  void ShutdownIsolatePoolIfUnused();
+
   void RunWithLockedGroup(std::function<void()> fun);
 
   void ScheduleInterrupts(uword interrupt_bits);
@@ -508,12 +524,38 @@ class IsolateGroup : public IntrusiveDListEntry<IsolateGroup> {
 
   StoreBuffer* store_buffer() const { return store_buffer_.get(); }
   ObjectStore* object_store() const { return object_store_.get(); }
+#if defined(DART_PRECOMPILED_RUNTIME)
+  StackFrameSymbolCache* stack_frame_symbol_cache() const {
+    return stack_frame_symbol_cache_.get();
+  }
+#endif  // defined(DART_PRECOMPILED_RUNTIME)
+#if !defined(DART_PRECOMPILED_RUNTIME)
+  JitFunctionStatistics* jit_function_statistics() const {
+    return jit_function_statistics_.get();
+  }
+#endif  // !defined(DART_PRECOMPILED_RUNTIME)
   Mutex* symbols_mutex() { return &symbols_mutex_; }
   Mutex* type_canonicalization_mutex() { return &type_canonicalization_mutex_; }
   Mutex* type_arguments_canonicalization_mutex() {
     return &type_arguments_canonicalization_mutex_;
   }
   Mutex* subtype_test_cache_mutex() { return &subtype_test_cache_mutex_; }
+
+  // Counts of type checks which were not decided by a type testing stub or
+  // inline code and reached the TypeCheck runtime entry, reported by the
+  // service in the isolate group.
+  struct TypeCheckCounters {
+    // Calls by the TypeCheckMode of the entry.
+    RelaxedAtomic<intptr_t> from_lazy_specialize_stub = {0};
+    RelaxedAtomic<intptr_t> from_slow_stub = {0};
+    RelaxedAtomic<intptr_t> from_inline = {0};
+    // Specialized type testing stubs installed by the entry.
+    RelaxedAtomic<intptr_t> stubs_specialized = {0};
+    RelaxedAtomic<intptr_t> stubs_respecialized = {0};
+    // Requests by the entry to add a result to a SubtypeTestCache.
+    RelaxedAtomic<intptr_t> cache_updates = {0};
+  };
+  TypeCheckCounters* type_check_counters() { return &type_check_counters_; }
   Mutex* megamorphic_table_mutex() { return &megamorphic_table_mutex_; }
   Mutex* type_feedback_mutex() { return &type_feedback_mutex_; }
   Mutex* patchable_call_mutex() { return &patchable_call_mutex_; }
@@ -834,8 +876,17 @@ class IsolateGroup : public IntrusiveDListEntry<IsolateGroup> {
   IdleTimeHandler idle_time_handler_;
   std::unique_ptr<MutatorThreadPool> thread_pool_;
   std::unique_ptr<SafepointRwLock> isolates_lock_;
+#if defined(DART_PRECOMPILED_RUNTIME)
+  std::unique_ptr<StackFrameSymbolCache> stack_frame_symbol_cache_;
+#endif  // defined(DART_PRECOMPILED_RUNTIME)
+#if !defined(DART_PRECOMPILED_RUNTIME)
+  std::unique_ptr<JitFunctionStatistics> jit_function_statistics_;
+#endif  // !defined(DART_PRECOMPILED_RUNTIME)
   IntrusiveDList<Isolate> isolates_;
   intptr_t isolate_count_ = 0;
+  Mutex isolate_pool_mutex_;
+  MallocGrowableArray<Isolate*> isolate_pool_;
+  bool isolate_pool_closed_ = false;
   bool initial_spawn_successful_ = false;
   Dart_LibraryTagHandler library_tag_handler_ = nullptr;
   Dart_DeferredLoadHandler deferred_load_handler_ = nullptr;
@@ -895,6 +946,7 @@ class IsolateGroup : public IntrusiveDListEntry<IsolateGroup> {
   Mutex type_canonicalization_mutex_;
   Mutex type_arguments_canonicalization_mutex_;
   Mutex subtype_test_cache_mutex_;
+  TypeCheckCounters type_check_counters_;
   Mutex megamorphic_table_mutex_;
   Mutex type_feedback_mutex_;
   Mutex patchable_call_mutex_;
@@ -1045,6 +1097,19 @@ class Isolate : public BaseIsolate, public IntrusiveDListEntry<Isolate> {
 
   int64_t UptimeMicros() const;
 
+  // Resources used by this isolate, for attributing the cost of isolates
+  // which share a group.
+  //
+  // CPU time is the thread CPU time spent while this isolate was entered,
+  // up to the last time it was exited. Allocated bytes count new-space
+  // allocations, accounted when a TLAB is released. GC time is the wall
+  // time of collections triggered by this isolate's mutator.
+  int64_t cpu_time_micros() const { return cpu_time_micros_; }
+  int64_t allocated_bytes() const { return allocated_bytes_; }
+  int64_t gc_time_micros() const { return gc_time_micros_; }
+  void AddAllocatedBytes(intptr_t bytes) { allocated_bytes_ += bytes; }
+  void AddGCTime(int64_t micros) { gc_time_micros_ += micros; }
+
   Dart_Port main_port() const { return main_port_; }
   void set_main_port(Dart_Port port) {
     ASSERT(main_port_ == 0);  // Only set main port once.
@@ -1083,6 +1148,11 @@ class Isolate : public BaseIsolate, public IntrusiveDListEntry<Isolate> {
     return group()->deferred_load_handler() != nullptr;
   }
   ObjectPtr CallDeferredLoadHandler(intptr_t id);
+#if defined(SUPPORT_TIMELINE)
+  // Reports the time between the deferred load handler being called for the
+  // given loading unit and the load completing to the timeline.
+  void RecordDeferredLoadLatency(intptr_t id);
+#endif  // defined(SUPPORT_TIMELINE)
 
   void ScheduleInterrupts(uword interrupt_bits);
 
@@ -1654,6 +1724,10 @@ class Isolate : public BaseIsolate, public IntrusiveDListEntry<Isolate> {
 
   // All other fields go here.
   int64_t start_time_micros_;
+  int64_t cpu_time_entry_micros_ = 0;
+  RelaxedAtomic<int64_t> cpu_time_micros_ = {0};
+  RelaxedAtomic<int64_t> allocated_bytes_ = {0};
+  RelaxedAtomic<int64_t> gc_time_micros_ = {0};
   std::atomic<Dart_MessageNotifyCallback> message_notify_callback_;
   Dart_IsolateShutdownCallback on_shutdown_callback_ = nullptr;
   Dart_IsolateCleanupCallback on_cleanup_callback_ = nullptr;
@@ -1738,6 +1812,11 @@ class Isolate : public BaseIsolate, public IntrusiveDListEntry<Isolate> {
 
   ArrayPtr loaded_prefixes_set_storage_;
 
+#if defined(SUPPORT_TIMELINE)
+  // When the deferred load handler was called, indexed by loading unit id.
+  MallocGrowableArray<int64_t> deferred_load_request_micros_;
+#endif  // defined(SUPPORT_TIMELINE)
+
   MallocGrowableArray<ObjectPtr> pointers_to_verify_at_exit_;
 
 #define REUSABLE_FRIEND_DECLARATION(name)                                      \
@@ -66,6 +66,21 @@ DECLARE_FLAG(bool, trace_deoptimization);
   TimelineBeginEndScope tbes##name(Thread::Current(),                          \
                                    Timeline::GetIsolateStream(), #name)
 
+// Accumulates the time spent in a reload phase for the reload report.
+class IsolateGroupReloadContext::PhaseTimer : public ValueObject {
+ public:
+  PhaseTimer(IsolateGroupReloadContext* context, ReloadPhase phase)
+      : micros_(&context->phase_micros_[phase]),
+        start_micros_(OS::GetCurrentMonotonicMicros()) {}
+  ~PhaseTimer() { *micros_ += OS::GetCurrentMonotonicMicros() - start_micros_; }
+
+ private:
+  int64_t* const micros_;
+  const int64_t start_micros_;
+};
+
+#define RELOAD_PHASE_SCOPE(name) PhaseTimer phase_timer##name(this, k##name)
+
 // The ObjectLocator is used for collecting instances that
 // needs to be morphed.
 class ObjectLocator : public ObjectVisitor {
@@ -715,38 +730,42 @@ bool IsolateGroupReloadContext::Reload(bool force_reload,
     intptr_t* p_num_received_classes = nullptr;
     intptr_t* p_num_received_procedures = nullptr;
 
-    // ReadKernelFromFile checks to see if the file at
-    // root_script_url is a valid .dill file. If that's the case, a Program*
-    // is returned. Otherwise, this is likely a source file that needs to be
-    // compiled, so ReadKernelFromFile returns nullptr.
-    kernel_program = kernel::Program::ReadFromFile(root_script_url);
-    if (kernel_program != nullptr) {
-      num_received_libs_ = kernel_program->library_count();
-      bytes_received_libs_ = kernel_program->binary().LengthInBytes();
-      p_num_received_classes = &num_received_classes_;
-      p_num_received_procedures = &num_received_procedures_;
-    } else {
-      if (kernel_buffer == nullptr || kernel_buffer_size == 0) {
-        char* error = CompileToKernel(force_reload, packages_url,
-                                      &kernel_buffer, &kernel_buffer_size);
-        did_kernel_compilation = true;
-        if (error != nullptr) {
-          TIR_Print("---- LOAD FAILED, ABORTING RELOAD\n");
-          const auto& error_str = String::Handle(Z, String::New(error));
-          free(error);
-          const ApiError& error = ApiError::Handle(Z, ApiError::New(error_str));
-          AddReasonForCancelling(new Aborted(Z, error));
-          ReportReasonsForCancelling();
-          CommonFinalizeTail(num_old_libs_);
-
-          RejectCompilation(thread);
-          return false;
+    {
+      RELOAD_PHASE_SCOPE(ReadKernel);
+      // ReadKernelFromFile checks to see if the file at
+      // root_script_url is a valid .dill file. If that's the case, a Program*
+      // is returned. Otherwise, this is likely a source file that needs to be
+      // compiled, so ReadKernelFromFile returns nullptr.
+      kernel_program = kernel::Program::ReadFromFile(root_script_url);
+      if (kernel_program != nullptr) {
+        num_received_libs_ = kernel_program->library_count();
+        bytes_received_libs_ = kernel_program->binary().LengthInBytes();
+        p_num_received_classes = &num_received_classes_;
+        p_num_received_procedures = &num_received_procedures_;
+      } else {
+        if (kernel_buffer == nullptr || kernel_buffer_size == 0) {
+          char* error = CompileToKernel(force_reload, packages_url,
+                                        &kernel_buffer, &kernel_buffer_size);
+          did_kernel_compilation = true;
+          if (error != nullptr) {
+            TIR_Print("---- LOAD FAILED, ABORTING RELOAD\n");
+            const auto& error_str = String::Handle(Z, String::New(error));
+            free(error);
+            const ApiError& error =
+                ApiError::Handle(Z, ApiError::New(error_str));
+            AddReasonForCancelling(new Aborted(Z, error));
+            ReportReasonsForCancelling();
+            CommonFinalizeTail(num_old_libs_);
+
+            RejectCompilation(thread);
+            return false;
+          }
         }
+        const auto& typed_data = ExternalTypedData::Handle(
+            Z, ExternalTypedData::NewFinalizeWithFree(
+                   const_cast<uint8_t*>(kernel_buffer), kernel_buffer_size));
+        kernel_program = kernel::Program::ReadFromTypedData(typed_data);
       }
-      const auto& typed_data = ExternalTypedData::Handle(
-          Z, ExternalTypedData::NewFinalizeWithFree(
-                 const_cast<uint8_t*>(kernel_buffer), kernel_buffer_size));
-      kernel_program = kernel::Program::ReadFromTypedData(typed_data);
     }
 
     NoActiveIsolateScope no_active_isolate_scope;
@@ -755,6 +774,7 @@ bool IsolateGroupReloadContext::Reload(bool force_reload,
     source->add_loaded_blob(Z,
                             ExternalTypedData::Cast(kernel_program->binary()));
 
+    RELOAD_PHASE_SCOPE(FindModifiedLibraries);
     modified_libs_ = new (Z) BitVector(Z, num_old_libs_);
     kernel::KernelLoader::FindModifiedLibraries(
         kernel_program.get(), IG, modified_libs_, force_reload, &skip_reload,
@@ -817,9 +837,13 @@ bool IsolateGroupReloadContext::Reload(bool force_reload,
   // assumptions from field guards or CHA or deferred library prefixes.
   // TODO(johnmccutchan): Deoptimizing dependent code here (before the reload)
   // is paranoid. This likely can be moved to the commit phase.
-  IG->program_reload_context()->EnsuredUnoptimizedCodeForStack();
-  IG->program_reload_context()->DeoptimizeDependentCode();
-  IG->program_reload_context()->ReloadPhase1AllocateStorageMapsAndCheckpoint();
+  {
+    RELOAD_PHASE_SCOPE(Checkpoint);
+    IG->program_reload_context()->EnsuredUnoptimizedCodeForStack();
+    IG->program_reload_context()->DeoptimizeDependentCode();
+    IG->program_reload_context()
+        ->ReloadPhase1AllocateStorageMapsAndCheckpoint();
+  }
 
   // Renumbering the libraries has invalidated this.
   modified_libs_ = nullptr;
@@ -834,6 +858,7 @@ bool IsolateGroupReloadContext::Reload(bool force_reload,
   // Clone the class table.
   {
     TIMELINE_SCOPE(CheckpointClasses);
+    RELOAD_PHASE_SCOPE(Checkpoint);
     IG->program_reload_context()->CheckpointClasses();
   }
 
@@ -848,9 +873,12 @@ bool IsolateGroupReloadContext::Reload(bool force_reload,
   //
   // If loading the hot-reload diff succeeded we'll finalize the loading, which
   // will either commit or reject the reload request.
-  const auto& result =
-      Object::Handle(Z, IG->program_reload_context()->ReloadPhase2LoadKernel(
-                            kernel_program.get(), root_lib_url_));
+  auto& result = Object::Handle(Z);
+  {
+    RELOAD_PHASE_SCOPE(LoadKernel);
+    result = IG->program_reload_context()->ReloadPhase2LoadKernel(
+        kernel_program.get(), root_lib_url_);
+  }
 
   if (result.IsError()) {
     TIR_Print("---- LOAD FAILED, ABORTING RELOAD\n");
@@ -864,7 +892,10 @@ bool IsolateGroupReloadContext::Reload(bool force_reload,
     ASSERT(!reload_skipped_ && !reload_finalized_);
     TIR_Print("---- LOAD SUCCEEDED\n");
 
-    IG->program_reload_context()->ReloadPhase3FinalizeLoading();
+    {
+      RELOAD_PHASE_SCOPE(FinalizeLoading);
+      IG->program_reload_context()->ReloadPhase3FinalizeLoading();
+    }
 
     if (FLAG_gc_during_reload) {
       // We force the GC to compact, which is more likely to discover untracked
@@ -886,7 +917,10 @@ bool IsolateGroupReloadContext::Reload(bool force_reload,
 
     if (!FLAG_reload_force_rollback && !HasReasonsForCancelling()) {
       TIR_Print("---- COMMITTING RELOAD\n");
-      isolate_group_->program_reload_context()->ReloadPhase4CommitPrepare();
+      {
+        RELOAD_PHASE_SCOPE(CommitPrepare);
+        isolate_group_->program_reload_context()->ReloadPhase4CommitPrepare();
+      }
       bool discard_class_tables = true;
       if (HasInstanceMorphers()) {
         // Find all objects that need to be morphed (reallocated to a new
@@ -894,6 +928,7 @@ bool IsolateGroupReloadContext::Reload(bool force_reload,
         ObjectLocator locator(this);
         {
           TIMELINE_SCOPE(CollectInstances);
+          RELOAD_PHASE_SCOPE(MorphInstances);
           HeapIterationScope iteration(thread);
           iteration.IterateObjects(&locator);
         }
@@ -907,6 +942,7 @@ bool IsolateGroupReloadContext::Reload(bool force_reload,
         const intptr_t count = locator.count();
         if (count > 0) {
           TIMELINE_SCOPE(MorphInstances);
+          RELOAD_PHASE_SCOPE(MorphInstances);
 
           // While we are reallocating instances to their new layout, the heap
           // will contain a mix of instances with the old and new layouts that
@@ -963,7 +999,10 @@ bool IsolateGroupReloadContext::Reload(bool force_reload,
       if (discard_class_tables) {
         IG->DropOriginalClassTable();
       }
-      isolate_group_->program_reload_context()->ReloadPhase4CommitFinish();
+      {
+        RELOAD_PHASE_SCOPE(CommitFinish);
+        isolate_group_->program_reload_context()->ReloadPhase4CommitFinish();
+      }
       TIR_Print("---- DONE COMMIT\n");
       isolate_group_->set_last_reload_timestamp(reload_timestamp_);
     } else {
@@ -1310,6 +1349,15 @@ void IsolateGroupReloadContext::ReportOnJSON(JSONStream* stream,
           final_library_count - num_saved_libs_;
       details.AddProperty("savedLibraryCount", num_saved_libs_);
       details.AddProperty("loadedLibraryCount", loaded_library_count);
+      {
+        JSONObject timings(&details, "phaseMicros");
+#define ADD_PHASE_TIMING(Name, json_name)                                      \
+  timings.AddProperty64(json_name, phase_micros_[k##Name]);
+        RELOAD_PHASE_LIST(ADD_PHASE_TIMING)
+#undef ADD_PHASE_TIMING
+      }
+      details.AddProperty64(
+          "totalMicros", OS::GetCurrentMonotonicMicros() - start_time_micros_);
       JSONArray array(&jsobj, "shapeChangeMappings");
       for (intptr_t i = 0; i < instance_morphers_.length(); i++) {
         instance_morphers_.At(i)->AppendTo(&array);
@@ -218,6 +218,27 @@ class IsolateGroupReloadContext {
 
   void ForEachIsolate(std::function<void(Isolate*)> callback);
 
+  // Phases of a reload whose wall-clock time is included in the reload report
+  // so that slow reloads of large programs can be attributed.
+#define RELOAD_PHASE_LIST(V)                                                   \
+  V(ReadKernel, "readKernel")                                                  \
+  V(FindModifiedLibraries, "findModifiedLibraries")                            \
+  V(Checkpoint, "checkpoint")                                                  \
+  V(LoadKernel, "loadKernel")                                                  \
+  V(FinalizeLoading, "finalizeLoading")                                        \
+  V(CommitPrepare, "commitPrepare")                                            \
+  V(MorphInstances, "morphInstances")                                          \
+  V(CommitFinish, "commitFinish")
+
+  enum ReloadPhase {
+#define DECLARE_RELOAD_PHASE(Name, json_name) k##Name,
+    RELOAD_PHASE_LIST(DECLARE_RELOAD_PHASE)
+#undef DECLARE_RELOAD_PHASE
+    kNumReloadPhases,
+  };
+
+  class PhaseTimer;
+
   // The zone used for all reload related allocations.
   Zone* zone_;
 
@@ -236,6 +257,7 @@ class IsolateGroupReloadContext {
   intptr_t num_received_classes_ = -1;
   intptr_t num_received_procedures_ = -1;
   intptr_t num_saved_libs_ = -1;
+  int64_t phase_micros_[kNumReloadPhases] = {};
 
   // Required trait for the instance_morpher_by_cid_;
   struct MorpherTrait {
@@ -99,6 +99,8 @@ void JSONStream::Setup(Zone* zone,
 }
 
 void JSONStream::SetupError() {
+  // Parts of the result may already have been sent.
+  ASSERT(reply_chunks_posted_ == 0);
   Clear();
   buffer()->Printf("{\"jsonrpc\":\"2.0\", \"error\":");
 }
@@ -193,6 +195,60 @@ static void Finalizer(void* isolate_callback_data, void* buffer) {
   free(buffer);
 }
 
+// Posts |length| bytes of a reply to |port|, transferring ownership of
+// |cstr|. All but the last part of a chunked reply are marked as partial.
+static bool PostReplyBytes(Dart_Port port,
+                           char* cstr,
+                           intptr_t length,
+                           bool partial) {
+  TransitionVMToNative transition(Thread::Current());
+  Dart_CObject bytes;
+  bytes.type = Dart_CObject_kExternalTypedData;
+  bytes.value.as_external_typed_data.type = Dart_TypedData_kUint8;
+  bytes.value.as_external_typed_data.length = length;
+  bytes.value.as_external_typed_data.data = reinterpret_cast<uint8_t*>(cstr);
+  bytes.value.as_external_typed_data.peer = cstr;
+  bytes.value.as_external_typed_data.callback = Finalizer;
+  Dart_CObject more;
+  more.type = Dart_CObject_kBool;
+  more.value.as_bool = true;
+  Dart_CObject* elements[2];
+  elements[0] = &bytes;
+  elements[1] = &more;
+  Dart_CObject message;
+  message.type = Dart_CObject_kArray;
+  message.value.as_array.length = partial ? 2 : 1;
+  message.value.as_array.values = elements;
+  return Dart_PostCObject(port, &message);
+}
+
+void JSONStream::EnableChunkedReply() {
+  if (reply_port_ == ILLEGAL_PORT || seq_ == nullptr || seq_->IsNull()) {
+    // Nobody receives the reply in parts.
+    return;
+  }
+  chunked_reply_ = true;
+  buffer()->Reserve(kReplyChunkSize);
+}
+
+void JSONStream::MaybePostReplyChunk() {
+  ASSERT(chunked_reply_);
+  if (buffer()->length() < kReplyChunkSize) {
+    return;
+  }
+  char* cstr;
+  intptr_t length;
+  // The next chunk usually overshoots the chunk size by a little.
+  writer_.StealChunk(&cstr, &length, kReplyChunkSize + kReplyChunkSize / 8);
+  if (PostReplyBytes(reply_port_, cstr, length, /*partial=*/true)) {
+    reply_chunks_posted_++;
+  } else {
+    // The receiver is gone, so the final part will not be delivered either.
+    free(cstr);
+    chunked_reply_ = false;
+  }
+}
+
 void JSONStream::PostReply() {
   ASSERT(seq_ != nullptr);
   Dart_Port port = reply_port();
@@ -227,25 +283,8 @@ void JSONStream::PostReply() {
   intptr_t length;
   Steal(&cstr, &length);
 
-  bool result;
-  {
-    TransitionVMToNative transition(Thread::Current());
-    Dart_CObject bytes;
-    bytes.type = Dart_CObject_kExternalTypedData;
-    bytes.value.as_external_typed_data.type = Dart_TypedData_kUint8;
-    bytes.value.as_external_typed_data.length = length;
-    bytes.value.as_external_typed_data.data = reinterpret_cast<uint8_t*>(cstr);
-    bytes.value.as_external_typed_data.peer = cstr;
-    bytes.value.as_external_typed_data.callback = Finalizer;
-    Dart_CObject* elements[1];
-    elements[0] = &bytes;
-    Dart_CObject message;
-    message.type = Dart_CObject_kArray;
-    message.value.as_array.length = 1;
-    message.value.as_array.values = elements;
-    result = Dart_PostCObject(port, &message);
-  }
-
+  chunked_reply_ = false;
+  const bool result = PostReplyBytes(port, cstr, length, /*partial=*/false);
   if (!result) {
     free(cstr);
   }
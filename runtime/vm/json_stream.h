@@ -91,6 +91,12 @@ class JSONStream : ValueObject {
 
   void PostReply();
 
+  // Sends the reply to the service isolate in parts of about
+  // kReplyChunkSize bytes as they are completed, instead of building it in a
+  // single buffer. Handlers producing large replies call this once they can
+  // no longer fail, since an error cannot replace output already sent.
+  void EnableChunkedReply();
+
   void set_id_zone(ServiceIdZone* id_zone) { id_zone_ = id_zone; }
   ServiceIdZone* id_zone() { return id_zone_; }
 
@@ -179,6 +185,7 @@ class JSONStream : ValueObject {
   void Clear() { writer_.Clear(); }
 
   void PostNullReply(Dart_Port port);
+  void MaybePostReplyChunk();
 
   void OpenObject(const char* property_name = nullptr) {
     if (ignore_object_depth_ > 0 ||
@@ -194,6 +201,7 @@ class JSONStream : ValueObject {
       return;
     }
     writer_.CloseObject();
+    if (chunked_reply_) MaybePostReplyChunk();
   }
   void UncloseObject() {
     // This should be updated to handle unclosing a private object if we need
@@ -215,6 +223,7 @@ class JSONStream : ValueObject {
       return;
     }
     writer_.CloseArray();
+    if (chunked_reply_) MaybePostReplyChunk();
   }
 
   // Append the Base64 encoding of |bytes| to the stream.
@@ -359,6 +368,11 @@ class JSONStream : ValueObject {
   int64_t setup_time_micros_;
   bool include_private_members_;
   intptr_t ignore_object_depth_;
+  bool chunked_reply_ = false;
+  intptr_t reply_chunks_posted_ = 0;
+
+  static constexpr intptr_t kReplyChunkSize = 1 * MB;
+
   friend class JSONObject;
   friend class JSONArray;
   friend class JSONBase64String;
@@ -20,6 +20,27 @@ TEST_CASE(JSON_TextBuffer) {
   EXPECT_STREQ("{ \"length\" : 175, \"command\" : \"stopIt\" }", w.buffer());
 }
 
+TEST_CASE(JSON_JSONWriter_StealChunk) {
+  JSONWriter writer;
+  writer.OpenArray();
+  writer.PrintValue(static_cast<intptr_t>(1));
+  char* first;
+  intptr_t first_length;
+  writer.StealChunk(&first, &first_length, 16);
+  // The next value still needs a separating comma.
+  writer.PrintValue(static_cast<intptr_t>(2));
+  writer.CloseArray();
+  char* second;
+  intptr_t second_length;
+  writer.Steal(&second, &second_length);
+  EXPECT_EQ(2, first_length);
+  EXPECT(strncmp("[1", first, first_length) == 0);
+  EXPECT_STREQ(",2]", second);
+  EXPECT_EQ(3, second_length);
+  free(first);
+  free(second);
+}
+
 TEST_CASE(JSON_JSONStream_Primitives) {
   {
     JSONStream js;
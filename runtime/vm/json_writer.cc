@@ -84,6 +84,7 @@ void JSONWriter::AppendSerializedObject(const char* property_name,
 void JSONWriter::Clear() {
   buffer_.Clear();
   open_objects_ = 0;
+  last_chunk_char_ = '\0';
 }
 
 void JSONWriter::OpenObject(const char* property_name) {
@@ -304,6 +305,20 @@ void JSONWriter::Steal(char** buffer, intptr_t* buffer_length) {
   *buffer = buffer_.Steal();
 }
 
+void JSONWriter::StealChunk(char** buffer,
+                            intptr_t* buffer_length,
+                            intptr_t capacity) {
+  ASSERT(buffer != nullptr);
+  ASSERT(buffer_length != nullptr);
+  const intptr_t length = buffer_.length();
+  if (length > 0) {
+    last_chunk_char_ = buffer_.buffer()[length - 1];
+  }
+  *buffer_length = length;
+  *buffer = buffer_.Steal();
+  buffer_.Reserve(capacity);
+}
+
 void JSONWriter::PrintPropertyName(const char* name) {
   ASSERT(name != nullptr);
   PrintCommaIfNeeded();
@@ -326,10 +341,10 @@ void JSONWriter::PrintCommaIfNeeded() {
 bool JSONWriter::NeedComma() {
   const char* buffer = buffer_.buffer();
   intptr_t length = buffer_.length();
-  if (length == 0) {
+  char ch = length == 0 ? last_chunk_char_ : buffer[length - 1];
+  if (ch == '\0') {
     return false;
   }
-  char ch = buffer[length - 1];
   return (ch != '[') && (ch != '{') && (ch != ':') && (ch != ',');
 }
 
@@ -21,6 +21,11 @@ class JSONWriter : ValueObject {
 
   void Steal(char** buffer, intptr_t* buffer_length);
 
+  // Takes ownership of the output written so far, which may end in the
+  // middle of the document. Later output continues the same document in a
+  // fresh buffer with room for |capacity| characters.
+  void StealChunk(char** buffer, intptr_t* buffer_length, intptr_t capacity);
+
   void PrintCommaIfNeeded();
 
   // Append |buffer| to the stream.
@@ -97,6 +102,9 @@ class JSONWriter : ValueObject {
 
   intptr_t open_objects_;
   TextBuffer buffer_;
+  // The last character of the most recently stolen chunk, consulted when
+  // deciding on a comma at the start of the next one.
+  char last_chunk_char_ = '\0';
 };
 
 }  // namespace dart
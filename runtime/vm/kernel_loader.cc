@@ -9,6 +9,7 @@
 
 #include <memory>
 
+#include "vm/class_finalizer.h"
 #include "vm/closure_functions_cache.h"
 #include "vm/compiler/backend/flow_graph_compiler.h"
 #include "vm/compiler/frontend/constant_reader.h"
@@ -55,6 +56,12 @@ DEFINE_FLAG_HANDLER(EnableExperimentSharedData,
                     experimental_shared_data,
                     "Enable experiment to share data between isolates.");
 
+DEFINE_FLAG(bool,
+            lazy_kernel_class_loading,
+            false,
+            "Only read the names of the classes of non-dart: libraries when "
+            "loading kernel and load their declarations on first use.");
+
 class SimpleExpressionConverter {
  public:
   SimpleExpressionConverter(TranslationHelper* translation_helper,
@@ -750,12 +757,37 @@ void KernelLoader::walk_incremental_kernel(BitVector* modified_libs,
   }
 }
 
+// Without an inferred type (e.g. when the program was not processed by
+// TFA), instance fields can still be unboxed based on their declared type:
+// with sound null safety a non-nullable double or int field holds nothing
+// else, regardless of who writes it.
+static void UnboxFieldBasedOnDeclaredType(const Field& field) {
+  if (field.is_late() || field.is_static()) {
+    return;
+  }
+  const AbstractType& type = AbstractType::Handle(field.type());
+  if (!type.IsNonNullable()) {
+    return;
+  }
+  if (type.IsDoubleType()) {
+    field.set_guarded_cid(kDoubleCid);
+  } else if (!type.IsIntType()) {
+    return;
+  }
+  field.set_is_nullable(false);
+  field.set_guarded_list_length(Field::kNoFixedLength);
+  field.set_is_unboxed(true);
+}
+
 void KernelLoader::ReadInferredType(const Field& field,
                                     intptr_t kernel_offset) {
   const InferredTypeMetadata type =
       inferred_type_metadata_helper_.GetInferredType(kernel_offset,
                                                      /*read_constant=*/false);
   if (type.IsTrivial()) {
+    if (FLAG_precompiled_mode) {
+      UnboxFieldBasedOnDeclaredType(field);
+    }
     return;
   }
   field.set_guarded_cid(type.cid);
@@ -828,6 +860,16 @@ LibraryPtr KernelLoader::LoadLibrary(intptr_t index) {
 
   if (library.Loaded()) return library.ptr();
 
+#if defined(SUPPORT_TIMELINE)
+  TimelineBeginEndScope tbes(thread_, Timeline::GetIsolateStream(),
+                             "LoadLibrary");
+  if (tbes.enabled()) {
+    tbes.SetNumArguments(1);
+    tbes.CopyArgument(0, "library",
+                      String::Handle(Z, library.url()).ToCString());
+  }
+#endif  // defined(SUPPORT_TIMELINE)
+
   const NNBDCompiledMode mode =
       library_helper.GetNonNullableByDefaultCompiledMode();
   if (mode == NNBDCompiledMode::kInvalid) {
@@ -918,12 +960,22 @@ LibraryPtr KernelLoader::LoadLibrary(intptr_t index) {
   const GrowableObjectArray& classes =
       GrowableObjectArray::Handle(Z, IG->object_store()->pending_classes());
 
+  // Only register the classes if their declarations are loaded on first use
+  // (see LoadClassDeclarationLazily).
+  const bool load_classes_lazily =
+      register_class && ShouldLoadClassesLazily(library);
+
   // Load all classes.
   intptr_t next_class_offset = library_index.ClassOffset(0);
   Class& klass = Class::Handle(Z);
   for (intptr_t i = 0; i < class_count; ++i) {
     helper_.SetOffset(next_class_offset);
     next_class_offset = library_index.ClassOffset(i + 1);
+    if (load_classes_lazily) {
+      ClassHelper class_helper(&helper_);
+      LoadClassHeader(library, &class_helper, &klass);
+      continue;
+    }
     LoadClass(library, toplevel_class, next_class_offset, &klass);
     if (register_class) {
       classes.Add(klass, Heap::kOld);
@@ -1331,33 +1383,46 @@ void KernelLoader::LoadPreliminaryClass(ClassHelper* class_helper,
   }
 }
 
-void KernelLoader::LoadClass(const Library& library,
-                             const Class& toplevel_class,
-                             intptr_t class_end,
-                             Class* out_class) {
-  intptr_t class_offset = helper_.ReaderOffset();
-  ClassIndex class_index(program_->binary(), class_offset,
-                         class_end - class_offset);
+bool KernelLoader::ShouldLoadClassesLazily(const Library& library) {
+  return FLAG_lazy_kernel_class_loading && !FLAG_precompiled_mode &&
+         !loading_native_wrappers_library_ && !IG->IsReloading() &&
+         !library.is_dart_scheme();
+}
 
-  ClassHelper class_helper(&helper_);
-  class_helper.ReadUntilIncluding(ClassHelper::kCanonicalName);
-  *out_class = LookupClass(library, class_helper.canonical_name_);
+void KernelLoader::LoadClassHeader(const Library& library,
+                                   ClassHelper* class_helper,
+                                   Class* out_class) {
+  const intptr_t class_offset = helper_.ReaderOffset();
+  class_helper->ReadUntilIncluding(ClassHelper::kCanonicalName);
+  *out_class = LookupClass(library, class_helper->canonical_name_);
   out_class->set_kernel_offset(class_offset - correction_offset_);
 
   // The class needs to have a script because all the functions in the class
   // will inherit it.  The predicate Function::IsOptimizable uses the absence of
   // a script to detect test functions that should not be optimized.
   if (out_class->script() == Script::null()) {
-    class_helper.ReadUntilIncluding(ClassHelper::kSourceUriIndex);
+    class_helper->ReadUntilIncluding(ClassHelper::kSourceUriIndex);
     const Script& script =
-        Script::Handle(Z, ScriptAt(class_helper.source_uri_index_));
+        Script::Handle(Z, ScriptAt(class_helper->source_uri_index_));
     out_class->set_script(script);
   }
   if (out_class->token_pos() == TokenPosition::kNoSource) {
-    class_helper.ReadUntilIncluding(ClassHelper::kEndPosition);
-    out_class->set_token_pos(class_helper.start_position_);
-    out_class->set_end_token_pos(class_helper.end_position_);
+    class_helper->ReadUntilIncluding(ClassHelper::kEndPosition);
+    out_class->set_token_pos(class_helper->start_position_);
+    out_class->set_end_token_pos(class_helper->end_position_);
   }
+}
+
+void KernelLoader::LoadClass(const Library& library,
+                             const Class& toplevel_class,
+                             intptr_t class_end,
+                             Class* out_class) {
+  intptr_t class_offset = helper_.ReaderOffset();
+  ClassIndex class_index(*helper_.reader_.typed_data(), class_offset,
+                         class_end - class_offset);
+
+  ClassHelper class_helper(&helper_);
+  LoadClassHeader(library, &class_helper, out_class);
 
   class_helper.ReadUntilIncluding(ClassHelper::kFlags);
   if (class_helper.is_enum_class()) {
@@ -1733,6 +1798,66 @@ void KernelLoader::FinishLoading(const Class& klass) {
                                    class_index, &class_helper);
 }
 
+bool KernelLoader::LoadClassDeclarationLazily(const Class& klass) {
+  if (!FLAG_lazy_kernel_class_loading || klass.is_declaration_loaded() ||
+      (klass.kernel_offset() <= 0)) {
+    return false;
+  }
+  Thread* thread = Thread::Current();
+  Zone* zone = thread->zone();
+  const Library& library = Library::Handle(zone, klass.library());
+  // Classes of libraries which are still being loaded are loaded eagerly.
+  if (library.IsNull() || !library.Loaded()) {
+    return false;
+  }
+
+  {
+    SafepointWriteRwLocker ml(thread, thread->isolate_group()->program_lock());
+    if (!klass.is_declaration_loaded()) {
+#if defined(SUPPORT_TIMELINE)
+      TimelineBeginEndScope tbes(thread, Timeline::GetIsolateStream(),
+                                 "LoadClassDeclarationLazily");
+      if (tbes.enabled()) {
+        tbes.SetNumArguments(1);
+        tbes.CopyArgument(0, "class", klass.ToCString());
+      }
+#endif  // defined(SUPPORT_TIMELINE)
+
+      const Class& toplevel_class =
+          Class::Handle(zone, library.toplevel_class());
+      const auto& library_kernel_data =
+          TypedDataView::Handle(zone, library.KernelLibrary());
+      ASSERT(!library_kernel_data.IsNull());
+      const auto& kernel_info =
+          KernelProgramInfo::Handle(zone, klass.KernelProgramInfo());
+      const intptr_t library_kernel_offset =
+          kernel_info.KernelLibraryStartOffset(library.kernel_library_index());
+
+      KernelLoader kernel_loader(kernel_info, library_kernel_data,
+                                 library_kernel_offset);
+      LibraryIndex library_index(library_kernel_data);
+      const intptr_t class_offset = klass.kernel_offset();
+      // Class offsets in the library index are whole program offsets.
+      const intptr_t class_end =
+          class_offset + library_index.SizeOfClassAtOffset(
+                             class_offset + library_kernel_offset);
+
+      Class& out_class = Class::Handle(zone);
+      kernel_loader.helper_.SetOffset(class_offset);
+      kernel_loader.LoadClass(library, toplevel_class, class_end, &out_class);
+      ASSERT(out_class.ptr() == klass.ptr());
+    }
+  }
+
+  // Finalize the types of the class here as ProcessPendingClasses would have
+  // done for classes loaded eagerly.
+  ClassFinalizer::FinalizeTypesInClass(klass);
+#if !defined(PRODUCT) || defined(FORCE_INCLUDE_SAMPLING_HEAP_PROFILER)
+  Class::Handle(zone, klass.ptr()).SetUserVisibleNameInClassTable();
+#endif
+  return true;
+}
+
 // Read annotations on a procedure or a class to identify potential VM-specific
 // directives.
 //
@@ -209,6 +209,11 @@ class KernelLoader : public ValueObject {
 
   static void FinishLoading(const Class& klass);
 
+  // Loads the declaration of a class whose library was loaded with
+  // --lazy-kernel-class-loading and finalizes its types. Returns false if the
+  // declaration of the class can not be loaded lazily.
+  static bool LoadClassDeclarationLazily(const Class& klass);
+
   void ReadObfuscationProhibitions();
   void ReadLoadingUnits();
 
@@ -298,6 +303,16 @@ class KernelLoader : public ValueObject {
   void ReadInferredType(const Field& field, intptr_t kernel_offset);
   void CheckForInitializer(const Field& field);
 
+  // Whether only the headers of the classes of [library] are read when
+  // loading it.
+  bool ShouldLoadClassesLazily(const Library& library);
+
+  // Looks up the class and sets its kernel offset, script and token
+  // positions.
+  void LoadClassHeader(const Library& library,
+                       ClassHelper* class_helper,
+                       Class* out_class);
+
   void LoadClass(const Library& library,
                  const Class& toplevel_class,
                  intptr_t class_end,
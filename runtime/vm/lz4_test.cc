@@ -0,0 +1,83 @@
+// Copyright (c) 2024, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+#include "platform/lz4.h"
+#include "platform/assert.h"
+#include "platform/globals.h"
+#include "vm/unit_test.h"
+
+namespace dart {
+
+static void CheckRoundTrip(const uint8_t* data, intptr_t size) {
+  uint8_t* compressed = new uint8_t[Lz4::MaxCompressedSize(size)];
+  const intptr_t compressed_size = Lz4::Compress(data, size, compressed);
+  EXPECT_LE(compressed_size, Lz4::MaxCompressedSize(size));
+  uint8_t* decompressed = new uint8_t[size + 1];
+  EXPECT(Lz4::Decompress(compressed, compressed_size, decompressed, size));
+  EXPECT_EQ(0, memcmp(data, decompressed, size));
+  // The size of the decompressed data must match exactly.
+  EXPECT(!Lz4::Decompress(compressed, compressed_size, decompressed, size + 1));
+  if (size > 0) {
+    EXPECT(
+        !Lz4::Decompress(compressed, compressed_size, decompressed, size - 1));
+  }
+  delete[] decompressed;
+  delete[] compressed;
+}
+
+VM_UNIT_TEST_CASE(Lz4_RoundTrip) {
+  const intptr_t kSize = 100 * KB;
+  uint8_t* data = new uint8_t[kSize];
+
+  CheckRoundTrip(data, 0);
+
+  // Repetitive data, including overlapping matches.
+  for (intptr_t i = 0; i < kSize; i++) {
+    data[i] = i % 7;
+  }
+  const intptr_t kRepetitiveSizes[] = {1, 12, 13, 100, 4 * KB, kSize};
+  for (intptr_t size : kRepetitiveSizes) {
+    CheckRoundTrip(data, size);
+  }
+  memset(data, 'a', kSize);
+  CheckRoundTrip(data, kSize);
+  uint8_t* compressed = new uint8_t[Lz4::MaxCompressedSize(kSize)];
+  EXPECT_LT(Lz4::Compress(data, kSize, compressed), kSize / 100);
+  delete[] compressed;
+
+  // Incompressible data.
+  uint32_t state = 42;
+  for (intptr_t i = 0; i < kSize; i++) {
+    state = state * 1103515245 + 12345;
+    data[i] = state >> 24;
+  }
+  const intptr_t kRandomSizes[] = {1, 15, 16, 300, kSize};
+  for (intptr_t size : kRandomSizes) {
+    CheckRoundTrip(data, size);
+  }
+
+  delete[] data;
+}
+
+VM_UNIT_TEST_CASE(Lz4_Malformed) {
+  uint8_t output[32];
+  // Ends in the middle of the literals.
+  const uint8_t truncated[] = {0x50, 'a', 'b'};
+  EXPECT(!Lz4::Decompress(truncated, sizeof(truncated), output, 5));
+  // A match before the start of the output.
+  const uint8_t bad_offset[] = {0x10, 'a', 0x02, 0x00, 0x00};
+  EXPECT(!Lz4::Decompress(bad_offset, sizeof(bad_offset), output, 5));
+  // A match with offset 0.
+  const uint8_t zero_offset[] = {0x10, 'a', 0x00, 0x00, 0x00};
+  EXPECT(!Lz4::Decompress(zero_offset, sizeof(zero_offset), output, 5));
+  // A well formed sequence which overflows the output.
+  const uint8_t overflow[] = {0x1f, 'a', 0x01, 0x00, 0x40, 0x00};
+  EXPECT(!Lz4::Decompress(overflow, sizeof(overflow), output, sizeof(output)));
+  // A well formed sequence: 'a' repeated 5 times.
+  const uint8_t repeat[] = {0x10, 'a', 0x01, 0x00, 0x00};
+  EXPECT(Lz4::Decompress(repeat, sizeof(repeat), output, 5));
+  EXPECT_EQ(0, memcmp(output, "aaaaa", 5));
+}
+
+}  // namespace dart
@@ -74,11 +74,13 @@ void MegamorphicCacheTable::PrintSizes(Thread* thread) {
   for (intptr_t i = 0; i < max_size; i++) {
     probe_counts[i] = 0;
   }
+  String& name = String::Handle();
   for (intptr_t i = 0; i < table.Length(); i++) {
     cache ^= table.At(i);
     buckets = cache.buckets();
     intptr_t mask = cache.mask();
     intptr_t capacity = mask + 1;
+    intptr_t cache_max_probe_count = 0;
     for (intptr_t j = 0; j < capacity; j++) {
       intptr_t class_id =
           Smi::Value(Smi::RawCast(cache.GetClassId(buckets, j)));
@@ -97,12 +99,25 @@ void MegamorphicCacheTable::PrintSizes(Thread* thread) {
           probe_index = (probe_index + 1) & mask;
         }
         probe_counts[probe_count]++;
-        if (probe_count > max_probe_count) {
-          max_probe_count = probe_count;
+        if (probe_count > cache_max_probe_count) {
+          cache_max_probe_count = probe_count;
         }
         entry_count++;
       }
     }
+    if (cache_max_probe_count > max_probe_count) {
+      max_probe_count = cache_max_probe_count;
+    }
+    // Every entry is the result of a miss in the lookup stub, so report the
+    // caches which missed often enough to grow.
+    if (cache.filled_entry_count() >
+        MegamorphicCache::kLoadFactor * MegamorphicCache::kInitialCapacity) {
+      name = cache.target_name();
+      OS::PrintErr("Megamorphic cache %s: %" Pd " misses, capacity %" Pd
+                   ", max probe %" Pd "\n",
+                   name.ToCString(), cache.filled_entry_count(), capacity,
+                   cache_max_probe_count);
+    }
   }
   intptr_t cumulative_entries = 0;
   for (intptr_t i = 0; i <= max_probe_count; i++) {
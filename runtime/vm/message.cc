@@ -84,7 +84,7 @@ const char* Message::PriorityAsString(Priority priority) {
   }
 }
 
-MessageQueue::MessageQueue() {
+MessageQueue::MessageQueue() : concurrent_head_(nullptr) {
   head_ = nullptr;
   tail_ = nullptr;
 }
@@ -96,6 +96,9 @@ MessageQueue::~MessageQueue() {
 }
 
 void MessageQueue::Enqueue(std::unique_ptr<Message> msg0, bool before_events) {
+  // Messages posted concurrently before this one are older.
+  TakeConcurrentMessages();
+
   // TODO(mdempsky): Use unique_ptr internally?
   Message* msg = msg0.release();
 
@@ -139,7 +142,50 @@ void MessageQueue::Enqueue(std::unique_ptr<Message> msg0, bool before_events) {
   }
 }
 
+bool MessageQueue::EnqueueConcurrent(std::unique_ptr<Message> msg0) {
+  Message* msg = msg0.release();
+
+  // Make sure messages are not reused.
+  ASSERT(msg->next_ == nullptr);
+  Message* head = concurrent_head_.load(std::memory_order_relaxed);
+  do {
+    msg->next_ = head;
+  } while (!concurrent_head_.compare_exchange_weak(
+      head, msg, std::memory_order_release, std::memory_order_relaxed));
+  return head == nullptr;
+}
+
+void MessageQueue::TakeConcurrentMessages() {
+  if (concurrent_head_.load(std::memory_order_relaxed) == nullptr) {
+    return;
+  }
+  Message* cur = concurrent_head_.exchange(nullptr, std::memory_order_acquire);
+
+  // The messages are linked most recent first. Reverse them to restore the
+  // order in which they were posted.
+  Message* first = nullptr;
+  Message* last = cur;
+  while (cur != nullptr) {
+    Message* next = cur->next_;
+    cur->next_ = first;
+    first = cur;
+    cur = next;
+  }
+  if (first == nullptr) {
+    return;
+  }
+  if (head_ == nullptr) {
+    ASSERT(tail_ == nullptr);
+    head_ = first;
+  } else {
+    ASSERT(tail_ != nullptr);
+    tail_->next_ = first;
+  }
+  tail_ = last;
+}
+
 std::unique_ptr<Message> MessageQueue::Dequeue() {
+  TakeConcurrentMessages();
   Message* result = head_;
   if (result != nullptr) {
     head_ = result->next_;
@@ -156,6 +202,7 @@ std::unique_ptr<Message> MessageQueue::Dequeue() {
 }
 
 void MessageQueue::Clear() {
+  TakeConcurrentMessages();
   std::unique_ptr<Message> cur(head_);
   head_ = nullptr;
   tail_ = nullptr;
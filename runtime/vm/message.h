@@ -9,6 +9,7 @@
 #include <utility>
 
 #include "platform/assert.h"
+#include "platform/atomic.h"
 #include "vm/allocation.h"
 #include "vm/finalizable_data.h"
 #include "vm/globals.h"
@@ -163,11 +164,26 @@ class MessageQueue {
 
   void Enqueue(std::unique_ptr<Message> msg, bool before_events);
 
+  // Appends a message without holding the lock which protects the queue.
+  // Any number of threads may call this concurrently with each other and with
+  // the thread holding the lock. The message becomes part of the queue when
+  // the lock holder next calls one of the other methods.
+  //
+  // Returns true if this is the only message posted this way which was not
+  // yet moved into the queue, i.e. if the poster has to wake up the consumer.
+  bool EnqueueConcurrent(std::unique_ptr<Message> msg);
+
+  // Moves the messages posted by [EnqueueConcurrent] to the end of the queue.
+  void TakeConcurrentMessages();
+
   // Gets the next message from the message queue or nullptr if no
   // message is available.  This function will not block.
   std::unique_ptr<Message> Dequeue();
 
-  bool IsEmpty() { return head_ == nullptr; }
+  bool IsEmpty() {
+    TakeConcurrentMessages();
+    return head_ == nullptr;
+  }
 
   // Clear all messages from the message queue.
   void Clear();
@@ -201,6 +217,9 @@ class MessageQueue {
   Message* head_;
   Message* tail_;
 
+  // Messages posted by [EnqueueConcurrent], most recent first.
+  AcqRelAtomic<Message*> concurrent_head_;
+
   DISALLOW_COPY_AND_ASSIGN(MessageQueue);
 };
 
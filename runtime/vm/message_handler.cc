@@ -7,6 +7,7 @@
 #include "vm/message_handler.h"
 
 #include "vm/dart.h"
+#include "vm/flags.h"
 #include "vm/heap/safepoint.h"
 #include "vm/isolate.h"
 #include "vm/lockers.h"
@@ -20,9 +21,16 @@ namespace dart {
 
 DECLARE_FLAG(bool, trace_service_pause_events);
 
+DEFINE_FLAG(int,
+            isolate_time_slice_micros,
+            10000,
+            "Let other isolates run after an isolate has handled messages for "
+            "this amount of time (0 means never).");
+
 class MessageHandlerTask : public ThreadPool::Task {
  public:
-  explicit MessageHandlerTask(MessageHandler* handler) : handler_(handler) {
+  MessageHandlerTask(MessageHandler* handler, Priority priority)
+      : ThreadPool::Task(priority), handler_(handler) {
     ASSERT(handler != nullptr);
   }
 
@@ -116,7 +124,7 @@ bool MessageHandler::Run(ThreadPool* pool,
   end_callback_ = end_callback;
   callback_data_ = data;
   task_running_ = true;
-  bool result = pool_->Run<MessageHandlerTask>(this);
+  bool result = StartTaskLocked(/*resumed=*/false);
   if (!result) {
     pool_ = nullptr;
     start_callback_ = nullptr;
@@ -129,7 +137,25 @@ bool MessageHandler::Run(ThreadPool* pool,
 
 void MessageHandler::PostMessage(std::unique_ptr<Message> message,
                                  bool before_events) {
-  Message::Priority saved_priority;
+  Message::Priority saved_priority = message->priority();
+
+  // Normal messages are appended without taking the monitor. Only the poster
+  // which finds no other such message pending has to take it to wake up or
+  // start the handler. Until the handler takes the pending messages, which it
+  // does under the monitor whenever it dequeues, later posters can rely on
+  // that.
+  if (!message->IsOOB() && !before_events && !FLAG_trace_isolates) {
+    if (!queue_->EnqueueConcurrent(std::move(message))) {
+      MessageNotify(saved_priority);
+      return;
+    }
+    {
+      MonitorLocker ml(&monitor_);
+      WakeUpLocked(&ml);
+    }
+    MessageNotify(saved_priority);
+    return;
+  }
 
   {
     MonitorLocker ml(&monitor_);
@@ -154,31 +180,65 @@ void MessageHandler::PostMessage(std::unique_ptr<Message> message,
       }
     }
 
-    saved_priority = message->priority();
     if (message->IsOOB()) {
       oob_queue_->Enqueue(std::move(message), before_events);
     } else {
       queue_->Enqueue(std::move(message), before_events);
     }
-    if (paused_for_messages_) {
-      ml.Notify();
-    }
-
-    if (pool_ != nullptr && !task_running_) {
-      ASSERT(!delete_me_);
-      task_running_ = true;
-      const bool launched_successfully = pool_->Run<MessageHandlerTask>(this);
-      ASSERT(launched_successfully);
-    }
+    WakeUpLocked(&ml);
   }
 
   // Invoke any custom message notification.
   MessageNotify(saved_priority);
 }
 
+void MessageHandler::WakeUpLocked(MonitorLocker* ml) {
+  if (paused_for_messages_) {
+    ml->Notify();
+  }
+
+  if (pool_ != nullptr && !task_running_) {
+    ASSERT(!delete_me_);
+    task_running_ = true;
+    const bool launched_successfully = StartTaskLocked(/*resumed=*/false);
+    ASSERT(launched_successfully);
+  }
+}
+
+bool MessageHandler::StartTaskLocked(bool resumed) {
+  ASSERT(monitor_.IsOwnedByCurrentThread());
+  ASSERT(pool_ != nullptr && task_running_);
+  ThreadPool::Task::Priority priority = ThreadPool::Task::kNormalPriority;
+  if (scheduling_class_ == kLatencySensitive) {
+    priority = ThreadPool::Task::kHighPriority;
+  } else if (scheduling_class_ == kBatch || resumed) {
+    // A handler which used up its time slice goes behind the tasks which
+    // were waiting while it ran.
+    priority = ThreadPool::Task::kLowPriority;
+  }
+#if !defined(PRODUCT)
+  task_scheduled_micros_ = OS::GetCurrentMonotonicMicros();
+  task_resumed_ = resumed;
+#endif
+  return pool_->Run<MessageHandlerTask>(this, priority);
+}
+
+MessageHandler::SchedulingClass MessageHandler::scheduling_class() {
+  MonitorLocker ml(&monitor_);
+  return scheduling_class_;
+}
+
+void MessageHandler::set_scheduling_class(SchedulingClass scheduling_class) {
+  MonitorLocker ml(&monitor_);
+  scheduling_class_ = scheduling_class;
+}
+
 std::unique_ptr<Message> MessageHandler::DequeueMessage(
     Message::Priority min_priority) {
   // TODO(turnidge): Add assert that monitor_ is held here.
+  // Take the concurrently posted messages even if only OOB messages are
+  // handled now: a poster only wakes us up if there are none pending.
+  queue_->TakeConcurrentMessages();
   std::unique_ptr<Message> message = oob_queue_->Dequeue();
   if ((message == nullptr) && (min_priority < Message::kOOBPriority)) {
     message = queue_->Dequeue();
@@ -273,6 +333,15 @@ MessageHandler::MessageStatus MessageHandler::HandleMessages(
       allow_normal_messages = false;
     }
 
+    // Messages are handled to completion, so a handler can only yield to
+    // other handlers between them.
+    if ((saved_priority == Message::kNormalPriority) &&
+        (time_slice_end_micros_ != 0) &&
+        (OS::GetCurrentMonotonicMicros() >= time_slice_end_micros_)) {
+      allow_normal_messages = false;
+      time_slice_expired_ = true;
+    }
+
     // Reevaluate the minimum allowable priority.  The paused state
     // may have changed as part of handling the message.  We may also
     // have encountered an error during message processing.
@@ -406,6 +475,11 @@ void MessageHandler::TaskCallback() {
     // [task_running_] to false.
     ASSERT(task_running_);
 
+#if !defined(PRODUCT)
+    NotifyTaskStarted(OS::GetCurrentMonotonicMicros() - task_scheduled_micros_,
+                      task_resumed_);
+#endif
+
 #if !defined(PRODUCT)
     if (ShouldPauseOnStart(kOK)) {
       if (!is_paused_on_start()) {
@@ -454,7 +528,24 @@ void MessageHandler::TaskCallback() {
 
       // Handle any pending messages for this message handler.
       if (status != kShutdown) {
+        if ((FLAG_isolate_time_slice_micros > 0) &&
+            (scheduling_class_ != kLatencySensitive)) {
+          time_slice_end_micros_ = OS::GetCurrentMonotonicMicros() +
+                                   FLAG_isolate_time_slice_micros;
+        }
         status = HandleMessages(&ml, (status == kOK), true);
+        time_slice_end_micros_ = 0;
+      }
+    }
+
+    if (time_slice_expired_) {
+      time_slice_expired_ = false;
+      // Continue with the remaining messages in a new task, which lets the
+      // tasks of other handlers run first.
+      if (status == kOK && KeepAliveLocked() && !paused() &&
+          !queue_->IsEmpty() && StartTaskLocked(/*resumed=*/true)) {
+        ASSERT(oob_queue_->IsEmpty());
+        return;
       }
     }
 
@@ -638,6 +729,7 @@ MessageHandler::AcquiredQueues::AcquiredQueues(MessageHandler* handler)
     : handler_(handler), ml_(&handler->monitor_) {
   ASSERT(handler != nullptr);
   handler_->oob_message_handling_allowed_ = false;
+  handler_->queue_->TakeConcurrentMessages();
 }
 
 MessageHandler::AcquiredQueues::~AcquiredQueues() {
@@ -29,6 +29,17 @@ class MessageHandler {
   };
   static const char* MessageStatusString(MessageStatus status);
 
+  // How the tasks of a handler running on a thread pool are scheduled.
+  enum SchedulingClass {
+    // Runs before tasks of other handlers and is never asked to yield.
+    kLatencySensitive,
+    // Yields to other handlers once it has handled messages for a time slice
+    // (--isolate-time-slice-micros).
+    kNormal,
+    // As [kNormal], but always queues behind pending tasks of other handlers.
+    kBatch,
+  };
+
   virtual ~MessageHandler();
 
   // Allow subclasses to provide a handler name.
@@ -97,6 +108,9 @@ class MessageHandler {
 
   bool paused() const { return paused_ > 0; }
 
+  SchedulingClass scheduling_class();
+  void set_scheduling_class(SchedulingClass scheduling_class);
+
   void increment_paused() { paused_++; }
   void decrement_paused() {
     ASSERT(paused_ > 0);
@@ -205,6 +219,14 @@ class MessageHandler {
   virtual void NotifyPauseOnStart() {}
   virtual void NotifyPauseOnExit() {}
 
+#if !defined(PRODUCT)
+  // Called when a task of this handler starts running on the thread pool.
+  // [resumed] is true if the task continues the work of a task which used up
+  // its time slice.
+  virtual void NotifyTaskStarted(int64_t queueing_delay_micros,
+                                 bool resumed) {}
+#endif
+
   // TODO(iposva): Set a local field before entering MessageHandler methods.
   Thread* thread() const { return Thread::Current(); }
 
@@ -236,6 +258,15 @@ class MessageHandler {
   void PausedOnStartLocked(MonitorLocker* ml, bool paused);
   void PausedOnExitLocked(MonitorLocker* ml, bool paused);
 
+  // Wakes up a thread waiting for messages or starts a task on the thread pool
+  // to handle them.
+  void WakeUpLocked(MonitorLocker* ml);
+
+  // Schedules a task for this handler on [pool_] according to its scheduling
+  // class. [resumed] is true if the handler yielded at the end of its time
+  // slice.
+  bool StartTaskLocked(bool resumed);
+
   // Dequeue the next message.  Prefer messages from the oob_queue_ to
   // messages from the queue_.
   std::unique_ptr<Message> DequeueMessage(Message::Priority min_priority);
@@ -269,6 +300,15 @@ class MessageHandler {
 #endif
   bool task_running_;
   bool delete_me_;
+  SchedulingClass scheduling_class_ = kNormal;
+  // Set by [TaskCallback] while handling messages which may be interrupted at
+  // the end of the time slice, zero otherwise.
+  int64_t time_slice_end_micros_ = 0;
+  bool time_slice_expired_ = false;
+#if !defined(PRODUCT)
+  int64_t task_scheduled_micros_ = 0;
+  bool task_resumed_ = false;
+#endif
   ThreadPool* pool_;
   StartCallback start_callback_;
   EndCallback end_callback_;
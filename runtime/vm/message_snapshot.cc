@@ -26,6 +26,12 @@
 
 namespace dart {
 
+DEFINE_FLAG(int,
+            message_typed_data_out_of_line_size,
+            64 * KB,
+            "Typed data of at least this many bytes is passed in a separate "
+            "buffer which the receiver adopts (0 means never).");
+
 static Dart_CObject cobj_sentinel = {Dart_CObject_kUnsupported, {false}};
 static Dart_CObject cobj_dynamic_type = {Dart_CObject_kUnsupported, {false}};
 static Dart_CObject cobj_void_type = {Dart_CObject_kUnsupported, {false}};
@@ -1131,6 +1137,37 @@ class GrowableObjectArrayMessageDeserializationCluster
   }
 };
 
+// This function's name can appear in Observatory.
+static void IsolateMessageTypedDataFinalizer(void* isolate_callback_data,
+                                             void* buffer) {
+  free(buffer);
+}
+
+// Large typed data is copied into its own buffer instead of into the message,
+// which saves growing the message and lets a Dart receiver use the buffer as
+// external typed data instead of copying it again.
+static bool IsOutOfLineTypedData(intptr_t length_in_bytes) {
+  return (FLAG_message_typed_data_out_of_line_size > 0) &&
+         (length_in_bytes >= FLAG_message_typed_data_out_of_line_size);
+}
+
+static void WriteTypedDataBytes(BaseSerializer* s,
+                                const uint8_t* cdata,
+                                intptr_t length_in_bytes) {
+  if (IsOutOfLineTypedData(length_in_bytes)) {
+    s->Write<uint8_t>(1);
+    void* passed_data = malloc(length_in_bytes);
+    memmove(passed_data, cdata, length_in_bytes);
+    s->finalizable_data()->Put(length_in_bytes,
+                               passed_data,  // data
+                               passed_data,  // peer,
+                               IsolateMessageTypedDataFinalizer);
+  } else {
+    s->Write<uint8_t>(0);
+    s->WriteBytes(cdata, length_in_bytes);
+  }
+}
+
 class TypedDataMessageSerializationCluster
     : public MessageSerializationCluster {
  public:
@@ -1157,7 +1194,7 @@ class TypedDataMessageSerializationCluster
       s->WriteUnsigned(length);
       NoSafepointScope no_safepoint;
       uint8_t* cdata = reinterpret_cast<uint8_t*>(data->untag()->data());
-      s->WriteBytes(cdata, length * element_size);
+      WriteTypedDataBytes(s, cdata, length * element_size);
     }
   }
 
@@ -1175,7 +1212,7 @@ class TypedDataMessageSerializationCluster
       intptr_t length = data->value.as_external_typed_data.length;
       s->WriteUnsigned(length);
       const uint8_t* cdata = data->value.as_typed_data.values;
-      s->WriteBytes(cdata, length * element_size);
+      WriteTypedDataBytes(s, cdata, length * element_size);
     }
   }
 
@@ -1194,11 +1231,24 @@ class TypedDataMessageDeserializationCluster
     intptr_t element_size = TypedData::ElementSizeInBytes(cid_);
     intptr_t count = d->ReadUnsigned();
     TypedData& data = TypedData::Handle(d->zone());
+    ExternalTypedData& external_data = ExternalTypedData::Handle(d->zone());
+    const intptr_t external_cid =
+        cid_ - kTypedDataCidRemainderInternal + kTypedDataCidRemainderExternal;
     for (intptr_t i = 0; i < count; i++) {
       intptr_t length = d->ReadUnsigned();
+      const intptr_t length_in_bytes = length * element_size;
+      if (d->Read<uint8_t>() != 0) {
+        FinalizableData finalizable_data = d->finalizable_data()->Take();
+        external_data = ExternalTypedData::New(
+            external_cid, reinterpret_cast<uint8_t*>(finalizable_data.data),
+            length);
+        external_data.AddFinalizer(finalizable_data.peer,
+                                   finalizable_data.callback, length_in_bytes);
+        d->AssignRef(external_data.ptr());
+        continue;
+      }
       data = TypedData::New(cid_, length);
       d->AssignRef(data.ptr());
-      const intptr_t length_in_bytes = length * element_size;
       NoSafepointScope no_safepoint;
       d->ReadBytes(data.untag()->data(), length_in_bytes);
     }
@@ -1260,7 +1310,10 @@ class TypedDataMessageDeserializationCluster
       intptr_t length = d->ReadUnsigned();
       data->value.as_typed_data.type = type;
       data->value.as_typed_data.length = length;
-      if (length == 0) {
+      if (d->Read<uint8_t>() != 0) {
+        data->value.as_typed_data.values =
+            reinterpret_cast<uint8_t*>(d->finalizable_data()->Get().data);
+      } else if (length == 0) {
         data->value.as_typed_data.values = nullptr;
       } else {
         data->value.as_typed_data.values = d->CurrentBufferAddress();
@@ -1274,12 +1327,6 @@ class TypedDataMessageDeserializationCluster
   const intptr_t cid_;
 };
 
-// This function's name can appear in Observatory.
-static void IsolateMessageTypedDataFinalizer(void* isolate_callback_data,
-                                             void* buffer) {
-  free(buffer);
-}
-
 class ExternalTypedDataMessageSerializationCluster
     : public MessageSerializationCluster {
  public:
@@ -140,4 +140,40 @@ TEST_CASE(MessageQueue_Clear) {
   EXPECT(queue.IsEmpty());
 }
 
+TEST_CASE(MessageQueue_EnqueueConcurrent) {
+  MessageQueue queue;
+  Dart_Port port = 1;
+
+  const char* str1 = "msg1";
+  const char* str2 = "msg2";
+  const char* str3 = "msg3";
+
+  std::unique_ptr<Message> msg;
+  msg = Message::New(port, AllocMsg(str1), strlen(str1) + 1, nullptr,
+                     Message::kNormalPriority);
+  queue.Enqueue(std::move(msg), false);
+
+  // Only the first concurrently posted message has to wake up the consumer.
+  msg = Message::New(port, AllocMsg(str2), strlen(str2) + 1, nullptr,
+                     Message::kNormalPriority);
+  EXPECT(queue.EnqueueConcurrent(std::move(msg)));
+  msg = Message::New(port, AllocMsg(str3), strlen(str3) + 1, nullptr,
+                     Message::kNormalPriority);
+  EXPECT(!queue.EnqueueConcurrent(std::move(msg)));
+
+  // Concurrently posted messages follow the older ones in posting order.
+  msg = queue.Dequeue();
+  EXPECT_STREQ(str1, reinterpret_cast<char*>(msg->snapshot()));
+  msg = queue.Dequeue();
+  EXPECT_STREQ(str2, reinterpret_cast<char*>(msg->snapshot()));
+  msg = Message::New(port, AllocMsg(str1), strlen(str1) + 1, nullptr,
+                     Message::kNormalPriority);
+  EXPECT(queue.EnqueueConcurrent(std::move(msg)));
+  msg = queue.Dequeue();
+  EXPECT_STREQ(str3, reinterpret_cast<char*>(msg->snapshot()));
+  EXPECT(!queue.IsEmpty());
+  queue.Clear();
+  EXPECT(queue.IsEmpty());
+}
+
 }  // namespace dart
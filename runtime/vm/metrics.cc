@@ -9,6 +9,7 @@
 #include "vm/log.h"
 #include "vm/native_entry.h"
 #include "vm/object.h"
+#include "vm/port.h"
 #include "vm/runtime_entry.h"
 
 namespace dart {
@@ -87,6 +88,7 @@ void Metric::PrintJSON(JSONStream* stream) {
   // TODO(johnmccutchan): Overflow?
   double value_as_double = static_cast<double>(Value());
   obj.AddProperty("value", value_as_double);
+  PrintExtraJSON(&obj);
 }
 #endif  // !defined(PRODUCT)
 
@@ -180,6 +182,14 @@ int64_t MetricHeapUsed::Value() const {
          isolate_group()->heap()->UsedInWords(Heap::kOld) * kWordSize;
 }
 
+int64_t MetricPortLookups::Value() const {
+  return PortMap::LookupCount();
+}
+
+int64_t MetricPortLookupsContended::Value() const {
+  return PortMap::ContendedLookupCount();
+}
+
 #if !defined(PRODUCT)
 int64_t MetricIsolateCount::Value() const {
   return Isolate::IsolateListLength();
@@ -192,7 +202,96 @@ int64_t MetricCurrentRSS::Value() const {
 int64_t MetricPeakRSS::Value() const {
   return Service::MaxRSS();
 }
+
+int64_t MetricIsolateCpuTime::Value() const {
+  ASSERT(isolate() != nullptr);
+  return isolate()->cpu_time_micros();
+}
+
+int64_t MetricIsolateAllocated::Value() const {
+  ASSERT(isolate() != nullptr);
+  return isolate()->allocated_bytes();
+}
+
+int64_t MetricIsolateGCTime::Value() const {
+  ASSERT(isolate() != nullptr);
+  return isolate()->gc_time_micros();
+}
+#endif  // !defined(PRODUCT)
+
+intptr_t HistogramMetric::BucketIndex(int64_t sample) {
+  ASSERT(sample >= 0);
+  if (sample < kSubBuckets) {
+    return sample;
+  }
+  const intptr_t shift = Utils::HighestBit(sample) - kSubBucketBits;
+  const intptr_t top = static_cast<intptr_t>(sample >> shift);
+  ASSERT(top >= kSubBuckets && top < 2 * kSubBuckets);
+  return (shift + 1) * kSubBuckets + (top - kSubBuckets);
+}
+
+int64_t HistogramMetric::BucketUpperBound(intptr_t index) {
+  ASSERT(index >= 0 && index < kNumBuckets);
+  if (index < kSubBuckets) {
+    return index;
+  }
+  const intptr_t shift = index / kSubBuckets - 1;
+  const uint64_t top = kSubBuckets + index % kSubBuckets;
+  return static_cast<int64_t>(((top + 1) << shift) - 1);
+}
+
+void HistogramMetric::Add(int64_t sample) {
+  if (sample < 0) sample = 0;
+  buckets_[BucketIndex(sample)].fetch_add(1);
+  count_.fetch_add(1);
+  sum_.fetch_add(sample);
+  int64_t max = max_.load();
+  while (sample > max && !max_.compare_exchange_weak(max, sample)) {
+  }
+}
+
+int64_t HistogramMetric::Percentile(double percentile) const {
+  ASSERT(percentile >= 0 && percentile <= 100);
+  // Count the buckets rather than using count_, which may be ahead of them
+  // while another thread is recording a sample.
+  int64_t total = 0;
+  for (intptr_t i = 0; i < kNumBuckets; i++) {
+    total += buckets_[i].load();
+  }
+  if (total == 0) {
+    return 0;
+  }
+  const int64_t rank = Utils::Maximum<int64_t>(
+      1, static_cast<int64_t>(ceil(total * percentile / 100.0)));
+  int64_t seen = 0;
+  for (intptr_t i = 0; i < kNumBuckets; i++) {
+    seen += buckets_[i].load();
+    if (seen >= rank) {
+      return Utils::Minimum(BucketUpperBound(i), max_.load());
+    }
+  }
+  return max_.load();
+}
+
+void HistogramMetric::Reset() {
+  for (intptr_t i = 0; i < kNumBuckets; i++) {
+    buckets_[i] = 0;
+  }
+  count_ = 0;
+  sum_ = 0;
+  max_ = 0;
+}
+
+void HistogramMetric::PrintExtraJSON(JSONObject* obj) const {
+#if !defined(PRODUCT)
+  obj->AddProperty64("count", count());
+  obj->AddProperty64("sum", sum());
+  obj->AddProperty64("p50", Percentile(50));
+  obj->AddProperty64("p90", Percentile(90));
+  obj->AddProperty64("p99", Percentile(99));
+  obj->AddProperty64("max", max());
 #endif  // !defined(PRODUCT)
+}
 
 MaxMetric::MaxMetric() : Metric() {
   set_value(kMinInt64);
@@ -5,12 +5,14 @@
 #ifndef RUNTIME_VM_METRICS_H_
 #define RUNTIME_VM_METRICS_H_
 
+#include "platform/atomic.h"
 #include "vm/allocation.h"
 
 namespace dart {
 
 class Isolate;
 class IsolateGroup;
+class JSONObject;
 class JSONStream;
 
 // Metrics for each isolate group.
@@ -32,23 +34,47 @@ class JSONStream;
   V(MetricHeapOldExternal, HeapOldExternal, "heap.old.external", kByte)        \
   V(MetricHeapNewUsed, HeapNewUsed, "heap.new.used", kByte)                    \
   V(MetricHeapNewCapacity, HeapNewCapacity, "heap.new.capacity", kByte)        \
-  V(MetricHeapNewExternal, HeapNewExternal, "heap.new.external", kByte)
+  V(MetricHeapNewExternal, HeapNewExternal, "heap.new.external", kByte)        \
+  V(Metric, HeapOldLive, "heap.old.live", kByte)
+
+// Distributions of GC and safepoint latencies. Also readable by embedders
+// through Dart_IsolateGroupHistogramMetric.
+//
+// heap.allocation.rate is sampled at every scavenge as the bytes allocated
+// in new space per second since the previous one.
+#define ISOLATE_GROUP_HISTOGRAM_METRIC_LIST(V)                                 \
+  V(HistogramMetric, GCScavengePause, "gc.scavenge.pause", kMicrosecond)       \
+  V(HistogramMetric, GCMarkPause, "gc.mark.pause", kMicrosecond)               \
+  V(HistogramMetric, GCSweepTime, "gc.sweep.time", kMicrosecond)               \
+  V(HistogramMetric, TimeToSafepoint, "safepoint.time", kMicrosecond)          \
+  V(HistogramMetric, AllocationRate, "heap.allocation.rate", kByte)
 
 #define ISOLATE_GROUP_METRIC_LIST(V)                                           \
   DART_API_ISOLATE_GROUP_METRIC_LIST(V)                                        \
+  ISOLATE_GROUP_HISTOGRAM_METRIC_LIST(V)                                       \
   V(MaxMetric, HeapOldUsedMax, "heap.old.used.max", kByte)                     \
   V(MaxMetric, HeapOldCapacityMax, "heap.old.capacity.max", kByte)             \
   V(MaxMetric, HeapNewUsedMax, "heap.new.used.max", kByte)                     \
   V(MaxMetric, HeapNewCapacityMax, "heap.new.capacity.max", kByte)             \
   V(MetricHeapUsed, HeapGlobalUsed, "heap.global.used", kByte)                 \
-  V(MaxMetric, HeapGlobalUsedMax, "heap.global.used.max", kByte)
+  V(MaxMetric, HeapGlobalUsedMax, "heap.global.used.max", kByte)               \
+  V(MetricPortLookups, PortLookups, "ports.lookups", kCounter)                 \
+  V(MetricPortLookupsContended, PortLookupsContended,                          \
+    "ports.lookups.contended", kCounter)
 
 // Metrics for each isolate.
 //
 // All metrics are exposed via vm-service protocol.
 #define ISOLATE_METRIC_LIST(V)                                                 \
   V(Metric, RunnableLatency, "isolate.runnable.latency", kMicrosecond)         \
-  V(Metric, RunnableHeapSize, "isolate.runnable.heap", kByte)
+  V(Metric, RunnableHeapSize, "isolate.runnable.heap", kByte)                  \
+  V(Metric, SchedulingDelay, "isolate.scheduling.delay", kMicrosecond)         \
+  V(MaxMetric, SchedulingDelayMax, "isolate.scheduling.delay.max",             \
+    kMicrosecond)                                                              \
+  V(Metric, SchedulingYields, "isolate.scheduling.yields", kCounter)           \
+  V(MetricIsolateCpuTime, CpuTime, "isolate.cpu.time", kMicrosecond)           \
+  V(MetricIsolateAllocated, Allocated, "isolate.allocated", kByte)             \
+  V(MetricIsolateGCTime, GCTime, "isolate.gc.time", kMicrosecond)
 
 class Metric {
  public:
@@ -86,6 +112,9 @@ class Metric {
   void PrintJSON(JSONStream* stream);
 #endif  // !PRODUCT
 
+  // Override to add properties beyond the scalar value to the JSON form.
+  virtual void PrintExtraJSON(JSONObject* obj) const {}
+
   // Returns a zone allocated string.
   static char* ValueToString(int64_t value, Unit unit);
 
@@ -143,6 +172,52 @@ class MinMetric : public Metric {
   void SetValue(int64_t new_value);
 };
 
+// A Metric class that records a distribution of non-negative samples.
+//
+// Samples are bucketed HDR-style by their highest set bit and the
+// kSubBucketBits bits below it, so any reported percentile is within 1/16 of
+// the true sample. Recording is lock-free and may happen on any thread.
+//
+// The scalar value, used by --print-metrics and the vm-service, is the 99th
+// percentile.
+class HistogramMetric : public Metric {
+ public:
+  HistogramMetric() : Metric() {}
+
+  void Add(int64_t sample);
+
+  int64_t count() const { return count_.load(); }
+  int64_t sum() const { return sum_.load(); }
+  int64_t max() const { return max_.load(); }
+
+  // Returns an upper bound of the smallest sample which is greater than or
+  // equal to |percentile| percent of the samples, or 0 if there are none.
+  int64_t Percentile(double percentile) const;
+
+  void Reset();
+
+  virtual int64_t Value() const { return Percentile(99); }
+  virtual void PrintExtraJSON(JSONObject* obj) const;
+
+  static constexpr intptr_t kSubBucketBits = 4;
+  static constexpr intptr_t kSubBuckets = 1 << kSubBucketBits;
+  // Samples below kSubBuckets are recorded exactly in the first bucket row.
+  static constexpr intptr_t kNumBuckets =
+      (kBitsPerInt64 - kSubBucketBits + 1) * kSubBuckets;
+
+  static intptr_t BucketIndex(int64_t sample);
+  // The largest sample recorded in the bucket at |index|.
+  static int64_t BucketUpperBound(intptr_t index);
+
+ private:
+  RelaxedAtomic<int64_t> buckets_[kNumBuckets] = {};
+  RelaxedAtomic<int64_t> count_ = {0};
+  RelaxedAtomic<int64_t> sum_ = {0};
+  RelaxedAtomic<int64_t> max_ = {0};
+
+  DISALLOW_COPY_AND_ASSIGN(HistogramMetric);
+};
+
 class MetricHeapOldUsed : public Metric {
  public:
   virtual int64_t Value() const;
@@ -188,6 +263,22 @@ class MetricPeakRSS : public Metric {
  public:
   virtual int64_t Value() const;
 };
+
+// The CPU time, new-space allocation and GC time attributed to an isolate.
+class MetricIsolateCpuTime : public Metric {
+ public:
+  virtual int64_t Value() const;
+};
+
+class MetricIsolateAllocated : public Metric {
+ public:
+  virtual int64_t Value() const;
+};
+
+class MetricIsolateGCTime : public Metric {
+ public:
+  virtual int64_t Value() const;
+};
 #endif  // !defined(PRODUCT)
 
 class MetricHeapUsed : public Metric {
@@ -195,6 +286,19 @@ class MetricHeapUsed : public Metric {
   virtual int64_t Value() const;
 };
 
+// The number of port lookups by all isolates in the VM.
+class MetricPortLookups : public Metric {
+ public:
+  virtual int64_t Value() const;
+};
+
+// The number of port lookups by all isolates in the VM which had to wait for
+// another thread using the [PortMap].
+class MetricPortLookupsContended : public Metric {
+ public:
+  virtual int64_t Value() const;
+};
+
 }  // namespace dart
 
 #endif  // RUNTIME_VM_METRICS_H_
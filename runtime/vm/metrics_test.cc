@@ -114,4 +114,101 @@ ISOLATE_UNIT_TEST_CASE(Metric_EmbedderAPI) {
   }
 }
 
+ISOLATE_UNIT_TEST_CASE(Metric_IsolateResourceUsage) {
+  Isolate* isolate = thread->isolate();
+  const int64_t allocated_before = isolate->allocated_bytes();
+  const int64_t gc_time_before = isolate->gc_time_micros();
+
+  const intptr_t kLength = 1000;
+  const Array& array = Array::Handle(Array::New(kLength, Heap::kNew));
+  for (intptr_t i = 0; i < kLength; i++) {
+    array.SetAt(i, String::Handle(String::New("<land-in-new-space>")));
+  }
+  // Scavenging releases the TLAB, which accounts for the allocations above.
+  thread->heap()->CollectGarbage(thread, GCType::kScavenge,
+                                 GCReason::kDebugging);
+
+  EXPECT(isolate->allocated_bytes() - allocated_before >=
+         kLength * String::InstanceSize());
+  EXPECT(isolate->gc_time_micros() >= gc_time_before);
+
+  {
+    TransitionVMToNative transition(thread);
+
+    Dart_IsolateResourceUsage usage;
+    Dart_GetIsolateResourceUsage(Dart_CurrentIsolate(), &usage);
+    EXPECT_EQ(isolate->allocated_bytes(), usage.allocated_bytes);
+    EXPECT_EQ(isolate->gc_time_micros(), usage.gc_time_micros);
+    EXPECT(usage.cpu_time_micros >= 0);
+  }
+}
+
+VM_UNIT_TEST_CASE(Metric_Histogram) {
+  HistogramMetric metric;
+  EXPECT_EQ(0, metric.Percentile(50));
+
+  // Small samples are recorded exactly.
+  for (intptr_t i = 1; i <= 10; i++) {
+    metric.Add(i);
+  }
+  EXPECT_EQ(10, metric.count());
+  EXPECT_EQ(55, metric.sum());
+  EXPECT_EQ(5, metric.Percentile(50));
+  EXPECT_EQ(9, metric.Percentile(90));
+  EXPECT_EQ(10, metric.Percentile(100));
+  EXPECT_EQ(10, metric.max());
+
+  // Larger samples are within 1/16 of the true value.
+  metric.Reset();
+  for (intptr_t i = 1; i <= 1000; i++) {
+    metric.Add(i * 1000);
+  }
+  const int64_t p50 = metric.Percentile(50);
+  EXPECT(p50 >= 500 * 1000);
+  EXPECT(p50 <= 500 * 1000 + 500 * 1000 / HistogramMetric::kSubBuckets);
+  const int64_t p99 = metric.Percentile(99);
+  EXPECT(p99 >= 990 * 1000);
+  EXPECT(p99 <= 990 * 1000 + 990 * 1000 / HistogramMetric::kSubBuckets);
+  EXPECT_EQ(1000 * 1000, metric.Percentile(100));
+
+  for (intptr_t i = 0; i < HistogramMetric::kNumBuckets; i++) {
+    const int64_t bound = HistogramMetric::BucketUpperBound(i);
+    EXPECT_EQ(i, HistogramMetric::BucketIndex(bound));
+    if (bound == kMaxInt64) break;
+    EXPECT_EQ(i + 1, HistogramMetric::BucketIndex(bound + 1));
+  }
+}
+
+ISOLATE_UNIT_TEST_CASE(Metric_GCHistograms) {
+  for (intptr_t i = 0; i < 3; i++) {
+    String::New("<land-in-new-space>", Heap::kNew);
+    thread->heap()->CollectGarbage(thread, GCType::kScavenge,
+                                   GCReason::kDebugging);
+  }
+  thread->heap()->CollectGarbage(thread, GCType::kMarkSweep,
+                                 GCReason::kDebugging);
+
+  IsolateGroup* isolate_group = thread->isolate_group();
+  EXPECT(isolate_group->GetGCScavengePauseMetric()->count() >= 3);
+  EXPECT(isolate_group->GetGCMarkPauseMetric()->count() >= 1);
+  EXPECT(isolate_group->GetGCSweepTimeMetric()->count() >= 1);
+  EXPECT(isolate_group->GetHeapOldLiveMetric()->Value() > 0);
+
+  {
+    TransitionVMToNative transition(thread);
+
+    Dart_IsolateGroup group = Dart_CurrentIsolateGroup();
+    Dart_HistogramMetric histogram;
+    EXPECT(Dart_IsolateGroupHistogramMetric(group, "gc.scavenge.pause",
+                                            &histogram));
+    EXPECT(histogram.count >= 3);
+    EXPECT(histogram.p50 <= histogram.p90);
+    EXPECT(histogram.p90 <= histogram.p99);
+    EXPECT(histogram.p99 <= histogram.max);
+    EXPECT(!Dart_IsolateGroupHistogramMetric(group, "heap.old.used",
+                                             &histogram));
+    EXPECT(Dart_IsolateGroupHeapOldLiveMetric(group) > 0);
+  }
+}
+
 }  // namespace dart
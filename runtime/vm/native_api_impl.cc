@@ -91,7 +91,7 @@ DART_EXPORT Dart_Port Dart_NewNativePort(const char* name,
   NativeMessageHandler* nmh = new NativeMessageHandler(name, handler);
   Dart_Port port_id = PortMap::CreatePort(nmh);
   if (port_id != ILLEGAL_PORT) {
-    if (!nmh->Run(Dart::thread_pool(), nullptr, nullptr, 0)) {
+    if (!nmh->Run(Dart::native_port_thread_pool(), nullptr, nullptr, 0)) {
       PortMap::ClosePort(port_id);
       nmh->RequestDeletion();
       port_id = ILLEGAL_PORT;
@@ -63,6 +63,7 @@
 #include "vm/runtime_entry.h"
 #include "vm/scopes.h"
 #include "vm/stack_frame.h"
+#include "vm/stack_trace.h"
 #include "vm/stub_code.h"
 #include "vm/symbols.h"
 #include "vm/tags.h"
@@ -2810,7 +2811,9 @@ ObjectPtr Object::Allocate(intptr_t cls_id,
   if (heap_sampler.HasOutstandingSample()) {
     thread->IncrementNoCallbackScopeDepth();
     void* data = heap_sampler.InvokeCallbackForLastSample(cls_id);
-    heap->SetHeapSamplingData(raw_obj, data);
+    if (data != nullptr) {
+      heap->SetHeapSamplingData(raw_obj, data);
+    }
     thread->DecrementNoCallbackScopeDepth();
   }
 #endif  // !defined(PRODUCT) || defined(FORCE_INCLUDE_SAMPLING_HEAP_PROFILER)
@@ -3554,6 +3557,11 @@ TypeArgumentsPtr Class::GetInstanceTypeArguments(
 
 intptr_t Class::NumTypeParameters(Thread* thread) const {
   if (!is_declaration_loaded()) {
+#if !defined(DART_PRECOMPILED_RUNTIME)
+    if (kernel::KernelLoader::LoadClassDeclarationLazily(*this)) {
+      return NumTypeParameters(thread);
+    }
+#endif
     ASSERT(is_prefinalized());
     const intptr_t cid = id();
     if ((cid == kArrayCid) || (cid == kImmutableArrayCid) ||
@@ -3767,53 +3775,71 @@ UnboxedFieldBitmap Class::CalculateFieldOffsets() const {
   ASSERT(host_offset > 0);
   ASSERT(target_offset > 0);
   Field& field = Field::Handle();
-  const intptr_t len = flds.Length();
-  for (intptr_t i = 0; i < len; i++) {
-    field ^= flds.At(i);
-    // Offset is computed only for instance fields.
-    if (!field.is_static()) {
-      ASSERT(field.HostOffset() == 0);
-      ASSERT(field.TargetOffset() == 0);
-      field.SetOffset(host_offset, target_offset);
-
-      if (field.is_unboxed()) {
-        const intptr_t field_size =
-            UnboxedFieldSizeInBytesByCid(field.guarded_cid());
-
-        const intptr_t host_num_words = field_size / kCompressedWordSize;
-        const intptr_t host_next_offset = host_offset + field_size;
-        const intptr_t host_next_position =
-            host_next_offset / kCompressedWordSize;
-
-        const intptr_t target_next_offset = target_offset + field_size;
-        const intptr_t target_next_position =
-            target_next_offset / compiler::target::kCompressedWordSize;
-
-        // The bitmap has fixed length. Checks if the offset position is smaller
-        // than its length. If it is not, than the field should be boxed
-        if (host_next_position <= UnboxedFieldBitmap::Length() &&
-            target_next_position <= UnboxedFieldBitmap::Length()) {
-          for (intptr_t j = 0; j < host_num_words; j++) {
-            // Activate the respective bit in the bitmap, indicating that the
-            // content is not a pointer
-            host_bitmap.Set(host_offset / kCompressedWordSize);
-            host_offset += kCompressedWordSize;
-          }
-
-          ASSERT(host_offset == host_next_offset);
-          target_offset = target_next_offset;
-        } else {
-          // Make the field boxed
-          field.set_is_unboxed(false);
+  auto layout_field = [&](const Field& instance_field) {
+    ASSERT(instance_field.HostOffset() == 0);
+    ASSERT(instance_field.TargetOffset() == 0);
+    instance_field.SetOffset(host_offset, target_offset);
+
+    if (instance_field.is_unboxed()) {
+      const intptr_t field_size =
+          UnboxedFieldSizeInBytesByCid(instance_field.guarded_cid());
+
+      const intptr_t host_num_words = field_size / kCompressedWordSize;
+      const intptr_t host_next_offset = host_offset + field_size;
+      const intptr_t host_next_position =
+          host_next_offset / kCompressedWordSize;
+
+      const intptr_t target_next_offset = target_offset + field_size;
+      const intptr_t target_next_position =
+          target_next_offset / compiler::target::kCompressedWordSize;
+
+      // The bitmap has fixed length. Checks if the offset position is smaller
+      // than its length. If it is not, than the field should be boxed
+      if (host_next_position <= UnboxedFieldBitmap::Length() &&
+          target_next_position <= UnboxedFieldBitmap::Length()) {
+        for (intptr_t j = 0; j < host_num_words; j++) {
+          // Activate the respective bit in the bitmap, indicating that the
+          // content is not a pointer
+          host_bitmap.Set(host_offset / kCompressedWordSize);
           host_offset += kCompressedWordSize;
-          target_offset += compiler::target::kCompressedWordSize;
         }
+
+        ASSERT(host_offset == host_next_offset);
+        target_offset = target_next_offset;
       } else {
+        // Make the field boxed
+        instance_field.set_is_unboxed(false);
         host_offset += kCompressedWordSize;
         target_offset += compiler::target::kCompressedWordSize;
       }
+    } else {
+      host_offset += kCompressedWordSize;
+      target_offset += compiler::target::kCompressedWordSize;
+    }
+  };
+  const intptr_t len = flds.Length();
+  // In AOT, unboxing of fields is decided before the layout is computed and
+  // instances of user classes have no layout fixed by the runtime. Lay out
+  // their unboxed fields first, so that they stay within the range covered
+  // by the unboxed fields bitmap and are not boxed again just because they
+  // are declared after many other fields.
+  const bool unboxed_fields_first =
+      FLAG_precompiled_mode && (id() >= kNumPredefinedCids);
+  if (unboxed_fields_first) {
+    for (intptr_t i = 0; i < len; i++) {
+      field ^= flds.At(i);
+      if (!field.is_static() && field.is_unboxed()) {
+        layout_field(field);
+      }
     }
   }
+  for (intptr_t i = 0; i < len; i++) {
+    field ^= flds.At(i);
+    // Offset is computed only for instance fields.
+    if (field.is_static()) continue;
+    if (unboxed_fields_first && field.HostOffset() != 0) continue;
+    layout_field(field);
+  }
 
   const intptr_t host_instance_size = RoundedAllocationSize(host_offset);
   const intptr_t target_instance_size =
@@ -4915,7 +4941,9 @@ void Class::EnsureDeclarationLoaded() const {
 #if defined(DART_PRECOMPILED_RUNTIME)
     UNREACHABLE();
 #else
-    FATAL("Unable to use class %s which is not loaded yet.", ToCString());
+    if (!kernel::KernelLoader::LoadClassDeclarationLazily(*this)) {
+      FATAL("Unable to use class %s which is not loaded yet.", ToCString());
+    }
 #endif
   }
 }
@@ -7724,11 +7752,11 @@ TypeArgumentsPtr TypeArguments::Canonicalize(Thread* thread) const {
   ObjectStore* object_store = isolate_group->object_store();
   TypeArguments& result = TypeArguments::Handle(zone);
   {
-    SafepointMutexLocker ml(isolate_group->type_canonicalization_mutex());
+    // See Type::Canonicalize for why the lookup does not need the lock.
     CanonicalTypeArgumentsSet table(zone,
                                     object_store->canonical_type_arguments());
     result ^= table.GetOrNull(CanonicalTypeArgumentsKey(*this));
-    object_store->set_canonical_type_arguments(table.Release());
+    table.Release();
   }
   if (result.IsNull()) {
     // Canonicalize each type argument.
@@ -11297,6 +11325,60 @@ ICDataPtr Function::FindICData(intptr_t deopt_id) const {
   return ICData::null();
 }
 
+CodePtr Function::FindOsrCode(intptr_t osr_id) const {
+#if !defined(DART_PRECOMPILED_RUNTIME)
+  const Array& array = Array::Handle(ic_data_array());
+  if (array.IsNull()) {
+    return Code::null();
+  }
+  const Array& osr_code =
+      Array::Handle(Array::RawCast(array.At(ICDataArrayIndices::kOsrCode)));
+  if (osr_code.IsNull()) {
+    return Code::null();
+  }
+  for (intptr_t i = 0; i < osr_code.Length(); i += 2) {
+    if (Smi::Value(Smi::RawCast(osr_code.At(i))) == osr_id) {
+      const CodePtr code = Code::RawCast(osr_code.At(i + 1));
+      return Code::IsDisabled(code) ? Code::null() : code;
+    }
+  }
+  return Code::null();
+#else   // DART_PRECOMPILED_RUNTIME
+  UNREACHABLE();
+  return Code::null();
+#endif  // DART_PRECOMPILED_RUNTIME
+}
+
+void Function::AddOsrCode(intptr_t osr_id, const Code& code) const {
+#if !defined(DART_PRECOMPILED_RUNTIME)
+  DEBUG_ASSERT(
+      IsolateGroup::Current()->program_lock()->IsCurrentThreadWriter());
+  ASSERT(code.is_optimized() && code.owner() == ptr());
+  const Array& array = Array::Handle(ic_data_array());
+  if (array.IsNull()) {
+    return;
+  }
+  Array& osr_code =
+      Array::Handle(Array::RawCast(array.At(ICDataArrayIndices::kOsrCode)));
+  if (!osr_code.IsNull()) {
+    for (intptr_t i = 0; i < osr_code.Length(); i += 2) {
+      if (Smi::Value(Smi::RawCast(osr_code.At(i))) == osr_id) {
+        osr_code.SetAt(i + 1, code);
+        return;
+      }
+    }
+  }
+  const intptr_t length = osr_code.IsNull() ? 0 : osr_code.Length();
+  osr_code = Array::Grow(osr_code.IsNull() ? Object::empty_array() : osr_code,
+                         length + 2, Heap::kOld);
+  osr_code.SetAt(length, Smi::Handle(Smi::New(osr_id)));
+  osr_code.SetAt(length + 1, code);
+  array.SetAt(ICDataArrayIndices::kOsrCode, osr_code);
+#else   // DART_PRECOMPILED_RUNTIME
+  UNREACHABLE();
+#endif  // DART_PRECOMPILED_RUNTIME
+}
+
 void Function::SetDeoptReasonForAll(intptr_t deopt_id,
                                     ICData::DeoptReasonId reason) {
   const Array& array = Array::Handle(ic_data_array());
@@ -15561,6 +15643,7 @@ intptr_t InstructionsTable::FindEntry(InstructionsTablePtr table,
   const auto entries = rodata->entries();
   intptr_t lo = start_index;
   intptr_t hi = rodata->length - 1;
+  rodata->NarrowSearch(pc_offset, &lo, &hi);
   while (lo <= hi) {
     intptr_t mid = (hi - lo + 1) / 2 + lo;
     ASSERT(mid >= lo);
@@ -18131,10 +18214,17 @@ CodePtr Code::FinalizeCode(FlowGraphCompiler* compiler,
   return code.ptr();
 }
 
+#endif  // !defined(DART_PRECOMPILED_RUNTIME)
+
 void Code::NotifyCodeObservers(const Code& code, bool optimized) {
 #if !defined(PRODUCT)
   ASSERT(!Thread::Current()->OwnsGCSafepoint());
   if (CodeObservers::AreActive()) {
+#if defined(DART_PRECOMPILED_RUNTIME)
+    if (code.IsUnknownDartCode()) {
+      return;
+    }
+#endif
     if (code.IsFunctionCode()) {
       const auto& function = Function::Handle(code.function());
       if (!function.IsNull()) {
@@ -18169,14 +18259,12 @@ void Code::NotifyCodeObservers(const char* name,
   ASSERT(!code.IsNull());
   ASSERT(!Thread::Current()->OwnsGCSafepoint());
   if (CodeObservers::AreActive()) {
-    const auto& instrs = Instructions::Handle(code.instructions());
-    CodeObservers::NotifyAll(name, instrs.PayloadStart(),
-                             code.GetPrologueOffset(), instrs.Size(), optimized,
+    CodeObservers::NotifyAll(name, code.PayloadStart(),
+                             code.GetPrologueOffset(), code.Size(), optimized,
                              &code.comments());
   }
 #endif
 }
-#endif  // !defined(DART_PRECOMPILED_RUNTIME)
 
 CodePtr Code::FindCode(uword pc, int64_t timestamp) {
   class SlowFindCodeVisitor : public ObjectVisitor {
@@ -18842,21 +18930,26 @@ void MegamorphicCache::InsertLocked(const Smi& class_id,
   // load-acquire barriers on the reader, ...
   isolate_group->RunWithStoppedMutators(
       [&]() {
-        EnsureCapacityLocked();
+        EnsureCapacityLocked(class_id);
         InsertEntryLocked(class_id, target);
       },
       /*use_force_growth=*/true);
 }
 
-void MegamorphicCache::EnsureCapacityLocked() const {
+void MegamorphicCache::EnsureCapacityLocked(const Smi& class_id) const {
   auto thread = Thread::Current();
   auto zone = thread->zone();
   auto isolate_group = thread->isolate_group();
   ASSERT(isolate_group->type_feedback_mutex()->IsOwnedByCurrentThread());
 
   intptr_t old_capacity = mask() + 1;
-  double load_limit = kLoadFactor * static_cast<double>(old_capacity);
-  if (static_cast<double>(filled_entry_count() + 1) > load_limit) {
+  const double new_count = static_cast<double>(filled_entry_count() + 1);
+  const double old_size = static_cast<double>(old_capacity);
+  bool grow = new_count > kLoadFactor * old_size;
+  if (!grow && (new_count >= kMinLoadFactor * 2 * old_size)) {
+    grow = ProbeLengthLocked(class_id) > kMaxProbeLength;
+  }
+  while (grow) {
     const Array& old_buckets = Array::Handle(zone, buckets());
     intptr_t new_capacity = old_capacity * 2;
     const Array& new_buckets =
@@ -18871,14 +18964,37 @@ void MegamorphicCache::EnsureCapacityLocked() const {
     set_filled_entry_count(0);
 
     // Rehash the valid entries.
-    Smi& class_id = Smi::Handle(zone);
+    Smi& entry_cid = Smi::Handle(zone);
     for (intptr_t i = 0; i < old_capacity; ++i) {
-      class_id ^= GetClassId(old_buckets, i);
-      if (class_id.Value() != kIllegalCid) {
+      entry_cid ^= GetClassId(old_buckets, i);
+      if (entry_cid.Value() != kIllegalCid) {
         target = GetTargetFunction(old_buckets, i);
-        InsertEntryLocked(class_id, target);
+        InsertEntryLocked(entry_cid, target);
       }
     }
+
+    // Keep growing while |class_id| still collides with a long chain.
+    old_capacity = new_capacity;
+    grow = (new_count >= kMinLoadFactor * 2 * new_capacity) &&
+           (ProbeLengthLocked(class_id) > kMaxProbeLength);
+  }
+}
+
+intptr_t MegamorphicCache::ProbeLengthLocked(const Smi& class_id) const {
+  auto isolate_group = IsolateGroup::Current();
+  ASSERT(isolate_group->type_feedback_mutex()->IsOwnedByCurrentThread());
+  const Array& backing_array = Array::Handle(buckets());
+  const intptr_t id_mask = mask();
+  intptr_t i = (class_id.Value() * kSpreadFactor) & id_mask;
+  intptr_t probes = 1;
+  while (true) {
+    const intptr_t probe_cid =
+        Smi::Value(Smi::RawCast(GetClassId(backing_array, i)));
+    if (probe_cid == class_id.Value() || probe_cid == kIllegalCid) {
+      return probes;
+    }
+    i = (i + 1) & id_mask;
+    probes++;
   }
 }
 
@@ -20230,8 +20346,10 @@ IntegerPtr Instance::IdentityHashCode(Thread* thread) const {
         }
       }
 
+      // Not cached in the header as it is cheap to recompute and canonical
+      // doubles may live in read-only image pages.
       uint64_t uval = bit_cast<uint64_t>(val);
-      hash = ((uval >> 32) ^ (uval)) & kSmiMax;
+      return Smi::New(((uval >> 32) ^ (uval)) & kSmiMax);
     } else {
       do {
         hash = thread->random()->NextUInt32() & 0x3FFFFFFF;
@@ -22248,10 +22366,12 @@ AbstractTypePtr Type::Canonicalize(Thread* thread) const {
   Type& type = Type::Handle(zone);
   ObjectStore* object_store = isolate_group->object_store();
   {
-    SafepointMutexLocker ml(isolate_group->type_canonicalization_mutex());
+    // Lookups do not need the lock: the table array and its entries are
+    // published with store-release/load-acquire barriers, and a table that
+    // has been grown is only replaced after it is fully populated.
     CanonicalTypeSet table(zone, object_store->canonical_types());
     type ^= table.GetOrNull(CanonicalTypeKey(*this));
-    ASSERT(object_store->canonical_types() == table.Release().ptr());
+    table.Release();
   }
   if (type.IsNull()) {
     // The type was not found in the table. It is not canonical yet.
@@ -23721,6 +23841,34 @@ StringPtr String::FromUTF8(const uint8_t* utf8_array,
   return strobj.ptr();
 }
 
+StringPtr String::FromWellFormedUTF8(const TypedDataBase& bytes,
+                                     intptr_t start,
+                                     intptr_t end,
+                                     intptr_t len,
+                                     bool is_one_byte,
+                                     Heap::Space space) {
+  ASSERT((0 <= start) && (start <= end) && (end <= bytes.LengthInBytes()));
+  // Allocate before taking the address of the bytes, which may move.
+  String& strobj = String::Handle();
+  if (is_one_byte) {
+    strobj = OneByteString::New(len, space);
+  } else {
+    strobj = TwoByteString::New(len, space);
+  }
+  NoSafepointScope no_safepoint;
+  const uint8_t* utf8_array =
+      reinterpret_cast<const uint8_t*>(bytes.DataAddr(start));
+  const bool ok =
+      is_one_byte
+          ? Utf8::DecodeWellFormedToLatin1(utf8_array, end - start,
+                                           OneByteString::DataStart(strobj),
+                                           len)
+          : Utf8::DecodeWellFormedToUTF16(utf8_array, end - start,
+                                          TwoByteString::DataStart(strobj),
+                                          len);
+  return ok ? strobj.ptr() : String::null();
+}
+
 StringPtr String::FromLatin1(const uint8_t* latin1_array,
                              intptr_t array_len,
                              Heap::Space space) {
@@ -24518,6 +24666,21 @@ OneByteStringPtr OneByteString::SubStringUnchecked(const String& str,
   return result;
 }
 
+intptr_t OneByteString::IndexOf(const String& str,
+                                uint8_t code_unit,
+                                intptr_t start) {
+  ASSERT(!str.IsNull() && str.IsOneByteString());
+  ASSERT((0 <= start) && (start <= str.Length()));
+  // memchr is vectorized by the C library for the CPU it runs on.
+  NoSafepointScope no_safepoint;
+  const uint8_t* data = &untag(str)->data()[0];
+  const void* found = memchr(data + start, code_unit, str.Length() - start);
+  if (found == nullptr) {
+    return -1;
+  }
+  return static_cast<const uint8_t*>(found) - data;
+}
+
 TwoByteStringPtr TwoByteString::EscapeSpecialCharacters(const String& str) {
   intptr_t len = str.Length();
   if (len > 0) {
@@ -24825,6 +24988,36 @@ ArrayPtr Array::Slice(intptr_t start,
   return dest.ptr();
 }
 
+void Array::CopyRange(intptr_t start,
+                      const Array& source,
+                      intptr_t source_start,
+                      intptr_t count) const {
+  ASSERT(!IsImmutable());
+  ASSERT((start >= 0) && (start + count <= Length()));
+  ASSERT((source_start >= 0) && (source_start + count <= source.Length()));
+  Thread* thread = Thread::Current();
+  // Copy backwards if the destination range starts inside the source range.
+  const bool backwards = (source.ptr() == ptr()) && (source_start < start) &&
+                         (start < source_start + count);
+  if (!UseCardMarkingForAllocation(count)) {
+    NoSafepointScope no_safepoint(thread);
+    for (intptr_t n = 0; n < count; n++) {
+      const intptr_t i = backwards ? count - 1 - n : n;
+      untag()->set_element(start + i, source.untag()->element(source_start + i),
+                           thread);
+    }
+  } else {
+    for (intptr_t n = 0; n < count; n++) {
+      const intptr_t i = backwards ? count - 1 - n : n;
+      untag()->set_element(start + i, source.untag()->element(source_start + i),
+                           thread);
+      if (((n + 1) % kSlotsPerInterruptCheck) == 0) {
+        thread->CheckForSafepoint();
+      }
+    }
+  }
+}
+
 void Array::MakeImmutable() const {
   if (IsImmutable()) return;
   ASSERT(!IsCanonical());
@@ -25121,23 +25314,69 @@ const char* Map::ToCString() const {
       Length());
 }
 
-void LinkedHashBase::ComputeAndSetHashMask() const {
-  ASSERT(IsImmutable());
-  ASSERT_EQUAL(Smi::Value(deleted_keys()), 0);
-  Thread* const thread = Thread::Current();
-  Zone* const zone = thread->zone();
-
-  const auto& data_array = Array::Handle(zone, data());
-  const intptr_t data_length = Utils::RoundUpToPowerOfTwo(data_array.Length());
+intptr_t LinkedHashBase::ImmutableIndexSize() const {
+  const intptr_t data_length =
+      Utils::RoundUpToPowerOfTwo(Array::LengthOf(data()));
   const intptr_t index_size_mult = IsMap() ? 1 : 2;
   const intptr_t index_size = Utils::Maximum(LinkedHashBase::kInitialIndexSize,
                                              data_length * index_size_mult);
   ASSERT(Utils::IsPowerOfTwo(index_size));
+  return index_size;
+}
+
+void LinkedHashBase::ComputeAndSetHashMask() const {
+  ASSERT(IsImmutable());
+  ASSERT_EQUAL(Smi::Value(deleted_keys()), 0);
 
-  const intptr_t hash_mask = IndexSizeToHashMask(index_size);
+  const intptr_t hash_mask = IndexSizeToHashMask(ImmutableIndexSize());
   set_hash_mask(hash_mask);
 }
 
+bool LinkedHashBase::ComputeAndSetIndex() const {
+  ASSERT(IsImmutable());
+  ASSERT_EQUAL(Smi::Value(deleted_keys()), 0);
+  Zone* const zone = Thread::Current()->zone();
+
+  const auto& data_array = Array::Handle(zone, data());
+  const intptr_t used = Smi::Value(used_data());
+  const intptr_t stride = IsMap() ? 2 : 1;
+  auto& key = Object::Handle(zone);
+  for (intptr_t j = 0; j < used; j += stride) {
+    key = data_array.At(j);
+    if (!key.IsInteger() && !key.IsString()) {
+      return false;
+    }
+  }
+
+  const intptr_t size = ImmutableIndexSize();
+  const intptr_t hash_mask = Smi::Value(this->hash_mask());
+  ASSERT_EQUAL(hash_mask, IndexSizeToHashMask(size));
+  const intptr_t size_mask = size - 1;
+  const auto& index = TypedData::Handle(
+      zone, TypedData::New(kTypedDataUint32ArrayCid, size, Heap::kOld));
+  for (intptr_t j = 0; j < used; j += stride) {
+    key = data_array.At(j);
+    // Matches the hashCode getters of _Smi, _Mint and _StringBase.
+    const intptr_t full_hash = key.IsInteger()
+                                   ? Integer::Cast(key).CanonicalizeHash()
+                                   : String::Cast(key).Hash();
+    const intptr_t masked_hash = full_hash & hash_mask;
+    const intptr_t hash_pattern =
+        (masked_hash == 0 ? 1 : masked_hash) * (size >> 1);
+    // Linear probing, see _HashBase._firstProbe and _HashBase._nextProbe.
+    intptr_t i = full_hash & size_mask;
+    i = ((i << 1) + i) & size_mask;
+    while (index.GetUint32(i << 2) != 0) {
+      i = (i + 1) & size_mask;
+    }
+    const intptr_t entry = j / stride;
+    ASSERT((hash_pattern & entry) == 0);
+    index.SetUint32(i << 2, static_cast<uint32_t>(hash_pattern | entry));
+  }
+  set_index(index);
+  return true;
+}
+
 bool LinkedHashBase::CanonicalizeEquals(const Instance& other) const {
   ASSERT(IsImmutable());
 
@@ -26178,7 +26417,6 @@ static void PrintSymbolicStackFrame(Zone* zone,
                                     BaseTextBuffer* buffer,
                                     const Function& function,
                                     TokenPosition token_pos_or_line,
-                                    intptr_t frame_index,
                                     bool is_line = false) {
   ASSERT(!function.IsNull());
   const auto& script = Script::Handle(zone, function.script());
@@ -26204,10 +26442,74 @@ static void PrintSymbolicStackFrame(Zone* zone,
     ASSERT(!script.IsNull());
     script.GetTokenLocation(token_pos_or_line, &line, &column);
   }
-  PrintSymbolicStackFrameIndex(buffer, frame_index);
   PrintSymbolicStackFrameBody(buffer, function_name, url, line, column);
 }
 
+static bool IsVisibleAsFutureListener(const Function& function);
+
+// Prints the frames for the return address at |pc_offset| in |code|: one line
+// for each visible function inlined there, without frame indices.
+static void PrintSymbolicStackFramesAt(
+    Zone* zone,
+    BaseTextBuffer* buffer,
+    const Code& code,
+    const Function& owner,
+    uword pc_offset,
+    bool expand_inlined,
+    GrowableArray<const Function*>* inlined_functions,
+    GrowableArray<TokenPosition>* inlined_token_positions) {
+  const bool is_future_listener =
+      pc_offset == StackTraceUtils::kFutureListenerPcOffset;
+  auto& function = Function::Handle(zone, owner.ptr());
+  if (code.is_optimized() && expand_inlined &&
+      (FLAG_precompiled_mode || !is_future_listener)) {
+    // Note: In AOT mode EmitFunctionEntrySourcePositionDescriptorIfNeeded
+    // will take care of emitting a descriptor that would allow us to
+    // symbolize stack frame with 0 offset.
+    code.GetInlinedFunctionsAtReturnAddress(is_future_listener ? 0 : pc_offset,
+                                            inlined_functions,
+                                            inlined_token_positions);
+    ASSERT(inlined_functions->length() >= 1);
+    for (intptr_t j = inlined_functions->length() - 1; j >= 0; j--) {
+      function = (*inlined_functions)[j]->ptr();
+      auto const pos = (*inlined_token_positions)[j];
+      if (is_future_listener && function.IsImplicitClosureFunction()) {
+        function = function.parent_function();
+      }
+      if (FLAG_show_invisible_frames || function.is_visible()) {
+        PrintSymbolicStackFrame(zone, buffer, function, pos,
+                                /*is_line=*/FLAG_precompiled_mode);
+      }
+    }
+    return;
+  }
+
+  if (FLAG_show_invisible_frames || function.is_visible() ||
+      (is_future_listener && IsVisibleAsFutureListener(function))) {
+    auto const pos =
+        is_future_listener
+            ? function.token_pos()
+            : code.GetTokenIndexOfPC(code.PayloadStart() + pc_offset);
+    PrintSymbolicStackFrame(zone, buffer, function, pos);
+  }
+}
+
+// Prints the lines of |frames| prefixed by consecutive frame indices starting
+// at |frame_index|. Returns the index of the next frame.
+static intptr_t PrintIndexedStackFrames(BaseTextBuffer* buffer,
+                                        const char* frames,
+                                        intptr_t frame_index) {
+  while (*frames != '\0') {
+    const char* line_end = strchr(frames, '\n');
+    ASSERT(line_end != nullptr);
+    PrintSymbolicStackFrameIndex(buffer, frame_index++);
+    buffer->AddRaw(reinterpret_cast<const uint8_t*>(frames),
+                   line_end - frames + 1);
+    frames = line_end + 1;
+  }
+  return frame_index;
+}
+
 static bool IsVisibleAsFutureListener(const Function& function) {
   if (function.is_visible()) {
     return true;
@@ -26276,6 +26578,11 @@ const char* StackTrace::ToCString() const {
 #endif
 
   ZoneTextBuffer buffer(zone, 1024);
+  // The frames printed for a single return address.
+  ZoneTextBuffer frame_buffer(zone);
+#if defined(DART_PRECOMPILED_RUNTIME)
+  auto* const symbol_cache = T->isolate_group()->stack_frame_symbol_cache();
+#endif
 
 #if defined(DART_PRECOMPILED_RUNTIME)
   auto const isolate_instructions = reinterpret_cast<uword>(
@@ -26376,15 +26683,11 @@ const char* StackTrace::ToCString() const {
       } else {
         function = Function::null();
       }
-      const uword pc = code.PayloadStart() + pc_offset;
-
-      const bool is_future_listener =
-          pc_offset == StackTraceUtils::kFutureListenerPcOffset;
-
       // A visible frame ends any gap we might be in.
       in_gap = false;
 
 #if defined(DART_PRECOMPILED_RUNTIME)
+      const uword pc = code.PayloadStart() + pc_offset;
       // When printing non-symbolic frames, we normally print call
       // addresses, not return addresses, by subtracting one from the PC to
       // get an address within the preceding instruction.
@@ -26423,37 +26726,23 @@ const char* StackTrace::ToCString() const {
       }
 #endif
 
-      if (code.is_optimized() && stack_trace.expand_inlined() &&
-          (FLAG_precompiled_mode || !is_future_listener)) {
-        // Note: In AOT mode EmitFunctionEntrySourcePositionDescriptorIfNeeded
-        // will take care of emitting a descriptor that would allow us to
-        // symbolize stack frame with 0 offset.
-        code.GetInlinedFunctionsAtReturnAddress(
-            is_future_listener ? 0 : pc_offset, &inlined_functions,
-            &inlined_token_positions);
-        ASSERT(inlined_functions.length() >= 1);
-        for (intptr_t j = inlined_functions.length() - 1; j >= 0; j--) {
-          function = inlined_functions[j]->ptr();
-          auto const pos = inlined_token_positions[j];
-          if (is_future_listener && function.IsImplicitClosureFunction()) {
-            function = function.parent_function();
-          }
-          if (FLAG_show_invisible_frames || function.is_visible()) {
-            PrintSymbolicStackFrame(zone, &buffer, function, pos, frame_index,
-                                    /*is_line=*/FLAG_precompiled_mode);
-            frame_index++;
-          }
-        }
-        continue;
-      }
-
-      if (FLAG_show_invisible_frames || function.is_visible() ||
-          (is_future_listener && IsVisibleAsFutureListener(function))) {
-        auto const pos = is_future_listener ? function.token_pos()
-                                            : code.GetTokenIndexOfPC(pc);
-        PrintSymbolicStackFrame(zone, &buffer, function, pos, frame_index);
-        frame_index++;
+      const char* frames = nullptr;
+#if defined(DART_PRECOMPILED_RUNTIME)
+      frames = symbol_cache->Lookup(zone, call_addr,
+                                    stack_trace.expand_inlined());
+#endif
+      if (frames == nullptr) {
+        frame_buffer.Clear();
+        PrintSymbolicStackFramesAt(zone, &frame_buffer, code, function,
+                                   pc_offset, stack_trace.expand_inlined(),
+                                   &inlined_functions,
+                                   &inlined_token_positions);
+        frames = frame_buffer.buffer();
+#if defined(DART_PRECOMPILED_RUNTIME)
+        symbol_cache->Insert(call_addr, stack_trace.expand_inlined(), frames);
+#endif
       }
+      frame_index = PrintIndexedStackFrames(&buffer, frames, frame_index);
     }
 
     // Follow the link.
@@ -4063,18 +4063,34 @@ class Function : public Object {
                         bool clone_ic_data) const;
 
   // ic_data_array attached to the function stores edge counters in the
-  // first element, coverage data array in the second element and the rest
-  // are ICData objects.
+  // first element, coverage data array in the second element, OSR code in
+  // the third element and the rest are ICData objects.
   struct ICDataArrayIndices {
     static constexpr intptr_t kEdgeCounters = 0;
     static constexpr intptr_t kCoverageData = 1;
-    static constexpr intptr_t kFirstICData = 2;
+    static constexpr intptr_t kOsrCode = 2;
+    static constexpr intptr_t kFirstICData = 3;
   };
 
   ArrayPtr ic_data_array() const;
   void ClearICDataArray() const;
   ICDataPtr FindICData(intptr_t deopt_id) const;
 
+  // OSR code array is a list of pairs:
+  //   element 2 * i + 0 is the deopt id of the loop (Smi)
+  //   element 2 * i + 1 is the OSR code entering the loop
+  //
+  // It lives as long as the unoptimized code, so that later invocations of
+  // the function running the same loop can enter the OSR code compiled for
+  // an earlier one.
+
+  // Returns OSR code entering the loop with the given deopt id or null if
+  // there is none or it was disabled because its assumptions no longer hold.
+  CodePtr FindOsrCode(intptr_t osr_id) const;
+  // Remembers OSR code entering the loop with the given deopt id, replacing
+  // earlier code for the same loop.
+  void AddOsrCode(intptr_t osr_id, const Code& code) const;
+
   // Coverage data array is a list of pairs:
   //   element 2 * i + 0 is token position
   //   element 2 * i + 1 is coverage hit (zero meaning code was not hit)
@@ -6390,6 +6406,16 @@ class CompressedStackMaps : public Object {
     const UntaggedCompressedStackMaps::Payload* payload_ = nullptr;
   };
 
+  // See Iterator::state().
+  struct IteratorState {
+    uintptr_t next_offset = 0;
+    uint32_t pc_offset = 0;
+    uintptr_t global_table_offset = 0;
+    intptr_t spill_slot_bit_count = -1;
+    intptr_t non_spill_slot_bit_count = -1;
+    intptr_t bits_offset = -1;
+  };
+
   template <typename PayloadHandle>
   class Iterator {
    public:
@@ -6409,9 +6435,35 @@ class CompressedStackMaps : public Object {
           current_pc_offset_(it.current_pc_offset_),
           current_global_table_offset_(it.current_global_table_offset_),
           current_spill_slot_bit_count_(it.current_spill_slot_bit_count_),
-          current_non_spill_slot_bit_count_(it.current_spill_slot_bit_count_),
+          current_non_spill_slot_bit_count_(
+              it.current_non_spill_slot_bit_count_),
           current_bits_offset_(it.current_bits_offset_) {}
 
+    // The position of the loaded entry. Restoring it into an iterator over
+    // the same maps loads that entry again without searching for it.
+    IteratorState state() const {
+      ASSERT(HasLoadedEntry());
+      IteratorState state;
+      state.next_offset = next_offset_;
+      state.pc_offset = current_pc_offset_;
+      state.global_table_offset = current_global_table_offset_;
+      state.spill_slot_bit_count = current_spill_slot_bit_count_;
+      state.non_spill_slot_bit_count = current_non_spill_slot_bit_count_;
+      state.bits_offset = current_bits_offset_;
+      return state;
+    }
+
+    void RestoreState(const IteratorState& state) {
+      ASSERT(state.next_offset > 0);
+      ASSERT(state.next_offset <= maps_.payload_size());
+      next_offset_ = state.next_offset;
+      current_pc_offset_ = state.pc_offset;
+      current_global_table_offset_ = state.global_table_offset;
+      current_spill_slot_bit_count_ = state.spill_slot_bit_count;
+      current_non_spill_slot_bit_count_ = state.non_spill_slot_bit_count;
+      current_bits_offset_ = state.bits_offset;
+    }
+
     // Loads the next entry from [maps_], if any. If [maps_] is the null value,
     // this always returns false.
     bool MoveNext() {
@@ -7197,15 +7249,6 @@ class Code : public Object {
                               bool optimized,
                               CodeStatistics* stats);
 
-  // Notifies all active [CodeObserver]s.
-  static void NotifyCodeObservers(const Code& code, bool optimized);
-  static void NotifyCodeObservers(const Function& function,
-                                  const Code& code,
-                                  bool optimized);
-  static void NotifyCodeObservers(const char* name,
-                                  const Code& code,
-                                  bool optimized);
-
   // Calls [FinalizeCode] and also notifies [CodeObserver]s.
   static CodePtr FinalizeCodeAndNotify(const Function& function,
                                        FlowGraphCompiler* compiler,
@@ -7221,6 +7264,16 @@ class Code : public Object {
                                        CodeStatistics* stats = nullptr);
 
 #endif
+
+  // Notifies all active [CodeObserver]s.
+  static void NotifyCodeObservers(const Code& code, bool optimized);
+  static void NotifyCodeObservers(const Function& function,
+                                  const Code& code,
+                                  bool optimized);
+  static void NotifyCodeObservers(const char* name,
+                                  const Code& code,
+                                  bool optimized);
+
   static CodePtr FindCode(uword pc, int64_t timestamp);
   static CodePtr FindCodeUnsafe(uword pc);
 
@@ -7608,6 +7661,11 @@ class MegamorphicCache : public CallSiteData {
   static constexpr intptr_t kInitialCapacity = 16;
   static constexpr intptr_t kSpreadFactor = 7;
   static constexpr double kLoadFactor = 0.50;
+  // Caches also grow when inserting a class id takes more than this many
+  // probes, as long as they stay above kMinLoadFactor afterwards. This keeps
+  // colliding class ids from making the lookup stub walk long chains.
+  static constexpr intptr_t kMaxProbeLength = 4;
+  static constexpr double kMinLoadFactor = 0.125;
 
   enum EntryType {
     kClassIdIndex,
@@ -7653,8 +7711,11 @@ class MegamorphicCache : public CallSiteData {
 
   // The caller must hold IsolateGroup::type_feedback_mutex().
   void InsertLocked(const Smi& class_id, const Object& target) const;
-  void EnsureCapacityLocked() const;
+  void EnsureCapacityLocked(const Smi& class_id) const;
   ObjectPtr LookupLocked(const Smi& class_id) const;
+  // Number of probes the lookup stub needs to find |class_id| (or an empty
+  // entry if |class_id| is not in the cache).
+  intptr_t ProbeLengthLocked(const Smi& class_id) const;
 
   void InsertEntryLocked(const Smi& class_id, const Object& target) const;
 
@@ -10339,6 +10400,17 @@ class String : public Instance {
                             intptr_t array_len,
                             Heap::Space space = Heap::kNew);
 
+  // Creates a new String object with |len| UTF-16 code units from the
+  // well-formed UTF-8 encoded bytes [start, end) of |bytes|. Returns null if
+  // the bytes are malformed (see Utf8::DecodeWellFormedToUTF16) or decode
+  // to a different number of code units.
+  static StringPtr FromWellFormedUTF8(const TypedDataBase& bytes,
+                                      intptr_t start,
+                                      intptr_t end,
+                                      intptr_t len,
+                                      bool is_one_byte,
+                                      Heap::Space space = Heap::kNew);
+
   // Creates a new String object from an array of Latin-1 encoded characters.
   static StringPtr FromLatin1(const uint8_t* latin1_array,
                               intptr_t array_len,
@@ -10628,6 +10700,10 @@ class OneByteString : public AllStatic {
                                              intptr_t length,
                                              Heap::Space space);
 
+  // Returns the index of the first occurrence of |code_unit| in |str| at or
+  // after |start| or -1.
+  static intptr_t IndexOf(const String& str, uint8_t code_unit, intptr_t start);
+
   static const ClassId kClassId = kOneByteStringCid;
 
   static OneByteStringPtr null() {
@@ -10663,6 +10739,7 @@ class OneByteString : public AllStatic {
   friend class StringHasher;
   friend class Symbols;
   friend class Utf8;
+  friend class IrregexpInterpreter;
   friend class OneByteStringMessageSerializationCluster;
   friend class Deserializer;
   friend class JSONWriter;
@@ -10785,6 +10862,7 @@ class TwoByteString : public AllStatic {
   friend class String;
   friend class StringHasher;
   friend class Symbols;
+  friend class IrregexpInterpreter;
   friend class TwoByteStringMessageSerializationCluster;
   friend class JSONWriter;
 };
@@ -10833,7 +10911,11 @@ class Array : public Instance {
   // this many elements. Consequently WB elimination code should not eliminate
   // WB on arrays of larger lengths across instructions that can cause GC.
   // Note: we also can't restore WB invariant for arrays which use card marking.
-  static constexpr intptr_t kMaxLengthForWriteBarrierElimination = 8;
+  //
+  // Large enough for loops initializing small fixed-length lists to store
+  // into them without barriers even though loop headers can trigger GC, while
+  // keeping the cost of rescanning remembered arrays after a scavenge low.
+  static constexpr intptr_t kMaxLengthForWriteBarrierElimination = 64;
 
   intptr_t Length() const { return LengthOf(ptr()); }
   static intptr_t LengthOf(const ArrayPtr array) {
@@ -11003,6 +11085,13 @@ class Array : public Instance {
                                   bool unique = false);
 
   ArrayPtr Slice(intptr_t start, intptr_t count, bool with_type_argument) const;
+
+  // Copies |count| elements of |source| starting at |source_start| into this
+  // array starting at |start|. The ranges may overlap.
+  void CopyRange(intptr_t start,
+                 const Array& source,
+                 intptr_t source_start,
+                 intptr_t count) const;
   ArrayPtr Copy() const {
     return Slice(0, Length(), /*with_type_argument=*/true);
   }
@@ -12075,11 +12164,19 @@ class LinkedHashBase : public Instance {
     return used - deleted;
   }
 
-  // We do not compute the indices in the VM, but we do precompute the hash
-  // mask to avoid a load acquire barrier on reading the combination of index
-  // and hash mask.
+  // Indices are usually computed lazily by the Dart implementation, but we do
+  // precompute the hash mask to avoid a load acquire barrier on reading the
+  // combination of index and hash mask.
   void ComputeAndSetHashMask() const;
 
+  // Computes the index of an immutable map or set the same way
+  // _createIndex in compact_hash.dart does, so that it can be written into an
+  // AOT snapshot instead of being built on first access at runtime.
+  //
+  // Only done if all keys are integers or strings, whose hash codes do not
+  // depend on object identity. Returns whether the index was set.
+  bool ComputeAndSetIndex() const;
+
   virtual bool CanonicalizeEquals(const Instance& other) const;
   virtual uint32_t CanonicalizeHash() const;
   virtual void CanonicalizeFieldsLocked(Thread* thread) const;
@@ -12090,6 +12187,10 @@ class LinkedHashBase : public Instance {
   static constexpr intptr_t kInitialIndexSize = 1 << (kInitialIndexBits + 1);
 
  private:
+  // Size of the index _createIndex in compact_hash.dart allocates for an
+  // immutable map or set.
+  intptr_t ImmutableIndexSize() const;
+
   LinkedHashBasePtr ptr() const { return static_cast<LinkedHashBasePtr>(ptr_); }
   UntaggedLinkedHashBase* untag() const {
     ASSERT(ptr() != null());
@@ -13335,6 +13436,7 @@ void Instance::GetNativeFields(uint16_t num_fields,
     for (intptr_t i = 0; i < num_fields; i++) {
       field_values[i] = 0;
     }
+    return;
   }
   intptr_t* fields =
       reinterpret_cast<intptr_t*>(native_fields->untag()->data());
@@ -21,6 +21,13 @@ namespace dart {
 
 #if defined(DART_ENABLE_HEAP_SNAPSHOT_WRITER)
 
+DEFINE_FLAG(bool,
+            heap_snapshot_evacuate_new_space,
+            false,
+            "Promote all new-space objects before writing a heap snapshot, so "
+            "that object ids need no side table. Reduces the memory needed to "
+            "snapshot large heaps.");
+
 static bool IsUserClass(intptr_t cid) {
   if (cid == kContextCid) return true;
   if (cid == kTypeArgumentsCid) return false;
@@ -1484,6 +1491,15 @@ void CallbackHeapSnapshotWriter::WriteChunk(uint8_t* buffer,
 }
 
 void HeapSnapshotWriter::Write() {
+  if (FLAG_heap_snapshot_evacuate_new_space) {
+    // Ids of objects on regular old-space pages live in the pages' counting
+    // bitvectors (about one bit per object), while everything else needs an
+    // entry in the heap's object id table. Emptying new space leaves only
+    // large-page objects and Smis in the table.
+    thread()->heap()->CollectGarbage(thread(), GCType::kEvacuate,
+                                     GCReason::kDebugging);
+  }
+
   HeapIterationScope iteration(thread());
 
   WriteBytes("dartheap", 8);  // Magic value.
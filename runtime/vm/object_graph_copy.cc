@@ -8,6 +8,7 @@
 
 #include "vm/dart_api_state.h"
 #include "vm/flags.h"
+#include "vm/heap/page.h"
 #include "vm/heap/weak_table.h"
 #include "vm/longjump.h"
 #include "vm/object.h"
@@ -145,6 +146,10 @@ static ObjectPtr Marker() {
   return Object::unknown_constant().ptr();
 }
 
+static bool IsDeeplyImmutableContainer(ObjectPtr obj,
+                                       intptr_t cid,
+                                       intptr_t depth);
+
 DART_FORCE_INLINE
 static bool CanShareObject(ObjectPtr obj, uword tags) {
   if ((tags & UntaggedObject::CanonicalBit::mask_in_place()) != 0) {
@@ -172,9 +177,56 @@ static bool CanShareObject(ObjectPtr obj, uword tags) {
     return Closure::RawCast(obj)->untag()->context() == Object::null();
   }
 
+  if (cid == kRecordCid || cid == kImmutableArrayCid) {
+    return IsDeeplyImmutableContainer(obj, cid, /*depth=*/0);
+  }
+
   return false;
 }
 
+// Records and unmodifiable lists can't be changed once created, but they can
+// refer to mutable objects. If everything they refer to can be shared, they
+// are deeply immutable and can be shared as well. Once this is established
+// the immutable bit is set on the object, so the elements are inspected at
+// most once and later messages take the fast check in [CanShareObject].
+//
+// Nested containers are checked up to a small depth to bound the recursion.
+static constexpr intptr_t kMaxDeeplyImmutableContainerDepth = 4;
+
+static bool IsDeeplyImmutableContainer(ObjectPtr obj,
+                                       intptr_t cid,
+                                       intptr_t depth) {
+  ASSERT(cid == kRecordCid || cid == kImmutableArrayCid);
+  intptr_t length;
+  if (cid == kRecordCid) {
+    length = Record::NumFields(Record::RawCast(obj));
+  } else {
+    length = Smi::Value(Array::RawCast(obj)->untag()->length());
+  }
+  for (intptr_t i = 0; i < length; i++) {
+    ObjectPtr value = cid == kRecordCid
+                          ? Record::RawCast(obj)->untag()->field(i)
+                          : Array::RawCast(obj)->untag()->element(i);
+    if (!value->IsHeapObject()) continue;
+    const uword tags = TagsFromUntaggedObject(value.untag());
+    const intptr_t value_cid = UntaggedObject::ClassIdTag::decode(tags);
+    if (value_cid == kRecordCid || value_cid == kImmutableArrayCid) {
+      if ((tags & (UntaggedObject::CanonicalBit::mask_in_place() |
+                   UntaggedObject::ImmutableBit::mask_in_place())) != 0) {
+        continue;
+      }
+      if (depth < kMaxDeeplyImmutableContainerDepth &&
+          IsDeeplyImmutableContainer(value, value_cid, depth + 1)) {
+        continue;
+      }
+      return false;
+    }
+    if (!CanShareObject(value, tags)) return false;
+  }
+  obj.untag()->SetImmutable();
+  return true;
+}
+
 bool CanShareObjectAcrossIsolates(ObjectPtr obj) {
   if (!obj->IsHeapObject()) return true;
   const uword tags = TagsFromUntaggedObject(obj.untag());
@@ -1502,9 +1554,13 @@ class SlowObjectCopyBase : public ObjectCopyBase {
                                       intptr_t offset,
                                       intptr_t end_offset) {
     if (Array::UseCardMarkingForAllocation(array_length)) {
+      // Check for safepoints once per card rather than for every element.
+      const intptr_t card_mask = (1 << Page::kBytesPerCardLog2) - 1;
       for (; offset < end_offset; offset += kCompressedWordSize) {
         ForwardCompressedLargeArrayPointer(src, dst, offset);
-        thread_->CheckForSafepoint();
+        if (((offset + kCompressedWordSize) & card_mask) == 0) {
+          thread_->CheckForSafepoint();
+        }
       }
     } else {
       for (; offset < end_offset; offset += kCompressedWordSize) {
@@ -2563,7 +2619,25 @@ class ObjectGraphCopier : public StackResource {
     }
 
     // Use the slow copy approach.
-    result = slow_object_copy_.ContinueCopyGraphSlow(root, result);
+    {
+      TIMELINE_DURATION(thread_, Isolate, "CopyMutableObjectGraphSlow");
+#if defined(SUPPORT_TIMELINE)
+      const intptr_t fast_allocated_bytes =
+          slow_object_copy_.slow_forward_map_.allocated_bytes;
+#endif
+      result = slow_object_copy_.ContinueCopyGraphSlow(root, result);
+#if defined(SUPPORT_TIMELINE)
+      if (tbes.enabled()) {
+        tbes.SetNumArguments(2);
+        tbes.FormatArgument(0, "FastAllocatedBytes", "%" Pd,
+                            fast_allocated_bytes);
+        tbes.FormatArgument(
+            1, "SlowAllocatedBytes", "%" Pd,
+            slow_object_copy_.slow_forward_map_.allocated_bytes -
+                fast_allocated_bytes);
+      }
+#endif
+    }
     ASSERT((result.ptr() == Marker()) ==
            (slow_object_copy_.exception_msg_ != nullptr));
     if (result.ptr() == Marker()) {
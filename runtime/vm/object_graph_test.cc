@@ -190,6 +190,37 @@ ISOLATE_UNIT_TEST_CASE(RetainingPathGCRoot) {
   EXPECT_STREQ(result.gc_root_type, "local handle");
 }
 
+#if defined(DART_ENABLE_HEAP_SNAPSHOT_WRITER)
+DECLARE_FLAG(bool, heap_snapshot_evacuate_new_space);
+
+static void CountSnapshotBytes(void* context,
+                               uint8_t* buffer,
+                               intptr_t size,
+                               bool is_last) {
+  if (size >= 8 && *reinterpret_cast<intptr_t*>(context) == 0) {
+    EXPECT(memcmp(buffer, "dartheap", 8) == 0);
+  }
+  *reinterpret_cast<intptr_t*>(context) += size;
+  free(buffer);
+}
+
+ISOLATE_UNIT_TEST_CASE(HeapSnapshotEvacuatesNewSpace) {
+  SetFlagScope<bool> sfs(&FLAG_heap_snapshot_evacuate_new_space, true);
+  const Array& array = Array::Handle(Array::New(10, Heap::kNew));
+  EXPECT(array.ptr()->IsNewObject());
+
+  intptr_t written = 0;
+  {
+    CallbackHeapSnapshotWriter callback_writer(thread, CountSnapshotBytes,
+                                               &written);
+    HeapSnapshotWriter writer(thread, &callback_writer);
+    writer.Write();
+  }
+  EXPECT(written > 8);
+  EXPECT(array.ptr()->IsOldObject());
+}
+#endif  // defined(DART_ENABLE_HEAP_SNAPSHOT_WRITER)
+
 #endif  // !defined(PRODUCT)
 
 }  // namespace dart
@@ -427,6 +427,7 @@ void ObjectStore::LazyInitCoreMembers() {
     ASSERT(non_nullable_map_rare_type_.load() == Type::null());
     ASSERT(enum_index_field_.load() == Field::null());
     ASSERT(enum_name_field_.load() == Field::null());
+    ASSERT(error_stack_trace_field_.load() == Field::null());
     ASSERT(_object_equals_function_.load() == Function::null());
     ASSERT(_object_hash_code_function_.load() == Function::null());
     ASSERT(_object_to_string_function_.load() == Function::null());
@@ -469,6 +470,12 @@ void ObjectStore::LazyInitCoreMembers() {
     ASSERT(!field.IsNull());
     enum_name_field_.store(field.ptr());
 
+    cls = error_class();
+    ASSERT(!cls.IsNull());
+    field = cls.LookupInstanceFieldAllowPrivate(Symbols::_stackTrace());
+    ASSERT(!field.IsNull());
+    error_stack_trace_field_.store(field.ptr());
+
     auto& function = Function::Handle(zone);
 
     function = core_lib.LookupFunctionAllowPrivate(Symbols::_objectHashCode());
@@ -49,6 +49,7 @@ class ObjectPointerVisitor;
   LAZY_CORE(Type, non_nullable_map_rare_type)                                  \
   LAZY_CORE(Field, enum_index_field)                                           \
   LAZY_CORE(Field, enum_name_field)                                            \
+  LAZY_CORE(Field, error_stack_trace_field)                                    \
   LAZY_CORE(Function, _object_equals_function)                                 \
   LAZY_CORE(Function, _object_hash_code_function)                              \
   LAZY_CORE(Function, _object_to_string_function)                              \
@@ -135,11 +136,11 @@ class ObjectPointerVisitor;
   RW(Class, dart_mutex_class)                                                  \
   ARW_AR(WeakArray, symbol_table)                                              \
   ARW_AR(WeakArray, regexp_table)                                              \
-  RW(Array, canonical_types)                                                   \
+  ARW_AR(Array, canonical_types)                                               \
   RW(Array, canonical_function_types)                                          \
   RW(Array, canonical_record_types)                                            \
   RW(Array, canonical_type_parameters)                                         \
-  RW(Array, canonical_type_arguments)                                          \
+  ARW_AR(Array, canonical_type_arguments)                                      \
   RW(Library, async_library)                                                   \
   RW(Library, core_library)                                                    \
   RW(Library, collection_library)                                              \
@@ -831,6 +831,19 @@ ISOLATE_UNIT_TEST_CASE(StringFormat) {
   EXPECT(str.Equals(hello_str));
 }
 
+ISOLATE_UNIT_TEST_CASE(OneByteStringIndexOf) {
+  const String& str = String::Handle(
+      String::New("GET /index.html HTTP/1.1\r\nHost: example.com\r\n"));
+  EXPECT(str.IsOneByteString());
+  EXPECT_EQ(3, OneByteString::IndexOf(str, ' ', 0));
+  EXPECT_EQ(3, OneByteString::IndexOf(str, ' ', 3));
+  EXPECT_EQ(15, OneByteString::IndexOf(str, ' ', 4));
+  EXPECT_EQ(24, OneByteString::IndexOf(str, '\r', 0));
+  EXPECT_EQ(str.Length() - 1, OneByteString::IndexOf(str, '\n', 26));
+  EXPECT_EQ(-1, OneByteString::IndexOf(str, 'z', 0));
+  EXPECT_EQ(-1, OneByteString::IndexOf(str, ' ', str.Length()));
+}
+
 ISOLATE_UNIT_TEST_CASE(StringConcat) {
   // Create strings from concatenated 1-byte empty strings.
   {
@@ -1844,6 +1857,34 @@ ISOLATE_UNIT_TEST_CASE(Array_Grow) {
   }
 }
 
+ISOLATE_UNIT_TEST_CASE(Array_CopyRange) {
+  const intptr_t kSize = 10;
+  const Array& src = Array::Handle(Array::New(kSize));
+  const Array& dst = Array::Handle(Array::New(kSize));
+  for (intptr_t i = 0; i < kSize; i++) {
+    src.SetAt(i, Smi::Handle(Smi::New(i)));
+  }
+
+  dst.CopyRange(2, src, 1, 5);
+  for (intptr_t i = 0; i < kSize; i++) {
+    if (i >= 2 && i < 7) {
+      EXPECT_EQ(Smi::New(i - 1), dst.At(i));
+    } else {
+      EXPECT_EQ(Object::null(), dst.At(i));
+    }
+  }
+
+  // Overlapping copies within the same array.
+  src.CopyRange(3, src, 0, 5);
+  for (intptr_t i = 0; i < kSize; i++) {
+    EXPECT_EQ(Smi::New(i >= 3 && i < 8 ? i - 3 : i), src.At(i));
+  }
+  src.CopyRange(0, src, 3, 5);
+  for (intptr_t i = 0; i < 5; i++) {
+    EXPECT_EQ(Smi::New(i), src.At(i));
+  }
+}
+
 ISOLATE_UNIT_TEST_CASE(EmptyInstantiationsCacheArray) {
   SafepointMutexLocker ml(
       thread->isolate_group()->type_arguments_canonicalization_mutex());
@@ -3176,6 +3217,28 @@ ISOLATE_UNIT_TEST_CASE(MegamorphicCache) {
       EXPECT(Smi::Cast(value).Equals(Smi::Cast(expected)));
     }
   }
+
+  // Class ids which collide grow the cache before it reaches its load factor.
+  {
+    const auto& cache =
+        MegamorphicCache::Handle(MegamorphicCache::New(name, args_descriptor));
+
+    auto& cid = Smi::Handle();
+    auto& value = Object::Handle();
+    const intptr_t kCount = MegamorphicCache::kMaxProbeLength + 2;
+    for (intptr_t i = 1; i <= kCount; ++i) {
+      cid = Smi::New(MegamorphicCache::kInitialCapacity * i);
+      value = Smi::New(i);
+      cache.EnsureContains(cid, value);
+    }
+    EXPECT_EQ(kCount, cache.filled_entry_count());
+    EXPECT_GT(cache.mask() + 1, MegamorphicCache::kInitialCapacity);
+    for (intptr_t i = 1; i <= kCount; ++i) {
+      cid = Smi::New(MegamorphicCache::kInitialCapacity * i);
+      value = cache.Lookup(cid);
+      EXPECT_EQ(i, Smi::Cast(value).Value());
+    }
+  }
 }
 
 ISOLATE_UNIT_TEST_CASE(FieldTests) {
@@ -6945,6 +7008,66 @@ void init() {
   HashMapNonConstEqualsConst(kScript);
 }
 
+// Checks that the index computed by the VM for AOT snapshots is the one the
+// Dart implementation would have created on first access.
+static void ExpectPrecomputedIndexMatches(const char* script,
+                                          bool expect_computed = true) {
+  Dart_Handle lib = TestCase::LoadTestScript(script, nullptr);
+  EXPECT_VALID(lib);
+  Dart_Handle result = Dart_Invoke(lib, NewString("constValue"), 0, nullptr);
+  EXPECT_VALID(result);
+  EXPECT_VALID(Dart_Invoke(lib, NewString("init"), 0, nullptr));
+
+  TransitionNativeToVM transition(Thread::Current());
+  const auto& value =
+      LinkedHashBase::Cast(Object::Handle(Api::UnwrapHandle(result)));
+  const auto& dart_index = TypedData::Handle(value.index());
+  EXPECT(!dart_index.IsNull());
+  EXPECT_EQ(expect_computed, value.ComputeAndSetIndex());
+  if (!expect_computed) return;
+  const auto& vm_index = TypedData::Handle(value.index());
+  EXPECT(vm_index.ptr() != dart_index.ptr());
+  EXPECT_EQ(dart_index.LengthInBytes(), vm_index.LengthInBytes());
+  for (intptr_t i = 0; i < dart_index.LengthInBytes(); i += 4) {
+    EXPECT_EQ(dart_index.GetUint32(i), vm_index.GetUint32(i));
+  }
+}
+
+TEST_CASE(ConstMap_ComputeAndSetIndex) {
+  ExpectPrecomputedIndexMatches(R"(
+constValue() => const {
+  1: 42, 'foo': 499, 2: 'bar', -3: 1, 0x7fffffffffffffff: 2, 'baz': 3,
+  '\u{1F600}': 4, 1000000: 5, 'qux': 6, 7: 7,
+};
+
+void init() {
+  constValue()[null];
+}
+)");
+  // Hash codes of other keys depend on identity, they are left to be computed
+  // at runtime.
+  ExpectPrecomputedIndexMatches(R"(
+class A { const A(); }
+
+constValue() => const {1: 42, A(): 499};
+
+void init() {
+  constValue()[null];
+}
+)",
+                                /*expect_computed=*/false);
+}
+
+TEST_CASE(ConstSet_ComputeAndSetIndex) {
+  ExpectPrecomputedIndexMatches(R"(
+constValue() => const {1, 'foo', 2, -3, 0x7fffffffffffffff, 'baz', 1000000};
+
+void init() {
+  constValue().contains(null);
+}
+)");
+}
+
 TEST_CASE(ConstMap_larger) {
   const char* kScript = R"(
 enum ExperimentalFlag {
@@ -10,6 +10,7 @@
 #include <dlfcn.h>         // NOLINT
 #include <elf.h>           // NOLINT
 #include <errno.h>         // NOLINT
+#include <inttypes.h>      // NOLINT
 #include <fcntl.h>         // NOLINT
 #include <limits.h>        // NOLINT
 #include <malloc.h>        // NOLINT
@@ -76,7 +77,8 @@ DECLARE_FLAG(bool, code_comments);
 // perf-report to resolve addresses falling into JIT generated code.
 // However perf-annotate does not work in this mode because JIT code
 // is transient and does not exist anymore at the moment when you
-// invoke perf-report.
+// invoke perf-report. In the precompiled runtime the map covers the
+// snapshot's instructions, which are reported when the snapshot is loaded.
 class PerfCodeObserver : public CodeObserver {
  public:
   PerfCodeObserver() : out_file_(nullptr) {
@@ -517,8 +519,44 @@ intptr_t OS::ActivationFrameAlignment() {
   return alignment;
 }
 
+// Returns the number of processors the CPU quota of the process' cgroup
+// amounts to, rounded up, or 0 if there is no quota.
+static intptr_t CgroupCpuLimit() {
+  int64_t quota = -1;
+  int64_t period = 0;
+  // cgroup v2 has "<quota> <period>", where the quota is "max" when unlimited.
+  if (FILE* file = fopen("/sys/fs/cgroup/cpu.max", "r")) {
+    char quota_string[32];
+    if (fscanf(file, "%31s %" SCNd64, quota_string, &period) == 2 &&
+        strcmp(quota_string, "max") != 0) {
+      quota = strtoll(quota_string, nullptr, 10);
+    }
+    fclose(file);
+  } else {
+    // cgroup v1 has the quota and period in separate files, and a quota of -1
+    // when unlimited.
+    if (FILE* file = fopen("/sys/fs/cgroup/cpu/cpu.cfs_quota_us", "r")) {
+      if (fscanf(file, "%" SCNd64, &quota) != 1) quota = -1;
+      fclose(file);
+    }
+    if (FILE* file = fopen("/sys/fs/cgroup/cpu/cpu.cfs_period_us", "r")) {
+      if (fscanf(file, "%" SCNd64, &period) != 1) period = 0;
+      fclose(file);
+    }
+  }
+  if (quota <= 0 || period <= 0) return 0;
+  return static_cast<intptr_t>((quota + period - 1) / period);
+}
+
 int OS::NumberOfAvailableProcessors() {
-  return sysconf(_SC_NPROCESSORS_ONLN);
+  // Containers commonly see all of the host's processors but are throttled
+  // to a CPU quota, so sizing thread pools by the former oversubscribes them.
+  static const int count = []() {
+    const int online = sysconf(_SC_NPROCESSORS_ONLN);
+    const intptr_t limit = CgroupCpuLimit();
+    return (limit > 0 && limit < online) ? static_cast<int>(limit) : online;
+  }();
+  return count;
 }
 
 void OS::Sleep(int64_t millis) {
@@ -6,6 +6,7 @@
 
 #include "platform/address_sanitizer.h"
 #include "platform/atomic.h"
+#include "vm/hardware_counters.h"
 #include "vm/lockers.h"
 #include "vm/log.h"
 #include "vm/thread_interrupter.h"
@@ -102,6 +103,10 @@ OSThread::~OSThread() {
   }
 #endif
   timeline_block_ = nullptr;
+#if defined(SUPPORT_TIMELINE)
+  delete hardware_counters_;
+  hardware_counters_ = nullptr;
+#endif
   free(name_);
 #if !defined(PRODUCT)
   if (prepared_for_interrupts_) {
@@ -112,6 +117,16 @@ OSThread::~OSThread() {
 #endif  // !defined(PRODUCT)
 }
 
+#if defined(SUPPORT_TIMELINE)
+HardwareCounters* OSThread::hardware_counters() {
+  ASSERT(OSThread::Current() == this);
+  if (hardware_counters_ == nullptr) {
+    hardware_counters_ = new HardwareCounters();
+  }
+  return hardware_counters_;
+}
+#endif
+
 void OSThread::SetName(const char* name) {
   MutexLocker ml(thread_list_lock_);
   // Clear the old thread name.
@@ -32,6 +32,7 @@
 namespace dart {
 
 // Forward declarations.
+class HardwareCounters;
 class Log;
 class Mutex;
 class ThreadState;
@@ -62,6 +63,7 @@ class Mutex {
   friend class TimelineEventRecorder;
   friend class TimelineEventRingRecorder;
   friend class PageSpace;
+  friend class PortMapShardLocker;
   friend void Dart_TestMutex();
   DISALLOW_COPY_AND_ASSIGN(Mutex);
 };
@@ -125,6 +127,12 @@ class OSThread : public BaseThread {
 
   Log* log() const { return log_; }
 
+#if defined(SUPPORT_TIMELINE)
+  // The hardware counters of this thread, opened on first use. Must only be
+  // called by the thread itself.
+  HardwareCounters* hardware_counters();
+#endif
+
   uword stack_base() const { return stack_base_; }
   uword stack_limit() const { return stack_limit_; }
   uword overflow_stack_limit() const { return stack_limit_ + stack_headroom_; }
@@ -296,6 +304,10 @@ class OSThread : public BaseThread {
   // events to.
   TimelineEventBlock* timeline_block_ = nullptr;
 
+#if defined(SUPPORT_TIMELINE)
+  HardwareCounters* hardware_counters_ = nullptr;
+#endif
+
   // All |Thread|s are registered in the thread list.
   OSThread* thread_list_next_ = nullptr;
 
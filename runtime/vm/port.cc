@@ -18,9 +18,60 @@
 namespace dart {
 
 Mutex* PortMap::mutex_ = nullptr;
-PortSet<PortMap::Entry>* PortMap::ports_ = nullptr;
+PortMap::Shard PortMap::shards_[PortMap::kNumShards];
 Random* PortMap::prng_ = nullptr;
 
+// Like [MutexLocker] for the lock of a [PortMap::Shard], but counts how often
+// the lock was already held by another thread.
+class PortMapShardLocker : public ValueObject {
+ public:
+  explicit PortMapShardLocker(PortMap::Shard* shard)
+      :
+#if defined(DEBUG)
+        no_safepoint_scope_(true),
+#endif
+        mutex_(shard->mutex) {
+    ASSERT(mutex_ != nullptr);
+#if defined(DEBUG)
+    Thread* thread = Thread::Current();
+    if ((thread != nullptr) &&
+        (thread->execution_state() != Thread::kThreadInNative)) {
+      thread->IncrementNoSafepointScopeDepth();
+    } else {
+      no_safepoint_scope_ = false;
+    }
+#endif
+    if (!mutex_->TryLock()) {
+      mutex_->Lock();
+      shard->contended_lookups++;
+    }
+    shard->lookups++;
+  }
+
+  ~PortMapShardLocker() {
+    mutex_->Unlock();
+#if defined(DEBUG)
+    if (no_safepoint_scope_) {
+      Thread::Current()->DecrementNoSafepointScopeDepth();
+    }
+#endif
+  }
+
+ private:
+  DEBUG_ONLY(bool no_safepoint_scope_;)
+  Mutex* const mutex_;
+
+  DISALLOW_COPY_AND_ASSIGN(PortMapShardLocker);
+};
+
+PortMap::Shard* PortMap::ShardFor(Dart_Port port) {
+  // The low bits of the port select the slot within the shard's [PortSet], so
+  // use the high bits of a multiplicative hash to select the shard.
+  const uint64_t hash =
+      static_cast<uint64_t>(port) * static_cast<uint64_t>(0x9e3779b97f4a7c15);
+  return &shards_[hash >> (64 - kShardBits)];
+}
+
 Dart_Port PortMap::AllocatePort() {
   Dart_Port result;
 
@@ -45,17 +96,22 @@ Dart_Port PortMap::AllocatePort() {
     }
 
     ASSERT(!static_cast<ObjectPtr>(static_cast<uword>(result))->IsWellFormed());
-  } while (ports_->Contains(result));
+
+    // Ports are only inserted while holding [mutex_], so the port remains
+    // unused after the shard lock is released.
+    Shard* shard = ShardFor(result);
+    PortMapShardLocker ml(shard);
+    if (!shard->ports->Contains(result)) break;
+  } while (true);
 
   ASSERT(result != 0);
-  ASSERT(!ports_->Contains(result));
   return result;
 }
 
 Dart_Port PortMap::CreatePort(MessageHandler* handler) {
   ASSERT(handler != nullptr);
   MutexLocker ml(mutex_);
-  if (ports_ == nullptr) {
+  if (prng_ == nullptr) {
     return ILLEGAL_PORT;
   }
 
@@ -74,7 +130,11 @@ Dart_Port PortMap::CreatePort(MessageHandler* handler) {
   Entry entry;
   entry.port = port;
   entry.handler = handler;
-  ports_->Insert(entry);
+  {
+    Shard* shard = ShardFor(port);
+    PortMapShardLocker sl(shard);
+    shard->ports->Insert(entry);
+  }
 
   if (FLAG_trace_isolates) {
     OS::PrintErr(
@@ -93,25 +153,29 @@ bool PortMap::ClosePort(Dart_Port port, MessageHandler** message_handler) {
   MessageHandler* handler = nullptr;
   {
     MutexLocker ml(mutex_);
-    if (ports_ == nullptr) {
+    if (prng_ == nullptr) {
       return false;
     }
-    auto it = ports_->TryLookup(port);
-    if (it == ports_->end()) {
-      return false;
-    }
-    Entry entry = *it;
-    handler = entry.handler;
-    ASSERT(handler != nullptr);
+    {
+      Shard* shard = ShardFor(port);
+      PortMapShardLocker sl(shard);
+      auto it = shard->ports->TryLookup(port);
+      if (it == shard->ports->end()) {
+        return false;
+      }
+      Entry entry = *it;
+      handler = entry.handler;
+      ASSERT(handler != nullptr);
 
 #if defined(DEBUG)
-    handler->CheckAccess();
+      handler->CheckAccess();
 #endif
 
-    // Delete the port entry before releasing the lock to avoid holding the lock
-    // while flushing the messages below.
-    it.Delete();
-    ports_->Rebalance();
+      // Delete the port entry before releasing the lock to avoid holding the
+      // lock while flushing the messages below.
+      it.Delete();
+      shard->ports->Rebalance();
+    }
 
     // The MessageHandler::ports_ is only accessed by [PortMap], it is guarded
     // by the [PortMap::mutex_] we already hold.
@@ -128,35 +192,38 @@ bool PortMap::ClosePort(Dart_Port port, MessageHandler** message_handler) {
 void PortMap::ClosePorts(MessageHandler* handler) {
   {
     MutexLocker ml(mutex_);
-    if (ports_ == nullptr) {
+    if (prng_ == nullptr) {
       return;
     }
     // The MessageHandler::ports_ is only accessed by [PortMap], it is guarded
     // by the [PortMap::mutex_] we already hold.
     for (auto isolate_it = handler->ports_.begin();
          isolate_it != handler->ports_.end(); ++isolate_it) {
-      auto it = ports_->TryLookup((*isolate_it).port);
-      ASSERT(it != ports_->end());
+      Shard* shard = ShardFor((*isolate_it).port);
+      PortMapShardLocker sl(shard);
+      auto it = shard->ports->TryLookup((*isolate_it).port);
+      ASSERT(it != shard->ports->end());
       Entry entry = *it;
       ASSERT(entry.port == (*isolate_it).port);
       ASSERT(entry.handler == handler);
       it.Delete();
+      shard->ports->Rebalance();
       isolate_it.Delete();
     }
     ASSERT(handler->ports_.IsEmpty());
-    ports_->Rebalance();
   }
   handler->CloseAllPorts();
 }
 
 bool PortMap::PostMessage(std::unique_ptr<Message> message,
                           bool before_events) {
-  MutexLocker ml(mutex_);
-  if (ports_ == nullptr) {
+  Shard* shard = ShardFor(message->dest_port());
+  PortMapShardLocker ml(shard);
+  if (shard->ports == nullptr) {
     return false;
   }
-  auto it = ports_->TryLookup(message->dest_port());
-  if (it == ports_->end()) {
+  auto it = shard->ports->TryLookup(message->dest_port());
+  if (it == shard->ports->end()) {
     // Ownership of external data remains with the poster.
     message->DropFinalizers();
     return false;
@@ -169,22 +236,24 @@ bool PortMap::PostMessage(std::unique_ptr<Message> message,
 
 #if defined(TESTING)
 bool PortMap::PortExists(Dart_Port id) {
-  MutexLocker ml(mutex_);
-  if (ports_ == nullptr) {
+  Shard* shard = ShardFor(id);
+  PortMapShardLocker ml(shard);
+  if (shard->ports == nullptr) {
     return false;
   }
-  auto it = ports_->TryLookup(id);
-  return it != ports_->end();
+  auto it = shard->ports->TryLookup(id);
+  return it != shard->ports->end();
 }
 #endif  // defined(TESTING)
 
 Isolate* PortMap::GetIsolate(Dart_Port id) {
-  MutexLocker ml(mutex_);
-  if (ports_ == nullptr) {
+  Shard* shard = ShardFor(id);
+  PortMapShardLocker ml(shard);
+  if (shard->ports == nullptr) {
     return nullptr;
   }
-  auto it = ports_->TryLookup(id);
-  if (it == ports_->end()) {
+  auto it = shard->ports->TryLookup(id);
+  if (it == shard->ports->end()) {
     // Port does not exist.
     return nullptr;
   }
@@ -194,12 +263,13 @@ Isolate* PortMap::GetIsolate(Dart_Port id) {
 }
 
 Dart_Port PortMap::GetOriginId(Dart_Port id) {
-  MutexLocker ml(mutex_);
-  if (ports_ == nullptr) {
+  Shard* shard = ShardFor(id);
+  PortMapShardLocker ml(shard);
+  if (shard->ports == nullptr) {
     return ILLEGAL_PORT;
   }
-  auto it = ports_->TryLookup(id);
-  if (it == ports_->end()) {
+  auto it = shard->ports->TryLookup(id);
+  if (it == shard->ports->end()) {
     // Port does not exist.
     return ILLEGAL_PORT;
   }
@@ -216,7 +286,7 @@ Dart_Port PortMap::GetOriginId(Dart_Port id) {
 #if defined(TESTING)
 bool PortMap::HasPorts(MessageHandler* handler) {
   MutexLocker ml(mutex_);
-  if (ports_ == nullptr) {
+  if (prng_ == nullptr) {
     return false;
   }
   // The MessageHandler::ports_ is only accessed by [PortMap], it is guarded
@@ -227,13 +297,14 @@ bool PortMap::HasPorts(MessageHandler* handler) {
 
 bool PortMap::IsReceiverInThisIsolateGroupOrClosed(Dart_Port receiver,
                                                    IsolateGroup* group) {
-  MutexLocker ml(mutex_);
-  if (ports_ == nullptr) {
+  Shard* shard = ShardFor(receiver);
+  PortMapShardLocker ml(shard);
+  if (shard->ports == nullptr) {
     // Port was closed.
     return true;
   }
-  auto it = ports_->TryLookup(receiver);
-  if (it == ports_->end()) {
+  auto it = shard->ports->TryLookup(receiver);
+  if (it == shard->ports->end()) {
     // Port was closed.
     return true;
   }
@@ -253,28 +324,41 @@ void PortMap::Init() {
   if (prng_ == nullptr) {
     prng_ = new Random();
   }
-  if (ports_ == nullptr) {
-    ports_ = new PortSet<Entry>();
+  for (intptr_t i = 0; i < kNumShards; i++) {
+    Shard* shard = &shards_[i];
+    if (shard->mutex == nullptr) {
+      shard->mutex = new Mutex();
+    }
+    if (shard->ports == nullptr) {
+      shard->ports = new PortSet<Entry>();
+    }
   }
 }
 
 void PortMap::Cleanup() {
-  ASSERT(ports_ != nullptr);
   ASSERT(prng_ != nullptr);
-  for (auto it = ports_->begin(); it != ports_->end(); ++it) {
-    const auto& entry = *it;
-    ASSERT(entry.handler != nullptr);
-    delete entry.handler;
-    it.Delete();
+  for (intptr_t i = 0; i < kNumShards; i++) {
+    PortSet<Entry>* ports = shards_[i].ports;
+    ASSERT(ports != nullptr);
+    for (auto it = ports->begin(); it != ports->end(); ++it) {
+      const auto& entry = *it;
+      ASSERT(entry.handler != nullptr);
+      delete entry.handler;
+      it.Delete();
+    }
+    ports->Rebalance();
   }
-  ports_->Rebalance();
 
-  // Grab the mutex and delete the port set.
+  // Grab the mutexes and delete the port sets.
   MutexLocker ml(mutex_);
   delete prng_;
   prng_ = nullptr;
-  delete ports_;
-  ports_ = nullptr;
+  for (intptr_t i = 0; i < kNumShards; i++) {
+    Shard* shard = &shards_[i];
+    PortMapShardLocker sl(shard);
+    delete shard->ports;
+    shard->ports = nullptr;
+  }
 }
 
 void PortMap::PrintPortsForMessageHandler(MessageHandler* handler,
@@ -285,36 +369,56 @@ void PortMap::PrintPortsForMessageHandler(MessageHandler* handler,
   Object& msg_handler = Object::Handle();
   {
     JSONArray ports(&jsobj, "ports");
-    SafepointMutexLocker ml(mutex_);
-    if (ports_ == nullptr) {
+    for (intptr_t i = 0; i < kNumShards; i++) {
+      SafepointMutexLocker ml(shards_[i].mutex);
+      if (shards_[i].ports == nullptr) {
+        return;
+      }
+      for (auto& entry : *shards_[i].ports) {
+        if (entry.handler == handler) {
+          JSONObject port(&ports);
+          port.AddProperty("type", "_Port");
+          port.AddPropertyF("name", "Isolate Port (%" Pd64 ")", entry.port);
+          msg_handler = DartLibraryCalls::LookupHandler(entry.port);
+          port.AddProperty("handler", msg_handler);
+        }
+      }
+    }
+  }
+#endif
+}
+
+void PortMap::DebugDumpForMessageHandler(MessageHandler* handler) {
+  Object& msg_handler = Object::Handle();
+  for (intptr_t i = 0; i < kNumShards; i++) {
+    SafepointMutexLocker ml(shards_[i].mutex);
+    if (shards_[i].ports == nullptr) {
       return;
     }
-    for (auto& entry : *ports_) {
+    for (auto& entry : *shards_[i].ports) {
       if (entry.handler == handler) {
-        JSONObject port(&ports);
-        port.AddProperty("type", "_Port");
-        port.AddPropertyF("name", "Isolate Port (%" Pd64 ")", entry.port);
+        OS::PrintErr("Port = %" Pd64 "\n", entry.port);
         msg_handler = DartLibraryCalls::LookupHandler(entry.port);
-        port.AddProperty("handler", msg_handler);
+        OS::PrintErr("Handler = %s\n", msg_handler.ToCString());
       }
     }
   }
-#endif
 }
 
-void PortMap::DebugDumpForMessageHandler(MessageHandler* handler) {
-  SafepointMutexLocker ml(mutex_);
-  if (ports_ == nullptr) {
-    return;
+int64_t PortMap::LookupCount() {
+  int64_t count = 0;
+  for (intptr_t i = 0; i < kNumShards; i++) {
+    count += shards_[i].lookups;
   }
-  Object& msg_handler = Object::Handle();
-  for (auto& entry : *ports_) {
-    if (entry.handler == handler) {
-      OS::PrintErr("Port = %" Pd64 "\n", entry.port);
-      msg_handler = DartLibraryCalls::LookupHandler(entry.port);
-      OS::PrintErr("Handler = %s\n", msg_handler.ToCString());
-    }
+  return count;
+}
+
+int64_t PortMap::ContendedLookupCount() {
+  int64_t count = 0;
+  for (intptr_t i = 0; i < kNumShards; i++) {
+    count += shards_[i].contended_lookups;
   }
+  return count;
 }
 
 }  // namespace dart
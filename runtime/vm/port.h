@@ -8,6 +8,7 @@
 #include <memory>
 
 #include "include/dart_api.h"
+#include "platform/atomic.h"
 #include "vm/allocation.h"
 #include "vm/globals.h"
 #include "vm/json_stream.h"
@@ -65,20 +66,47 @@ class PortMap : public AllStatic {
 
   static void DebugDumpForMessageHandler(MessageHandler* handler);
 
+  // The number of times a port was looked up and how many of those lookups
+  // had to wait for the lock of the port's shard.
+  static int64_t LookupCount();
+  static int64_t ContendedLookupCount();
+
  private:
+  friend class PortMapShardLocker;
+
   struct Entry : public PortSet<Entry>::Entry {
     Entry() : handler(nullptr) {}
 
     MessageHandler* handler;
   };
 
+  // The ports are distributed over a fixed number of shards, each with its
+  // own lock, so that posting messages to unrelated ports does not serialize
+  // on a single lock.
+  static constexpr intptr_t kShardBits = 4;
+  static constexpr intptr_t kNumShards = 1 << kShardBits;
+
+  // Shards are padded to a cache line each to avoid false sharing between
+  // threads posting to ports in different shards.
+  struct alignas(kCacheLineSize) Shard {
+    Mutex* mutex;
+    PortSet<Entry>* ports;
+    // Only incremented while holding [mutex].
+    RelaxedAtomic<int64_t> lookups;
+    RelaxedAtomic<int64_t> contended_lookups;
+  };
+
+  static Shard* ShardFor(Dart_Port port);
+
   // Allocate a new unique port.
   static Dart_Port AllocatePort();
 
-  // Lock protecting access to the port map.
+  // Lock serializing the creation and closing of ports. It protects [prng_]
+  // and the [MessageHandler::ports_] of all handlers. It is always acquired
+  // before any shard lock.
   static Mutex* mutex_;
 
-  static PortSet<Entry>* ports_;
+  static Shard shards_[kNumShards];
 
   static Random* prng_;
 };
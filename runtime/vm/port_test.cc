@@ -74,6 +74,30 @@ TEST_CASE(PortMap_CreateManyPorts) {
   }
 }
 
+TEST_CASE(PortMap_ManyLivePorts) {
+  // Enough ports to populate every shard of the port map.
+  const intptr_t kNumPorts = 256;
+  PortTestMessageHandler handler;
+  Dart_Port ports[kNumPorts];
+  for (intptr_t i = 0; i < kNumPorts; i++) {
+    ports[i] = PortMap::CreatePort(&handler);
+  }
+  const int64_t lookups = PortMap::LookupCount();
+  for (intptr_t i = 0; i < kNumPorts; i++) {
+    EXPECT(PortMap::PortExists(ports[i]));
+    EXPECT(PortMap::PostMessage(
+        Message::New(ports[i], Smi::New(i), Message::kNormalPriority)));
+  }
+  EXPECT_EQ(kNumPorts, handler.notify_count);
+  EXPECT_LE(lookups + 2 * kNumPorts, PortMap::LookupCount());
+  EXPECT_LE(PortMap::ContendedLookupCount(), PortMap::LookupCount());
+
+  PortMap::ClosePorts(&handler);
+  for (intptr_t i = 0; i < kNumPorts; i++) {
+    EXPECT(!PortMap::PortExists(ports[i]));
+  }
+}
+
 TEST_CASE(PortMap_PostMessage) {
   PortTestMessageHandler handler;
   Dart_Port port = PortMap::CreatePort(&handler);
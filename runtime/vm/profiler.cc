@@ -13,6 +13,7 @@
 #if !defined(DART_PRECOMPILED_RUNTIME)
 #include "vm/compiler/compiler_state.h"
 #endif
+#include "vm/datastream.h"
 #include "vm/debugger.h"
 #include "vm/instructions.h"
 #include "vm/isolate.h"
@@ -49,6 +50,12 @@ DEFINE_FLAG(bool, profile_vm, true, "Always collect native stack traces.");
 #else
 DEFINE_FLAG(bool, profile_vm, false, "Always collect native stack traces.");
 #endif
+DEFINE_FLAG(bool,
+            profile_native_frames,
+            false,
+            "When Dart code has called into the VM or a native extension, "
+            "collect the native frames above the exit frame as well as the "
+            "Dart frames below it. Implied by --profile_vm.");
 DEFINE_FLAG(bool,
             profile_vm_allocation,
             false,
@@ -63,6 +70,18 @@ DEFINE_FLAG(
     "default is ~4 seconds. Large values will greatly increase memory "
     "consumption.");
 
+DEFINE_FLAG(bool,
+            profile_aggregate,
+            false,
+            "Fold CPU samples into an aggregated stack dictionary as they are "
+            "collected instead of keeping them in the sample buffer.");
+DEFINE_FLAG(charp,
+            profile_aggregate_file,
+            nullptr,
+            "Write the aggregated CPU profile in the pprof format to the "
+            "given file when the profiler shuts down. Implies "
+            "--profile_aggregate.");
+
 // Include native stack dumping helpers into AOT compiler even in PRODUCT
 // mode. This allows to report more informative errors when gen_snapshot
 // crashes.
@@ -133,7 +152,8 @@ class ProfilerStackWalker : public ValueObject {
         skip_count_(skip_count),
         frames_skipped_(0),
         frame_index_(0),
-        total_frames_(0) {
+        total_frames_(0),
+        head_sample_(head_sample) {
     if (sample_ == nullptr) {
       ASSERT(sample_buffer_ == nullptr);
     } else {
@@ -176,6 +196,16 @@ class ProfilerStackWalker : public ValueObject {
     return true;
   }
 
+  // Appends further frames after the ones already collected by |other| into
+  // the same sample.
+  void ContinueFrom(const ProfilerStackWalker& other) {
+    ASSERT(head_sample_ == other.head_sample_);
+    sample_ = other.sample_;
+    frames_skipped_ = other.frames_skipped_;
+    frame_index_ = other.frame_index_;
+    total_frames_ = other.total_frames_;
+  }
+
  protected:
   Dart_Port port_id_;
   Sample* sample_;
@@ -184,6 +214,9 @@ class ProfilerStackWalker : public ValueObject {
   intptr_t frames_skipped_;
   intptr_t frame_index_;
   intptr_t total_frames_;
+  // Flags describing the whole stack trace are kept on the head sample, even
+  // once frames spill into linked samples.
+  Sample* const head_sample_;
 };
 
 // The layout of C stack frames.
@@ -234,7 +267,10 @@ class ProfilerNativeStackWalker : public ProfilerStackWalker {
         original_sp_(sp),
         lower_bound_(stack_lower) {}
 
-  void walk() {
+  // Walks the frame pointer chain from the interrupted frame. A non-zero
+  // |stop_fp| ends the walk at the first frame at or above it, which is where
+  // the Dart frames of an exit frame begin.
+  void walk(uword stop_fp = 0) {
     Append(original_pc_, original_fp_);
 
     uword* pc = reinterpret_cast<uword*>(original_pc_);
@@ -255,6 +291,11 @@ class ProfilerNativeStackWalker : public ProfilerStackWalker {
         return;
       }
 
+      if ((stop_fp != 0) && (reinterpret_cast<uword>(fp) >= stop_fp)) {
+        // Reached the exit frame.
+        return;
+      }
+
       if (fp <= previous_fp) {
         // Frame pointer did not move to a higher address.
         counters_->incomplete_sample_fp_step.fetch_add(1);
@@ -565,6 +606,7 @@ void Profiler::DumpStackTrace(uword sp, uword fp, uword pc, bool for_crash) {
 
 RelaxedAtomic<bool> Profiler::initialized_ = false;
 SampleBlockBuffer* Profiler::sample_block_buffer_ = nullptr;
+AggregatedProfile* Profiler::aggregated_profile_ = nullptr;
 
 bool SampleBlockProcessor::initialized_ = false;
 bool SampleBlockProcessor::shutdown_ = false;
@@ -587,6 +629,10 @@ void Profiler::Init() {
     intptr_t num_blocks = CalculateSampleBufferCapacity();
     sample_block_buffer_ = new SampleBlockBuffer(num_blocks);
   }
+  if ((aggregated_profile_ == nullptr) &&
+      (FLAG_profile_aggregate || (FLAG_profile_aggregate_file != nullptr))) {
+    aggregated_profile_ = new AggregatedProfile();
+  }
   ThreadInterrupter::Init();
   ThreadInterrupter::Startup();
   SampleBlockProcessor::Init();
@@ -612,6 +658,7 @@ void Profiler::Cleanup() {
   ASSERT(initialized_);
   ThreadInterrupter::Cleanup();
   SampleBlockProcessor::Cleanup();
+  WriteAggregatedProfile();
   SampleBlockCleanupVisitor visitor;
   Isolate::VisitIsolates(&visitor);
   initialized_ = false;
@@ -1024,10 +1071,12 @@ class ProfilerDartStackWalker : public ProfilerStackWalker {
         sp_(reinterpret_cast<uword*>(sp)),
         lr_(reinterpret_cast<uword*>(lr)) {}
 
+  uword exit_frame_fp() const { return thread_->top_exit_frame_info(); }
+
   void walk() {
     RELEASE_ASSERT(StubCode::HasBeenInitialized());
     if (thread_->isolate()->IsDeoptimizing()) {
-      sample_->set_ignore_sample(true);
+      head_sample_->set_ignore_sample(true);
       return;
     }
 
@@ -1065,12 +1114,12 @@ class ProfilerDartStackWalker : public ProfilerStackWalker {
         // to identify the entry frame and lead the stack walk into the weeds.
         // Do not continue the stalk walk since this might be a false positive
         // from a Smi or unboxed value.
-        sample_->set_ignore_sample(true);
+        head_sample_->set_ignore_sample(true);
         return;
       }
     }
 
-    sample_->set_exit_frame_sample(has_exit_frame);
+    head_sample_->set_exit_frame_sample(has_exit_frame);
 
     for (;;) {
       // Skip entry frame.
@@ -1203,6 +1252,12 @@ static void CollectSample(Isolate* isolate,
       native_stack_walker->walk();
     } else if (StubCode::HasBeenInitialized() && exited_dart_code) {
       counters->stack_walker_dart_exit.fetch_add(1);
+      if (FLAG_profile_native_frames) {
+        // Collect the native frames up to the exit frame, then let the Dart
+        // stack walker continue from there.
+        native_stack_walker->walk(dart_stack_walker->exit_frame_fp());
+        dart_stack_walker->ContinueFrom(*native_stack_walker);
+      }
       // We have a valid exit frame info, use the Dart stack walker.
       dart_stack_walker->walk();
     } else if (StubCode::HasBeenInitialized() && in_dart_code) {
@@ -1273,7 +1328,8 @@ static bool CheckIsolate(Isolate* isolate) {
 
 void Profiler::SampleAllocation(Thread* thread,
                                 intptr_t cid,
-                                uint32_t identity_hash) {
+                                uint32_t identity_hash,
+                                intptr_t allocation_size) {
   ASSERT(thread != nullptr);
   OSThread* os_thread = thread->os_thread();
   ASSERT(os_thread != nullptr);
@@ -1314,6 +1370,7 @@ void Profiler::SampleAllocation(Thread* thread,
   }
   sample->SetAllocationCid(cid);
   sample->set_allocation_identity_hash(identity_hash);
+  sample->set_allocation_size(allocation_size);
 
   if (FLAG_profile_vm_allocation) {
     ProfilerNativeStackWalker native_stack_walker(
@@ -1652,6 +1709,7 @@ ProcessedSample* SampleBuffer::BuildProcessedSample(
     processed_sample->set_allocation_cid(sample->allocation_cid());
     processed_sample->set_allocation_identity_hash(
         sample->allocation_identity_hash());
+    processed_sample->set_allocation_size(sample->allocation_size());
   }
   processed_sample->set_first_frame_executing(!sample->exit_frame_sample());
 
@@ -1704,6 +1762,7 @@ ProcessedSample::ProcessedSample()
       user_tag_(0),
       allocation_cid_(-1),
       allocation_identity_hash_(0),
+      allocation_size_(0),
       truncated_(false) {}
 
 void ProcessedSample::FixupCaller(const CodeLookupTable& clt,
@@ -1780,6 +1839,274 @@ ProcessedSampleBuffer::ProcessedSampleBuffer()
   ASSERT(code_lookup_table_ != nullptr);
 }
 
+AggregatedProfile::AggregatedProfile() {}
+
+AggregatedProfile::~AggregatedProfile() {
+  for (intptr_t i = 0; i < function_names_.length(); i++) {
+    free(function_names_[i]);
+  }
+  for (intptr_t i = 0; i < stacks_.length(); i++) {
+    free(stacks_[i]->ids());
+    delete stacks_[i];
+  }
+}
+
+uword AggregatedProfile::Stack::ComputeHash(intptr_t* ids, intptr_t length) {
+  uint32_t hash = 0;
+  for (intptr_t i = 0; i < length; i++) {
+    hash = CombineHashes(hash, static_cast<uint32_t>(ids[i]));
+  }
+  return FinalizeHash(hash);
+}
+
+int64_t AggregatedProfile::sample_count() {
+  MutexLocker ml(&mutex_);
+  return sample_count_;
+}
+
+intptr_t AggregatedProfile::stack_count() {
+  MutexLocker ml(&mutex_);
+  return stacks_.length();
+}
+
+intptr_t AggregatedProfile::FunctionIdFor(const char* name) {
+  auto* pair = function_ids_.Lookup(name);
+  if (pair != nullptr) {
+    return pair->value;
+  }
+  char* copy = Utils::StrDup(name);
+  function_names_.Add(copy);
+  const intptr_t id = function_names_.length();
+  function_ids_.Insert({copy, id});
+  return id;
+}
+
+intptr_t AggregatedProfile::LocationIdFor(uword pc,
+                                          const CodeLookupTable& clt) {
+  intptr_t function_id;
+  const CodeDescriptor* descriptor = clt.FindCode(pc);
+  if (descriptor != nullptr) {
+    function_id = FunctionIdFor(descriptor->Name());
+  } else {
+    uword native_start = 0;
+    const char* native_name =
+        NativeSymbolResolver::LookupSymbolName(pc, &native_start);
+    if (native_name != nullptr) {
+      function_id = FunctionIdFor(native_name);
+      NativeSymbolResolver::FreeSymbolName(native_name);
+    } else {
+      Zone* zone = Thread::Current()->zone();
+      uword dso_base;
+      const char* dso_name;
+      if (NativeSymbolResolver::LookupSharedObject(pc, &dso_base,
+                                                   &dso_name)) {
+        function_id = FunctionIdFor(OS::SCreate(
+            zone, "[Native] %s+0x%" Px, dso_name, pc - dso_base));
+        NativeSymbolResolver::FreeSymbolName(dso_name);
+      } else {
+        function_id = FunctionIdFor(OS::SCreate(zone, "[Native] %" Px, pc));
+      }
+    }
+  }
+
+  const Location location = {pc, function_id};
+  auto* pair = location_ids_.Lookup(location);
+  if (pair != nullptr) {
+    return pair->value;
+  }
+  locations_.Add(location);
+  const intptr_t id = locations_.length();
+  location_ids_.Insert({location, id});
+  return id;
+}
+
+void AggregatedProfile::Fold(ProcessedSampleBuffer* buffer) {
+  Zone* zone = Thread::Current()->zone();
+  const CodeLookupTable& clt = buffer->code_lookup_table();
+  // Code lookups and symbolization are the expensive part of folding, so each
+  // pc is only resolved once per batch. Ids are never 0.
+  IntMap<intptr_t> resolved(zone);
+  GrowableArray<intptr_t> ids(zone, Sample::kPCArraySizeInWords);
+
+  MutexLocker ml(&mutex_);
+  for (intptr_t i = 0; i < buffer->length(); i++) {
+    ProcessedSample* sample = buffer->At(i);
+    if (sample->IsAllocationSample()) {
+      continue;
+    }
+    ids.Clear();
+    for (intptr_t j = 0; j < sample->length(); j++) {
+      const uword pc = sample->At(j);
+      intptr_t id = resolved.Lookup(pc);
+      if (id == 0) {
+        id = LocationIdFor(pc, clt);
+        resolved.Insert(pc, id);
+      }
+      ids.Add(id);
+    }
+    Stack key(ids.data(), ids.length());
+    Stack* stack = stack_set_.LookupValue(&key);
+    if (stack == nullptr) {
+      intptr_t* copy =
+          reinterpret_cast<intptr_t*>(malloc(ids.length() * sizeof(intptr_t)));
+      memmove(copy, ids.data(), ids.length() * sizeof(intptr_t));
+      stack = new Stack(copy, ids.length());
+      stacks_.Add(stack);
+      stack_set_.Insert(stack);
+    }
+    stack->Increment();
+    sample_count_++;
+  }
+}
+
+// Field numbers and wire types from pprof's profile.proto.
+enum PprofField : intptr_t {
+  kProfileSampleType = 1,
+  kProfileSample = 2,
+  kProfileLocation = 4,
+  kProfileFunction = 5,
+  kProfileStringTable = 6,
+  kProfilePeriodType = 11,
+  kProfilePeriod = 12,
+  kValueTypeType = 1,
+  kValueTypeUnit = 2,
+  kSampleLocationId = 1,
+  kSampleValue = 2,
+  kLocationId = 1,
+  kLocationAddress = 3,
+  kLocationLine = 4,
+  kLineFunctionId = 1,
+  kFunctionId = 1,
+  kFunctionName = 2,
+  kFunctionSystemName = 3,
+};
+
+static constexpr intptr_t kWireTypeVarint = 0;
+static constexpr intptr_t kWireTypeLengthDelimited = 2;
+
+static void WriteVarintField(BaseWriteStream* stream,
+                             intptr_t field,
+                             uint64_t value) {
+  stream->WriteLEB128<uint64_t>((field << 3) | kWireTypeVarint);
+  stream->WriteLEB128<uint64_t>(value);
+}
+
+static void WriteBytesField(BaseWriteStream* stream,
+                            intptr_t field,
+                            const void* bytes,
+                            intptr_t length) {
+  stream->WriteLEB128<uint64_t>((field << 3) | kWireTypeLengthDelimited);
+  stream->WriteLEB128<uint64_t>(length);
+  stream->WriteBytes(bytes, length);
+}
+
+// Writes the contents of |message| as a length-delimited field and resets it
+// for reuse.
+static void WriteMessageField(BaseWriteStream* stream,
+                              intptr_t field,
+                              NonStreamingWriteStream* message) {
+  WriteBytesField(stream, field, message->buffer(), message->bytes_written());
+  message->SetPosition(0);
+}
+
+void AggregatedProfile::SerializePprof(uint8_t** buffer, intptr_t* length) {
+  // The leading entries of the string table. Function names follow, so
+  // function |id| has its name at kFunctionNamesString + id - 1.
+  enum : intptr_t {
+    kEmptyString,
+    kSamplesString,
+    kCountString,
+    kCpuString,
+    kNanosecondsString,
+    kFunctionNamesString,
+  };
+  static const char* const kStrings[] = {"", "samples", "count", "cpu",
+                                         "nanoseconds"};
+  const int64_t period = FLAG_profile_period * kNanosecondsPerMicrosecond;
+
+  MallocWriteStream profile(64 * KB);
+  MallocWriteStream message(KB);
+  MallocWriteStream inner(KB);
+
+  MutexLocker ml(&mutex_);
+  WriteVarintField(&message, kValueTypeType, kSamplesString);
+  WriteVarintField(&message, kValueTypeUnit, kCountString);
+  WriteMessageField(&profile, kProfileSampleType, &message);
+  WriteVarintField(&message, kValueTypeType, kCpuString);
+  WriteVarintField(&message, kValueTypeUnit, kNanosecondsString);
+  WriteMessageField(&profile, kProfileSampleType, &message);
+
+  for (intptr_t i = 0; i < stacks_.length(); i++) {
+    const Stack* stack = stacks_[i];
+    for (intptr_t j = 0; j < stack->length(); j++) {
+      inner.WriteLEB128<uint64_t>(stack->ids()[j]);
+    }
+    WriteMessageField(&message, kSampleLocationId, &inner);
+    inner.WriteLEB128<uint64_t>(stack->count());
+    inner.WriteLEB128<uint64_t>(stack->count() * period);
+    WriteMessageField(&message, kSampleValue, &inner);
+    WriteMessageField(&profile, kProfileSample, &message);
+  }
+
+  for (intptr_t i = 0; i < locations_.length(); i++) {
+    WriteVarintField(&message, kLocationId, i + 1);
+    WriteVarintField(&message, kLocationAddress, locations_[i].pc);
+    WriteVarintField(&inner, kLineFunctionId, locations_[i].function_id);
+    WriteMessageField(&message, kLocationLine, &inner);
+    WriteMessageField(&profile, kProfileLocation, &message);
+  }
+
+  for (intptr_t i = 0; i < function_names_.length(); i++) {
+    WriteVarintField(&message, kFunctionId, i + 1);
+    WriteVarintField(&message, kFunctionName, kFunctionNamesString + i);
+    WriteVarintField(&message, kFunctionSystemName, kFunctionNamesString + i);
+    WriteMessageField(&profile, kProfileFunction, &message);
+  }
+
+  for (intptr_t i = 0; i < kFunctionNamesString; i++) {
+    WriteBytesField(&profile, kProfileStringTable, kStrings[i],
+                    strlen(kStrings[i]));
+  }
+  for (intptr_t i = 0; i < function_names_.length(); i++) {
+    WriteBytesField(&profile, kProfileStringTable, function_names_[i],
+                    strlen(function_names_[i]));
+  }
+
+  WriteVarintField(&message, kValueTypeType, kCpuString);
+  WriteVarintField(&message, kValueTypeUnit, kNanosecondsString);
+  WriteMessageField(&profile, kProfilePeriodType, &message);
+  WriteVarintField(&profile, kProfilePeriod, period);
+
+  *buffer = profile.Steal(length);
+}
+
+void Profiler::WriteAggregatedProfile() {
+  if ((aggregated_profile_ == nullptr) ||
+      (FLAG_profile_aggregate_file == nullptr)) {
+    return;
+  }
+  Dart_FileOpenCallback file_open = Dart::file_open_callback();
+  Dart_FileWriteCallback file_write = Dart::file_write_callback();
+  Dart_FileCloseCallback file_close = Dart::file_close_callback();
+  if ((file_open == nullptr) || (file_write == nullptr) ||
+      (file_close == nullptr)) {
+    OS::PrintErr("warning: Could not access file callbacks.");
+    return;
+  }
+  void* file = (*file_open)(FLAG_profile_aggregate_file, true);
+  if (file == nullptr) {
+    OS::PrintErr("warning: Failed to write aggregated profile: %s\n",
+                 FLAG_profile_aggregate_file);
+    return;
+  }
+  uint8_t* buffer = nullptr;
+  intptr_t length = 0;
+  aggregated_profile_->SerializePprof(&buffer, &length);
+  (*file_write)(buffer, length, file);
+  (*file_close)(file);
+  free(buffer);
+}
+
 void SampleBlockProcessor::Init() {
   ASSERT(!initialized_);
   if (monitor_ == nullptr) {
@@ -1838,7 +2165,8 @@ class StreamableSampleFilter : public SampleFilter {
 };
 
 void Profiler::ProcessCompletedBlocks(Isolate* isolate) {
-  if (!Service::profiler_stream.enabled()) return;
+  const bool streaming = Service::profiler_stream.enabled();
+  if (!streaming && (aggregated_profile_ == nullptr)) return;
   auto thread = Thread::Current();
   if (Isolate::IsSystemIsolate(isolate)) return;
 
@@ -1846,6 +2174,14 @@ void Profiler::ProcessCompletedBlocks(Isolate* isolate) {
   DisableThreadInterruptsScope dtis(thread);
   StackZone zone(thread);
   HandleScope handle_scope(thread);
+  if (aggregated_profile_ != nullptr) {
+    // Leave the samples in place for the stream below if anyone is listening.
+    SampleFilter filter(isolate->main_port(), SampleFilter::kNoTaskFilter, -1,
+                        -1, /*take_samples=*/!streaming);
+    aggregated_profile_->Fold(
+        sample_block_buffer()->BuildProcessedSampleBuffer(isolate, &filter));
+  }
+  if (!streaming) return;
   StreamableSampleFilter filter(isolate->main_port(), isolate);
   Profile profile;
   profile.Build(thread, isolate, &filter, Profiler::sample_block_buffer());
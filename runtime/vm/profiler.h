@@ -12,6 +12,8 @@
 #include "vm/code_observers.h"
 #include "vm/globals.h"
 #include "vm/growable_array.h"
+#include "vm/hash.h"
+#include "vm/hash_map.h"
 #include "vm/native_symbol.h"
 #include "vm/object.h"
 #include "vm/tags.h"
@@ -23,6 +25,7 @@
 namespace dart {
 
 // Forward declarations.
+class AggregatedProfile;
 class ProcessedSample;
 class ProcessedSampleBuffer;
 
@@ -74,9 +77,12 @@ class Profiler : public AllStatic {
   static void DumpStackTrace(void* context);
   static void DumpStackTrace(bool for_crash = true);
 
+  // 'allocation_size' is the number of bytes the sample stands for, or zero if
+  // the allocation was traced rather than sampled.
   static void SampleAllocation(Thread* thread,
                                intptr_t cid,
-                               uint32_t identity_hash);
+                               uint32_t identity_hash,
+                               intptr_t allocation_size = 0);
 
   // SampleThread is called from inside the signal handler and hence it is very
   // critical that the implementation of SampleThread does not do any of the
@@ -97,9 +103,17 @@ class Profiler : public AllStatic {
   static void ProcessCompletedBlocks(Isolate* isolate);
   static void IsolateShutdown(Thread* thread);
 
+  // Non-null when --profile_aggregate is set.
+  static AggregatedProfile* aggregated_profile() {
+    return aggregated_profile_;
+  }
+
  private:
   static void DumpStackTrace(uword sp, uword fp, uword pc, bool for_crash);
 
+  // Writes the aggregated profile to --profile_aggregate_file, if set.
+  static void WriteAggregatedProfile();
+
   // Calculates the sample buffer capacity. Returns
   // SampleBuffer::kDefaultBufferCapacity if --sample-buffer-duration is not
   // provided. Otherwise, the capacity is based on the sample rate, maximum
@@ -114,6 +128,7 @@ class Profiler : public AllStatic {
   static RelaxedAtomic<bool> initialized_;
 
   static SampleBlockBuffer* sample_block_buffer_;
+  static AggregatedProfile* aggregated_profile_;
 
   static ProfilerCounters counters_;
 
@@ -224,6 +239,7 @@ class Sample {
     state_ = 0;
     next_ = nullptr;
     allocation_identity_hash_ = 0;
+    allocation_size_ = 0;
     set_head_sample(true);
   }
 
@@ -319,6 +335,9 @@ class Sample {
     allocation_identity_hash_ = hash;
   }
 
+  intptr_t allocation_size() const { return allocation_size_; }
+  void set_allocation_size(intptr_t size) { allocation_size_ = size; }
+
   Thread::TaskKind thread_task() const { return ThreadTaskBit::decode(state_); }
 
   void set_thread_task(Thread::TaskKind task) {
@@ -376,6 +395,7 @@ class Sample {
   uint32_t state_;
   Sample* next_;
   uint32_t allocation_identity_hash_;
+  intptr_t allocation_size_;
 
   using HeadSampleBit = BitField<decltype(state_), bool, 0, 1>;
   using LeafFrameIsDart =
@@ -843,6 +863,10 @@ class ProcessedSample : public ZoneAllocated {
     allocation_identity_hash_ = hash;
   }
 
+  // The bytes a sampled allocation stands for. 0 otherwise.
+  intptr_t allocation_size() const { return allocation_size_; }
+  void set_allocation_size(intptr_t size) { allocation_size_ = size; }
+
   bool IsAllocationSample() const { return allocation_cid_ > 0; }
 
   // Was the stack trace truncated?
@@ -872,6 +896,7 @@ class ProcessedSample : public ZoneAllocated {
   uword user_tag_;
   intptr_t allocation_cid_;
   uint32_t allocation_identity_hash_;
+  intptr_t allocation_size_;
   bool truncated_;
   bool first_frame_executing_;
 
@@ -901,6 +926,98 @@ class ProcessedSampleBuffer : public ZoneAllocated {
   DISALLOW_COPY_AND_ASSIGN(ProcessedSampleBuffer);
 };
 
+// A deduplicated dictionary of CPU sample stacks and their counts.
+//
+// With --profile_aggregate, completed sample blocks are folded into a single
+// instance on the sample block processor thread and then released, so the
+// profile can stay enabled indefinitely without the sample buffer filling up
+// or the cost of building a |Profile| from raw samples. Frames are resolved to
+// names when they are first seen, while the code they belong to is alive.
+class AggregatedProfile {
+ public:
+  AggregatedProfile();
+  ~AggregatedProfile();
+
+  // Adds each sample in |buffer| to the dictionary. Must be called by a thread
+  // with a current zone.
+  void Fold(ProcessedSampleBuffer* buffer);
+
+  int64_t sample_count();
+  intptr_t stack_count();
+
+  // Serializes the dictionary as an uncompressed pprof 'Profile' message into
+  // a malloc'ed buffer owned by the caller.
+  void SerializePprof(uint8_t** buffer, intptr_t* length);
+
+ private:
+  struct Location {
+    uword pc;
+    intptr_t function_id;
+  };
+
+  struct LocationKeyValueTrait {
+    using Key = Location;
+    using Value = intptr_t;
+
+    struct Pair {
+      Key key;
+      Value value;
+      Pair() : key({0, 0}), value(0) {}
+      Pair(const Key key, const Value& value) : key(key), value(value) {}
+    };
+
+    static Key KeyOf(const Pair& pair) { return pair.key; }
+    static Value ValueOf(const Pair& pair) { return pair.value; }
+    static uword Hash(const Key& key) {
+      return CombineHashes(static_cast<uint32_t>(key.pc),
+                           static_cast<uint32_t>(key.function_id));
+    }
+    static bool IsKeyEqual(const Pair& kv, const Key& key) {
+      return (kv.key.pc == key.pc) && (kv.key.function_id == key.function_id);
+    }
+  };
+
+  // A stack of location ids, leaf first.
+  class Stack : public MallocAllocated {
+   public:
+    Stack(intptr_t* ids, intptr_t length)
+        : ids_(ids), length_(length), hash_(ComputeHash(ids, length)) {}
+
+    intptr_t* ids() const { return ids_; }
+    intptr_t length() const { return length_; }
+    int64_t count() const { return count_; }
+    void Increment() { count_++; }
+
+    uword Hash() const { return hash_; }
+    bool Equals(const Stack& other) const {
+      return (hash_ == other.hash_) && (length_ == other.length_) &&
+             (memcmp(ids_, other.ids_, length_ * sizeof(intptr_t)) == 0);
+    }
+
+   private:
+    static uword ComputeHash(intptr_t* ids, intptr_t length);
+
+    intptr_t* ids_;
+    intptr_t length_;
+    uword hash_;
+    int64_t count_ = 0;
+  };
+
+  intptr_t FunctionIdFor(const char* name);
+  intptr_t LocationIdFor(uword pc, const CodeLookupTable& clt);
+
+  Mutex mutex_;
+  int64_t sample_count_ = 0;
+  MallocGrowableArray<char*> function_names_;
+  MallocDirectChainedHashMap<CStringIntMapKeyValueTrait> function_ids_;
+  MallocGrowableArray<Location> locations_;
+  MallocDirectChainedHashMap<LocationKeyValueTrait> location_ids_;
+  MallocGrowableArray<Stack*> stacks_;
+  MallocDirectChainedHashMap<PointerSetKeyValueTrait<Stack>> stack_set_;
+
+  DISALLOW_COPY_AND_ASSIGN(AggregatedProfile);
+};
+
 class SampleBlockProcessor : public AllStatic {
  public:
   static void Init();
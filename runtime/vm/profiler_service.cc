@@ -1811,6 +1811,9 @@ void Profile::PrintSamplesJSON(JSONObject* obj, bool code_samples) {
       sample_obj.AddProperty64("classId", sample->allocation_cid());
       sample_obj.AddProperty64("identityHashCode",
                                sample->allocation_identity_hash());
+      if (sample->allocation_size() > 0) {
+        sample_obj.AddProperty64("_allocationSize", sample->allocation_size());
+      }
     }
   }
 }
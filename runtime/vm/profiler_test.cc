@@ -21,6 +21,7 @@ DECLARE_FLAG(bool, profile_vm);
 DECLARE_FLAG(bool, profile_vm_allocation);
 DECLARE_FLAG(int, max_profile_depth);
 DECLARE_FLAG(int, optimization_counter_threshold);
+DECLARE_FLAG(bool, heap_sampling_profile);
 
 // SampleVisitor ignores samples with timestamp == 0.
 const int64_t kValidTimeStamp = 1;
@@ -621,6 +622,54 @@ ISOLATE_UNIT_TEST_CASE(Profiler_ToggleRecordAllocation) {
   }
 }
 
+ISOLATE_UNIT_TEST_CASE(Profiler_HeapSamplingProfile) {
+  EnableProfiler();
+  SetFlagScope<bool> sfs(&FLAG_heap_sampling_profile, true);
+
+  DisableNativeProfileScope dnps;
+  DisableBackgroundCompilationScope dbcs;
+  const char* kScript =
+      "class A {\n"
+      "  var a;\n"
+      "  var b;\n"
+      "}\n"
+      "main() {\n"
+      "  return new A();\n"
+      "}\n";
+
+  const Library& root_library = Library::Handle(LoadTestScript(kScript));
+  const Class& class_a = Class::Handle(GetClass(root_library, "A"));
+  EXPECT(!class_a.IsNull());
+
+  // Sample every byte, without tracing A or registering a callback.
+  HeapProfileSampler::Enable(true);
+  HeapProfileSampler::SetSamplingInterval(1);
+  thread->HandleInterrupts();
+
+  Invoke(root_library, "main");
+
+  HeapProfileSampler::Enable(false);
+  HeapProfileSampler::SetSamplingInterval(512 * KB);
+  thread->HandleInterrupts();
+
+  {
+    Isolate* isolate = thread->isolate();
+    StackZone zone(thread);
+    Profile profile;
+    AllocationFilter filter(isolate->main_port(), class_a.id());
+    profile.Build(thread, isolate, &filter, Profiler::sample_block_buffer());
+    // The sampled allocation carries its stack.
+    EXPECT(profile.sample_count() > 0);
+    ProfileStackWalker walker(&profile);
+    EXPECT_STREQ("DRT_AllocateObject", walker.VMTagName());
+    bool found_main = false;
+    do {
+      found_main |= strstr(walker.CurrentName(), "main") != nullptr;
+    } while (walker.Down());
+    EXPECT(found_main);
+  }
+}
+
 ISOLATE_UNIT_TEST_CASE(Profiler_CodeTicks) {
   EnableProfiler();
   DisableNativeProfileScope dnps;
@@ -2447,6 +2496,46 @@ ISOLATE_UNIT_TEST_CASE(Profiler_EnterExitIsolate) {
   }
 }
 
+static ProcessedSample* MakeProcessedSample(uword leaf, uword caller) {
+  ProcessedSample* sample = new ProcessedSample();
+  sample->Add(leaf);
+  sample->Add(caller);
+  return sample;
+}
+
+ISOLATE_UNIT_TEST_CASE(Profiler_AggregatedProfile) {
+  AggregatedProfile profile;
+  ProcessedSampleBuffer* buffer = new ProcessedSampleBuffer();
+  buffer->Add(MakeProcessedSample(kValidPc, kValidPc + 1));
+  buffer->Add(MakeProcessedSample(kValidPc + 2, kValidPc + 1));
+  buffer->Add(MakeProcessedSample(kValidPc, kValidPc + 1));
+  profile.Fold(buffer);
+  EXPECT_EQ(3, profile.sample_count());
+  EXPECT_EQ(2, profile.stack_count());
+
+  // Folding the same stacks again only bumps their counts.
+  profile.Fold(buffer);
+  EXPECT_EQ(6, profile.sample_count());
+  EXPECT_EQ(2, profile.stack_count());
+
+  uint8_t* bytes = nullptr;
+  intptr_t length = 0;
+  profile.SerializePprof(&bytes, &length);
+  EXPECT(length > 0);
+  // Starts with the first sample_type, a length-delimited field 1.
+  EXPECT_EQ(0x0A, bytes[0]);
+  const char* kSamples = "samples";
+  bool found_string = false;
+  for (intptr_t i = 0; i + 7 <= length; i++) {
+    if (memcmp(bytes + i, kSamples, 7) == 0) {
+      found_string = true;
+      break;
+    }
+  }
+  EXPECT(found_string);
+  free(bytes);
+}
+
 #endif  // !PRODUCT
 
 }  // namespace dart
@@ -773,6 +773,97 @@ void ProgramVisitor::DedupPcDescriptors(Thread* thread) {
   WalkProgram(thread->zone(), thread->isolate_group(), &visitor);
 }
 
+#if defined(DART_PRECOMPILER)
+class ExceptionHandlersKeyValueTrait {
+ public:
+  // Typedefs needed for the DirectChainedHashMap template.
+  typedef const ExceptionHandlers* Key;
+  typedef const ExceptionHandlers* Value;
+  typedef const ExceptionHandlers* Pair;
+
+  static Key KeyOf(Pair kv) { return kv; }
+
+  static Value ValueOf(Pair kv) { return kv; }
+
+  static inline uword Hash(Key key) {
+    uint32_t hash = key->num_entries();
+    ExceptionHandlerInfo info;
+    for (intptr_t i = 0; i < key->num_entries(); i++) {
+      key->GetHandlerInfo(i, &info);
+      hash = CombineHashes(hash, info.handler_pc_offset);
+    }
+    return FinalizeHash(hash);
+  }
+
+  static inline bool IsKeyEqual(Pair pair, Key key) {
+    if (pair->num_entries() != key->num_entries() ||
+        pair->has_async_handler() != key->has_async_handler()) {
+      return false;
+    }
+    ExceptionHandlerInfo a, b;
+    for (intptr_t i = 0; i < key->num_entries(); i++) {
+      pair->GetHandlerInfo(i, &a);
+      key->GetHandlerInfo(i, &b);
+      if (a.handler_pc_offset != b.handler_pc_offset ||
+          a.outer_try_index != b.outer_try_index ||
+          a.needs_stacktrace != b.needs_stacktrace ||
+          a.has_catch_all != b.has_catch_all ||
+          a.is_generated != b.is_generated) {
+        return false;
+      }
+    }
+    // Handled types are canonical, so they can be compared by identity.
+    auto& a_types = Array::Handle();
+    auto& b_types = Array::Handle();
+    for (intptr_t i = 0; i < key->num_entries(); i++) {
+      a_types = pair->GetHandledTypes(i);
+      b_types = key->GetHandledTypes(i);
+      if (a_types.ptr() == b_types.ptr()) continue;
+      if (a_types.IsNull() || b_types.IsNull() ||
+          a_types.Length() != b_types.Length()) {
+        return false;
+      }
+      for (intptr_t j = 0; j < a_types.Length(); j++) {
+        if (a_types.At(j) != b_types.At(j)) return false;
+      }
+    }
+    return true;
+  }
+};
+
+// Code objects with identical try/catch structure (typically stubs and
+// small generated functions) end up with identical handler tables. Sharing
+// them shrinks the ExceptionHandlers cluster materialized when the snapshot
+// is loaded and lets DedupInstructions merge more Code objects, as it
+// compares handler tables by identity.
+void ProgramVisitor::DedupExceptionHandlers(Thread* thread) {
+  class DedupExceptionHandlersVisitor
+      : public CodeVisitor,
+        public Deduper<ExceptionHandlers, ExceptionHandlersKeyValueTrait> {
+   public:
+    explicit DedupExceptionHandlersVisitor(Zone* zone)
+        : Deduper(zone), handlers_(ExceptionHandlers::Handle(zone)) {
+      AddCanonical(Object::empty_exception_handlers());
+      AddCanonical(Object::empty_async_exception_handlers());
+    }
+
+    void VisitCode(const Code& code) {
+      handlers_ = code.exception_handlers();
+      if (handlers_.IsNull()) return;
+      handlers_ = Dedup(handlers_);
+      code.set_exception_handlers(handlers_);
+    }
+
+   private:
+    ExceptionHandlers& handlers_;
+  };
+
+  StackZone stack_zone(thread);
+  DedupExceptionHandlersVisitor visitor(thread->zone());
+  WalkProgram(thread->zone(), thread->isolate_group(), &visitor);
+}
+#endif  // defined(DART_PRECOMPILER)
+
 class TypedDataKeyValueTrait {
  public:
   // Typedefs needed for the DirectChainedHashMap template.
@@ -1163,6 +1254,10 @@ class InstructionsKeyValueTrait {
 // objects are only deduplicated if the metadata in the code is the same.
 // The runtime can then pick any code object corresponding to the PC in the
 // frame and use the metadata.
+//
+// Note that the equality is not symmetric across loading units: a stored
+// [Code] from the root unit matches code from any unit, but not vice versa,
+// so deferred code is only ever replaced by code that is loaded with it.
 #if defined(DART_PRECOMPILER)
 class CodeKeyValueTrait {
  public:
@@ -1211,8 +1306,11 @@ class CodeKeyValueTrait {
     if (!Instructions::Equals(pair->instructions(), key->instructions())) {
       return false;
     }
-    return LoadingUnit::LoadingUnitOf(*pair) ==
-           LoadingUnit::LoadingUnitOf(*key);
+    // Code in the root unit is always loaded, so code of any deferred unit
+    // can share it. Other code can only be shared within its own unit.
+    const intptr_t pair_unit = LoadingUnit::LoadingUnitOf(*pair);
+    return pair_unit == LoadingUnit::kRootId ||
+           pair_unit == LoadingUnit::LoadingUnitOf(*key);
   }
 };
 #endif
@@ -1414,6 +1512,7 @@ void ProgramVisitor::Dedup(Thread* thread) {
   DedupDeoptEntries(thread);
 #if defined(DART_PRECOMPILER)
   DedupCatchEntryMovesMaps(thread);
+  DedupExceptionHandlers(thread);
   DedupUnlinkedCalls(thread);
   PruneSubclasses(thread);
 #endif
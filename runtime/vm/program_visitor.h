@@ -113,6 +113,7 @@ class ProgramVisitor : public AllStatic {
   static void DedupDeoptEntries(Thread* thread);
 #if defined(DART_PRECOMPILER)
   static void DedupCatchEntryMovesMaps(Thread* thread);
+  static void DedupExceptionHandlers(Thread* thread);
   static void DedupUnlinkedCalls(Thread* thread);
   static void PruneSubclasses(Thread* thread);
 #endif
@@ -271,6 +271,8 @@ class UntaggedObject {
   //    `IsShallowlyImmutableCid(intptr_t predefined_cid)`
   //    a. Unmodifiable typed data view (backing store may be mutable).
   //    b. Closures (the context may be modifiable).
+  // 3. Records and unmodifiable lists found to only refer to shareable
+  //    objects when sent in a message (see `IsDeeplyImmutableContainer`).
   //
   // The bit is used in `CanShareObject` in object_graph_copy, where special
   // care is taken to look at the shallow immutable instances. Shallow immutable
@@ -2289,13 +2291,33 @@ class UntaggedInstructionsTable : public UntaggedObject {
   static_assert(sizeof(DataEntry) == sizeof(uint32_t) * 2);
 
   struct Data {
+    // The lookup index divides instructions into buckets of this many bits
+    // worth of bytes. It holds the number of buckets N followed by N + 1 entry
+    // indices: the index of the last entry starting at or before the start of
+    // each bucket and finally the index of the last entry.
+    static constexpr intptr_t kLookupBucketBits = 10;
+
     uint32_t canonical_stack_map_entries_offset;
     uint32_t length;
     uint32_t first_entry_with_code;
-    uint32_t padding;
+    // Offset of the lookup index or 0 if there is none.
+    uint32_t lookup_index_offset;
 
     const DataEntry* entries() const { OPEN_ARRAY_START(DataEntry, uint32_t); }
 
+    // Narrows down the range of entries [*lo, *hi] to the ones which can
+    // contain the given offset.
+    void NarrowSearch(uint32_t pc_offset, intptr_t* lo, intptr_t* hi) const {
+      if (lookup_index_offset == 0) return;
+      const uint32_t* index = reinterpret_cast<const uint32_t*>(
+          reinterpret_cast<uword>(this) + lookup_index_offset);
+      const uint32_t bucket_count = index[0];
+      const uint32_t bucket =
+          Utils::Minimum(pc_offset >> kLookupBucketBits, bucket_count - 1);
+      *lo = Utils::Maximum<intptr_t>(*lo, index[1 + bucket]);
+      *hi = Utils::Minimum<intptr_t>(*hi, index[2 + bucket]);
+    }
+
     const UntaggedCompressedStackMaps::Payload* StackMapAt(
         intptr_t offset) const {
       return reinterpret_cast<UntaggedCompressedStackMaps::Payload*>(
@@ -3280,8 +3302,22 @@ class UntaggedLinkedHashBase : public UntaggedInstance {
   VISIT_TO(index)
 
   CompressedObjectPtr* to_snapshot(Snapshot::Kind kind) {
-    // Do not serialize index.
-    return reinterpret_cast<CompressedObjectPtr*>(&deleted_keys_);
+    switch (kind) {
+      case Snapshot::kFullAOT:
+        // Indices of constant maps and sets precomputed by
+        // LinkedHashBase::ComputeAndSetIndex.
+        return reinterpret_cast<CompressedObjectPtr*>(&index_);
+      case Snapshot::kFull:
+      case Snapshot::kFullCore:
+      case Snapshot::kFullJIT:
+        // Do not serialize index.
+        return reinterpret_cast<CompressedObjectPtr*>(&deleted_keys_);
+      case Snapshot::kNone:
+      case Snapshot::kInvalid:
+        break;
+    }
+    UNREACHABLE();
+    return nullptr;
   }
 };
 
@@ -22,7 +22,10 @@ BytecodeRegExpMacroAssembler::BytecodeRegExpMacroAssembler(
     : RegExpMacroAssembler(zone),
       buffer_(buffer),
       pc_(0),
-      advance_current_end_(kInvalidPC) {}
+      advance_current_end_(kInvalidPC),
+      load_current_char_start_(kInvalidPC),
+      load_current_char_end_(kInvalidPC),
+      check_char_end_(kInvalidPC) {}
 
 BytecodeRegExpMacroAssembler::~BytecodeRegExpMacroAssembler() {
   if (backtrack_.is_linked()) backtrack_.Unuse();
@@ -35,6 +38,8 @@ BytecodeRegExpMacroAssembler::Implementation() {
 
 void BytecodeRegExpMacroAssembler::BindBlock(BlockLabel* l) {
   advance_current_end_ = kInvalidPC;
+  load_current_char_end_ = kInvalidPC;
+  check_char_end_ = kInvalidPC;
   ASSERT(!l->is_bound());
   if (l->is_linked()) {
     intptr_t pos = l->pos();
@@ -145,7 +150,25 @@ void BytecodeRegExpMacroAssembler::Backtrack() {
 }
 
 void BytecodeRegExpMacroAssembler::GoTo(BlockLabel* l) {
-  if (advance_current_end_ == pc_) {
+  if (advance_current_end_ == pc_ && advance_current_offset_ == 1 &&
+      check_char_end_ == advance_current_start_ && l->is_bound() &&
+      l->pos() == load_current_char_start_) {
+    // Replace the search loop
+    //
+    //   l: LOAD_CURRENT_CHAR offset, on_failure
+    //      CHECK_CHAR c, on_equal
+    //      ADVANCE_CP_AND_GOTO 1, l
+    //
+    // with a single SKIP_UNTIL_CHAR, which scans the subject with memchr.
+    // It keeps the operands of the first two instructions in place, so
+    // unresolved links to on_failure and on_equal remain valid.
+    ASSERT(advance_current_start_ - load_current_char_start_ ==
+           BC_SKIP_UNTIL_CHAR_LENGTH);
+    buffer_->data()[load_current_char_start_] = BC_SKIP_UNTIL_CHAR;
+    pc_ = advance_current_start_;
+    advance_current_end_ = kInvalidPC;
+    check_char_end_ = kInvalidPC;
+  } else if (advance_current_end_ == pc_) {
     // Combine advance current and goto.
     pc_ = advance_current_start_;
     Emit(BC_ADVANCE_CP_AND_GOTO, advance_current_offset_);
@@ -213,8 +236,11 @@ void BytecodeRegExpMacroAssembler::LoadCurrentCharacter(intptr_t cp_offset,
       bytecode = BC_LOAD_CURRENT_CHAR_UNCHECKED;
     }
   }
+  load_current_char_start_ = pc_;
   Emit(bytecode, cp_offset);
   if (check_bounds) EmitOrLink(on_failure);
+  load_current_char_end_ =
+      (bytecode == BC_LOAD_CURRENT_CHAR && cp_offset >= 0) ? pc_ : kInvalidPC;
 }
 
 void BytecodeRegExpMacroAssembler::CheckCharacterLT(uint16_t limit,
@@ -231,6 +257,7 @@ void BytecodeRegExpMacroAssembler::CheckCharacterGT(uint16_t limit,
 
 void BytecodeRegExpMacroAssembler::CheckCharacter(uint32_t c,
                                                   BlockLabel* on_equal) {
+  const bool follows_load = load_current_char_end_ == pc_;
   if (c > MAX_FIRST_ARG) {
     Emit(BC_CHECK_4_CHARS, 0);
     Emit32(c);
@@ -238,6 +265,8 @@ void BytecodeRegExpMacroAssembler::CheckCharacter(uint32_t c,
     Emit(BC_CHECK_CHAR, c);
   }
   EmitOrLink(on_equal);
+  check_char_end_ =
+      (follows_load && c <= Utf16::kMaxCodeUnit) ? pc_ : kInvalidPC;
 }
 
 void BytecodeRegExpMacroAssembler::CheckAtStart(BlockLabel* on_at_start) {
@@ -559,4 +588,28 @@ ObjectPtr BytecodeRegExpMacroAssembler::Interpret(const RegExp& regexp,
   return Instance::null();
 }
 
+bool BytecodeRegExpMacroAssembler::HasMatch(const RegExp& regexp,
+                                            const String& subject,
+                                            const Smi& start_index,
+                                            bool sticky,
+                                            Zone* zone) {
+  intptr_t required_registers = Prepare(regexp, subject, sticky, zone);
+  if (required_registers < 0) {
+    // Compiling failed with an exception.
+    UNREACHABLE();
+  }
+
+  int32_t* output_registers = zone->Alloc<int32_t>(required_registers);
+
+  const Object& result =
+      Object::Handle(zone, ExecRaw(regexp, subject, start_index.Value(), sticky,
+                                   output_registers, required_registers, zone));
+  if (result.IsError()) {
+    Exceptions::PropagateError(Error::Cast(result));
+    UNREACHABLE();
+  }
+  ASSERT(result.IsBool());
+  return result.ptr() == Bool::True().ptr();
+}
+
 }  // namespace dart
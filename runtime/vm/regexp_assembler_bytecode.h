@@ -113,6 +113,14 @@ class BytecodeRegExpMacroAssembler : public RegExpMacroAssembler {
                              bool is_sticky,
                              Zone* zone);
 
+  // Like Interpret, but only returns whether there is a match, without
+  // allocating an array for the captures.
+  static bool HasMatch(const RegExp& regexp,
+                       const String& str,
+                       const Smi& start_index,
+                       bool is_sticky,
+                       Zone* zone);
+
  private:
   void Expand();
   // Code and bitmap emission.
@@ -136,6 +144,12 @@ class BytecodeRegExpMacroAssembler : public RegExpMacroAssembler {
   intptr_t advance_current_offset_;
   intptr_t advance_current_end_;
 
+  // Tracks a LOAD_CURRENT_CHAR immediately followed by a CHECK_CHAR, which
+  // GoTo turns into SKIP_UNTIL_CHAR when it closes a search loop.
+  intptr_t load_current_char_start_;
+  intptr_t load_current_char_end_;
+  intptr_t check_char_end_;
+
   static constexpr int kInvalidPC = -1;
 
   DISALLOW_IMPLICIT_CONSTRUCTORS(BytecodeRegExpMacroAssembler);
@@ -176,6 +176,36 @@ class BacktrackStack {
   DISALLOW_COPY_AND_ASSIGN(BacktrackStack);
 };
 
+template <>
+const uint8_t* IrregexpInterpreter::SubjectData<uint8_t>(
+    const String& subject) {
+  return OneByteString::DataStart(subject);
+}
+
+template <>
+const uint16_t* IrregexpInterpreter::SubjectData<uint16_t>(
+    const String& subject) {
+  return TwoByteString::DataStart(subject);
+}
+
+// Returns the first occurrence of |c| in [start, end), or |end|.
+static const uint8_t* FindCharacter(const uint8_t* start,
+                                    const uint8_t* end,
+                                    uint32_t c) {
+  if (c > 0xFF) return end;
+  const void* result = memchr(start, c, end - start);
+  return result == nullptr ? end : static_cast<const uint8_t*>(result);
+}
+
+static const uint16_t* FindCharacter(const uint16_t* start,
+                                     const uint16_t* end,
+                                     uint32_t c) {
+  while (start < end && *start != c) {
+    start++;
+  }
+  return start;
+}
+
 // Returns True if success, False if failure, Null if internal exception,
 // Error if VM error needs to be propagated up the callchain.
 template <typename Char>
@@ -679,6 +709,26 @@ static ObjectPtr RawMatch(const TypedData& bytecode,
           pc += BC_SET_CURRENT_POSITION_FROM_END_LENGTH;
           break;
         }
+        BYTECODE(SKIP_UNTIL_CHAR) {
+          // Fused LOAD_CURRENT_CHAR, CHECK_CHAR and ADVANCE_CP_AND_GOTO by 1
+          // back to the load, see BytecodeRegExpMacroAssembler::GoTo.
+          const int32_t cp_offset = insn >> BYTECODE_SHIFT;
+          const uint32_t c = Load32Aligned(pc + 8) >> BYTECODE_SHIFT;
+          intptr_t pos = current + cp_offset;
+          if (pos >= 0 && pos < subject_length) {
+            const Char* data =
+                IrregexpInterpreter::SubjectData<Char>(subject);
+            pos = FindCharacter(data + pos, data + subject_length, c) - data;
+            current = pos - cp_offset;
+          }
+          if (pos >= 0 && pos < subject_length) {
+            current_char = c;
+            pc = code_base + Load32Aligned(pc + 12);
+          } else {
+            pc = code_base + Load32Aligned(pc + 4);
+          }
+          break;
+        }
         default:
           UNREACHABLE();
           break;
@@ -22,6 +22,11 @@ class IrregexpInterpreter : public AllStatic {
                          const String& subject,
                          int32_t* captures,
                          int32_t start_position);
+
+  // Returns the characters of a one-byte (uint8_t) or two-byte (uint16_t)
+  // subject string. Only valid while no safepoint can be reached.
+  template <typename Char>
+  static const Char* SubjectData(const String& subject);
 };
 
 }  // namespace dart
@@ -7,6 +7,7 @@
 #include "vm/isolate.h"
 #include "vm/object.h"
 #include "vm/regexp.h"
+#include "vm/regexp_assembler_bytecode.h"
 #include "vm/regexp_assembler_ir.h"
 #include "vm/unit_test.h"
 
@@ -66,4 +67,67 @@ ISOLATE_UNIT_TEST_CASE(RegExp_TwoByteString) {
   EXPECT_EQ(3, smi_2.Value());
 }
 
+// Expects the interpreted match of |pattern| in |subject| from |start| to be
+// [match_start, match_end), or no match if match_start is -1.
+static void ExpectInterpretedMatch(Thread* thread,
+                                   const char* pattern,
+                                   const String& subject,
+                                   intptr_t start,
+                                   intptr_t match_start,
+                                   intptr_t match_end) {
+  const String& pat = String::Handle(
+      Symbols::New(thread, String::Handle(String::New(pattern))));
+  const RegExp& regexp =
+      RegExp::Handle(RegExpEngine::CreateRegExp(thread, pat, RegExpFlags()));
+  const Object& result = Object::Handle(BytecodeRegExpMacroAssembler::Interpret(
+      regexp, subject, Smi::Handle(Smi::New(start)), /*sticky=*/false,
+      thread->zone()));
+  if (match_start == -1) {
+    EXPECT(result.IsNull());
+    return;
+  }
+  EXPECT(result.IsTypedData());
+  if (!result.IsTypedData()) return;
+  const TypedData& captures = TypedData::Cast(result);
+  EXPECT_EQ(match_start, captures.GetInt32(0));
+  EXPECT_EQ(match_end, captures.GetInt32(sizeof(int32_t)));
+}
+
+ISOLATE_UNIT_TEST_CASE(RegExp_Interpreter_SkipUntilChar) {
+  const String& one_byte = String::Handle(String::New("abcbaxyzzy"));
+  ExpectInterpretedMatch(thread, "bc", one_byte, 0, 1, 3);
+  ExpectInterpretedMatch(thread, "a", one_byte, 1, 4, 5);
+  ExpectInterpretedMatch(thread, "zy", one_byte, 0, 8, 10);
+  ExpectInterpretedMatch(thread, "y", one_byte, 9, 9, 10);
+  ExpectInterpretedMatch(thread, "w", one_byte, 0, -1, -1);
+  ExpectInterpretedMatch(thread, "\u1234", one_byte, 0, -1, -1);
+
+  const uint16_t chars[] = {'a', 0x1234, 'b', 'c', 0x1234, 'x'};
+  const String& two_byte = String::Handle(
+      TwoByteString::New(chars, ARRAY_SIZE(chars), Heap::kNew));
+  ExpectInterpretedMatch(thread, "bc", two_byte, 0, 2, 4);
+  ExpectInterpretedMatch(thread, "\u1234", two_byte, 2, 4, 5);
+  ExpectInterpretedMatch(thread, "x", two_byte, 0, 5, 6);
+  ExpectInterpretedMatch(thread, "y", two_byte, 0, -1, -1);
+}
+
+ISOLATE_UNIT_TEST_CASE(RegExp_Interpreter_HasMatch) {
+  const String& pat = String::Handle(
+      Symbols::New(thread, String::Handle(String::New("b(c)"))));
+  const RegExp& regexp =
+      RegExp::Handle(RegExpEngine::CreateRegExp(thread, pat, RegExpFlags()));
+  const String& subject = String::Handle(String::New("abcbc"));
+  auto has_match = [&](intptr_t start, bool sticky) {
+    return BytecodeRegExpMacroAssembler::HasMatch(
+        regexp, subject, Smi::Handle(Smi::New(start)), sticky, thread->zone());
+  };
+  EXPECT(has_match(0, /*sticky=*/false));
+  EXPECT(has_match(2, /*sticky=*/false));
+  EXPECT(!has_match(4, /*sticky=*/false));
+  EXPECT(!has_match(0, /*sticky=*/true));
+  EXPECT(has_match(1, /*sticky=*/true));
+  EXPECT(!has_match(2, /*sticky=*/true));
+  EXPECT(has_match(3, /*sticky=*/true));
+}
+
 }  // namespace dart
@@ -67,6 +67,12 @@ DEFINE_FLAG(bool,
             false,
             "Ensure results of allocation via runtime calls are not in an "
             "active TLAB.");
+DEFINE_FLAG(bool,
+            coalesce_ffi_listener_callbacks,
+            false,
+            "Coalesce NativeCallable.listener invocations made while an "
+            "earlier one is still queued into a single message. Microtasks "
+            "then run once per message instead of once per invocation.");
 DEFINE_FLAG(bool, trace_deoptimization, false, "Trace deoptimization");
 DEFINE_FLAG(bool,
             trace_deoptimization_verbose,
@@ -368,6 +374,15 @@ static Heap::Space SpaceForRuntimeAllocation() {
   return UNLIKELY(FLAG_runtime_allocate_old) ? Heap::kOld : Heap::kNew;
 }
 
+// Instances of pretenured classes reach the runtime because their allocation
+// stubs skip the inline new-space fast path.
+static Heap::Space SpaceForObjectAllocation(Thread* thread, const Class& cls) {
+  if (UNLIKELY(thread->heap()->pretenuring()->ShouldAllocateOld(cls.id()))) {
+    return Heap::kOld;
+  }
+  return SpaceForRuntimeAllocation();
+}
+
 static void RuntimeAllocationEpilogue(Thread* thread) {
   if (UNLIKELY(FLAG_runtime_allocate_spill_tlab)) {
     static RelaxedAtomic<uword> count = 0;
@@ -535,7 +550,8 @@ DEFINE_RUNTIME_ENTRY(AllocateObject, 2) {
   const Class& cls = Class::CheckedHandle(zone, arguments.ArgAt(0));
   ASSERT(cls.is_allocate_finalized());
   const Instance& instance = Instance::Handle(
-      zone, Instance::NewAlreadyFinalized(cls, SpaceForRuntimeAllocation()));
+      zone,
+      Instance::NewAlreadyFinalized(cls, SpaceForObjectAllocation(thread, cls)));
   if (cls.NumTypeArguments() == 0) {
     // No type arguments required for a non-parameterized type.
     ASSERT(Instance::CheckedHandle(zone, arguments.ArgAt(1)).IsNull());
@@ -1045,6 +1061,29 @@ static void UpdateTypeTestCache(
         static_cast<uword>(result.ptr()));
     THR_Print("%s", buffer.buffer());
   }
+  // Lookups do not need the lock, like the probing in the stubs: occupied
+  // entries of a backing array never change and grown arrays are published
+  // with a store-release, so at worst a concurrently added entry is missed.
+  // Checking first avoids contending on the mutex when other isolates in the
+  // group already added the entry after missing it in the stub.
+  {
+    auto& old_result = Bool::Handle(zone);
+    if (new_cache.HasCheck(
+            instance_class_id_or_signature, destination_type,
+            instance_type_arguments, instantiator_type_arguments,
+            function_type_arguments, instance_parent_function_type_arguments,
+            instance_delayed_type_arguments, /*index=*/nullptr, &old_result)) {
+      if (old_result.ptr() != result.ptr()) {
+        FATAL("Existing subtype test cache entry has result %s, not %s",
+              old_result.ToCString(), result.ToCString());
+      }
+      if (FLAG_trace_type_checks) {
+        THR_Print("  Found existing entry in test cache %#" Px "\n",
+                  static_cast<uword>(new_cache.ptr()));
+      }
+      return;
+    }
+  }
   {
     SafepointMutexLocker ml(
         thread->isolate_group()->subtype_test_cache_mutex());
@@ -1184,6 +1223,19 @@ DEFINE_RUNTIME_ENTRY(TypeCheck, 7) {
   TESTING_runtime_entered_on_TTS_invocation = true;
 #endif
 
+  auto* const counters = isolate->group()->type_check_counters();
+  switch (mode) {
+    case kTypeCheckFromLazySpecializeStub:
+      counters->from_lazy_specialize_stub++;
+      break;
+    case kTypeCheckFromSlowStub:
+      counters->from_slow_stub++;
+      break;
+    case kTypeCheckFromInline:
+      counters->from_inline++;
+      break;
+  }
+
 #if defined(TARGET_ARCH_IA32)
   ASSERT(mode == kTypeCheckFromInline);
   // Hash-based caches are still not handled by the stubs on IA32.
@@ -1321,6 +1373,10 @@ DEFINE_RUNTIME_ENTRY(TypeCheck, 7) {
     const Code& code = Code::Handle(
         zone, TypeTestingStubGenerator::SpecializeStubFor(thread, tts_type));
     tts_type.SetTypeTestingStub(code);
+    if (code.ptr() != StubCode::DefaultNullableTypeTest().ptr() &&
+        code.ptr() != StubCode::DefaultTypeTest().ptr()) {
+      counters->stubs_specialized++;
+    }
 
     // Only create the cache if we failed to create a specialized TTS and doing
     // the same check would cause an update to the cache.
@@ -1369,6 +1425,7 @@ DEFINE_RUNTIME_ENTRY(TypeCheck, 7) {
     }
     if (!should_update_cache) {
       tts_type.SetTypeTestingStub(new_code);
+      counters->stubs_respecialized++;
     }
   }
 #endif  // !defined(DART_PRECOMPILED_RUNTIME)
@@ -1423,6 +1480,7 @@ DEFINE_RUNTIME_ENTRY(TypeCheck, 7) {
     UpdateTypeTestCache(zone, thread, src_instance, dst_type,
                         instantiator_type_arguments, function_type_arguments,
                         Bool::True(), cache);
+    counters->cache_updates++;
   }
 
   arguments.SetReturn(src_instance);
@@ -3117,6 +3175,23 @@ static void HandleOSRRequest(Thread* thread) {
                  function.usage_counter());
   }
 
+  // Reuse OSR code compiled for this loop by an earlier invocation, unless
+  // it was invalidated since. The program lock keeps it from being disabled
+  // before the frame is switched over.
+  {
+    SafepointReadRwLocker ml(thread, isolate_group->program_lock());
+    const Code& osr_code = Code::Handle(function.FindOsrCode(osr_id));
+    if (!osr_code.IsNull()) {
+      if (FLAG_trace_osr) {
+        OS::PrintErr("Reusing OSR code for %s at id=%" Pd "\n",
+                     function.ToFullyQualifiedCString(), osr_id);
+      }
+      frame->set_pc(osr_code.EntryPoint());
+      frame->set_pc_marker(osr_code.ptr());
+      return;
+    }
+  }
+
   // Since the code is referenced from the frame and the ZoneHandle,
   // it cannot have been removed from the function.
   const Object& result = Object::Handle(
@@ -3860,6 +3935,18 @@ DEFINE_RUNTIME_ENTRY(FfiAsyncCallbackSend, 1) {
   Dart_Port target_port = Thread::Current()->unboxed_int64_runtime_arg();
   TRACE_RUNTIME_CALL("FfiAsyncCallbackSend %p", (void*)target_port);
   const Object& message = Object::Handle(zone, arguments.ArgAt(0));
+  if (FLAG_coalesce_ffi_listener_callbacks) {
+    PersistentHandle* handle =
+        isolate->group()->api_state()->AllocatePersistentHandle();
+    handle->set_ptr(message);
+    // A null message tells the listener to take the queued invocations.
+    if (FfiCallbackMetadata::Instance()->AddPendingAsyncCallback(target_port,
+                                                                 handle)) {
+      PortMap::PostMessage(Message::New(target_port, Object::null(),
+                                        Message::kNormalPriority));
+    }
+    return;
+  }
   const Array& msg_array = Array::Handle(zone, Array::New(3));
   msg_array.SetAt(0, message);
   PersistentHandle* handle =
@@ -53,6 +53,10 @@
 #include "vm/timeline.h"
 #include "vm/version.h"
 
+#if !defined(DART_PRECOMPILED_RUNTIME)
+#include "vm/compiler/compiler_timings.h"
+#endif
+
 #if defined(SUPPORT_PERFETTO)
 #include "vm/perfetto_utils.h"
 #endif  // defined(SUPPORT_PERFETTO)
@@ -61,6 +65,7 @@ namespace dart {
 
 #define Z (T->zone())
 
+DECLARE_FLAG(bool, collect_jit_function_statistics);
 DECLARE_FLAG(bool, trace_service);
 DECLARE_FLAG(bool, trace_service_pause_events);
 DECLARE_FLAG(bool, profile_vm);
@@ -3824,6 +3829,7 @@ static void GetSourceReport(Thread* thread, JSONStream* js) {
 
   SourceReport report(report_set, library_filters, libraries_already_compiled,
                       compile_mode, report_lines);
+  js->EnableChunkedReply();
   report.PrintJSON(js, script, TokenPosition::Deserialize(start_pos),
                    TokenPosition::Deserialize(end_pos));
 #endif  // !DART_PRECOMPILED_RUNTIME
@@ -4172,6 +4178,7 @@ static void GetCpuSamplesCommon(TimelineOrSamplesResponseFormat format,
   }
 
   if (format == TimelineOrSamplesResponseFormat::JSON) {
+    js->EnableChunkedReply();
     ProfilerService::PrintJSON(js, time_origin_micros, time_extent_micros,
                                include_code_samples);
   } else if (format == TimelineOrSamplesResponseFormat::Perfetto) {
@@ -4519,6 +4526,32 @@ static void ClearCpuSamples(Thread* thread, JSONStream* js) {
   PrintSuccess(js);
 }
 
+static const MethodParameter* const get_jit_function_statistics_params[] = {
+    RUNNABLE_ISOLATE_PARAMETER,
+    new BoolParameter("reset", false),
+    nullptr,
+};
+
+static void GetJitFunctionStatistics(Thread* thread, JSONStream* js) {
+#if defined(DART_PRECOMPILED_RUNTIME)
+  js->PrintError(kFeatureDisabled,
+                 "JIT function statistics are not available in AOT mode.");
+#else
+  if (!FLAG_collect_jit_function_statistics) {
+    js->PrintError(kFeatureDisabled,
+                   "JIT function statistics are disabled. Run with "
+                   "--collect-jit-function-statistics to enable them.");
+    return;
+  }
+  JitFunctionStatistics* statistics =
+      thread->isolate_group()->jit_function_statistics();
+  statistics->PrintJSON(js);
+  if (BoolParameter::Parse(js->LookupParam("reset"), false)) {
+    statistics->Clear();
+  }
+#endif  // defined(DART_PRECOMPILED_RUNTIME)
+}
+
 static void GetAllocationProfileImpl(Thread* thread,
                                      JSONStream* js,
                                      bool internal) {
@@ -4548,6 +4581,7 @@ static void GetAllocationProfileImpl(Thread* thread,
     isolate_group->UpdateLastAllocationProfileGCTimestamp();
     isolate_group->heap()->CollectAllGarbage(GCReason::kDebugging);
   }
+  js->EnableChunkedReply();
   isolate_group->class_table()->AllocationProfilePrintJSON(js, internal);
 }
 
@@ -5933,6 +5967,8 @@ static const ServiceMethodDescriptor service_methods_[] = {
     get_isolate_metric_list_params },
   { "getIsolatePauseEvent", GetIsolatePauseEvent,
     get_isolate_pause_event_params },
+  { "_getJitFunctionStatistics", GetJitFunctionStatistics,
+    get_jit_function_statistics_params },
   { "getObject", GetObject,
     get_object_params },
   { "_getObjectStore", GetObjectStore,
@@ -22,6 +22,8 @@
 
 namespace dart {
 
+DECLARE_FLAG(int, message_typed_data_out_of_line_size);
+
 // Check if serialized and deserialized objects are equal.
 static bool Equals(const Object& expected, const Object& actual) {
   if (expected.IsNull()) {
@@ -581,6 +583,45 @@ ISOLATE_UNIT_TEST_CASE(SerializeByteArray) {
   CheckEncodeDecodeMessage(scope.zone(), root);
 }
 
+ISOLATE_UNIT_TEST_CASE(SerializeOutOfLineByteArray) {
+  SetFlagScope<int> sfs(&FLAG_message_typed_data_out_of_line_size, 128);
+  const int kTypedDataLength = 256;
+  TypedData& typed_data = TypedData::Handle(
+      TypedData::New(kTypedDataUint8ArrayCid, kTypedDataLength));
+  for (int i = 0; i < kTypedDataLength; i++) {
+    typed_data.SetUint8(i, i);
+  }
+  std::unique_ptr<Message> message =
+      WriteMessage(/* same_group */ false, typed_data, ILLEGAL_PORT,
+                   Message::kNormalPriority);
+  // The data is not part of the snapshot.
+  EXPECT(message->snapshot_length() < kTypedDataLength);
+
+  // Read object back from the snapshot into a C structure.
+  {
+    ApiNativeScope scope;
+    Dart_CObject* root = ReadApiMessage(scope.zone(), message.get());
+    EXPECT_EQ(Dart_CObject_kTypedData, root->type);
+    EXPECT_EQ(kTypedDataLength, root->value.as_typed_data.length);
+    for (int i = 0; i < kTypedDataLength; i++) {
+      EXPECT(root->value.as_typed_data.values[i] == i);
+    }
+    CheckEncodeDecodeMessage(scope.zone(), root);
+  }
+
+  // Read object back from the snapshot, adopting the buffer.
+  Object& serialized = Object::Handle(ReadMessage(thread, message.get()));
+  EXPECT(serialized.IsExternalTypedData());
+  const ExternalTypedData& serialized_typed_data =
+      ExternalTypedData::Cast(serialized);
+  EXPECT_EQ(kExternalTypedDataUint8ArrayCid,
+            serialized_typed_data.GetClassId());
+  EXPECT_EQ(kTypedDataLength, serialized_typed_data.Length());
+  for (int i = 0; i < kTypedDataLength; i++) {
+    EXPECT_EQ(i, serialized_typed_data.GetUint8(i));
+  }
+}
+
 #define TEST_TYPED_ARRAY(darttype, ctype)                                      \
   {                                                                            \
     StackZone zone(thread);                                                    \
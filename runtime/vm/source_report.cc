@@ -97,6 +97,10 @@ bool SourceReport::IsReportRequested(ReportKind report_kind) {
   return (report_set_ & report_kind) != 0;
 }
 
+bool SourceReport::IsCoverageOnlyReport() const {
+  return (report_set_ & ~(kCoverage | kBranchCoverage)) == 0;
+}
+
 bool SourceReport::ShouldSkipFunction(const Function& func) {
   // TODO(32315): Verify that the check is still needed after the issue is
   // resolved.
@@ -332,9 +336,7 @@ intptr_t SourceReport::GetTokenPosOrLine(const Script& script,
 
 void SourceReport::PrintCoverageData(JSONObject* jsobj,
                                      const Function& function,
-                                     const Code& code,
                                      bool report_branch_coverage) {
-  ASSERT(!code.IsNull());
   const TokenPosition& begin_pos = function.token_pos();
   const TokenPosition& end_pos = function.end_token_pos();
 
@@ -527,6 +529,24 @@ void SourceReport::VisitFunction(JSONArray* jsarr,
   }
 
   Code& code = Code::Handle(zone(), func.unoptimized_code());
+  if (code.IsNull() && IsCoverageOnlyReport() &&
+      (func.GetCoverageArray() != Array::null())) {
+    // The coverage array outlives the unoptimized code it was created for
+    // (e.g. when the code was dropped after optimization), so coverage can
+    // be reported from it directly instead of recompiling the function.
+    JSONObject range(jsarr);
+    range.AddProperty("scriptIndex", script_index);
+    range.AddProperty("startPos", begin_pos);
+    range.AddProperty("endPos", end_pos);
+    range.AddProperty("compiled", true);
+    if (IsReportRequested(kCoverage)) {
+      PrintCoverageData(&range, func, /* report_branch_coverage */ false);
+    }
+    if (IsReportRequested(kBranchCoverage)) {
+      PrintCoverageData(&range, func, /* report_branch_coverage */ true);
+    }
+    return;
+  }
   if (code.IsNull()) {
     if (func.HasCode() || (compile_mode == kForceCompile)) {
       const Error& err =
@@ -564,10 +584,10 @@ void SourceReport::VisitFunction(JSONArray* jsarr,
     PrintCallSitesData(&range, func, code);
   }
   if (IsReportRequested(kCoverage)) {
-    PrintCoverageData(&range, func, code, /* report_branch_coverage */ false);
+    PrintCoverageData(&range, func, /* report_branch_coverage */ false);
   }
   if (IsReportRequested(kBranchCoverage)) {
-    PrintCoverageData(&range, func, code, /* report_branch_coverage */ true);
+    PrintCoverageData(&range, func, /* report_branch_coverage */ true);
   }
   if (IsReportRequested(kPossibleBreakpoints)) {
     PrintPossibleBreakpointsData(&range, func, code);
@@ -74,6 +74,7 @@ class SourceReport {
   Isolate* isolate() const { return thread_->isolate(); }
 
   bool IsReportRequested(ReportKind report_kind);
+  bool IsCoverageOnlyReport() const;
   bool ShouldSkipFunction(const Function& func);
   bool ShouldSkipField(const Field& field);
   intptr_t GetScriptIndex(const Script& script);
@@ -89,7 +90,6 @@ class SourceReport {
                           const Code& code);
   void PrintCoverageData(JSONObject* jsobj,
                          const Function& func,
-                         const Code& code,
                          bool report_branch_coverage);
   void PrintPossibleBreakpointsData(JSONObject* jsobj,
                                     const Function& func,
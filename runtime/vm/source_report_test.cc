@@ -172,6 +172,69 @@ ISOLATE_UNIT_TEST_CASE(SourceReport_Coverage_SimpleCall) {
       buffer);
 }
 
+ISOLATE_UNIT_TEST_CASE(SourceReport_Coverage_WithoutUnoptimizedCode) {
+  // WARNING: This MUST be big enough for the serialized JSON string.
+  const int kBufferSize = 1024;
+  char buffer[kBufferSize];
+  const char* kScript =
+      "helper0() {}\n"
+      "helper1() {}\n"
+      "main() {\n"
+      "  if (true) {\n"
+      "    helper0();\n"
+      "  } else {\n"
+      "    helper1();\n"
+      "  }\n"
+      "}";
+
+  Library& lib = Library::Handle();
+  lib ^= ExecuteScript(kScript);
+  ASSERT(!lib.IsNull());
+  const Script& script =
+      Script::Handle(lib.LookupScript(String::Handle(String::New("test-lib"))));
+
+  // Drop the code of main. Its coverage array stays attached to the function
+  // and a coverage-only report is produced from it without recompiling.
+  const Function& main = Function::Handle(
+      lib.LookupFunctionAllowPrivate(String::Handle(String::New("main"))));
+  ASSERT(!main.IsNull());
+  {
+    SafepointWriteRwLocker ml(thread, thread->isolate_group()->program_lock());
+    main.ClearCode();
+  }
+  EXPECT(main.unoptimized_code() == Code::null());
+  EXPECT(main.GetCoverageArray() != Array::null());
+
+  SourceReport report(SourceReport::kCoverage);
+  JSONStream js;
+  report.PrintJSON(&js, script);
+  const char* json_str = js.ToCString();
+  ASSERT(strlen(json_str) < kBufferSize);
+  ElideJSONSubstring("classes", json_str, buffer);
+  ElideJSONSubstring("libraries", buffer, buffer);
+  EXPECT_STREQ(
+      "{\"type\":\"SourceReport\",\"ranges\":["
+
+      // One range compiled with one hit at function declaration (helper0).
+      "{\"scriptIndex\":0,\"startPos\":0,\"endPos\":11,\"compiled\":true,"
+      "\"coverage\":{\"hits\":[0],\"misses\":[]}},"
+
+      // One range not compiled (helper1).
+      "{\"scriptIndex\":0,\"startPos\":13,\"endPos\":24,\"compiled\":false},"
+
+      // One range with two hits and a miss (main).
+      "{\"scriptIndex\":0,\"startPos\":26,\"endPos\":94,\"compiled\":true,"
+      "\"coverage\":{\"hits\":[26,53],\"misses\":[79]}}],"
+
+      // Only one script in the script table.
+      "\"scripts\":[{\"type\":\"@Script\",\"fixedId\":true,\"id\":\"\","
+      "\"uri\":\"file:\\/\\/\\/test-lib\",\"_kind\":\"kernel\"}]}",
+      buffer);
+
+  // The code is not recompiled.
+  EXPECT(main.unoptimized_code() == Code::null());
+}
+
 ISOLATE_UNIT_TEST_CASE(SourceReport_Coverage_ForceCompile) {
   // WARNING: This MUST be big enough for the serialized JSON string.
   const int kBufferSize = 1024;
@@ -251,7 +251,17 @@ void StackFrame::VisitObjectPointers(ObjectPointerVisitor* visitor) {
     CompressedStackMaps::Iterator<CompressedStackMaps::RawPayloadHandle> it(
         maps, global_table);
     const uint32_t pc_offset = pc() - code_start;
-    if (it.Find(pc_offset)) {
+    bool found = false;
+    if (pc() == stack_map_cache_pc_) {
+      it.RestoreState(stack_map_cache_state_);
+      ASSERT(it.pc_offset() == pc_offset);
+      found = true;
+    } else if (it.Find(pc_offset)) {
+      stack_map_cache_pc_ = pc();
+      stack_map_cache_state_ = it.state();
+      found = true;
+    }
+    if (found) {
       ObjectPtr* first = reinterpret_cast<ObjectPtr*>(sp());
       ObjectPtr* last = reinterpret_cast<ObjectPtr*>(
           fp() + (runtime_frame_layout.first_local_from_fp * kWordSize));
@@ -155,6 +155,13 @@ class StackFrame : public ValueObject {
   uword pc_;
   Thread* thread_;
 
+  // The stack map entry found for the last frame visited by
+  // VisitObjectPointers through this object, keyed by its return address.
+  // Iterators reuse a single frame object for all frames of a frame set, so
+  // this saves repeating the stack map search when visiting deep recursions.
+  uword stack_map_cache_pc_ = 0;
+  CompressedStackMaps::IteratorState stack_map_cache_state_;
+
   // The iterators FrameSetIterator and StackFrameIterator set the private
   // fields fp_ and sp_ when they return the respective frame objects.
   friend class FrameSetIterator;
@@ -759,4 +759,39 @@ bool StackTraceUtils::GetSuspendState(const Closure& closure,
   return false;
 }
 
+#if defined(DART_PRECOMPILED_RUNTIME)
+StackFrameSymbolCache::~StackFrameSymbolCache() {
+  ClearLocked();
+}
+
+const char* StackFrameSymbolCache::Lookup(Zone* zone,
+                                          uword call_addr,
+                                          bool expand_inlined) {
+  MutexLocker ml(&mutex_);
+  const char* description =
+      descriptions_.LookupValue(KeyOf(call_addr, expand_inlined));
+  return description == nullptr ? nullptr : zone->MakeCopyOfString(description);
+}
+
+void StackFrameSymbolCache::Insert(uword call_addr,
+                                   bool expand_inlined,
+                                   const char* description) {
+  MutexLocker ml(&mutex_);
+  const uword key = KeyOf(call_addr, expand_inlined);
+  if (descriptions_.HasKey(key)) return;
+  if (descriptions_.Size() >= kMaxEntries) {
+    ClearLocked();
+  }
+  descriptions_.Insert({key, Utils::StrDup(description)});
+}
+
+void StackFrameSymbolCache::ClearLocked() {
+  auto it = descriptions_.GetIterator();
+  for (auto* kv = it.Next(); kv != nullptr; kv = it.Next()) {
+    free(kv->value);
+  }
+  descriptions_.Clear();
+}
+#endif  // defined(DART_PRECOMPILED_RUNTIME)
+
 }  // namespace dart
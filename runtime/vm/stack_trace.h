@@ -9,6 +9,7 @@
 
 #include "vm/allocation.h"
 #include "vm/flag_list.h"
+#include "vm/hash_map.h"
 #include "vm/object.h"
 #include "vm/symbols.h"
 
@@ -66,6 +67,63 @@ class StackTraceUtils : public AllStatic {
   static bool GetSuspendState(const Closure& closure, Object* suspend_state);
 };
 
+#if defined(DART_PRECOMPILED_RUNTIME)
+// Caches the symbolic description of stack frames by call address.
+//
+// In AOT all instructions are part of snapshot images which do not move, so a
+// call address always symbolizes to the same (inlined) functions and
+// positions. Printing many similar stack traces, e.g. when logging exceptions,
+// can then skip decoding the CodeSourceMap and formatting the names of the
+// functions again.
+class StackFrameSymbolCache {
+ public:
+  StackFrameSymbolCache() {}
+  ~StackFrameSymbolCache();
+
+  // Returns a zone allocated copy of the description of the frames at
+  // |call_addr| or nullptr if it is not cached. The description has one line
+  // per printed frame, without the frame index.
+  const char* Lookup(Zone* zone, uword call_addr, bool expand_inlined);
+
+  // Caches the description of the frames at |call_addr|.
+  void Insert(uword call_addr, bool expand_inlined, const char* description);
+
+ private:
+  // Once this many descriptions are cached the cache starts from scratch.
+  static constexpr intptr_t kMaxEntries = 16 * KB;
+
+  struct Trait {
+    typedef uword Key;
+    typedef char* Value;
+
+    struct Pair {
+      Key key;
+      Value value;
+      Pair() : key(0), value(nullptr) {}
+      Pair(const Key key, const Value& value) : key(key), value(value) {}
+      Pair(const Pair& other) : key(other.key), value(other.value) {}
+      Pair& operator=(const Pair&) = default;
+    };
+
+    static Key KeyOf(Pair kv) { return kv.key; }
+    static Value ValueOf(Pair kv) { return kv.value; }
+    static uword Hash(Key key) { return Utils::WordHash(key); }
+    static bool IsKeyEqual(Pair kv, Key key) { return kv.key == key; }
+  };
+
+  static uword KeyOf(uword call_addr, bool expand_inlined) {
+    return (call_addr << 1) | (expand_inlined ? 1 : 0);
+  }
+
+  void ClearLocked();
+
+  Mutex mutex_;
+  MallocDirectChainedHashMap<Trait> descriptions_;
+
+  DISALLOW_COPY_AND_ASSIGN(StackFrameSymbolCache);
+};
+#endif  // defined(DART_PRECOMPILED_RUNTIME)
+
 }  // namespace dart
 
 #endif  // RUNTIME_VM_STACK_TRACE_H_
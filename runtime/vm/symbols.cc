@@ -199,6 +199,15 @@ StringPtr Symbols::FromUTF8(Thread* thread,
   if (array_len == 0 || utf8_array == nullptr) {
     return FromLatin1(thread, static_cast<uint8_t*>(nullptr), 0);
   }
+  // Most symbols are plain ASCII, which is already its own Latin-1 encoding
+  // and needs neither counting nor decoding.
+  intptr_t ascii_len = 0;
+  while ((ascii_len < array_len) && (utf8_array[ascii_len] < 0x80)) {
+    ascii_len++;
+  }
+  if (ascii_len == array_len) {
+    return FromLatin1(thread, utf8_array, array_len);
+  }
   Utf8::Type type;
   intptr_t len = Utf8::CodeUnitCount(utf8_array, array_len, &type);
   ASSERT(len != 0);
@@ -359,10 +368,16 @@ StringPtr Symbols::NewSymbol(Thread* thread, const StringType& str) {
     }
     // Otherwise we'll have to get exclusive access and get-or-insert it.
     if (symbol.IsNull()) {
+      // Allocate and fill in the candidate symbol before taking the lock so
+      // that concurrent insertions only contend on the table update itself.
+      // If another thread inserts an equal symbol first, the candidate is
+      // dropped.
+      const String& candidate =
+          String::Handle(thread->zone(), str.ToSymbol());
       SafepointMutexLocker ml(group->symbols_mutex());
       data = object_store->symbol_table();
       CanonicalStringSet table(&key, &value, &data);
-      symbol ^= table.InsertNewOrGet(str);
+      symbol ^= table.InsertOrGet(candidate);
       object_store->set_symbol_table(table.Release());
     }
   }
@@ -43,11 +43,14 @@ Thread::~Thread() {
   ASSERT(deferred_marking_stack_block_ == nullptr);
   // There should be no top api scopes at this point.
   ASSERT(api_top_scope() == nullptr);
-  // Delete the reusable api scope if there is one.
-  if (api_reusable_scope_ != nullptr) {
-    delete api_reusable_scope_;
-    api_reusable_scope_ = nullptr;
+  // Delete the reusable api scopes.
+  while (api_reusable_scope_ != nullptr) {
+    ApiLocalScope* scope = api_reusable_scope_;
+    api_reusable_scope_ = scope->previous();
+    delete scope;
   }
+  api_reusable_scope_count_ = 0;
+  Zone::ClearThreadCache(this);
 
   DO_IF_TSAN(delete tsan_utils_);
 }
@@ -407,6 +410,7 @@ void Thread::EnterIsolate(Isolate* isolate) {
 
   isolate->scheduled_mutator_thread_ = thread;
   ResumeDartMutatorThreadInternal(thread);
+  isolate->cpu_time_entry_micros_ = OS::GetCurrentThreadCPUMicros();
 }
 
 static bool ShouldSuspend(bool isolate_shutdown, Thread* thread) {
@@ -438,6 +442,9 @@ void Thread::ExitIsolate(bool isolate_shutdown) {
   auto isolate = thread->isolate();
   auto group = thread->isolate_group();
 
+  isolate->cpu_time_micros_ +=
+      OS::GetCurrentThreadCPUMicros() - isolate->cpu_time_entry_micros_;
+
   thread->set_vm_tag(isolate->is_runnable() ? VMTag::kIdleTagId
                                             : VMTag::kLoadWaitTagId);
   if (thread->sticky_error() != Error::null()) {
@@ -575,6 +582,7 @@ void Thread::ResumeThreadInternal(Thread* thread) {
 
 void Thread::SuspendThreadInternal(Thread* thread, VMTag::VMTagId tag) {
   thread->heap()->new_space()->AbandonRemainingTLAB(thread);
+  thread->heap()->old_space()->ReleaseCache(thread);
 
 #if !defined(PRODUCT) || defined(FORCE_INCLUDE_SAMPLING_HEAP_PROFILER)
   thread->heap_sampler().Cleanup();
@@ -740,7 +748,8 @@ ErrorPtr Thread::HandleInterrupts() {
   uword interrupt_bits = GetAndClearInterrupts();
   if ((interrupt_bits & kVMInterrupt) != 0) {
     CheckForSafepoint();
-    if (isolate_group()->store_buffer()->Overflowed()) {
+    if (isolate_group()->store_buffer()->Overflowed() &&
+        !heap()->PruneStoreBuffer(this)) {
       // Evacuate: If the popular store buffer targets are copied instead of
       // promoted, the store buffer won't shrink and a second scavenge will
       // occur that does promote them.
@@ -748,6 +757,12 @@ ErrorPtr Thread::HandleInterrupts() {
     }
     heap()->CheckFinalizeMarking(this);
 
+#if !defined(DART_PRECOMPILED_RUNTIME)
+    if (heap()->pretenuring()->HasPendingChanges()) {
+      heap()->pretenuring()->ApplyPendingChanges(this);
+    }
+#endif  // !defined(DART_PRECOMPILED_RUNTIME)
+
 #if !defined(PRODUCT)
     if (isolate()->TakeHasCompletedBlocks()) {
       Profiler::ProcessCompletedBlocks(isolate());
@@ -1298,33 +1313,42 @@ int Thread::ZoneSizeInBytes() const {
   return total;
 }
 
+// The number of exited api scopes a thread keeps for reuse. Natives which call
+// back into Dart, which in turn calls natives, need one scope per level.
+static constexpr intptr_t kMaxReusableApiScopes = 4;
+
 void Thread::EnterApiScope() {
   ASSERT(MayAllocateHandles());
-  ApiLocalScope* new_scope = api_reusable_scope();
+  ApiLocalScope* new_scope = api_reusable_scope_;
   if (new_scope == nullptr) {
     new_scope = new ApiLocalScope(api_top_scope(), top_exit_frame_info());
     ASSERT(new_scope != nullptr);
   } else {
+    api_reusable_scope_ = new_scope->previous();
+    api_reusable_scope_count_--;
     new_scope->Reinit(this, api_top_scope(), top_exit_frame_info());
-    set_api_reusable_scope(nullptr);
   }
   set_api_top_scope(new_scope);  // New scope is now the top scope.
 }
 
-void Thread::ExitApiScope() {
-  ASSERT(MayAllocateHandles());
-  ApiLocalScope* scope = api_top_scope();
-  ApiLocalScope* reusable_scope = api_reusable_scope();
-  set_api_top_scope(scope->previous());  // Reset top scope to previous.
-  if (reusable_scope == nullptr) {
+void Thread::ReleaseApiScope(ApiLocalScope* scope) {
+  if (api_reusable_scope_count_ < kMaxReusableApiScopes) {
     scope->Reset(this);  // Reset the old scope which we just exited.
-    set_api_reusable_scope(scope);
+    scope->set_previous(api_reusable_scope_);
+    api_reusable_scope_ = scope;
+    api_reusable_scope_count_++;
   } else {
-    ASSERT(reusable_scope != scope);
     delete scope;
   }
 }
 
+void Thread::ExitApiScope() {
+  ASSERT(MayAllocateHandles());
+  ApiLocalScope* scope = api_top_scope();
+  set_api_top_scope(scope->previous());  // Reset top scope to previous.
+  ReleaseApiScope(scope);
+}
+
 void Thread::UnwindScopes(uword stack_marker) {
   // Unwind all scopes using the same stack_marker, i.e. all scopes allocated
   // under the same top_exit_frame_info.
@@ -1332,7 +1356,7 @@ void Thread::UnwindScopes(uword stack_marker) {
   while (scope != nullptr && scope->stack_marker() != 0 &&
          scope->stack_marker() == stack_marker) {
     api_top_scope_ = scope->previous();
-    delete scope;
+    ReleaseApiScope(scope);
     scope = api_top_scope_;
   }
 }
@@ -20,6 +20,7 @@
 #include "vm/constants.h"
 #include "vm/globals.h"
 #include "vm/handles.h"
+#include "vm/heap/freelist_cache.h"
 #include "vm/heap/pointer_block.h"
 #include "vm/heap/sampler.h"
 #include "vm/os_thread.h"
@@ -67,6 +68,7 @@ class TimelineStream;
 class TypeArguments;
 class TypeParameter;
 class TypeUsageInfo;
+class VirtualMemory;
 class Zone;
 
 namespace compiler {
@@ -352,6 +354,7 @@ class Thread : public ThreadState {
     kScavengerTask,
     kSampleBlockTask,
     kIncrementalCompactorTask,
+    kDeserializerTask,
   };
   // Converts a TaskKind to its corresponding C-String name.
   static const char* TaskKindToCString(TaskKind kind);
@@ -501,11 +504,16 @@ class Thread : public ThreadState {
   // Monitor corresponding to this thread.
   Monitor* thread_lock() const { return &thread_lock_; }
 
-  // The reusable api local scope for this thread.
+  // The api local scopes kept for reuse by this thread, linked through their
+  // previous scope. Nested native calls each take one from this list.
   ApiLocalScope* api_reusable_scope() const { return api_reusable_scope_; }
-  void set_api_reusable_scope(ApiLocalScope* value) {
-    ASSERT(value == nullptr || api_reusable_scope_ == nullptr);
-    api_reusable_scope_ = value;
+
+  // A zone segment of the default size kept for reuse by the zones of this
+  // thread, so that short-lived zones can skip the global segment cache and
+  // its lock.
+  VirtualMemory* zone_segment_cache() const { return zone_segment_cache_; }
+  void set_zone_segment_cache(VirtualMemory* value) {
+    zone_segment_cache_ = value;
   }
 
   // The api local scope for this thread, this where all local handles
@@ -1141,6 +1149,8 @@ class Thread : public ThreadState {
   HeapProfileSampler& heap_sampler() { return heap_sampler_; }
 #endif
 
+  FreeListCache* old_space_cache() { return &old_space_cache_; }
+
   PendingDeopts& pending_deopts() { return pending_deopts_; }
 
   SafepointLevel current_safepoint_level() const {
@@ -1303,6 +1313,8 @@ class Thread : public ThreadState {
   StreamInfo* const service_extension_stream_;
   mutable Monitor thread_lock_;
   ApiLocalScope* api_reusable_scope_;
+  intptr_t api_reusable_scope_count_ = 0;
+  VirtualMemory* zone_segment_cache_ = nullptr;
   int32_t no_callback_scope_depth_;
   int32_t force_growth_scope_depth_ = 0;
   intptr_t no_reload_scope_depth_ = 0;
@@ -1407,6 +1419,9 @@ class Thread : public ThreadState {
   HeapProfileSampler heap_sampler_;
 #endif
 
+  // Small old-space free-list elements owned by this thread.
+  FreeListCache old_space_cache_;
+
   explicit Thread(bool is_vm_isolate);
 
   void StoreBufferRelease(
@@ -1424,6 +1439,9 @@ class Thread : public ThreadState {
   void ReleaseMarkingStacks();
   void FlushMarkingStacks();
 
+  // Keeps an exited api scope for reuse or deletes it.
+  void ReleaseApiScope(ApiLocalScope* scope);
+
   void set_safepoint_state(uint32_t value) { safepoint_state_ = value; }
   void EnterSafepointUsingLock();
   void ExitSafepointUsingLock();
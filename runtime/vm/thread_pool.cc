@@ -34,8 +34,16 @@ static int64_t ComputeTimeout(int64_t idle_start) {
   }
 }
 
+// The number of consecutive tasks a worker takes from its own deque before it
+// looks at the shared list again, so tasks scheduled from outside the pool are
+// not starved by workers which keep scheduling tasks for themselves.
+static constexpr intptr_t kMaxConsecutiveLocalTasks = 16;
+
 ThreadPool::ThreadPool(uintptr_t max_pool_size)
-    : all_workers_dead_(false), max_pool_size_(max_pool_size) {}
+    : all_workers_dead_(false), max_pool_size_(max_pool_size) {
+  MonitorLocker ml(&pool_monitor_);
+  UpdateAvailableLocked();
+}
 
 ThreadPool::~ThreadPool() {
   Shutdown();
@@ -82,6 +90,16 @@ void ThreadPool::Shutdown() {
 }
 
 bool ThreadPool::RunImpl(std::unique_ptr<Task> task) {
+  OSThread* os_thread = OSThread::TryCurrent();
+  if (os_thread != nullptr) {
+    auto worker = static_cast<Worker*>(os_thread->owning_thread_pool_worker_);
+    // A blocked worker might not get to its own tasks for a long time.
+    if (worker != nullptr && worker->pool_ == this && !worker->is_blocked_ &&
+        task->priority() == Task::kNormalPriority) {
+      return RunLocal(worker, std::move(task));
+    }
+  }
+
   Worker* new_worker = nullptr;
   {
     MonitorLocker ml(&pool_monitor_);
@@ -96,6 +114,60 @@ bool ThreadPool::RunImpl(std::unique_ptr<Task> task) {
   return true;
 }
 
+bool ThreadPool::RunLocal(Worker* worker, std::unique_ptr<Task> task) {
+  if (shutting_down_) {
+    return false;
+  }
+  if (!worker->local_tasks_.Push(task.get())) {
+    // The deque is full, use the shared list.
+    Worker* new_worker = nullptr;
+    {
+      MonitorLocker ml(&pool_monitor_);
+      if (shutting_down_) {
+        return false;
+      }
+      new_worker = ScheduleTaskLocked(&ml, std::move(task));
+    }
+    if (new_worker != nullptr) {
+      new_worker->StartThread();
+    }
+    return true;
+  }
+  task.release();
+
+  // Pairs with the fence in [WorkerLoop] after a worker announced that it is
+  // going to wait: either it sees the task or we see it waiting.
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if (num_waiting_.load(std::memory_order_relaxed) == 0 &&
+      available_.load(std::memory_order_relaxed) == 0) {
+    // All workers are running and no more can be started. One of them will
+    // take the task once it is done, at the latest this one.
+    return true;
+  }
+
+  Worker* new_worker = nullptr;
+  {
+    MonitorLocker ml(&pool_monitor_);
+    if (num_waiting_.load(std::memory_order_relaxed) > 0) {
+      ml.Notify();
+    } else if (count_idle_ == 0 &&
+               (max_pool_size_ == 0 ||
+                (count_idle_ + count_running_) < max_pool_size_)) {
+      // Idle workers which are not waiting look at all deques before they
+      // wait. If there are none, start a worker which can run the task in
+      // parallel, as would be done for a task in the shared list.
+      new_worker = new Worker(this);
+      idle_workers_.Append(new_worker);
+      count_idle_++;
+      UpdateAvailableLocked();
+    }
+  }
+  if (new_worker != nullptr) {
+    new_worker->StartThread();
+  }
+  return true;
+}
+
 bool ThreadPool::CurrentThreadIsWorker() {
   auto worker =
       static_cast<Worker*>(OSThread::Current()->owning_thread_pool_worker_);
@@ -110,6 +182,17 @@ void ThreadPool::MarkCurrentWorkerAsBlocked() {
     MonitorLocker ml(&pool_monitor_);
     ASSERT(!worker->is_blocked_);
     worker->is_blocked_ = true;
+
+    // Hand the tasks this worker scheduled for itself to the other workers.
+    Task* task;
+    while (worker->local_tasks_.Steal(&task)) {
+      tasks_.Append(task);
+      pending_tasks_++;
+    }
+    if (pending_tasks_ > 0 && count_idle_ > 0) {
+      ml.NotifyAll();
+    }
+
     if (max_pool_size_ > 0) {
       ++max_pool_size_;
       // This thread is blocked and therefore no longer usable as a worker.
@@ -122,6 +205,7 @@ void ThreadPool::MarkCurrentWorkerAsBlocked() {
         count_idle_++;
       }
     }
+    UpdateAvailableLocked();
   }
   if (new_worker != nullptr) {
     new_worker->StartThread();
@@ -138,6 +222,7 @@ void ThreadPool::MarkCurrentWorkerAsUnBlocked() {
       if (max_pool_size_ > 0) {
         --max_pool_size_;
         ASSERT(max_pool_size_ > 0);
+        UpdateAvailableLocked();
       }
     }
   }
@@ -149,23 +234,33 @@ void ThreadPool::WorkerLoop(Worker* worker) {
   while (true) {
     MonitorLocker ml(&pool_monitor_);
 
-    if (!tasks_.IsEmpty()) {
+    Task* next = TakeTaskLocked(worker);
+    if (next != nullptr) {
       IdleToRunningLocked(worker);
-      while (!tasks_.IsEmpty()) {
-        std::unique_ptr<Task> task(tasks_.RemoveFirst());
-        pending_tasks_--;
-        MonitorLeaveScope mls(&ml);
-        task->Run();
-        ASSERT(Isolate::Current() == nullptr);
-        task.reset();
+      while (next != nullptr) {
+        {
+          MonitorLeaveScope mls(&ml);
+          intptr_t local_tasks = 0;
+          do {
+            std::unique_ptr<Task> task(next);
+            task->Run();
+            ASSERT(Isolate::Current() == nullptr);
+            task.reset();
+            // Continue with the tasks this worker scheduled, oldest first,
+            // without taking the pool's lock.
+          } while (++local_tasks < kMaxConsecutiveLocalTasks &&
+                   pending_high_priority_tasks_ == 0 &&
+                   worker->local_tasks_.Steal(&next));
+        }
+        next = TakeTaskLocked(worker);
       }
       RunningToIdleLocked(worker);
     }
 
     if (running_workers_.IsEmpty()) {
-      ASSERT(tasks_.IsEmpty());
+      ASSERT(!TasksWaitingToRunLocked());
       OnEnterIdleLocked(&ml);
-      if (!tasks_.IsEmpty()) {
+      if (TasksWaitingToRunLocked()) {
         continue;
       }
     }
@@ -180,10 +275,19 @@ void ThreadPool::WorkerLoop(Worker* worker) {
     const int64_t idle_start = OS::GetCurrentMonotonicMicros();
     bool done = false;
     while (!done) {
+      // Pairs with the fence in [RunLocal]: either the worker scheduling a
+      // task in its deque sees us waiting and notifies us, or we see the task.
+      num_waiting_.fetch_add(1, std::memory_order_relaxed);
+      std::atomic_thread_fence(std::memory_order_seq_cst);
+      if (HasLocalTasksLocked()) {
+        num_waiting_.fetch_sub(1, std::memory_order_relaxed);
+        break;
+      }
       const auto result = ml.WaitMicros(ComputeTimeout(idle_start));
+      num_waiting_.fetch_sub(1, std::memory_order_relaxed);
 
       // We have to drain all pending tasks.
-      if (!tasks_.IsEmpty()) break;
+      if (TasksWaitingToRunLocked() || HasLocalTasksLocked()) break;
 
       if (shutting_down_ || result == Monitor::kTimedOut) {
         done = true;
@@ -204,32 +308,89 @@ void ThreadPool::WorkerLoop(Worker* worker) {
   JoinDeadWorkersLocked(&dead_workers_to_join);
 }
 
+ThreadPool::Task* ThreadPool::TakeTaskLocked(Worker* worker) {
+  if (!high_priority_tasks_.IsEmpty()) {
+    pending_tasks_--;
+    pending_high_priority_tasks_--;
+    return high_priority_tasks_.RemoveFirst();
+  }
+  if (!tasks_.IsEmpty()) {
+    pending_tasks_--;
+    return tasks_.RemoveFirst();
+  }
+  Task* task;
+  while (!worker->local_tasks_.IsEmpty()) {
+    if (worker->local_tasks_.Steal(&task)) {
+      return task;
+    }
+  }
+  for (Worker* other : running_workers_) {
+    if (other != worker && other->local_tasks_.Steal(&task)) {
+      return task;
+    }
+  }
+  for (Worker* other : idle_workers_) {
+    if (other != worker && other->local_tasks_.Steal(&task)) {
+      return task;
+    }
+  }
+  return nullptr;
+}
+
+bool ThreadPool::HasLocalTasksLocked() {
+  for (Worker* worker : running_workers_) {
+    if (!worker->local_tasks_.IsEmpty()) {
+      return true;
+    }
+  }
+  for (Worker* worker : idle_workers_) {
+    if (!worker->local_tasks_.IsEmpty()) {
+      return true;
+    }
+  }
+  return false;
+}
+
+void ThreadPool::UpdateAvailableLocked() {
+  intptr_t available = kIntptrMax;
+  if (max_pool_size_ > 0) {
+    const uint64_t workers = count_idle_ + count_running_;
+    available = count_idle_ +
+                (workers < max_pool_size_ ? max_pool_size_ - workers : 0);
+  }
+  available_.store(available, std::memory_order_seq_cst);
+}
+
 void ThreadPool::IdleToRunningLocked(Worker* worker) {
   ASSERT(idle_workers_.ContainsForDebugging(worker));
   idle_workers_.Remove(worker);
   running_workers_.Append(worker);
   count_idle_--;
   count_running_++;
+  UpdateAvailableLocked();
 }
 
 void ThreadPool::RunningToIdleLocked(Worker* worker) {
-  ASSERT(tasks_.IsEmpty());
+  ASSERT(!TasksWaitingToRunLocked());
 
   ASSERT(running_workers_.ContainsForDebugging(worker));
   running_workers_.Remove(worker);
   idle_workers_.Append(worker);
   count_running_--;
   count_idle_++;
+  UpdateAvailableLocked();
 }
 
 void ThreadPool::IdleToDeadLocked(Worker* worker) {
-  ASSERT(tasks_.IsEmpty());
+  ASSERT(!TasksWaitingToRunLocked());
+  ASSERT(worker->local_tasks_.IsEmpty());
 
   ASSERT(idle_workers_.ContainsForDebugging(worker));
   idle_workers_.Remove(worker);
   dead_workers_.Append(worker);
   count_idle_--;
   count_dead_++;
+  UpdateAvailableLocked();
 
   // Notify shutdown thread that the worker thread is about to finish.
   if (shutting_down_) {
@@ -262,7 +423,12 @@ void ThreadPool::JoinDeadWorkersLocked(WorkerList* dead_workers_to_join) {
 ThreadPool::Worker* ThreadPool::ScheduleTaskLocked(MonitorLocker* ml,
                                                    std::unique_ptr<Task> task) {
   // Enqueue the new task.
-  tasks_.Append(task.release());
+  if (task->priority() == Task::kHighPriority) {
+    high_priority_tasks_.Append(task.release());
+    pending_high_priority_tasks_++;
+  } else {
+    tasks_.Append(task.release());
+  }
   pending_tasks_++;
   ASSERT(pending_tasks_ >= 1);
 
@@ -286,6 +452,7 @@ ThreadPool::Worker* ThreadPool::ScheduleTaskLocked(MonitorLocker* ml,
   auto new_worker = new Worker(this);
   idle_workers_.Append(new_worker);
   count_idle_++;
+  UpdateAvailableLocked();
   return new_worker;
 }
 
@@ -8,8 +8,10 @@
 #include <memory>
 #include <utility>
 
+#include "platform/atomic.h"
 #include "vm/allocation.h"
 #include "vm/globals.h"
+#include "vm/heap/work_stealing_deque.h"
 #include "vm/intrusive_dlist.h"
 #include "vm/os_thread.h"
 
@@ -21,8 +23,18 @@ class ThreadPool {
  public:
   // Subclasses of Task are able to run on a ThreadPool.
   class Task : public IntrusiveDListEntry<Task> {
+   public:
+    // High priority tasks run before all other pending tasks. Low priority
+    // tasks are never put into the deque of the scheduling worker, where they
+    // could run before older tasks of other workers.
+    enum Priority {
+      kHighPriority,
+      kNormalPriority,
+      kLowPriority,
+    };
+
    protected:
-    Task() {}
+    explicit Task(Priority priority = kNormalPriority) : priority_(priority) {}
 
    public:
     virtual ~Task() {}
@@ -30,10 +42,19 @@ class ThreadPool {
     // Override this to provide task-specific behavior.
     virtual void Run() = 0;
 
+    Priority priority() const { return priority_; }
+
    private:
+    const Priority priority_;
+
     DISALLOW_COPY_AND_ASSIGN(Task);
   };
 
+  // Tasks scheduled by a worker of the pool go to a deque owned by that worker
+  // and are run by it once its current task is done, unless an idle worker
+  // steals them first. This keeps related work (e.g. an isolate handling a
+  // message another isolate just sent) on a warm core and avoids the pool's
+  // lock when all workers are busy. Other tasks go to a shared list.
   explicit ThreadPool(uintptr_t max_pool_size = 0);
 
   // Prevent scheduling of new tasks, wait until all pending tasks are done
@@ -88,6 +109,10 @@ class ThreadPool {
     OSThread* os_thread_ = nullptr;
     bool is_blocked_ = false;
 
+    // Tasks scheduled by this worker. Only this worker pushes, any worker
+    // takes from it (while holding the pool's lock, except for this worker).
+    WorkStealingDeque<Task*, 8> local_tasks_;
+
     DISALLOW_COPY_AND_ASSIGN(Worker);
   };
 
@@ -102,17 +127,28 @@ class ThreadPool {
   bool ShuttingDownLocked() { return shutting_down_; }
 
   // Whether new tasks are ready to be run.
-  bool TasksWaitingToRunLocked() { return !tasks_.IsEmpty(); }
+  bool TasksWaitingToRunLocked() {
+    return !tasks_.IsEmpty() || !high_priority_tasks_.IsEmpty();
+  }
 
  private:
   using TaskList = IntrusiveDList<Task>;
   using WorkerList = IntrusiveDList<Worker>;
 
   bool RunImpl(std::unique_ptr<Task> task);
+  bool RunLocal(Worker* worker, std::unique_ptr<Task> task);
   void WorkerLoop(Worker* worker);
 
   Worker* ScheduleTaskLocked(MonitorLocker* ml, std::unique_ptr<Task> task);
 
+  // Takes a task from the shared list or steals one from a running worker.
+  Task* TakeTaskLocked(Worker* worker);
+  bool HasLocalTasksLocked();
+
+  // Recomputes [available_] after the number of workers or the maximum pool
+  // size changed.
+  void UpdateAvailableLocked();
+
   void IdleToRunningLocked(Worker* worker);
   void RunningToIdleLocked(Worker* worker);
   void IdleToDeadLocked(Worker* worker);
@@ -120,7 +156,8 @@ class ThreadPool {
   void JoinDeadWorkersLocked(WorkerList* dead_workers_to_join);
 
   Monitor pool_monitor_;
-  bool shutting_down_ = false;
+  // Written while holding [pool_monitor_], read without it by [RunLocal].
+  RelaxedAtomic<bool> shutting_down_ = false;
   uint64_t count_running_ = 0;
   uint64_t count_idle_ = 0;
   uint64_t count_dead_ = 0;
@@ -128,8 +165,19 @@ class ThreadPool {
   WorkerList idle_workers_;
   WorkerList dead_workers_;
   uint64_t pending_tasks_ = 0;
+  TaskList high_priority_tasks_;
   TaskList tasks_;
 
+  // The number of workers waiting for tasks and the number of idle workers
+  // plus the number of workers which could still be started. Both are
+  // written while holding [pool_monitor_] and read without it by [RunLocal]
+  // to decide whether a worker has to be woken up or started.
+  std::atomic<intptr_t> num_waiting_ = {0};
+  std::atomic<intptr_t> available_ = {kIntptrMax};
+  // The length of [high_priority_tasks_]. Workers running their own tasks
+  // check it without taking [pool_monitor_].
+  RelaxedAtomic<intptr_t> pending_high_priority_tasks_ = 0;
+
   Monitor exit_monitor_;
   std::atomic<bool> all_workers_dead_;
 
@@ -256,4 +256,116 @@ THREAD_POOL_UNIT_TEST_CASE(ThreadPool_RecursiveSpawn) {
   EXPECT_EQ(kTotalTasks, done);
 }
 
+class SignalTask : public ThreadPool::Task {
+ public:
+  SignalTask(Monitor* sync, bool* done) : sync_(sync), done_(done) {}
+
+  virtual void Run() {
+    MonitorLocker ml(sync_);
+    *done_ = true;
+    ml.NotifyAll();
+  }
+
+ private:
+  Monitor* sync_;
+  bool* done_;
+};
+
+// Schedules a task from a worker, which puts it into the worker's own deque,
+// and waits for it without marking the worker as blocked.
+class WaitForLocalTask : public ThreadPool::Task {
+ public:
+  WaitForLocalTask(ThreadPool* pool,
+                   Monitor* sync,
+                   bool* child_done,
+                   bool* done)
+      : pool_(pool), sync_(sync), child_done_(child_done), done_(done) {}
+
+  virtual void Run() {
+    EXPECT(pool_->Run<SignalTask>(sync_, child_done_));
+    MonitorLocker ml(sync_);
+    while (!*child_done_) {
+      ml.Wait();
+    }
+    *done_ = true;
+    ml.NotifyAll();
+  }
+
+ private:
+  ThreadPool* pool_;
+  Monitor* sync_;
+  bool* child_done_;
+  bool* done_;
+};
+
+THREAD_POOL_UNIT_TEST_CASE(ThreadPool_StealLocalTask) {
+  // The second worker has to steal the task from the first one.
+  ThreadPool thread_pool(2);
+  Monitor sync;
+  bool child_done = false;
+  bool done = false;
+  thread_pool.Run<WaitForLocalTask>(&thread_pool, &sync, &child_done, &done);
+  {
+    MonitorLocker ml(&sync);
+    while (!done) {
+      ml.Wait();
+    }
+  }
+  EXPECT(child_done);
+  EXPECT_EQ(2U, thread_pool.workers_started());
+}
+
+class RecordOrderTask : public ThreadPool::Task {
+ public:
+  RecordOrderTask(Priority priority,
+                  Monitor* sync,
+                  intptr_t id,
+                  intptr_t* order,
+                  intptr_t* count)
+      : ThreadPool::Task(priority),
+        sync_(sync),
+        id_(id),
+        order_(order),
+        count_(count) {}
+
+  virtual void Run() {
+    MonitorLocker ml(sync_);
+    order_[(*count_)++] = id_;
+    ml.NotifyAll();
+  }
+
+ private:
+  Monitor* sync_;
+  intptr_t id_;
+  intptr_t* order_;
+  intptr_t* count_;
+};
+
+THREAD_POOL_UNIT_TEST_CASE(ThreadPool_TaskPriorities) {
+  ThreadPool thread_pool(1);
+  Monitor sync;
+  bool done = true;
+  intptr_t order[3] = {0, 0, 0};
+  intptr_t count = 0;
+  // Keep the only worker busy while the other tasks are scheduled.
+  thread_pool.Run<TestTask>(&sync, &done);
+  thread_pool.Run<RecordOrderTask>(ThreadPool::Task::kNormalPriority, &sync, 1,
+                                   order, &count);
+  thread_pool.Run<RecordOrderTask>(ThreadPool::Task::kLowPriority, &sync, 2,
+                                   order, &count);
+  thread_pool.Run<RecordOrderTask>(ThreadPool::Task::kHighPriority, &sync, 3,
+                                   order, &count);
+  {
+    MonitorLocker ml(&sync);
+    done = false;
+    ml.NotifyAll();
+    while (count < 3) {
+      ml.Wait();
+    }
+  }
+  EXPECT_EQ(3, order[0]);
+  EXPECT_EQ(1, order[1]);
+  EXPECT_EQ(2, order[2]);
+}
+
 }  // namespace dart
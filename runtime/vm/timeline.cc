@@ -82,6 +82,12 @@ DEFINE_FLAG(charp,
             DEFAULT_TIMELINE_RECORDER,
             "Select the timeline recorder used. "
             "Valid values: none, " SUPPORTED_TIMELINE_RECORDERS)
+DEFINE_FLAG(bool,
+            timeline_hardware_counters,
+            false,
+            "Attach hardware counter deltas (cycles, instructions and last "
+            "level cache misses) to duration events recorded by begin/end "
+            "scopes, such as GC and compiler phases. Linux and Android only.");
 
 // Implementation notes:
 //
@@ -1213,12 +1219,28 @@ void TimelineBeginEndScope::EmitBegin() {
   // Emit a begin event.
   event->Begin(label(), id());
   event->Complete();
+  if (FLAG_timeline_hardware_counters) {
+    has_begin_counters_ =
+        OSThread::Current()->hardware_counters()->Read(&begin_counters_);
+  }
 }
 
 void TimelineBeginEndScope::EmitEnd() {
   if (!ShouldEmitEvent()) {
     return;
   }
+  HardwareCounters::Values end_counters;
+  if (has_begin_counters_ &&
+      OSThread::Current()->hardware_counters()->Read(&end_counters)) {
+    const intptr_t index = arguments_length();
+    SetNumArguments(index + 3);
+    FormatArgument(index, "cycles", "%" Pd64,
+                   end_counters.cycles - begin_counters_.cycles);
+    FormatArgument(index + 1, "instructions", "%" Pd64,
+                   end_counters.instructions - begin_counters_.instructions);
+    FormatArgument(index + 2, "llcMisses", "%" Pd64,
+                   end_counters.cache_misses - begin_counters_.cache_misses);
+  }
   TimelineEvent* event = stream()->StartEvent();
   if (event == nullptr) {
     // Stream is now disabled.
@@ -1353,16 +1375,8 @@ TimelineEvent* TimelineEventRecorder::ThreadBlockStartEvent() {
   // Grab the current thread.
   OSThread* thread = OSThread::Current();
   ASSERT(thread != nullptr);
-  // Acquire the recorder lock in case we need to call |GetNewBlockLocked|. We
-  // acquire the lock here and not directly before calls to |GetNewBlockLocked|
-  // due to locking order restrictions.
-  Mutex& recorder_lock = lock_;
-  recorder_lock.Lock();
   Mutex* thread_block_lock = thread->timeline_block_lock();
   ASSERT(thread_block_lock != nullptr);
-  // We are accessing the thread's timeline block- so take the lock here.
-  // This lock will be held until the call to |CompleteEvent| is made.
-  thread_block_lock->Lock();
 #if defined(DEBUG)
   Thread* T = Thread::Current();
   if (T != nullptr) {
@@ -1370,7 +1384,30 @@ TimelineEvent* TimelineEventRecorder::ThreadBlockStartEvent() {
   }
 #endif  // defined(DEBUG)
 
+  // Fast path: the thread already has a block with room in it. Blocks are
+  // only handed out, reclaimed, or stolen by other threads while holding both
+  // the recorder lock and the owning thread's block lock, so holding the
+  // latter is enough to use the thread's own block. This keeps the
+  // recorder-wide lock off the path of all but one event per block.
+  thread_block_lock->Lock();
   TimelineEventBlock* thread_block = thread->TimelineBlockLocked();
+  if ((thread_block != nullptr) && !thread_block->IsFull()) {
+    // NOTE: We are exiting this function with the thread's block lock held.
+    return thread_block->StartEventLocked();
+  }
+  thread_block_lock->Unlock();
+
+  // Acquire the recorder lock in case we need to call |GetNewBlockLocked|. We
+  // acquire the lock here and not directly before calls to |GetNewBlockLocked|
+  // due to locking order restrictions.
+  Mutex& recorder_lock = lock_;
+  recorder_lock.Lock();
+  // We are accessing the thread's timeline block- so take the lock here.
+  // This lock will be held until the call to |CompleteEvent| is made.
+  thread_block_lock->Lock();
+
+  // The block may have changed while no lock was held, so look again.
+  thread_block = thread->TimelineBlockLocked();
 
   if ((thread_block != nullptr) && thread_block->IsFull()) {
     // Thread has a block and it is full:
@@ -1984,6 +2021,8 @@ TimelineEventFileRecorderBase::TimelineEventFileRecorderBase(const char* path)
       head_(nullptr),
       tail_(nullptr),
       file_(nullptr),
+      write_buffer_(nullptr),
+      write_buffer_length_(0),
       shutting_down_(false),
       drained_(false),
       thread_id_(OSThread::kInvalidThreadJoinId) {
@@ -2002,6 +2041,7 @@ TimelineEventFileRecorderBase::TimelineEventFileRecorderBase(const char* path)
   }
 
   file_ = file;
+  write_buffer_ = reinterpret_cast<char*>(malloc(kWriteBufferSize));
 }
 
 TimelineEventFileRecorderBase::~TimelineEventFileRecorderBase() {
@@ -2020,6 +2060,10 @@ TimelineEventFileRecorderBase::~TimelineEventFileRecorderBase() {
   ASSERT(head_ == nullptr);
   ASSERT(tail_ == nullptr);
 
+  FlushWriteBuffer();
+  free(write_buffer_);
+  write_buffer_ = nullptr;
+
   Dart_FileCloseCallback file_close = Dart::file_close_callback();
   (*file_close)(file_);
   file_ = nullptr;
@@ -2033,19 +2077,27 @@ void TimelineEventFileRecorderBase::Drain() {
       if (shutting_down_) {
         break;
       }
+      if (write_buffer_length_ > 0) {
+        // Out of events for now, so write out what has been buffered before
+        // waiting for more.
+        ml.Exit();
+        FlushWriteBuffer();
+        ml.Enter();
+        continue;  // Recheck empty.
+      }
       ml.Wait();
       continue;  // Recheck empty.
     }
+    // Take all queued events at once so producers contend for the monitor
+    // once per batch rather than once per event.
     TimelineEvent* event = head_;
-    TimelineEvent* next = event->next();
-    head_ = next;
-    if (next == nullptr) {
-      tail_ = nullptr;
-    }
+    head_ = tail_ = nullptr;
     ml.Exit();
-    {
+    while (event != nullptr) {
+      TimelineEvent* next = event->next();
       DrainImpl(*event);
       delete event;
+      event = next;
     }
     ml.Enter();
   }
@@ -2053,10 +2105,29 @@ void TimelineEventFileRecorderBase::Drain() {
   ml.Notify();
 }
 
-void TimelineEventFileRecorderBase::Write(const char* buffer,
-                                          intptr_t len) const {
+void TimelineEventFileRecorderBase::Write(const char* buffer, intptr_t len) {
+  if (file_ == nullptr) {
+    return;
+  }
+  if (len > kWriteBufferSize - write_buffer_length_) {
+    FlushWriteBuffer();
+  }
+  if (len >= kWriteBufferSize) {
+    Dart_FileWriteCallback file_write = Dart::file_write_callback();
+    (*file_write)(buffer, len, file_);
+    return;
+  }
+  memmove(write_buffer_ + write_buffer_length_, buffer, len);
+  write_buffer_length_ += len;
+}
+
+void TimelineEventFileRecorderBase::FlushWriteBuffer() {
+  if (write_buffer_length_ == 0) {
+    return;
+  }
   Dart_FileWriteCallback file_write = Dart::file_write_callback();
-  (*file_write)(buffer, len, file_);
+  (*file_write)(write_buffer_, write_buffer_length_, file_);
+  write_buffer_length_ = 0;
 }
 
 void TimelineEventFileRecorderBase::CompleteEvent(TimelineEvent* event) {
@@ -2073,11 +2144,13 @@ void TimelineEventFileRecorderBase::CompleteEvent(TimelineEvent* event) {
   event->set_next(nullptr);
   if (tail_ == nullptr) {
     head_ = tail_ = event;
+    // The drain thread only waits when the queue is empty, so it only needs
+    // waking up for the first event of a batch.
+    ml.Notify();
   } else {
     tail_->set_next(event);
     tail_ = event;
   }
-  ml.Notify();
 }
 
 // Must be called in derived class destructors.
@@ -2173,8 +2246,7 @@ TimelineEventPerfettoFileRecorder::~TimelineEventPerfettoFileRecorder() {
 }
 
 void TimelineEventPerfettoFileRecorder::WritePacket(
-    protozero::HeapBuffered<perfetto::protos::pbzero::TracePacket>* packet)
-    const {
+    protozero::HeapBuffered<perfetto::protos::pbzero::TracePacket>* packet) {
   const std::tuple<std::unique_ptr<const uint8_t[]>, intptr_t>& response =
       perfetto_utils::GetProtoPreamble(packet);
   Write(reinterpret_cast<const char*>(std::get<0>(response).get()),
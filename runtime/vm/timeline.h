@@ -17,6 +17,7 @@
 #include "vm/bitfield.h"
 #include "vm/globals.h"
 #include "vm/growable_array.h"
+#include "vm/hardware_counters.h"
 #include "vm/os.h"
 #include "vm/os_thread.h"
 
@@ -765,6 +766,10 @@ class TimelineBeginEndScope : public TimelineEventScope {
   void EmitBegin();
   void EmitEnd();
 
+  // Counter values at the begin event, with --timeline_hardware_counters.
+  HardwareCounters::Values begin_counters_;
+  bool has_begin_counters_ = false;
+
   DISALLOW_COPY_AND_ASSIGN(TimelineBeginEndScope);
 };
 
@@ -1258,18 +1263,25 @@ class TimelineEventFileRecorderBase : public TimelineEventPlatformRecorder {
   void Drain();
 
  protected:
-  void Write(const char* buffer, intptr_t len) const;
-  void Write(const char* buffer) const { Write(buffer, strlen(buffer)); }
+  // Output is buffered and written to the file in chunks of up to
+  // kWriteBufferSize bytes, and whenever the drain thread runs out of events.
+  void Write(const char* buffer, intptr_t len);
+  void Write(const char* buffer) { Write(buffer, strlen(buffer)); }
   void CompleteEvent(TimelineEvent* event) final;
   void ShutDown();
 
  private:
+  static constexpr intptr_t kWriteBufferSize = 64 * KB;
+
   virtual void DrainImpl(const TimelineEvent& event) = 0;
+  void FlushWriteBuffer();
 
   Monitor monitor_;
   TimelineEvent* head_;
   TimelineEvent* tail_;
   void* file_;
+  char* write_buffer_;
+  intptr_t write_buffer_length_;
   bool shutting_down_;
   bool drained_;
   ThreadJoinId thread_id_;
@@ -1298,8 +1310,7 @@ class TimelineEventPerfettoFileRecorder : public TimelineEventFileRecorderBase {
 
  private:
   void WritePacket(
-      protozero::HeapBuffered<perfetto::protos::pbzero::TracePacket>* packet)
-      const;
+      protozero::HeapBuffered<perfetto::protos::pbzero::TracePacket>* packet);
   void DrainImpl(const TimelineEvent& event) final;
 };
 #endif  // defined(SUPPORT_PERFETTO) && !defined(PRODUCT)
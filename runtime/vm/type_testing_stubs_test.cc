@@ -202,6 +202,12 @@ extern bool TESTING_runtime_entered_on_TTS_invocation;
 extern bool TESTING_found_hash_STC_entry;
 #endif
 
+static intptr_t TypeCheckRuntimeCalls(IsolateGroup* isolate_group) {
+  auto* const counters = isolate_group->type_check_counters();
+  return counters->from_lazy_specialize_stub + counters->from_slow_stub +
+         counters->from_inline;
+}
+
 enum TTSTestResult {
   // The TTS invocation should enter the runtime and trigger a TypeError.
   kFail,
@@ -587,6 +593,8 @@ class TTSTestState : public ValueObject {
     // Clear the runtime entered flag prior to invocation.
     TESTING_runtime_entered_on_TTS_invocation = false;
 #endif
+    const intptr_t previous_runtime_calls =
+        TypeCheckRuntimeCalls(thread_->isolate_group());
     {
       TraceStubInvocationScope scope;
       last_result_ = DartEntry::InvokeCode(tts_invoker_, arguments_descriptor_,
@@ -596,6 +604,9 @@ class TTSTestState : public ValueObject {
     EXPECT_EQ(test_case.ShouldEnterRuntime(),
               TESTING_runtime_entered_on_TTS_invocation);
 #endif
+    EXPECT_EQ(test_case.ShouldEnterRuntime(),
+              TypeCheckRuntimeCalls(thread_->isolate_group()) >
+                  previous_runtime_calls);
     new_tts_stub_ = last_tested_type_.type_test_stub();
     last_stc_ = current_stc();
     if (test_case.expected_result == kFail) {
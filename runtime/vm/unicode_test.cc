@@ -1090,4 +1090,54 @@ ISOLATE_UNIT_TEST_CASE(Utf8Decode) {
   }
 }
 
+ISOLATE_UNIT_TEST_CASE(Utf8DecodeWellFormed) {
+  // Long enough to take the word at a time ASCII path on both sides of the
+  // multi-byte sequences.
+  {
+    const char* src = "abcdefghijklmnop\xC3\xA6\xC3\xB8rstuvwxyz01234567";
+    const intptr_t len = 16 + 2 + 17;
+    uint8_t latin1[len];
+    EXPECT(Utf8::DecodeWellFormedToLatin1(
+        reinterpret_cast<const uint8_t*>(src), strlen(src), latin1, len));
+    EXPECT_EQ('p', latin1[15]);
+    EXPECT_EQ(0xE6, latin1[16]);
+    EXPECT_EQ(0xF8, latin1[17]);
+    EXPECT_EQ('7', latin1[len - 1]);
+    // The output length must match exactly.
+    EXPECT(!Utf8::DecodeWellFormedToLatin1(
+        reinterpret_cast<const uint8_t*>(src), strlen(src), latin1, len - 1));
+  }
+
+  {
+    // U+20AC, U+1D11E.
+    const char* src = "01234567\xE2\x82\xAC\xF0\x9D\x84\x9E";
+    uint16_t utf16[11];
+    EXPECT(Utf8::DecodeWellFormedToUTF16(
+        reinterpret_cast<const uint8_t*>(src), strlen(src), utf16, 11));
+    EXPECT_EQ(0x20AC, utf16[8]);
+    EXPECT_EQ(0xD834, utf16[9]);
+    EXPECT_EQ(0xDD1E, utf16[10]);
+    // Not representable in Latin-1.
+    uint8_t latin1[11];
+    EXPECT(!Utf8::DecodeWellFormedToLatin1(
+        reinterpret_cast<const uint8_t*>(src), strlen(src), latin1, 11));
+  }
+
+  // Malformed input.
+  const char* const kMalformed[] = {
+      "\x80",              // Unexpected trail byte.
+      "\xC0\x80",          // Overlong.
+      "\xE0\x80\xAF",      // Overlong.
+      "\xED\xA0\x80",      // Encoded surrogate.
+      "\xF4\x90\x80\x80",  // Above U+10FFFF.
+      "\xE2\x82",          // Unfinished sequence.
+      "\xF8\x88\x80\x80",  // Invalid lead byte.
+  };
+  for (const char* src : kMalformed) {
+    uint16_t utf16[2];
+    EXPECT(!Utf8::DecodeWellFormedToUTF16(
+        reinterpret_cast<const uint8_t*>(src), strlen(src), utf16, 1));
+  }
+}
+
 }  // namespace dart
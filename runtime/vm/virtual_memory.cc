@@ -6,6 +6,7 @@
 
 #include "platform/assert.h"
 #include "platform/utils.h"
+#include "vm/flags.h"
 
 #if defined(DART_HOST_OS_MACOS)
 #include <mach/mach.h>
@@ -13,6 +14,15 @@
 
 namespace dart {
 
+DEFINE_FLAG(bool,
+            huge_pages,
+            false,
+            "Request transparent huge pages for the compressed heap region, "
+            "large heap pages and image pages.");
+
+RelaxedAtomic<intptr_t> VirtualMemory::huge_page_bytes_ = {0};
+RelaxedAtomic<intptr_t> VirtualMemory::huge_page_failures_ = {0};
+
 bool VirtualMemory::InSamePage(uword address0, uword address1) {
   return (Utils::RoundDown(address0, PageSize()) ==
           Utils::RoundDown(address1, PageSize()));
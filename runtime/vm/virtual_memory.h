@@ -5,6 +5,7 @@
 #ifndef RUNTIME_VM_VIRTUAL_MEMORY_H_
 #define RUNTIME_VM_VIRTUAL_MEMORY_H_
 
+#include "platform/atomic.h"
 #include "platform/utils.h"
 #include "vm/flags.h"
 #include "vm/globals.h"
@@ -49,6 +50,16 @@ class VirtualMemory {
 
   static void DontNeed(void* address, intptr_t size);
 
+  // With --huge_pages, asks the OS to back the kHugePageSize-aligned parts of
+  // the given range with transparent huge pages. Returns false if the request
+  // was not made or was refused.
+  static bool AdviseHugePages(void* address, intptr_t size);
+  static constexpr intptr_t kHugePageSize = 2 * MB;
+  // Bytes for which huge pages were requested successfully, and the number of
+  // refused requests, for metrics.
+  static intptr_t huge_page_bytes() { return huge_page_bytes_; }
+  static intptr_t huge_page_failures() { return huge_page_failures_; }
+
   // Reserves and commits a virtual memory segment with size. If a segment of
   // the requested size cannot be allocated, nullptr is returned.
   static VirtualMemory* Allocate(intptr_t size,
@@ -118,6 +129,8 @@ class VirtualMemory {
 
   static uword page_size_;
   static VirtualMemory* compressed_heap_;
+  static RelaxedAtomic<intptr_t> huge_page_bytes_;
+  static RelaxedAtomic<intptr_t> huge_page_failures_;
 
   DISALLOW_IMPLICIT_CONSTRUCTORS(VirtualMemory);
 };
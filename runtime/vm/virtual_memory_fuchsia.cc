@@ -281,6 +281,10 @@ void VirtualMemory::DontNeed(void* address, intptr_t size) {
   }
 }
 
+bool VirtualMemory::AdviseHugePages(void* address, intptr_t size) {
+  return false;
+}
+
 }  // namespace dart
 
 #endif  // defined(DART_HOST_OS_FUCHSIA)
@@ -43,6 +43,7 @@ namespace dart {
 #define LARGE_RESERVATIONS_MAY_FAIL
 #endif
 
+DECLARE_FLAG(bool, huge_pages);
 DECLARE_FLAG(bool, write_protect_code);
 
 #if defined(DART_TARGET_OS_LINUX)
@@ -232,6 +233,11 @@ VirtualMemory* VirtualMemory::AllocateAligned(intptr_t size,
   ASSERT(Utils::IsAligned(alignment, PageSize()));
   ASSERT(name != nullptr);
 
+  if (FLAG_huge_pages && !is_executable && (size >= kHugePageSize)) {
+    // Lets the whole allocation be backed by huge pages.
+    alignment = Utils::Maximum(alignment, kHugePageSize);
+  }
+
 #if defined(DART_COMPRESSED_POINTERS)
   if (is_compressed) {
     RELEASE_ASSERT(!is_executable);
@@ -260,6 +266,16 @@ VirtualMemory* VirtualMemory::AllocateAligned(intptr_t size,
       return nullptr;
     }
     Commit(region.pointer(), region.size());
+    if (FLAG_huge_pages) {
+      // Committing replaces the mapping, dropping any earlier advice. Cover
+      // the surrounding huge page(s): neighbouring heap pages are likely to be
+      // committed too, and the reservation is a single mapping.
+      uword start = Utils::RoundDown(region.start(), kHugePageSize);
+      uword end = Utils::RoundUp(region.end(), kHugePageSize);
+      start = Utils::Maximum(start, compressed_heap_->start());
+      end = Utils::Minimum(end, compressed_heap_->end());
+      AdviseHugePages(reinterpret_cast<void*>(start), end - start);
+    }
     return new VirtualMemory(region, region);
   }
 #endif  // defined(DART_COMPRESSED_POINTERS)
@@ -315,6 +331,11 @@ VirtualMemory* VirtualMemory::AllocateAligned(intptr_t size,
   prctl(PR_SET_VMA, PR_SET_VMA_ANON_NAME, address, size, name);
 #endif
 
+  if (FLAG_huge_pages && !is_executable) {
+    // Only benefits allocations of at least one huge page, i.e. large pages.
+    AdviseHugePages(address, size);
+  }
+
   MemoryRegion region(reinterpret_cast<void*>(address), size);
   return new VirtualMemory(region, region);
 }
@@ -431,6 +452,34 @@ void VirtualMemory::Protect(void* address, intptr_t size, Protection mode) {
            end_address - page_address, prot);
 }
 
+bool VirtualMemory::AdviseHugePages(void* address, intptr_t size) {
+#if (defined(DART_HOST_OS_ANDROID) || defined(DART_HOST_OS_LINUX)) &&           \
+    defined(MADV_HUGEPAGE)
+  if (!FLAG_huge_pages) {
+    return false;
+  }
+  const uword start =
+      Utils::RoundUp(reinterpret_cast<uword>(address), kHugePageSize);
+  const uword end =
+      Utils::RoundDown(reinterpret_cast<uword>(address) + size, kHugePageSize);
+  if (start >= end) {
+    return false;
+  }
+  if (madvise(reinterpret_cast<void*>(start), end - start, MADV_HUGEPAGE) !=
+      0) {
+    // E.g., THP is disabled in this kernel.
+    LOG_INFO("madvise(%p, 0x%" Px ", MADV_HUGEPAGE) failed: %d\n",
+             reinterpret_cast<void*>(start), end - start, errno);
+    huge_page_failures_.fetch_add(1);
+    return false;
+  }
+  huge_page_bytes_.fetch_add(end - start);
+  return true;
+#else
+  return false;
+#endif
+}
+
 void VirtualMemory::DontNeed(void* address, intptr_t size) {
   uword start_address = reinterpret_cast<uword>(address);
   uword end_address = start_address + size;
@@ -243,6 +243,12 @@ void VirtualMemory::Protect(void* address, intptr_t size, Protection mode) {
 
 void VirtualMemory::DontNeed(void* address, intptr_t size) {}
 
+bool VirtualMemory::AdviseHugePages(void* address, intptr_t size) {
+  // Large pages need SeLockMemoryPrivilege and cannot be requested after
+  // reservation.
+  return false;
+}
+
 }  // namespace dart
 
 #endif  // defined(DART_HOST_OS_WINDOWS)
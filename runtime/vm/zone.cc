@@ -12,6 +12,7 @@
 #include "vm/handles_impl.h"
 #include "vm/heap/heap.h"
 #include "vm/os.h"
+#include "vm/thread.h"
 #include "vm/virtual_memory.h"
 
 namespace dart {
@@ -50,6 +51,9 @@ class Zone::Segment {
 // zone segments (jemalloc to the point of causing OOM), so instead of using
 // malloc to allocate segments, we allocate directly from mmap/zx_vmo_create/
 // VirtualAlloc, and cache a small number of the normal sized segments.
+// Each thread additionally keeps one normal sized segment for itself, which
+// serves the common case of a short-lived StackZone needing a single segment
+// without taking the lock.
 static constexpr intptr_t kSegmentCacheCapacity = 16;  // 1 MB of Segments
 static Mutex* segment_cache_mutex = nullptr;
 static VirtualMemory* segment_cache[kSegmentCacheCapacity] = {nullptr};
@@ -73,17 +77,36 @@ void Zone::ClearCache() {
   while (segment_cache_size > 0) {
     delete segment_cache[--segment_cache_size];
   }
+  Thread* thread = Thread::Current();
+  if (thread != nullptr) {
+    ClearThreadCache(thread);
+  }
+}
+
+void Zone::ClearThreadCache(Thread* thread) {
+  VirtualMemory* memory = thread->zone_segment_cache();
+  if (memory != nullptr) {
+    thread->set_zone_segment_cache(nullptr);
+    total_size_.fetch_sub(memory->size());
+    delete memory;
+  }
 }
 
 Zone::Segment* Zone::Segment::New(intptr_t size, Zone::Segment* next) {
   size = Utils::RoundUp(size, VirtualMemory::PageSize());
   VirtualMemory* memory = nullptr;
   if (size == kSegmentSize) {
-    MutexLocker ml(segment_cache_mutex);
-    ASSERT(segment_cache_size >= 0);
-    ASSERT(segment_cache_size <= kSegmentCacheCapacity);
-    if (segment_cache_size > 0) {
-      memory = segment_cache[--segment_cache_size];
+    Thread* thread = Thread::Current();
+    if (thread != nullptr && thread->zone_segment_cache() != nullptr) {
+      memory = thread->zone_segment_cache();
+      thread->set_zone_segment_cache(nullptr);
+    } else {
+      MutexLocker ml(segment_cache_mutex);
+      ASSERT(segment_cache_size >= 0);
+      ASSERT(segment_cache_size <= kSegmentCacheCapacity);
+      if (segment_cache_size > 0) {
+        memory = segment_cache[--segment_cache_size];
+      }
     }
   }
   if (memory == nullptr) {
@@ -125,12 +148,18 @@ void Zone::Segment::DeleteSegmentList(Segment* head) {
     LSAN_UNREGISTER_ROOT_REGION(current, sizeof(*current));
 
     if (size == kSegmentSize) {
-      MutexLocker ml(segment_cache_mutex);
-      ASSERT(segment_cache_size >= 0);
-      ASSERT(segment_cache_size <= kSegmentCacheCapacity);
-      if (segment_cache_size < kSegmentCacheCapacity) {
-        segment_cache[segment_cache_size++] = memory;
+      Thread* thread = Thread::Current();
+      if (thread != nullptr && thread->zone_segment_cache() == nullptr) {
+        thread->set_zone_segment_cache(memory);
         memory = nullptr;
+      } else {
+        MutexLocker ml(segment_cache_mutex);
+        ASSERT(segment_cache_size >= 0);
+        ASSERT(segment_cache_size <= kSegmentCacheCapacity);
+        if (segment_cache_size < kSegmentCacheCapacity) {
+          segment_cache[segment_cache_size++] = memory;
+          memory = nullptr;
+        }
       }
     }
     if (memory != nullptr) {
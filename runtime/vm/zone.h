@@ -13,6 +13,8 @@
 
 namespace dart {
 
+class Thread;
+
 // Zones support very fast allocation of small chunks of memory. The
 // chunks cannot be deallocated individually, but instead zones
 // support deallocating all chunks in one fast operation.
@@ -91,6 +93,8 @@ class Zone {
   static void Cleanup();
 
   static void ClearCache();
+  // Frees the segment [thread] keeps for reuse, called when it is deleted.
+  static void ClearThreadCache(Thread* thread);
   static intptr_t Size() { return total_size_; }
 
  private:
@@ -269,6 +269,26 @@ ISOLATE_UNIT_TEST_CASE(ZonesNotLimitedByCompressedHeap) {
 }
 #endif  // defined(DART_COMPRESSED_POINTERS)
 
+ISOLATE_UNIT_TEST_CASE(ZoneSegmentReusedByThread) {
+  {
+    StackZone stack_zone(thread);
+    // Needs a second, normal sized segment.
+    stack_zone.GetZone()->AllocUnsafe(1 * KB);
+    Zone::ClearThreadCache(thread);
+  }
+  VirtualMemory* cached = thread->zone_segment_cache();
+  EXPECT(cached != nullptr);
+  {
+    StackZone stack_zone(thread);
+    stack_zone.GetZone()->AllocUnsafe(1 * KB);
+    // The segment was taken from the thread.
+    EXPECT(thread->zone_segment_cache() == nullptr);
+  }
+  EXPECT(thread->zone_segment_cache() == cached);
+  Zone::ClearThreadCache(thread);
+  EXPECT(thread->zone_segment_cache() == nullptr);
+}
+
 ISOLATE_UNIT_TEST_CASE(ZoneVerificationScaling) {
   // This ought to complete in O(n), not O(n^2).
   const intptr_t n = 1000000;
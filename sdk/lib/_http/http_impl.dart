@@ -1691,6 +1691,29 @@ class _HttpOutgoing implements StreamConsumer<List<int>> {
 
   _HttpOutgoing(this.socket);
 
+  // Whether an Accept-Encoding header allows a gzip response body.
+  //
+  // Each coding may carry a quality value ("gzip;q=0.5"); a quality of zero
+  // means the coding is not acceptable.
+  static bool _acceptsGZip(List<String> acceptEncodings) {
+    for (var header in acceptEncodings) {
+      for (var element in header.split(",")) {
+        var parameters = element.split(";");
+        if (parameters[0].trim().toLowerCase() != "gzip") continue;
+        var quality = 1.0;
+        for (var i = 1; i < parameters.length; i++) {
+          var parameter = parameters[i].trim();
+          if (parameter.length > 2 &&
+              parameter.substring(0, 2).toLowerCase() == "q=") {
+            quality = double.tryParse(parameter.substring(2).trim()) ?? 1.0;
+          }
+        }
+        if (quality > 0) return true;
+      }
+    }
+    return false;
+  }
+
   // Returns either a future or 'null', if it was able to write headers
   // immediately.
   Future<void>? writeHeaders(
@@ -1711,9 +1734,7 @@ class _HttpOutgoing implements StreamConsumer<List<int>> {
             response.headers[HttpHeaders.contentEncodingHeader];
         if (acceptEncodings != null &&
             contentEncoding == null &&
-            acceptEncodings
-                .expand((list) => list.split(","))
-                .any((encoding) => encoding.trim().toLowerCase() == "gzip")) {
+            _acceptsGZip(acceptEncodings)) {
           response.headers.set(HttpHeaders.contentEncodingHeader, "gzip");
           gzip = true;
         }
@@ -95,6 +95,8 @@ base class _RandomAccessFileOpsImpl extends NativeFieldWrapperClass1
   external read(int bytes);
   @pragma("vm:external-name", "File_ReadInto")
   external readInto(List<int> buffer, int start, int? end);
+  @pragma("vm:external-name", "File_Map")
+  external map(int start, int end, bool copyOnWrite);
   @pragma("vm:external-name", "File_WriteByte")
   external writeByte(int value);
   @pragma("vm:external-name", "File_WriteFrom")
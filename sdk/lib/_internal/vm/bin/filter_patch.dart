@@ -11,6 +11,18 @@ base class _FilterImpl extends NativeFieldWrapperClass1
 
   @pragma("vm:external-name", "Filter_Processed")
   external List<int>? processed({bool flush = true, bool end = false});
+
+  /// Writes processed output directly into [buffer] between [start] and
+  /// [end], returning the number of bytes written.
+  ///
+  /// Returns 0 when there is no more output for the data passed to [process].
+  @pragma("vm:external-name", "Filter_ProcessedInto")
+  external int _processedInto(
+      Uint8List buffer, int start, int end, bool flush, bool finish);
+
+  /// Resets the filter so it can be reused for a new stream.
+  @pragma("vm:external-name", "Filter_Reset")
+  external void _reset();
 }
 
 base class _ZLibInflateFilter extends _FilterImpl {
@@ -590,9 +590,11 @@ Future<ProcessResult> _runNonInteractiveProcess(
     // Setup stdout and stderr handling.
     Future foldStream(Stream<List<int>> stream, Encoding? encoding) {
       if (encoding == null) {
+        // The chunks are freshly allocated by the pipe reads and not used
+        // elsewhere, so they can be collected without copying.
         return stream
-            .fold<BytesBuilder>(
-                new BytesBuilder(), (builder, data) => builder..add(data))
+            .fold<BytesBuilder>(new BytesBuilder(copy: false),
+                (builder, data) => builder..add(data))
             .then((builder) => builder.takeBytes());
       } else {
         return stream
@@ -63,12 +63,13 @@ class _SecureSocket extends _Socket implements SecureSocket {
 base class _SecureFilterImpl extends NativeFieldWrapperClass1
     implements _SecureFilter {
   // Performance is improved if a full buffer of plaintext fits
-  // in the encrypted buffer, when encrypted.
+  // in the encrypted buffer, when encrypted. A full buffer of plaintext is
+  // the maximum TLS record payload, so records are not split.
   // SIZE and ENCRYPTED_SIZE are referenced from C++.
   @pragma("vm:entry-point")
-  static final int SIZE = 8 * 1024;
+  static final int SIZE = 16 * 1024;
   @pragma("vm:entry-point")
-  static final int ENCRYPTED_SIZE = 10 * 1024;
+  static final int ENCRYPTED_SIZE = 20 * 1024;
 
   _SecureFilterImpl._() {
     buffers = <_ExternalBuffer>[
@@ -512,23 +512,37 @@ base class _NativeSocket extends _NativeSocketNativeWrapper
   // a HttpServer, a WebSocket connection, a process pipe, etc.
   Object? owner;
 
+  // Lookups that have been sent to the IO service but not answered yet,
+  // keyed by address type and host. Concurrent lookups of the same host share
+  // one request instead of each occupying an IO service thread with its own
+  // blocking getaddrinfo call.
+  static final Map<String, Future<List<InternetAddress>>> _pendingLookups =
+      <String, Future<List<InternetAddress>>>{};
+
   static Future<List<InternetAddress>> lookup(String host,
       {InternetAddressType type = InternetAddressType.any}) {
-    return _IOService._dispatch(_IOService.socketLookup, [host, type._value])
-        .then((response) {
-      if (isErrorResponse(response)) {
-        throw createError(response, "Failed host lookup: '$host'");
-      }
-      return [
-        for (List<Object?> result in (response as List).skip(1))
-          _InternetAddress(
-              InternetAddressType._from(result[0] as int),
-              result[1] as String,
-              host,
-              result[2] as Uint8List,
-              result[3] as int)
-      ];
-    });
+    final key = "${type._value}:$host";
+    var pending = _pendingLookups[key];
+    if (pending == null) {
+      pending = _pendingLookups[key] = _IOService._dispatch(
+              _IOService.socketLookup, [host, type._value])
+          .then((response) {
+        if (isErrorResponse(response)) {
+          throw createError(response, "Failed host lookup: '$host'");
+        }
+        return <InternetAddress>[
+          for (List<Object?> result in (response as List).skip(1))
+            _InternetAddress(
+                InternetAddressType._from(result[0] as int),
+                result[1] as String,
+                host,
+                result[2] as Uint8List,
+                result[3] as int)
+        ];
+      }).whenComplete(() => _pendingLookups.remove(key));
+    }
+    // Every caller gets its own list, as the result is growable.
+    return pending.then((addresses) => addresses.toList());
   }
 
   static Future<InternetAddress> reverseLookup(InternetAddress addr) {
@@ -1136,6 +1150,25 @@ base class _NativeSocket extends _NativeSocketNativeWrapper
     }
   }
 
+  // Reads up to [count] bytes into [buffer] starting at [offset], without
+  // allocating a new list for the data. Returns the number of bytes read.
+  int readInto(Uint8List buffer, int offset, int count) {
+    RangeError.checkValidRange(offset, offset + count, buffer.length);
+    if (isClosing || isClosed) return 0;
+    try {
+      final bytesRead = nativeReadInto(buffer, offset, count);
+      available = nativeAvailable();
+      if (!const bool.fromEnvironment("dart.vm.product")) {
+        _SocketProfile.collectStatistic(
+            nativeGetSocketId(), _SocketProfileType.readBytes, bytesRead);
+      }
+      return bytesRead;
+    } catch (e) {
+      reportError(e, StackTrace.current, "Read failed");
+      return 0;
+    }
+  }
+
   Datagram? receive() {
     if (isClosing || isClosed) return null;
     try {
@@ -1152,6 +1185,32 @@ base class _NativeSocket extends _NativeSocketNativeWrapper
     }
   }
 
+  // Receives up to [count] datagrams with a single batched system call where
+  // the platform supports it. Returns an empty list if none are available.
+  List<Datagram> receiveMultiple(int count) {
+    if (count <= 0) {
+      throw ArgumentError("Illegal count $count");
+    }
+    if (isClosing || isClosed) return const <Datagram>[];
+    try {
+      List<dynamic>? datagrams = nativeRecvFromMultiple(count);
+      List<Datagram> result = datagrams == null
+          ? const <Datagram>[]
+          : <Datagram>[for (final datagram in datagrams) datagram as Datagram];
+      if (!const bool.fromEnvironment("dart.vm.product")) {
+        for (final datagram in result) {
+          _SocketProfile.collectStatistic(nativeGetSocketId(),
+              _SocketProfileType.readBytes, datagram.data.length);
+        }
+      }
+      _availableDatagram = nativeAvailableDatagram();
+      return result;
+    } catch (e) {
+      reportError(e, StackTrace.current, "Receive failed");
+      return const <Datagram>[];
+    }
+  }
+
   SocketMessage? readMessage([int? count]) {
     if (count != null && count <= 0) {
       throw ArgumentError("Illegal length $count");
@@ -1255,6 +1314,61 @@ base class _NativeSocket extends _NativeSocketNativeWrapper
     }
   }
 
+  // Maximum number of buffers accepted by [writeBuffers], matching
+  // SocketBase::kMaxWriteBuffers.
+  static const int maxWriteBuffers = 16;
+
+  // Writes [buffers] in order with a single vectored write where the
+  // platform supports it. Returns the total number of bytes written, which
+  // may end in the middle of any of the buffers.
+  int writeBuffers(List<Uint8List> buffers) {
+    if (buffers.length > maxWriteBuffers) {
+      throw new RangeError.range(buffers.length, 0, maxWriteBuffers);
+    }
+    if (isClosing || isClosed) return 0;
+    int bytes = 0;
+    for (final buffer in buffers) {
+      bytes += buffer.length;
+    }
+    if (bytes == 0) return 0;
+    try {
+      int result = nativeWriteBuffers(buffers);
+      if (result >= 0) {
+        writeAvailable = (result == bytes) && !hasPendingWrite();
+      } else {
+        // Negative result indicates a forced short write, see [write].
+        result = -result;
+        writeAvailable = !hasPendingWrite();
+      }
+      if (!const bool.fromEnvironment("dart.vm.product")) {
+        _SocketProfile.collectStatistic(
+            nativeGetSocketId(), _SocketProfileType.writeBytes, result);
+      }
+      return result;
+    } catch (e) {
+      StackTrace st = StackTrace.current;
+      scheduleMicrotask(() => reportError(e, st, "Write failed"));
+      return 0;
+    }
+  }
+
+  // Sends up to [count] bytes of [file] starting at [position] with
+  // sendfile, without reading them into the Dart heap. Returns the number of
+  // bytes sent, 0 at the end of the file, or null if the socket cannot take
+  // more data until the next write event. Only supported on Linux and
+  // Android.
+  int? sendFile(RandomAccessFile file, int position, int count) {
+    if (isClosing || isClosed) return 0;
+    int? result = nativeSendFile(
+        (file as _RandomAccessFile)._ops.fd, position, count);
+    writeAvailable = result != null && result == count;
+    if (!const bool.fromEnvironment("dart.vm.product")) {
+      _SocketProfile.collectStatistic(
+          nativeGetSocketId(), _SocketProfileType.writeBytes, result ?? 0);
+    }
+    return result;
+  }
+
   int send(List<int> buffer, int offset, int bytes, InternetAddress address,
       int port) {
     _throwOnBadPort(port);
@@ -1739,14 +1853,22 @@ base class _NativeSocket extends _NativeSocketNativeWrapper
   external bool nativeAvailableDatagram();
   @pragma("vm:external-name", "Socket_Read")
   external Uint8List? nativeRead(int len);
+  @pragma("vm:external-name", "Socket_ReadInto")
+  external int nativeReadInto(Uint8List buffer, int offset, int len);
   @pragma("vm:external-name", "Socket_RecvFrom")
   external Datagram? nativeRecvFrom();
+  @pragma("vm:external-name", "Socket_RecvFromMultiple")
+  external List<dynamic>? nativeRecvFromMultiple(int count);
   @pragma("vm:external-name", "Socket_ReceiveMessage")
   external List<dynamic> nativeReceiveMessage(int len);
   @pragma("vm:external-name", "Socket_WriteList")
   external int nativeWrite(List<int> buffer, int offset, int bytes);
+  @pragma("vm:external-name", "Socket_WriteBuffers")
+  external int nativeWriteBuffers(List<Uint8List> buffers);
   @pragma("vm:external-name", "Socket_HasPendingWrite")
   external bool nativeHasPendingWrite();
+  @pragma("vm:external-name", "Socket_SendFile")
+  external int? nativeSendFile(int fileFd, int position, int count);
   @pragma("vm:external-name", "Socket_SendTo")
   external int nativeSendTo(
       List<int> buffer, int offset, int bytes, Uint8List address, int port);
@@ -2158,6 +2280,11 @@ class _SocketStreamConsumer implements StreamConsumer<List<int>> {
   List<int>? buffer;
   bool paused = false;
   Completer<Socket>? streamCompleter;
+  // The file being sent with sendfile when a stream from File.openRead is
+  // added, and the range of it which is still to be sent.
+  RandomAccessFile? file;
+  int filePosition = 0;
+  int fileEnd = 0;
 
   _SocketStreamConsumer(this.socket);
 
@@ -2165,6 +2292,10 @@ class _SocketStreamConsumer implements StreamConsumer<List<int>> {
     socket._ensureRawSocketSubscription();
     final completer = streamCompleter = new Completer<Socket>();
     if (socket._raw != null) {
+      if (_canSendFile(stream)) {
+        _startSendFile(stream as _FileStream);
+        return completer.future;
+      }
       subscription = stream.listen((data) {
         assert(!paused);
         assert(buffer == null);
@@ -2212,7 +2343,80 @@ class _SocketStreamConsumer implements StreamConsumer<List<int>> {
     return true;
   }
 
+  // Whether [stream] is an unlistened stream from File.openRead which can be
+  // sent with sendfile instead of being read into the Dart heap.
+  bool _canSendFile(Stream<List<int>> stream) {
+    return (Platform.isLinux || Platform.isAndroid) &&
+        stream is _FileStream &&
+        stream._path != null &&
+        stream._openedFile == null &&
+        stream._position >= 0 &&
+        socket._raw is _RawSocket;
+  }
+
+  void _startSendFile(_FileStream stream) {
+    new File(stream._path!).open().then((RandomAccessFile opened) {
+      return opened.length().then((int length) {
+        if (streamCompleter == null) {
+          // The socket was destroyed while the file was being opened.
+          return opened.close();
+        }
+        final end = stream._end;
+        if (end != null && end < stream._position) {
+          opened.close();
+          done(new RangeError("Bad end position: $end"));
+          return null;
+        }
+        file = opened;
+        filePosition = stream._position;
+        fileEnd = min(end ?? length, length);
+        write();
+        return null;
+      });
+    }).catchError((e, s) {
+      socket.destroy();
+      done(e, s);
+    });
+  }
+
+  void _writeFile() {
+    final rawSocket = socket._raw;
+    if (rawSocket is! _RawSocket) return;
+    try {
+      while (filePosition < fileEnd) {
+        final sent = rawSocket._socket
+            .sendFile(file!, filePosition, fileEnd - filePosition);
+        if (sent == null) {
+          // Wait for the socket to become writable again.
+          socket._enableWriteEvent();
+          return;
+        }
+        // The file got shorter since its length was read.
+        if (sent == 0) break;
+        filePosition += sent;
+      }
+    } catch (e, s) {
+      _closeFile();
+      socket.destroy();
+      done(e, s);
+      return;
+    }
+    _closeFile();
+    done();
+  }
+
+  void _closeFile() {
+    final f = file;
+    if (f == null) return;
+    file = null;
+    f.close();
+  }
+
   void write() {
+    if (file != null) {
+      _writeFile();
+      return;
+    }
     final sub = subscription;
     if (sub == null) return;
 
@@ -2256,6 +2460,10 @@ class _SocketStreamConsumer implements StreamConsumer<List<int>> {
   }
 
   void stop() {
+    if (file != null) {
+      _closeFile();
+      socket._disableWriteEvent();
+    }
     final sub = subscription;
     if (sub == null) return;
     sub.cancel();
@@ -32,7 +32,14 @@ class _StdIOUtils {
       throw FileSystemException(
           "Failed to get type of stdio handle (fd $fd)", "", type);
     }
-    return new Stdout._(new IOSink(new _StdConsumer(fd)), fd);
+    // Output to files and pipes is usually consumed by another program, such
+    // as a log collector, so writes are coalesced to save system calls. On
+    // terminals each write is made immediately, which keeps the interleaving
+    // of stdout and stderr exactly as written.
+    final coalesce =
+        type == _stdioHandleTypeFile || type == _stdioHandleTypePipe;
+    return new Stdout._(
+        new IOSink(new _StdConsumer(fd, coalesce: coalesce)), fd);
   }
 
   @patch
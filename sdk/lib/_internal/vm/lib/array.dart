@@ -196,10 +196,10 @@ class _List<E> extends _Array<E> {
     int length = end - start;
     if (length == 0) return;
     if (identical(this, iterable)) {
-      Lists.copy(this, skipCount, this, start, length);
+      _copyRange(start, this, skipCount, length);
     } else if (ClassID.getID(iterable) == ClassID.cidArray) {
       final _List<E> iterableAsList = unsafeCast<_List<E>>(iterable);
-      Lists.copy(iterableAsList, skipCount, this, start, length);
+      _copyRange(start, iterableAsList, skipCount, length);
     } else if (iterable is List<E>) {
       Lists.copy(iterable, skipCount, this, start, length);
     } else {
@@ -215,6 +215,21 @@ class _List<E> extends _Array<E> {
     }
   }
 
+  @pragma("vm:prefer-inline")
+  void _copyRange(int start, _List<E> src, int srcStart, int count) {
+    if (count <= 64) {
+      Lists.copy(src, srcStart, this, start, count);
+    } else {
+      _copyRangeInternal(start, src, srcStart, count);
+    }
+  }
+
+  // Copies elements with the write barrier applied in the VM rather than
+  // by a loop of indexed stores.
+  @pragma("vm:external-name", "List_copyRange")
+  external void _copyRangeInternal(
+      int start, _List<E> src, int srcStart, int count);
+
   void setAll(int index, Iterable<E> iterable) {
     if (index < 0 || index > this.length) {
       throw new RangeError.range(index, 0, this.length, "index");
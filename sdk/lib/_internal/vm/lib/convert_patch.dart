@@ -102,6 +102,16 @@ class _JsonListener {
   /** The most recently read property key. */
   String key = '';
 
+  /**
+   * Property names seen so far, so that objects with the same keys share the
+   * key strings instead of each retaining its own copies.
+   *
+   * Bounded by [maxCachedKeys] so that data used as keys (e.g. ids) does not
+   * grow the cache with the size of the input.
+   */
+  final Map<String, String> keyCache = <String, String>{};
+  static const int maxCachedKeys = 256;
+
   /** The most recently read value. */
   Object? value;
 
@@ -140,7 +150,14 @@ class _JsonListener {
   }
 
   void propertyName() {
-    key = unsafeCast<String>(value);
+    String name = unsafeCast<String>(value);
+    final String? cached = keyCache[name];
+    if (cached != null) {
+      name = cached;
+    } else if (keyCache.length < maxCachedKeys) {
+      keyCache[name] = name;
+    }
+    key = name;
     value = null;
   }
 
@@ -1652,6 +1669,10 @@ class _JsonUtf8Parser extends _JsonParserWithListener
   }
 }
 
+@pragma("vm:external-name", "Utf8Decoder_decodeWellFormed")
+external String? _decodeWellFormed(
+    Uint8List bytes, int start, int end, int size, bool oneByte);
+
 @pragma("vm:external-name", "Double_parse")
 external double _parseDouble(String source, int start, int end);
 
@@ -1729,6 +1750,10 @@ class _Utf8Decoder {
   static const int flagNonLatin1 = 1 << 4;
   static const int flagIllegal = 1 << 5;
 
+  /// Inputs decoding to at least this many code units are decoded natively
+  /// when they are well-formed.
+  static const int _nativeDecodeThreshold = 64;
+
   // ASCII     'A' = 64 + (1);
   // Extension 'D' = 64 + (0 | flagExtension);
   // Latin1    'I' = 64 + (1 | flagLatin1);
@@ -1830,6 +1855,17 @@ class _Utf8Decoder {
       return result;
     }
 
+    if (size >= _nativeDecodeThreshold && (flags & flagIllegal) == 0) {
+      // Decode well-formed input natively. Malformed input is left to the
+      // decoders below, which locate and report the error.
+      final String? decoded = _decodeWellFormed(
+          bytes, start, end, size, flags == (flagLatin1 | flagExtension));
+      if (decoded != null) {
+        _state = accept;
+        return decoded;
+      }
+    }
+
     String result;
     if (flags == (flagLatin1 | flagExtension)) {
       // Latin1.
@@ -53,7 +53,7 @@ import "dart:collection"
 
 import "dart:convert" show ascii, Encoding, json, latin1, utf8;
 
-import "dart:ffi" show Pointer, Struct, Union, NativePort;
+import "dart:ffi" show Int64, Native, NativePort, Pointer, Struct, Union;
 
 import "dart:isolate" show Isolate, RawReceivePort;
 
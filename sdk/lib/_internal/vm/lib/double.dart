@@ -256,6 +256,18 @@ final class _Double implements double {
   external String _toString();
 
   String toString() {
+    if (identical(0.0, this)) {
+      return "0.0";
+    }
+    // Integral values below 2**53 are their own shortest representation, so
+    // they can be printed by the integer printer. Excludes -0.0, NaN and
+    // infinities.
+    const double MAX_EXACT_DOUBLE = 9007199254740992.0;
+    if (this != 0.0 &&
+        this.abs() < MAX_EXACT_DOUBLE &&
+        this == this.truncateToDouble()) {
+      return this.toInt().toString() + ".0";
+    }
     // TODO(koda): Consider starting at most recently inserted.
     for (int i = 0; i < CACHE_LENGTH; i += 2) {
       // Need 'identical' to handle negative zero, etc.
@@ -263,10 +275,6 @@ final class _Double implements double {
         return _cache[i + 1];
       }
     }
-    // TODO(koda): Consider optimizing all small integral values.
-    if (identical(0.0, this)) {
-      return "0.0";
-    }
     String result = _toString();
     // Replace the least recently inserted entry.
     _cache[_cacheEvictIndex] = this;
@@ -16,3 +16,38 @@ extension AllocatorAlloc on Allocator {
     throw UnimplementedError("Pointer<$T>");
   }
 }
+
+@patch
+final class TypedDataArena {
+  // Address of the VM's BulkMemoryArena, or 0 once released.
+  int _arena;
+
+  TypedDataArena._(this._arena);
+
+  @patch
+  factory TypedDataArena() => TypedDataArena._(_new());
+
+  @patch
+  Uint8List allocateUint8List(int length) {
+    if (_arena == 0) {
+      throw StateError("TypedDataArena has been released.");
+    }
+    return _allocateUint8List(_arena, length);
+  }
+
+  @patch
+  void release() {
+    if (_arena == 0) return;
+    _delete(_arena);
+    _arena = 0;
+  }
+
+  @pragma("vm:external-name", "TypedDataArena_new")
+  external static int _new();
+
+  @pragma("vm:external-name", "TypedDataArena_allocateUint8List")
+  external static Uint8List _allocateUint8List(int arena, int length);
+
+  @pragma("vm:external-name", "TypedDataArena_delete")
+  external static void _delete(int arena);
+}
@@ -2,7 +2,7 @@
 // for details. All rights reserved. Use of this source code is governed by a
 // BSD-style license that can be found in the LICENSE file.
 
-import "dart:_internal" show patch, has63BitSmis;
+import "dart:_internal" show patch, has63BitSmis, unsafeCast;
 import 'dart:async';
 import 'dart:typed_data';
 import 'dart:isolate';
@@ -178,6 +178,9 @@ external dynamic _nativeAsyncCallbackFunction<NS extends Function>();
 external Pointer<NS> _createNativeCallableListener<NS extends NativeFunction>(
     dynamic function, RawReceivePort port);
 
+@pragma("vm:external-name", "Ffi_takeCoalescedNativeCallableListenerCalls")
+external List _takeCoalescedNativeCallableListenerCalls(RawReceivePort port);
+
 @pragma("vm:external-name", "Ffi_createNativeCallableIsolateLocal")
 external Pointer<NS>
     _createNativeCallableIsolateLocal<NS extends NativeFunction>(
@@ -295,9 +298,21 @@ final class _NativeCallableListener<T extends Function>
   final RawReceivePort _port;
 
   _NativeCallableListener(void Function(List) handler, String portDebugName)
-      : _port = RawReceivePort(
-            Zone.current.bindUnaryCallbackGuarded(handler), portDebugName),
-        super(nullptr);
+      : _port = RawReceivePort(null, portDebugName),
+        super(nullptr) {
+    final guardedHandler = Zone.current.bindUnaryCallbackGuarded(handler);
+    _port.handler = (List? args) {
+      if (args != null) {
+        guardedHandler(args);
+        return;
+      }
+      // The VM coalesced invocations (--coalesce-ffi-listener-callbacks).
+      final calls = _takeCoalescedNativeCallableListenerCalls(_port);
+      for (int i = 0; i < calls.length; i++) {
+        guardedHandler(unsafeCast<List>(calls[i]));
+      }
+    };
+  }
 
   @override
   void _close() {
@@ -373,7 +373,18 @@ class _GrowableList<T> extends ListBase<T> {
   // Grow from 0 to 3, and then double + 1.
   int _nextCapacity(int old_capacity) => (old_capacity * 2) | 3;
 
+  /// Lists at least this long are grown by the VM, which copies the elements
+  /// into the new backing store with a single pass of barriered stores.
+  static const int _minNativeGrowLength = 64;
+
+  @pragma("vm:external-name", "GrowableList_grow")
+  external void _growInternal(int new_capacity);
+
   void _grow(int new_capacity) {
+    if (length >= _minNativeGrowLength) {
+      _growInternal(_adjustedCapacity(new_capacity));
+      return;
+    }
     var newData = _allocateData(new_capacity);
     // This is a workaround for dartbug.com/30090: array-bound-check
     // generalization causes excessive deoptimizations because it
@@ -81,6 +81,13 @@ external String allocateTwoByteString(int length);
 @pragma("vm:external-name", "Internal_writeIntoTwoByteString")
 external void writeIntoTwoByteString(String string, int index, int codePoint);
 
+/// Returns the CRC-32C (Castagnoli) checksum [crc] updated with the bytes of
+/// [data] from [start] to [end]. Use 0 as the initial checksum.
+///
+/// Uses the CRC32 instruction when the CPU supports it.
+@pragma("vm:external-name", "Internal_crc32c")
+external int crc32c(int crc, Uint8List data, int start, int end);
+
 class VMLibraryHooks {
   // Example: "dart:isolate _Timer._factory"
   static Timer Function(int, void Function(Timer), bool)? timerFactory;
@@ -183,10 +183,18 @@ class _RegExp implements RegExp {
   bool hasMatch(String input) {
     // TODO: Remove these null checks once all code is opted into strong nonnullable mode.
     if (input == null) throw new ArgumentError.notNull('input');
+    if (_interpretsBytecode) return _ExecuteHasMatch(input, 0, false);
     List? match = _ExecuteMatch(input, 0);
     return (match == null) ? false : true;
   }
 
+  // Same as `matchAsPrefix(string, start) != null`, without allocating a
+  // match. [start] must be a valid index into [string].
+  bool _matchesAt(String string, int start) {
+    if (_interpretsBytecode) return _ExecuteHasMatch(string, start, true);
+    return _ExecuteMatchSticky(string, start) != null;
+  }
+
   String? stringMatch(String input) {
     // TODO: Remove these null checks once all code is opted into strong nonnullable mode.
     if (input == null) throw new ArgumentError.notNull('input');
@@ -297,6 +305,17 @@ class _RegExp implements RegExp {
   @pragma("vm:external-name", "RegExp_ExecuteMatchSticky")
   external List<int>? _ExecuteMatchSticky(String str, int start_index);
 
+  // Only used with the bytecode interpreter. Generated matchers are called
+  // directly by the intrinsics of _ExecuteMatch and _ExecuteMatchSticky,
+  // which is cheaper than calling this native.
+  @pragma("vm:external-name", "RegExp_ExecuteHasMatch")
+  external bool _ExecuteHasMatch(String str, int start_index, bool sticky);
+
+  @pragma("vm:external-name", "RegExp_interpretsBytecode")
+  external static bool _getInterpretsBytecode();
+
+  static final bool _interpretsBytecode = _getInterpretsBytecode();
+
   static Int32List _getRegisters(int registers_count) {
     var registers = _registers;
     if (registers == null || registers.length < registers_count) {
@@ -13,7 +13,7 @@ class Stopwatch {
 
   // Returns the current clock tick.
   @patch
-  @pragma("vm:external-name", "Stopwatch_now")
+  @Native<Int64 Function()>(symbol: "Stopwatch_now", isLeaf: true)
   external static int _now();
 
   // Returns the frequency of clock ticks in Hz.
@@ -363,6 +363,9 @@ abstract final class _StringBase implements String {
     if (pattern is String) {
       return _substringMatches(index, pattern);
     }
+    if (pattern is _RegExp) {
+      return pattern._matchesAt(this, index);
+    }
     return pattern.matchAsPrefix(this, index) != null;
   }
 
@@ -381,6 +384,12 @@ abstract final class _StringBase implements String {
       }
       return -1;
     }
+    if (pattern is _RegExp) {
+      for (int i = start; i <= this.length; i++) {
+        if (pattern._matchesAt(this, i)) return i;
+      }
+      return -1;
+    }
     for (int i = start; i <= this.length; i++) {
       // TODO(11276); This has quadratic behavior because matchAsPrefix tries
       // to find a later match too. Optimize matchAsPrefix to avoid this.
@@ -406,6 +415,12 @@ abstract final class _StringBase implements String {
       }
       return -1;
     }
+    if (pattern is _RegExp) {
+      for (int i = start; i >= 0; i--) {
+        if (pattern._matchesAt(this, i)) return i;
+      }
+      return -1;
+    }
     for (int i = start; i >= 0; i--) {
       // TODO(11276); This has quadratic behavior because matchAsPrefix tries
       // to find a later match too. Optimize matchAsPrefix to avoid this.
@@ -1090,12 +1105,7 @@ final class _OneByteString extends _StringBase {
         if (patternCu0 > 0xFF) {
           return -1;
         }
-        for (int i = start; i < len; i++) {
-          if (this.codeUnitAt(i) == patternCu0) {
-            return i;
-          }
-        }
-        return -1;
+        return _indexOfCodeUnit(patternCu0, start);
       }
     }
     return super.indexOf(pattern, start);
@@ -1112,17 +1122,32 @@ final class _OneByteString extends _StringBase {
         if (patternCu0 > 0xFF) {
           return false;
         }
-        for (int i = start; i < len; i++) {
-          if (this.codeUnitAt(i) == patternCu0) {
-            return true;
-          }
-        }
-        return false;
+        return _indexOfCodeUnit(patternCu0, start) >= 0;
       }
     }
     return super.contains(pattern, start);
   }
 
+  // Short searches are not worth the cost of a native call.
+  static const int _nativeIndexOfThreshold = 32;
+
+  int _indexOfCodeUnit(int codeUnit, int start) {
+    final len = this.length;
+    if (len - start >= _nativeIndexOfThreshold) {
+      return _indexOfCodeUnitNative(codeUnit, start);
+    }
+    for (int i = start; i < len; i++) {
+      if (this.codeUnitAt(i) == codeUnit) {
+        return i;
+      }
+    }
+    return -1;
+  }
+
+  // Assumes 0 <= codeUnit <= 0xFF and 0 <= start <= length.
+  @pragma("vm:external-name", "OneByteString_indexOfCodeUnit")
+  external int _indexOfCodeUnitNative(int codeUnit, int start);
+
   String operator *(int times) {
     if (times <= 0) return "";
     if (times == 1) return this;
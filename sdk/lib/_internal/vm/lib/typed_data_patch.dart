@@ -155,6 +155,22 @@ abstract final class _TypedListBase {
   external void _setClampedRange(
       int start, int count, _TypedListBase from, int skipOffset);
 
+  // Sets the [count] elements starting at [start] to the low eight bits of
+  // [value].
+  //
+  // The element size of [this] must be 1 and the range must be valid (tests
+  // at caller).
+  @pragma("vm:external-name", "TypedDataBase_fillBytes")
+  external void _fillBytes(int start, int count, int value);
+
+  // Returns the index of the first element in [start, end) whose low eight
+  // bits equal [value], or -1.
+  //
+  // The element size of [this] must be 1, [value] must be in 0..255 and the
+  // range must be valid (tests at caller).
+  @pragma("vm:external-name", "TypedDataBase_indexOfByte")
+  external int _indexOfByte(int value, int start, int end);
+
   // Performs a copy of the [count] elements starting at [skipCount] in [from]
   // to [this] starting at [start].
   //
@@ -414,6 +430,13 @@ base mixin _IntListMixin on _TypedListBase implements TypedDataList<int> {
     } else if (start < 0) {
       start = 0;
     }
+    if (elementSizeInBytes == 1 &&
+        this.length - start >= _minNativeByteLoopLength) {
+      final index = _indexOfByte(element & 0xFF, start, this.length);
+      // Elements are distinct iff their bytes are, so if the first match of
+      // the low byte is a different value, [element] is out of range.
+      return (index < 0 || this[index] != element) ? -1 : index;
+    }
     for (int i = start; i < this.length; i++) {
       if (this[i] == element) return i;
     }
@@ -472,6 +495,13 @@ base mixin _IntListMixin on _TypedListBase implements TypedDataList<int> {
     if (fillValue == null) {
       throw ArgumentError.notNull("fillValue");
     }
+    if (elementSizeInBytes == 1 && end - start >= _minNativeByteLoopLength) {
+      // Storing the first element truncates or clamps the value as the list
+      // requires (and throws for unmodifiable views), the rest is a memset.
+      this[start] = fillValue;
+      _fillBytes(start + 1, end - start - 1, this[start]);
+      return;
+    }
     for (var i = start; i < end; ++i) {
       this[i] = fillValue;
     }
@@ -482,6 +512,10 @@ base mixin _IntListMixin on _TypedListBase implements TypedDataList<int> {
       _setRange(start, end, from, skipCount);
 }
 
+// Below this many elements, loops over lists with one byte elements are
+// cheaper in Dart than a call to the corresponding native.
+const int _minNativeByteLoopLength = 64;
+
 base mixin _TypedIntListMixin<SpawnedType extends List<int>> on _IntListMixin
     implements List<int> {
   SpawnedType _createList(int length);
@@ -88,7 +88,7 @@ class _BigIntImpl implements BigInt {
   static final _BigIntImpl _minusOne = -one;
   static final _BigIntImpl _oneDigitMask = new _BigIntImpl._fromInt(_digitMask);
   static final _BigIntImpl _twoDigitMask = (one << (2 * _digitBits)) - one;
-  static final _BigIntImpl _oneBillion = new _BigIntImpl._fromInt(1000000000);
+  static const int _oneBillion = 1000000000;
   static const int _minInt = -0x8000000000000000;
   static const int _maxInt = 0x7fffffffffffffff;
 
@@ -177,23 +177,32 @@ class _BigIntImpl implements BigInt {
   static _BigIntImpl _parseDecimal(String source, bool isNegative) {
     const _0 = 48;
 
-    int part = 0;
-    _BigIntImpl result = zero;
-    // Read in the source 9 digits at a time.
-    // The first part may have a few leading virtual '0's to make the remaining
-    // parts all have exactly 9 digits.
-    int digitInPartCount = 9 - unsafeCast<int>(source.length.remainder(9));
-    if (digitInPartCount == 9) digitInPartCount = 0;
-    for (int i = 0; i < source.length; i++) {
-      part = part * 10 + source.codeUnitAt(i) - _0;
-      if (++digitInPartCount == 9) {
-        result = result * _oneBillion + new _BigIntImpl._fromInt(part);
-        part = 0;
-        digitInPartCount = 0;
+    // A digit holds more than 9 decimal digits.
+    final digits = _newDigits(source.length ~/ 9 + 1);
+    int used = 0;
+    // Read in the source 9 digits at a time and multiply-add them into
+    // [digits] in place.
+    // The first part may have fewer digits to make the remaining parts all
+    // have exactly 9 digits.
+    int partEnd = unsafeCast<int>(source.length.remainder(9));
+    if (partEnd == 0) partEnd = 9;
+    int i = 0;
+    while (i < source.length) {
+      int part = 0;
+      for (; i < partEnd; i++) {
+        part = part * 10 + source.codeUnitAt(i) - _0;
+      }
+      // digits = digits * 10^9 + part. Intermediate values fit in 62 bits.
+      int carry = part;
+      for (int j = 0; j < used; j++) {
+        carry += digits[j] * _oneBillion;
+        digits[j] = carry & _digitMask;
+        carry >>= _digitBits;
       }
+      if (carry != 0) digits[used++] = carry;
+      partEnd += 9;
     }
-    if (isNegative) return -result;
-    return result;
+    return new _BigIntImpl._(isNegative, used, digits);
   }
 
   /// Returns the value of a given source digit.
@@ -2462,12 +2471,23 @@ class _BigIntImpl implements BigInt {
       return _digits[0].toString();
     }
 
-    // Generate in chunks of 9 digits.
+    // Generate in chunks of 9 digits by dividing a copy of the digits by 10^9
+    // in place.
     // The chunks are in reversed order.
     var decimalDigitChunks = <String>[];
-    var rest = isNegative ? -this : this;
-    while (rest._used > 1) {
-      var digits9 = rest.remainder(_oneBillion).toString();
+    var digits = _cloneDigits(_digits, 0, _used, _used);
+    var used = _used;
+    while (used > 1) {
+      // The remainder is below 10^9, so intermediate values fit in 62 bits.
+      int remainder = 0;
+      for (int i = used - 1; i >= 0; i--) {
+        final value = (remainder << _digitBits) | digits[i];
+        final quotient = value ~/ _oneBillion;
+        digits[i] = quotient;
+        remainder = value - quotient * _oneBillion;
+      }
+      if (digits[used - 1] == 0) used--;
+      var digits9 = remainder.toString();
       decimalDigitChunks.add(digits9);
       var zeros = 9 - digits9.length;
       if (zeros == 8) {
@@ -2485,9 +2505,8 @@ class _BigIntImpl implements BigInt {
           decimalDigitChunks.add("0");
         }
       }
-      rest = rest ~/ _oneBillion;
     }
-    decimalDigitChunks.add(rest._digits[0].toString());
+    decimalDigitChunks.add(digits[0].toString());
     if (_isNegative) decimalDigitChunks.add("-");
     return decimalDigitChunks.reversed.join();
   }
@@ -171,6 +171,11 @@ mixin _HashBase on _HashAbstractBase {
   static const int _UNINITIALIZED_HASH_MASK = 0;
 
   // Unused and deleted entries are marked by 0 and 1, respectively.
+  //
+  // A hash pattern is a non-zero multiple of the maximum number of entries,
+  // so `hashPattern ^ _DELETED_PAIR` never decodes to a valid entry. Loops
+  // which only look for an existing key therefore skip deleted pairs without
+  // testing for them, saving a branch per probe.
   static const int _UNUSED_PAIR = 0;
   static const int _DELETED_PAIR = 1;
 
@@ -559,18 +564,16 @@ mixin _LinkedHashMapMixin<K, V> on _HashBase, _EqualsAndHashCode {
     int i = _HashBase._firstProbe(fullHash, sizeMask);
     int pair = _index[i];
     while (pair != _HashBase._UNUSED_PAIR) {
-      if (pair != _HashBase._DELETED_PAIR) {
-        final int entry = hashPattern ^ pair;
-        if (entry < maxEntries) {
-          final int d = entry << 1;
-          if (_equals(key, _data[d])) {
-            _index[i] = _HashBase._DELETED_PAIR;
-            _HashBase._setDeletedAt(_data, d);
-            V value = _data[d + 1] as V;
-            _HashBase._setDeletedAt(_data, d + 1);
-            ++_deletedKeys;
-            return value;
-          }
+      final int entry = hashPattern ^ pair;
+      if (entry < maxEntries) {
+        final int d = entry << 1;
+        if (_equals(key, _data[d])) {
+          _index[i] = _HashBase._DELETED_PAIR;
+          _HashBase._setDeletedAt(_data, d);
+          V value = _data[d + 1] as V;
+          _HashBase._setDeletedAt(_data, d + 1);
+          ++_deletedKeys;
+          return value;
         }
       }
       i = _HashBase._nextProbe(i, sizeMask);
@@ -589,13 +592,11 @@ mixin _LinkedHashMapMixin<K, V> on _HashBase, _EqualsAndHashCode {
     int i = _HashBase._firstProbe(fullHash, sizeMask);
     int pair = _index[i];
     while (pair != _HashBase._UNUSED_PAIR) {
-      if (pair != _HashBase._DELETED_PAIR) {
-        final int entry = hashPattern ^ pair;
-        if (entry < maxEntries) {
-          final int d = entry << 1;
-          if (_equals(key, _data[d])) {
-            return _data[d + 1];
-          }
+      final int entry = hashPattern ^ pair;
+      if (entry < maxEntries) {
+        final int d = entry << 1;
+        if (_equals(key, _data[d])) {
+          return _data[d + 1];
         }
       }
       i = _HashBase._nextProbe(i, sizeMask);
@@ -892,11 +893,9 @@ mixin _LinkedHashSetMixin<E> on _HashBase, _EqualsAndHashCode {
     int i = _HashBase._firstProbe(fullHash, sizeMask);
     int pair = _index[i];
     while (pair != _HashBase._UNUSED_PAIR) {
-      if (pair != _HashBase._DELETED_PAIR) {
-        final int d = hashPattern ^ pair;
-        if (d < maxEntries && _equals(key, _data[d])) {
-          return _data[d]; // Note: Must return the existing key.
-        }
+      final int d = hashPattern ^ pair;
+      if (d < maxEntries && _equals(key, _data[d])) {
+        return _data[d]; // Note: Must return the existing key.
       }
       i = _HashBase._nextProbe(i, sizeMask);
       pair = _index[i];
@@ -920,14 +919,12 @@ mixin _LinkedHashSetMixin<E> on _HashBase, _EqualsAndHashCode {
     int i = _HashBase._firstProbe(fullHash, sizeMask);
     int pair = _index[i];
     while (pair != _HashBase._UNUSED_PAIR) {
-      if (pair != _HashBase._DELETED_PAIR) {
-        final int d = hashPattern ^ pair;
-        if (d < maxEntries && _equals(key, _data[d])) {
-          _index[i] = _HashBase._DELETED_PAIR;
-          _HashBase._setDeletedAt(_data, d);
-          ++_deletedKeys;
-          return true;
-        }
+      final int d = hashPattern ^ pair;
+      if (d < maxEntries && _equals(key, _data[d])) {
+        _index[i] = _HashBase._DELETED_PAIR;
+        _HashBase._setDeletedAt(_data, d);
+        ++_deletedKeys;
+        return true;
       }
       i = _HashBase._nextProbe(i, sizeMask);
       pair = _index[i];
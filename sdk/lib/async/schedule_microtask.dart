@@ -12,11 +12,24 @@ class _AsyncCallbackEntry {
   _AsyncCallbackEntry(this.callback);
 }
 
-/// Head of single linked list of pending callbacks.
-_AsyncCallbackEntry? _nextCallback;
+/// Pending callbacks, stored as a circular buffer.
+///
+/// A buffer is used instead of a linked list of entries so that scheduling
+/// a microtask does not allocate, except when the buffer has to grow.
+/// The length of the buffer is always a power of two.
+List<_AsyncCallback?> _callbacks = List<_AsyncCallback?>.filled(16, null);
+
+/// Index of the next callback to run in [_callbacks].
+int _callbacksHead = 0;
 
-/// Tail of single linked list of pending callbacks.
-_AsyncCallbackEntry? _lastCallback;
+/// Index in [_callbacks] where the next scheduled callback is stored.
+int _callbacksTail = 0;
+
+/// Head of single linked list of pending priority callbacks.
+///
+/// Priority callbacks run before all callbacks in [_callbacks]. They are
+/// rare, so they are kept in a separate list.
+_AsyncCallbackEntry? _nextPriorityCallback;
 
 /// Tail of priority callbacks added by the currently executing callback.
 ///
@@ -31,13 +44,25 @@ _AsyncCallbackEntry? _lastPriorityCallback;
 /// even if adding a first element.
 bool _isInCallbackLoop = false;
 
+bool get _hasPendingCallbacks =>
+    _nextPriorityCallback != null || _callbacksHead != _callbacksTail;
+
 void _microtaskLoop() {
-  for (var entry = _nextCallback; entry != null; entry = _nextCallback) {
+  while (true) {
     _lastPriorityCallback = null;
-    var next = entry.next;
-    _nextCallback = next;
-    if (next == null) _lastCallback = null;
-    (entry.callback)();
+    var entry = _nextPriorityCallback;
+    if (entry != null) {
+      _nextPriorityCallback = entry.next;
+      (entry.callback)();
+      continue;
+    }
+    final head = _callbacksHead;
+    if (head == _callbacksTail) return;
+    final callbacks = _callbacks;
+    final callback = callbacks[head]!;
+    callbacks[head] = null;
+    _callbacksHead = (head + 1) & (callbacks.length - 1);
+    callback();
   }
 }
 
@@ -50,28 +75,38 @@ void _startMicrotaskLoop() {
   } finally {
     _lastPriorityCallback = null;
     _isInCallbackLoop = false;
-    if (_nextCallback != null) {
+    if (_hasPendingCallbacks) {
       _AsyncRun._scheduleImmediate(_startMicrotaskLoop);
     }
   }
 }
 
+/// Doubles the size of [_callbacks], which must be full.
+void _growCallbacks() {
+  final callbacks = _callbacks;
+  final length = callbacks.length;
+  final newCallbacks = List<_AsyncCallback?>.filled(length * 2, null);
+  final head = _callbacksHead;
+  newCallbacks.setRange(0, length - head, callbacks, head);
+  newCallbacks.setRange(length - head, length, callbacks, 0);
+  _callbacks = newCallbacks;
+  _callbacksHead = 0;
+  _callbacksTail = length;
+}
+
 /// Schedules a callback to be called as a microtask.
 ///
 /// The microtask is called after all other currently scheduled
 /// microtasks, but as part of the current system event.
 void _scheduleAsyncCallback(_AsyncCallback callback) {
-  _AsyncCallbackEntry newEntry = new _AsyncCallbackEntry(callback);
-  _AsyncCallbackEntry? lastCallback = _lastCallback;
-  if (lastCallback == null) {
-    _nextCallback = _lastCallback = newEntry;
-    if (!_isInCallbackLoop) {
-      _AsyncRun._scheduleImmediate(_startMicrotaskLoop);
-    }
-  } else {
-    lastCallback.next = newEntry;
-    _lastCallback = newEntry;
+  if (!_isInCallbackLoop && !_hasPendingCallbacks) {
+    _AsyncRun._scheduleImmediate(_startMicrotaskLoop);
   }
+  final callbacks = _callbacks;
+  final tail = _callbacksTail;
+  callbacks[tail] = callback;
+  _callbacksTail = (tail + 1) & (callbacks.length - 1);
+  if (_callbacksTail == _callbacksHead) _growCallbacks();
 }
 
 /// Schedules a callback to be called before all other currently scheduled ones.
@@ -81,25 +116,19 @@ void _scheduleAsyncCallback(_AsyncCallback callback) {
 ///
 /// Is always run in the root zone.
 void _schedulePriorityAsyncCallback(_AsyncCallback callback) {
-  if (_nextCallback == null) {
-    _scheduleAsyncCallback(callback);
-    _lastPriorityCallback = _lastCallback;
-    return;
+  if (!_isInCallbackLoop && !_hasPendingCallbacks) {
+    _AsyncRun._scheduleImmediate(_startMicrotaskLoop);
   }
   _AsyncCallbackEntry entry = new _AsyncCallbackEntry(callback);
   _AsyncCallbackEntry? lastPriorityCallback = _lastPriorityCallback;
   if (lastPriorityCallback == null) {
-    entry.next = _nextCallback;
-    _nextCallback = _lastPriorityCallback = entry;
+    entry.next = _nextPriorityCallback;
+    _nextPriorityCallback = entry;
   } else {
-    var next = lastPriorityCallback.next;
-    entry.next = next;
+    entry.next = lastPriorityCallback.next;
     lastPriorityCallback.next = entry;
-    _lastPriorityCallback = entry;
-    if (next == null) {
-      _lastCallback = entry;
-    }
   }
+  _lastPriorityCallback = entry;
 }
 
 /// Runs a function asynchronously.
@@ -1073,9 +1073,20 @@ class _JsonUtf8Stringifier extends _JsonStringifier {
 
   /// Write a string that is known to not have non-ASCII characters.
   void writeAsciiString(String string) {
-    // TODO(lrn): Optimize by copying directly into buffer instead of going
-    // through writeCharCode;
-    for (var i = 0; i < string.length; i++) {
+    var length = string.length;
+    var buffer = this.buffer;
+    var index = this.index;
+    if (length <= buffer.length - index) {
+      // Copy directly into the buffer when the string fits.
+      for (var i = 0; i < length; i++) {
+        var char = string.codeUnitAt(i);
+        assert(char <= 0x7f);
+        buffer[index + i] = char;
+      }
+      this.index = index + length;
+      return;
+    }
+    for (var i = 0; i < length; i++) {
       var char = string.codeUnitAt(i);
       assert(char <= 0x7f);
       writeByte(char);
@@ -1087,31 +1098,42 @@ class _JsonUtf8Stringifier extends _JsonStringifier {
   }
 
   void writeStringSlice(String string, int start, int end) {
-    // TODO(lrn): Optimize by copying directly into buffer instead of going
-    // through writeCharCode/writeByte. Assumption is the most characters
-    // in strings are plain ASCII.
-    for (var i = start; i < end; i++) {
-      var char = string.codeUnitAt(i);
+    var i = start;
+    while (i < end) {
+      // Most characters are expected to be plain ASCII, so copy runs of them
+      // directly into the current buffer, as far as it has room.
+      var buffer = this.buffer;
+      var index = this.index;
+      var limit = i + (buffer.length - index);
+      if (limit > end) limit = end;
+      while (i < limit) {
+        var char = string.codeUnitAt(i);
+        if (char > 0x7f) break;
+        buffer[index++] = char;
+        i++;
+      }
+      this.index = index;
+      if (i == end) return;
+      var char = string.codeUnitAt(i++);
       if (char <= 0x7f) {
+        // The buffer is full.
         writeByte(char);
-      } else {
-        if ((char & 0xF800) == 0xD800) {
-          // Surrogate.
-          if (char < 0xDC00 && i + 1 < end) {
-            // Lead surrogate.
-            var nextChar = string.codeUnitAt(i + 1);
-            if ((nextChar & 0xFC00) == 0xDC00) {
-              // Tail surrogate.
-              char = 0x10000 + ((char & 0x3ff) << 10) + (nextChar & 0x3ff);
-              writeFourByteCharCode(char);
-              i++;
-              continue;
-            }
+      } else if ((char & 0xF800) == 0xD800) {
+        // Surrogate.
+        if (char < 0xDC00 && i < end) {
+          // Lead surrogate.
+          var nextChar = string.codeUnitAt(i);
+          if ((nextChar & 0xFC00) == 0xDC00) {
+            // Tail surrogate.
+            char = 0x10000 + ((char & 0x3ff) << 10) + (nextChar & 0x3ff);
+            writeFourByteCharCode(char);
+            i++;
+            continue;
           }
-          // Unpaired surrogate.
-          writeMultiByteCharCode(unicodeReplacementCharacterRune);
-          continue;
         }
+        // Unpaired surrogate.
+        writeMultiByteCharCode(unicodeReplacementCharacterRune);
+      } else {
         writeMultiByteCharCode(char);
       }
     }
@@ -111,3 +111,40 @@ extension AllocatorAlloc on Allocator {
   /// [Allocator] in terms of other allocators.
   external Pointer<T> call<T extends SizedNativeType>([int count = 1]);
 }
+
+/// A region of native memory from which [Uint8List]s are allocated and which
+/// is freed all at once by [release].
+///
+/// The lists are backed by memory that the garbage collector neither scans
+/// nor accounts for, so many large, short-lived buffers can be allocated
+/// without triggering or lengthening collections. Their memory is only
+/// reclaimed by [release], which must be called explicitly: an arena that
+/// becomes unreachable without being released leaks its memory.
+///
+/// As with memory released by [Allocator.free], a list allocated from an
+/// arena must not be accessed after the arena has been released.
+///
+/// ```dart import:typed_data
+/// final arena = TypedDataArena();
+/// try {
+///   final buffer = arena.allocateUint8List(1 << 20);
+///   buffer[0] = 42;
+/// } finally {
+///   arena.release();
+/// }
+/// ```
+@Since('3.6')
+final class TypedDataArena {
+  /// Creates an empty arena.
+  external factory TypedDataArena();
+
+  /// Allocates a zero-filled [Uint8List] of [length] bytes in this arena.
+  ///
+  /// Throws a [StateError] if the arena has been released.
+  external Uint8List allocateUint8List(int length);
+
+  /// Frees the memory of all lists allocated from this arena.
+  ///
+  /// Releasing an arena more than once has no effect.
+  external void release();
+}
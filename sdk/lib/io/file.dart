@@ -785,6 +785,29 @@ abstract interface class RandomAccessFile {
   /// Throws a [FileSystemException] if the operation fails.
   int readIntoSync(List<int> buffer, [int start = 0, int? end]);
 
+  /// Synchronously maps the bytes of the file from [start] to [end] into
+  /// memory.
+  ///
+  /// The [start] must be non-negative and no greater than the length of the
+  /// file. If [end] is omitted, it defaults to the length of the file.
+  /// Otherwise [end] must be no less than [start] and no greater than the
+  /// length of the file.
+  ///
+  /// The returned list is backed directly by the mapping, so its bytes are
+  /// not copied into the Dart heap. They are loaded from the file lazily as
+  /// they are accessed, and the mapping is removed once the list is garbage
+  /// collected. The file may be closed while the list is still in use.
+  ///
+  /// If [copyOnWrite] is `false`, the returned list is unmodifiable. If it is
+  /// `true`, the list can be modified, but the changes are private to the
+  /// list and are never written back to the file.
+  ///
+  /// The contents of the list are unspecified if the file is truncated while
+  /// the list is in use.
+  ///
+  /// Throws a [FileSystemException] if the operation fails.
+  Uint8List mapSync({int start = 0, int? end, bool copyOnWrite = false});
+
   /// Writes a single byte to the file.
   ///
   /// Returns a `Future<RandomAccessFile>` that completes with this
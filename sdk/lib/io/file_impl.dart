@@ -692,6 +692,7 @@ abstract class _RandomAccessFileOps {
   readByte();
   read(int bytes);
   readInto(List<int> buffer, int start, int? end);
+  map(int start, int end, bool copyOnWrite);
   writeByte(int value);
   writeFrom(List<int> buffer, int start, int? end);
   position();
@@ -838,6 +839,20 @@ class _RandomAccessFile implements RandomAccessFile {
     return result;
   }
 
+  Uint8List mapSync({int start = 0, int? end, bool copyOnWrite = false}) {
+    _checkAvailable();
+    end = RangeError.checkValidRange(start, end, lengthSync());
+    if (end == start) {
+      var empty = new Uint8List(0);
+      return copyOnWrite ? empty : empty.asUnmodifiableView();
+    }
+    var result = _ops.map(start, end, copyOnWrite);
+    if (result is OSError) {
+      throw new FileSystemException("map failed", path, result);
+    }
+    return result;
+  }
+
   Future<RandomAccessFile> writeByte(int value) {
     // TODO(40614): Remove once non-nullability is sound.
     ArgumentError.checkNotNull(value, "value");
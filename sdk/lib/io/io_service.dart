@@ -50,6 +50,10 @@ class _IOService {
   static const int directoryListStop = 41;
   static const int directoryRename = 42;
   static const int sslProcessFilter = 43;
+  // Runs several requests in one round trip. The data is a flat list of
+  // request id and request data pairs, and the result is the list of the
+  // individual results in the same order.
+  static const int ioServiceBatch = 44;
 
   external static Future<Object?> _dispatch(int request, List data);
 }
@@ -304,27 +304,68 @@ class StdinException implements IOException {
 }
 
 class _StdConsumer implements StreamConsumer<List<int>> {
+  /// Pending output is written early once it reaches this many bytes.
+  static const int _maxPendingBytes = 64 * 1024;
+
   final RandomAccessFile _file;
 
-  _StdConsumer(int fd) : _file = _File._openStdioSync(fd);
+  /// Whether writes made in the same event loop turn are gathered and written
+  /// with one system call at the end of the turn, rather than one per write.
+  final bool _coalesce;
+  final BytesBuilder _pending = new BytesBuilder();
+  bool _flushScheduled = false;
+
+  _StdConsumer(int fd, {bool coalesce = false})
+      : _file = _File._openStdioSync(fd),
+        _coalesce = coalesce;
 
   Future addStream(Stream<List<int>> stream) {
     var completer = new Completer();
     late StreamSubscription<List<int>> sub;
+    void fail(Object e, StackTrace s) {
+      sub.cancel();
+      if (!completer.isCompleted) completer.completeError(e, s);
+    }
+
     sub = stream.listen((data) {
       try {
-        _file.writeFromSync(data);
+        if (!_coalesce) {
+          _file.writeFromSync(data);
+          return;
+        }
+        _pending.add(data);
+        if (_pending.length >= _maxPendingBytes) {
+          _flushPending();
+        } else if (!_flushScheduled) {
+          _flushScheduled = true;
+          Timer.run(() {
+            _flushScheduled = false;
+            try {
+              _flushPending();
+            } catch (e, s) {
+              fail(e, s);
+            }
+          });
+        }
+      } catch (e, s) {
+        fail(e, s);
+      }
+    }, onError: completer.completeError, onDone: () {
+      try {
+        _flushPending();
+        completer.complete();
       } catch (e, s) {
-        sub.cancel();
         completer.completeError(e, s);
       }
-    },
-        onError: completer.completeError,
-        onDone: completer.complete,
-        cancelOnError: true);
+    }, cancelOnError: true);
     return completer.future;
   }
 
+  void _flushPending() {
+    if (_pending.isEmpty) return;
+    _file.writeFromSync(_pending.takeBytes());
+  }
+
   Future close() {
     _file.closeSync();
     return new Future.value();
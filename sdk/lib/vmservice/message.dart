@@ -162,6 +162,7 @@ class Message {
     // it if isolate exits before sending a response.
     ports.add(receivePort);
     receivePort.handler = (value) {
+      if (_addPartialResponse(value)) return;
       receivePort.close();
       ports.remove(receivePort);
       _setResponseFromPort(value);
@@ -209,6 +210,7 @@ class Message {
   Future<Response> sendToVM() {
     final receivePort = RawReceivePort(null, 'VM Message');
     receivePort.handler = (value) {
+      if (_addPartialResponse(value)) return;
       receivePort.close();
       _setResponseFromPort(value);
     };
@@ -236,12 +238,31 @@ class Message {
     return _completer.future;
   }
 
+  // Large replies are sent in parts as they are produced. All parts but the
+  // last one arrive as `[bytes, true]`.
+  BytesBuilder? _partialResponse;
+
+  bool _addPartialResponse(Object? value) {
+    if (value is List && value.length == 2 && value[1] == true) {
+      (_partialResponse ??= BytesBuilder(copy: false))
+          .add(value[0] as Uint8List);
+      return true;
+    }
+    return false;
+  }
+
   void _setResponseFromPort(Object? response) {
     if (response == null) {
       // We should only have a null response for Notifications.
       assert(type == MessageType.Notification);
       return null;
     }
+    final partialResponse = _partialResponse;
+    if (partialResponse != null && response is List) {
+      _partialResponse = null;
+      partialResponse.add(response[0] as Uint8List);
+      response = <Object?>[partialResponse.takeBytes()];
+    }
     _completer.complete(Response.from(response));
   }
 
@@ -0,0 +1,36 @@
+// Copyright (c) 2024, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+//
+// Verifies that growing large growable lists keeps their elements, whichever
+// way the capacity is increased.
+
+import "package:expect/expect.dart";
+
+void checkElements(List<int?> list, int length) {
+  Expect.equals(length, list.length);
+  for (int i = 0; i < length; i++) {
+    Expect.equals(i, list[i]);
+  }
+}
+
+void main() {
+  final added = <int>[];
+  for (int i = 0; i < 10000; i++) {
+    added.add(i);
+  }
+  checkElements(added, 10000);
+
+  final addedAll = <int>[for (int i = 0; i < 100; i++) i];
+  addedAll.addAll([for (int i = 100; i < 5000; i++) i]);
+  checkElements(addedAll, 5000);
+
+  final lengthened = <int?>[for (int i = 0; i < 200; i++) i];
+  lengthened.length = 3000;
+  Expect.equals(3000, lengthened.length);
+  checkElements(lengthened.sublist(0, 200), 200);
+  Expect.isNull(lengthened[200]);
+  Expect.isNull(lengthened[2999]);
+  lengthened.add(null);
+  Expect.equals(3001, lengthened.length);
+}
@@ -0,0 +1,68 @@
+// Copyright (c) 2024, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+//
+// Verifies that lookups and removals probe past deleted index entries, also
+// when all keys collide.
+
+import "package:expect/expect.dart";
+
+class Collider {
+  final int id;
+  const Collider(this.id);
+
+  int get hashCode => 42;
+  bool operator ==(Object other) => other is Collider && other.id == id;
+}
+
+void testMap<K>(Map<K, int> map, K Function(int) key) {
+  const n = 50;
+  for (int i = 0; i < n; i++) {
+    map[key(i)] = i;
+  }
+  // Delete every other key, leaving deleted entries in the probe sequences.
+  for (int i = 0; i < n; i += 2) {
+    Expect.equals(i, map.remove(key(i)));
+    Expect.isNull(map.remove(key(i)));
+  }
+  Expect.equals(n ~/ 2, map.length);
+  for (int i = 0; i < n; i++) {
+    Expect.equals(i.isOdd, map.containsKey(key(i)));
+    Expect.equals(i.isOdd ? i : null, map[key(i)]);
+  }
+  Expect.isNull(map[key(n)]);
+  // Re-inserted keys go after the surviving ones.
+  for (int i = 0; i < n; i += 2) {
+    map[key(i)] = -i;
+  }
+  Expect.equals(n, map.length);
+  Expect.listEquals([
+    for (int i = 1; i < n; i += 2) i,
+    for (int i = 0; i < n; i += 2) -i,
+  ], map.values.toList());
+}
+
+void testSet<E>(Set<E> set, E Function(int) key) {
+  const n = 50;
+  for (int i = 0; i < n; i++) {
+    Expect.isTrue(set.add(key(i)));
+  }
+  for (int i = 0; i < n; i += 2) {
+    Expect.isTrue(set.remove(key(i)));
+    Expect.isFalse(set.remove(key(i)));
+  }
+  Expect.equals(n ~/ 2, set.length);
+  for (int i = 0; i < n; i++) {
+    Expect.equals(i.isOdd, set.contains(key(i)));
+    Expect.equals(i.isOdd ? key(i) : null, set.lookup(key(i)));
+  }
+  Expect.isFalse(set.contains(key(n)));
+}
+
+void main() {
+  testMap<int>(<int, int>{}, (i) => i);
+  testMap<String>(<String, int>{}, (i) => "key$i");
+  testMap<Collider>(<Collider, int>{}, (i) => Collider(i));
+  testSet<int>(<int>{}, (i) => i);
+  testSet<Collider>(<Collider>{}, (i) => Collider(i));
+}
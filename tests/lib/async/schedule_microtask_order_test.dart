@@ -0,0 +1,40 @@
+// Copyright (c) 2024, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+//
+// Verifies that microtasks run in scheduling order while the pending queue
+// wraps around and grows.
+
+import 'dart:async';
+import 'package:async_helper/async_helper.dart';
+import "package:expect/expect.dart";
+
+main() {
+  asyncStart();
+  final log = <int>[];
+  int next = 0;
+
+  void schedule(int count) {
+    for (int i = 0; i < count; i++) {
+      final id = next++;
+      scheduleMicrotask(() {
+        log.add(id);
+        // Keep scheduling while earlier callbacks are being consumed, so the
+        // queue wraps around before it has to grow.
+        if (id % 7 == 0 && next < 2000) schedule(3);
+      });
+    }
+  }
+
+  schedule(5);
+  // Schedule enough at once to force the queue to grow several times.
+  schedule(500);
+
+  Timer.run(() {
+    Expect.equals(next, log.length);
+    for (int i = 0; i < log.length; i++) {
+      Expect.equals(i, log[i]);
+    }
+    asyncEnd();
+  });
+}
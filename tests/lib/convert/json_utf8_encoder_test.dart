@@ -0,0 +1,39 @@
+// Copyright (c) 2024, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+//
+// Verifies that JsonUtf8Encoder produces the same bytes as encoding the
+// result of JsonEncoder, for strings that cross buffer boundaries.
+
+import "dart:convert";
+
+import "package:expect/expect.dart";
+
+const values = <Object?>[
+  "",
+  "plain ascii text that is longer than the smallest buffers",
+  "latin1 æøå and bmp €☃ mixed in",
+  "surrogate pair \u{1F600} and unpaired \uD800 and \uDC00 surrogates",
+  "escapes \" \\ \n \t \u0001 between ascii runs",
+  {"key": 12345678901234, "kéy": -1.5, "list": [true, false, null]},
+];
+
+void main() {
+  for (final bufferSize in [1, 2, 3, 7, 16, 1024]) {
+    for (final indent in [null, "  "]) {
+      final encoded = indent == null
+          ? jsonEncode(values)
+          : JsonEncoder.withIndent(indent).convert(values);
+      final expected = utf8.encode(encoded);
+      final encoder = JsonUtf8Encoder(indent, null, bufferSize);
+      Expect.listEquals(expected, encoder.convert(values));
+
+      final chunks = <List<int>>[];
+      final sink = encoder.startChunkedConversion(
+          ChunkedConversionSink<List<int>>.withCallback(chunks.addAll));
+      sink.add(values);
+      sink.close();
+      Expect.listEquals(expected, [for (final chunk in chunks) ...chunk]);
+    }
+  }
+}
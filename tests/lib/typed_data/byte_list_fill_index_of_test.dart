@@ -0,0 +1,59 @@
+// Copyright (c) 2024, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+//
+// Verifies fillRange and indexOf on lists with one byte elements, which are
+// handled natively for long ranges.
+
+import 'dart:typed_data';
+
+import "package:expect/expect.dart";
+
+const int length = 300;
+
+void testFill(List<int> list, int value, int expected) {
+  list.fillRange(10, 10);
+  Expect.equals(0, list[10]);
+  list.fillRange(3, 5, value);
+  Expect.listEquals([0, 0, 0, expected, expected, 0], list.sublist(0, 6));
+  list.fillRange(20, length - 1, value);
+  Expect.equals(0, list[19]);
+  for (int i = 20; i < length - 1; i++) {
+    Expect.equals(expected, list[i]);
+  }
+  Expect.equals(0, list[length - 1]);
+  Expect.throwsRangeError(() => list.fillRange(0, length + 1, value));
+}
+
+void testIndexOf(List<int> list, int inRange, int outOfRange) {
+  list.fillRange(0, length, 0);
+  list[200] = inRange;
+  list[250] = inRange;
+  Expect.equals(200, list.indexOf(inRange));
+  Expect.equals(250, list.indexOf(inRange, 201));
+  Expect.equals(-1, list.indexOf(inRange, 251));
+  Expect.equals(200, list.indexOf(inRange, -5));
+  Expect.equals(-1, list.indexOf(inRange, length));
+  // Values with the same low byte as a stored element are not found.
+  list[100] = outOfRange & 0xFF;
+  Expect.equals(-1, list.indexOf(outOfRange));
+  Expect.equals(-1, list.indexOf(outOfRange + (1 << 40)));
+}
+
+void main() {
+  testFill(new Uint8List(length), 0x1FF, 0xFF);
+  testFill(new Int8List(length), 0x180, -128);
+  testFill(new Uint8ClampedList(length), 300, 255);
+  testFill(new Uint8ClampedList(length), -7, 0);
+  final buffer = new Uint8List(length + 8).buffer;
+  testFill(new Uint8List.view(buffer, 8), 42, 42);
+
+  testIndexOf(new Uint8List(length), 0xAB, 0x1AB);
+  testIndexOf(new Int8List(length), -3, 0xFD);
+  testIndexOf(new Uint8ClampedList(length), 7, -249);
+  testIndexOf(new Uint8List.view(buffer, 8), 1, 257);
+
+  final unmodifiable = new Uint8List(length).asUnmodifiableView();
+  Expect.throwsUnsupportedError(() => unmodifiable.fillRange(0, length, 1));
+  Expect.equals(0, unmodifiable[length - 1]);
+}
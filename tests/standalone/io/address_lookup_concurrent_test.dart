@@ -0,0 +1,51 @@
+// Copyright (c) 2024, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+//
+// Verifies that concurrent lookups of the same host, which share a single
+// request to the IO service, each complete with their own result.
+
+import "dart:io";
+
+import "package:async_helper/async_helper.dart";
+import "package:expect/expect.dart";
+
+Future<void> testConcurrentLookups() async {
+  final results = await Future.wait([
+    for (int i = 0; i < 10; i++) InternetAddress.lookup("localhost"),
+  ]);
+  for (final result in results) {
+    Expect.isTrue(result.isNotEmpty);
+    Expect.listEquals(results.first, result);
+  }
+  // Each caller can modify its list without affecting the others.
+  results[0].clear();
+  Expect.isTrue(results[1].isNotEmpty);
+}
+
+Future<void> testConcurrentFailures() async {
+  const host = "some.bad.host.name.7654321";
+  var failures = 0;
+  await Future.wait([
+    for (int i = 0; i < 3; i++)
+      InternetAddress.lookup(host).then<void>((_) {}, onError: (e) {
+        Expect.isTrue(e is SocketException);
+        failures++;
+      }),
+  ]);
+  Expect.equals(3, failures);
+}
+
+Future<void> testLookupAfterCompletion() async {
+  final first = await InternetAddress.lookup("localhost");
+  final second = await InternetAddress.lookup("localhost");
+  Expect.listEquals(first, second);
+}
+
+void main() async {
+  asyncStart();
+  await testConcurrentLookups();
+  await testConcurrentFailures();
+  await testLookupAfterCompletion();
+  asyncEnd();
+}
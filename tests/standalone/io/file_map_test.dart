@@ -0,0 +1,73 @@
+// Copyright (c) 2024, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+import "package:expect/expect.dart";
+import 'dart:io';
+import 'dart:typed_data';
+
+// Larger than the 64KB mapping alignment, so offsets inside the second
+// aligned block are exercised.
+const int fileLength = 200 * 1024 + 17;
+
+int byteAt(int i) => (i * 31 + 7) & 0xFF;
+
+void testMapWholeFile(File file) {
+  final raf = file.openSync();
+  final bytes = raf.mapSync();
+  Expect.equals(fileLength, bytes.length);
+  for (int i = 0; i < fileLength; i += 997) {
+    Expect.equals(byteAt(i), bytes[i]);
+  }
+  Expect.equals(byteAt(fileLength - 1), bytes[fileLength - 1]);
+  // The mapping is read-only unless copyOnWrite is requested.
+  Expect.throwsUnsupportedError(() => bytes[0] = 1);
+  raf.closeSync();
+  // The list stays valid after the file is closed.
+  Expect.equals(byteAt(1), bytes[1]);
+}
+
+void testMapRange(File file) {
+  final raf = file.openSync();
+  raf.setPositionSync(123);
+  const start = 70 * 1024 + 5;
+  const end = 150 * 1024 + 3;
+  final bytes = raf.mapSync(start: start, end: end);
+  Expect.equals(end - start, bytes.length);
+  for (int i = 0; i < bytes.length; i++) {
+    Expect.equals(byteAt(start + i), bytes[i]);
+  }
+  // Mapping does not move the file position.
+  Expect.equals(123, raf.positionSync());
+  Expect.equals(0, raf.mapSync(start: 10, end: 10).length);
+  Expect.throwsRangeError(() => raf.mapSync(end: fileLength + 1));
+  Expect.throwsRangeError(() => raf.mapSync(start: 5, end: 4));
+  raf.closeSync();
+}
+
+void testMapCopyOnWrite(File file) {
+  final raf = file.openSync();
+  final bytes = raf.mapSync(start: 10, end: 20, copyOnWrite: true);
+  bytes[0] = byteAt(10) ^ 0xFF;
+  Expect.equals(byteAt(10) ^ 0xFF, bytes[0]);
+  raf.closeSync();
+  // Writes are never carried through to the file.
+  Expect.equals(byteAt(10), file.readAsBytesSync()[10]);
+}
+
+void main() {
+  final tmp = Directory.systemTemp.createTempSync('dart_file_map');
+  try {
+    final file = new File('${tmp.path}/file');
+    final data = new Uint8List(fileLength);
+    for (int i = 0; i < fileLength; i++) {
+      data[i] = byteAt(i);
+    }
+    file.writeAsBytesSync(data);
+    testMapWholeFile(file);
+    testMapRange(file);
+    testMapCopyOnWrite(file);
+  } finally {
+    tmp.deleteSync(recursive: true);
+  }
+}
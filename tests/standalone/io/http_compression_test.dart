@@ -76,6 +76,11 @@ Future<void> testAcceptEncodingHeader() async {
   await test('abc,deflate  ,  gzip,def,,,ghi  ,jkl', true);
   await test('xgzip', false);
   await test('gzipx;', false);
+  await test('gzip;q=1.0', true);
+  await test('gzip; q=0.5, deflate', true);
+  await test('deflate, gzip;Q=0.001', true);
+  await test('gzip;q=0', false);
+  await test('gzip; q=0.0, deflate', false);
 }
 
 Future<void> testDisableCompressTest() async {
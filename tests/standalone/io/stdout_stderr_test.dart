@@ -187,6 +187,15 @@ void testWriteCharCodeLineFeedFollowingCarriageReturn() {
           "default", "ascii", "write-char-code-linefeed-after-carriagereturn"));
 }
 
+void testManyWrites() {
+  final expected = <int>[];
+  for (var i = 0; i < 20000; i++) {
+    expected.add(48 + i % 10);
+    if (i % 100 == 99) expected.addAll(posixEol);
+  }
+  Expect.listEquals(expected, runTest("unix", "ascii", "many-writes"));
+}
+
 void testInvalidLineTerminator() {
   Expect.throwsArgumentError(() => stdout.lineTerminator = "\r");
 }
@@ -204,5 +213,6 @@ void main() {
   testStringCarriageReturnFollowedByWriteln();
   testWriteCharCodeLineFeed();
   testWriteCharCodeLineFeedFollowingCarriageReturn();
+  testManyWrites();
   testInvalidLineTerminator();
 }
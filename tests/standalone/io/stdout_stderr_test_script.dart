@@ -93,6 +93,14 @@ main(List<String> arguments) {
     case "object-internal-linefeeds":
       print(ToString("l1\nl2\nl3"));
       break;
+    case "many-writes":
+      // Enough small writes to exceed the size at which coalesced output is
+      // written early.
+      for (var i = 0; i < 20000; i++) {
+        stdout.write("${i % 10}");
+        if (i % 100 == 99) stdout.writeln();
+      }
+      break;
     default:
       stderr.writeln("Command was not recognized");
       exit(1);